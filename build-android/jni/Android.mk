@@ -22,6 +22,7 @@ VULKAN_INCLUDE := $(LOCAL_PATH)/$(THIRD_PARTY)/Vulkan-Headers/include
 
 include $(CLEAR_VARS)
 LOCAL_MODULE := layer_utils
+LOCAL_SRC_FILES += $(SRC_DIR)/layers/vk_layer_async_log.cpp
 LOCAL_SRC_FILES += $(SRC_DIR)/layers/vk_layer_config.cpp
 LOCAL_SRC_FILES += $(SRC_DIR)/layers/vk_layer_extension_utils.cpp
 LOCAL_SRC_FILES += $(SRC_DIR)/layers/vk_layer_utils.cpp
@@ -74,6 +75,7 @@ LOCAL_SRC_FILES += $(SRC_DIR)/tests/layer_validation_tests.cpp \
 				   $(SRC_DIR)/tests/vklayertests_others.cpp \
 				   $(SRC_DIR)/tests/vklayertests_descriptor_renderpass_framebuffer.cpp \
 				   $(SRC_DIR)/tests/vklayertests_command.cpp \
+				   $(SRC_DIR)/tests/vklayertests_range_map.cpp \
 				   $(SRC_DIR)/tests/vkpositivelayertests.cpp \
                    $(SRC_DIR)/tests/vktestbinding.cpp \
                    $(SRC_DIR)/tests/vktestframeworkandroid.cpp \
@@ -105,6 +107,7 @@ LOCAL_SRC_FILES += $(SRC_DIR)/tests/layer_validation_tests.cpp \
 				   $(SRC_DIR)/tests/vklayertests_others.cpp \
 				   $(SRC_DIR)/tests/vklayertests_descriptor_renderpass_framebuffer.cpp \
 				   $(SRC_DIR)/tests/vklayertests_command.cpp \
+				   $(SRC_DIR)/tests/vklayertests_range_map.cpp \
 				   $(SRC_DIR)/tests/vkpositivelayertests.cpp \
                    $(SRC_DIR)/tests/vktestbinding.cpp \
                    $(SRC_DIR)/tests/vktestframeworkandroid.cpp \
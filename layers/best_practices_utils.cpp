@@ -443,26 +443,24 @@ void BestPractices::PostCallRecordAllocateMemory(VkDevice device, const VkMemory
                                                  VkResult result) {
     ValidationStateTracker::PostCallRecordAllocateMemory(device, pAllocateInfo, pAllocator, pMemory, result);
     if (result != VK_SUCCESS) {
-        static std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY, VK_ERROR_OUT_OF_DEVICE_MEMORY,
-                                                    VK_ERROR_TOO_MANY_OBJECTS, VK_ERROR_INVALID_EXTERNAL_HANDLE,
-                                                    VK_ERROR_INVALID_OPAQUE_CAPTURE_ADDRESS_KHR};
-        static std::vector<VkResult> success_codes = {};
-        ValidateReturnCodes("vkReleaseFullScreenExclusiveModeEXT", result, error_codes, success_codes);
+        static constexpr uint64_t error_codes =
+            VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY) |
+            VkResultBit(VK_ERROR_TOO_MANY_OBJECTS) | VkResultBit(VK_ERROR_INVALID_EXTERNAL_HANDLE) |
+            VkResultBit(VK_ERROR_INVALID_OPAQUE_CAPTURE_ADDRESS_KHR);
+        static constexpr uint64_t success_codes = 0;
+        ValidateReturnCodes("vkAllocateMemory", result, error_codes, success_codes);
         return;
     }
     num_mem_objects++;
 }
 
-void BestPractices::ValidateReturnCodes(const char* api_name, VkResult result, const std::vector<VkResult>& success_codes,
-                                        const std::vector<VkResult>& error_codes) const {
-    auto error = std::find(error_codes.begin(), error_codes.end(), result);
-    if (error != error_codes.end()) {
-        LogWarning(instance, kVUID_BestPractices_NonSuccess_Result, "%s(): Returned error %s.", api_name, string_VkResult(result));
-        return;
-    }
-    auto success = std::find(success_codes.begin(), success_codes.end(), result);
-    if (success != success_codes.end()) {
-        LogWarning(instance, kVUID_BestPractices_Error_Result, "%s(): Returned non-success return code %s.", api_name,
+void BestPractices::ValidateReturnCodes(const char* api_name, VkResult result, uint64_t error_codes,
+                                        uint64_t success_codes) const {
+    const uint64_t result_bit = VkResultBit(result);
+    if (error_codes & result_bit) {
+        LogWarning(instance, kVUID_BestPractices_Error_Result, "%s(): Returned error %s.", api_name, string_VkResult(result));
+    } else if (success_codes & result_bit) {
+        LogWarning(instance, kVUID_BestPractices_NonSuccess_Result, "%s(): Returned non-success return code %s.", api_name,
                    string_VkResult(result));
     }
 }
@@ -978,11 +976,7 @@ bool BestPractices::ValidateCmdDrawType(VkCommandBuffer cmd_buffer, const char*
     bool skip = false;
     const CMD_BUFFER_STATE* cb_state = GetCBState(cmd_buffer);
     if (cb_state) {
-        const auto last_bound_it = cb_state->lastBound.find(VK_PIPELINE_BIND_POINT_GRAPHICS);
-        const PIPELINE_STATE* pipeline_state = nullptr;
-        if (last_bound_it != cb_state->lastBound.cend()) {
-            pipeline_state = last_bound_it->second.pipeline_state;
-        }
+        const PIPELINE_STATE* pipeline_state = cb_state->lastBound[BindPoint_Graphics].pipeline_state;
         const auto& current_vtx_bfr_binding_info = cb_state->current_vertex_buffer_binding_info.vertex_buffer_bindings;
         // Verify vertex binding
         if (pipeline_state->vertex_binding_descriptions_.size() <= 0) {
@@ -1347,10 +1341,11 @@ void BestPractices::PostCallRecordQueueBindSparse(VkQueue queue, uint32_t bindIn
     ValidationStateTracker::PostCallRecordQueueBindSparse(queue, bindInfoCount, pBindInfo, fence, result);
 
     if (result != VK_SUCCESS) {
-        static std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY, VK_ERROR_OUT_OF_DEVICE_MEMORY,
-                                                    VK_ERROR_DEVICE_LOST};
-        static std::vector<VkResult> success_codes = {};
-        ValidateReturnCodes("vkReleaseFullScreenExclusiveModeEXT", result, error_codes, success_codes);
+        static constexpr uint64_t error_codes =
+            VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY) |
+            VkResultBit(VK_ERROR_DEVICE_LOST);
+        static constexpr uint64_t success_codes = 0;
+        ValidateReturnCodes("vkQueueBindSparse", result, error_codes, success_codes);
         return;
     }
 
@@ -193,8 +193,8 @@ class BestPractices : public ValidationStateTracker {
     bool PreCallValidateCmdClearAttachments(VkCommandBuffer commandBuffer, uint32_t attachmentCount,
                                             const VkClearAttachment* pAttachments, uint32_t rectCount,
                                             const VkClearRect* pRects) const;
-    void ValidateReturnCodes(const char* api_name, VkResult result, const std::vector<VkResult>& success_codes,
-                             const std::vector<VkResult>& error_codes) const;
+    // error_codes and success_codes are masks of VkResultBit() values
+    void ValidateReturnCodes(const char* api_name, VkResult result, uint64_t error_codes, uint64_t success_codes) const;
     bool PreCallValidateCmdResolveImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout,
                                         VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount,
                                         const VkImageResolve* pRegions) const;
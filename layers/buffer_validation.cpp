@@ -20,6 +20,7 @@
  * Shannon McPherson <shannon@lunarg.com>
  */
 
+#include <algorithm>
 #include <cmath>
 #include <set>
 #include <sstream>
@@ -1836,6 +1837,63 @@ static bool RegionIntersects(const VkImageCopy *rgn0, const VkImageCopy *rgn1, V
     return result;
 }
 
+// Returns the (i, j) pairs, ordered by i then j, for which the source area of pRegions[i] intersects the dest area of
+// pRegions[j]. Every intersecting pair must overlap along x, so rather than testing all pairs the source and dest x-ranges
+// are sorted and swept, and only pairs whose x-ranges overlap are given the full RegionIntersects test.
+static std::vector<std::pair<uint32_t, uint32_t>> FindIntersectingRegions(uint32_t regionCount, const VkImageCopy *pRegions,
+                                                                          VkImageType type, bool is_multiplane) {
+    std::vector<std::pair<uint32_t, uint32_t>> intersections;
+    if ((type != VK_IMAGE_TYPE_1D) && (type != VK_IMAGE_TYPE_2D) && (type != VK_IMAGE_TYPE_3D)) {
+        for (uint32_t i = 0; i < regionCount; i++) {
+            for (uint32_t j = 0; j < regionCount; j++) {
+                if (RegionIntersects(&pRegions[i], &pRegions[j], type, is_multiplane)) intersections.emplace_back(i, j);
+            }
+        }
+        return intersections;
+    }
+
+    struct Interval {
+        uint64_t begin;
+        uint64_t end;
+        uint32_t region;
+        bool is_src;
+    };
+    // Widened to 64 bits so the sweep never wraps; RangesIntersect rejects ranges that wrap in 32 bits, so this only
+    // admits extra candidates, never loses one.
+    std::vector<Interval> intervals;
+    intervals.reserve(2 * regionCount);
+    for (uint32_t i = 0; i < regionCount; i++) {
+        const VkImageCopy &region = pRegions[i];
+        if (region.extent.width == 0) continue;
+        const uint64_t src_x = static_cast<uint32_t>(region.srcOffset.x);
+        const uint64_t dst_x = static_cast<uint32_t>(region.dstOffset.x);
+        intervals.push_back({src_x, src_x + region.extent.width, i, true});
+        intervals.push_back({dst_x, dst_x + region.extent.width, i, false});
+    }
+    std::sort(intervals.begin(), intervals.end(), [](const Interval &a, const Interval &b) { return a.begin < b.begin; });
+
+    std::vector<const Interval *> active_src;
+    std::vector<const Interval *> active_dst;
+    auto retire = [](std::vector<const Interval *> &active, uint64_t position) {
+        active.erase(std::remove_if(active.begin(), active.end(), [position](const Interval *a) { return a->end <= position; }),
+                     active.end());
+    };
+    for (const auto &interval : intervals) {
+        retire(active_src, interval.begin);
+        retire(active_dst, interval.begin);
+        for (const auto *other : interval.is_src ? active_dst : active_src) {
+            const uint32_t src_region = interval.is_src ? interval.region : other->region;
+            const uint32_t dst_region = interval.is_src ? other->region : interval.region;
+            if (RegionIntersects(&pRegions[src_region], &pRegions[dst_region], type, is_multiplane)) {
+                intersections.emplace_back(src_region, dst_region);
+            }
+        }
+        (interval.is_src ? active_src : active_dst).push_back(&interval);
+    }
+    std::sort(intersections.begin(), intersections.end());
+    return intersections;
+}
+
 // Returns non-zero if offset and extent exceed image extents
 static const uint32_t x_bit = 1;
 static const uint32_t y_bit = 2;
@@ -2118,233 +2176,291 @@ bool CoreChecks::ValidateImageCopyData(const uint32_t regionCount, const VkImage
                                        const IMAGE_STATE *dst_state) const {
     bool skip = false;
 
-    for (uint32_t i = 0; i < regionCount; i++) {
-        const VkImageCopy region = ic_regions[i];
-
-        // For comp<->uncomp copies, the copy extent for the dest image must be adjusted
-        const VkExtent3D src_copy_extent = region.extent;
-        const VkExtent3D dst_copy_extent =
-            GetAdjustedDestImageExtent(src_state->createInfo.format, dst_state->createInfo.format, region.extent);
-
-        bool slice_override = false;
-        uint32_t depth_slices = 0;
+    const VkImageType src_type = src_state->createInfo.imageType;
+    const VkImageType dst_type = dst_state->createInfo.imageType;
+    const VkFormat src_format = src_state->createInfo.format;
+    const VkFormat dst_format = dst_state->createInfo.format;
+    const bool maintenance1 = device_extensions.vk_khr_maintenance1;
+    // VU01199 changed with mnt1: before it, copies with either image of type VK_IMAGE_TYPE_3D need single layers on both sides
+    const bool any_3d = (src_type == VK_IMAGE_TYPE_3D) || (dst_type == VK_IMAGE_TYPE_3D);
+    const bool src_single_layer = maintenance1 ? (src_type == VK_IMAGE_TYPE_3D) : any_3d;
+    const bool dst_single_layer = maintenance1 ? (dst_type == VK_IMAGE_TYPE_3D) : any_3d;
+    // Checks that apply only to compressed images (or to _422 images if ycbcr enabled)
+    const bool ext_ycbcr = IsExtEnabled(device_extensions.vk_khr_sampler_ycbcr_conversion);
+    const bool src_blocked = FormatIsCompressed(src_format) || (ext_ycbcr && FormatIsSinglePlane_422(src_format));
+    const bool dst_blocked = FormatIsCompressed(dst_format) || (ext_ycbcr && FormatIsSinglePlane_422(dst_format));
+    const VkExtent3D src_block = FormatTexelBlockExtent(src_format);
+    const VkExtent3D dst_block = FormatTexelBlockExtent(dst_format);
+
+    struct RegionExtents {
+        VkExtent3D dst_copy;  // For comp<->uncomp copies, the copy extent for the dest image must be adjusted
+        uint32_t src_copy_depth;
+        uint32_t dst_copy_depth;
+        VkExtent3D src_mip;  // Only set for block-compressed sources
+        VkExtent3D dst_mip;  // Only set for block-compressed destinations
+    };
+    enum : uint32_t {
+        kSrc1DOffsetY = 1u << 0,
+        kSrc1DOffsetZ = 1u << 1,
+        kSrc2DOffsetZ = 1u << 2,
+        kSrcSingleLayer = 1u << 3,
+        kSrcBlockOffset = 1u << 4,
+        kSrcBlockWidth = 1u << 5,
+        kSrcBlockHeight = 1u << 6,
+        kSrcBlockDepth = 1u << 7,
+        kDst1DOffsetY = 1u << 8,
+        kDst1DOffsetZ = 1u << 9,
+        kDst2DOffsetZ = 1u << 10,
+        kDst3DSingleLayer = 1u << 11,
+        kDstSingleLayer = 1u << 12,
+        kDstBlockOffset = 1u << 13,
+        kDstBlockWidth = 1u << 14,
+        kDstBlockHeight = 1u << 15,
+        kDstBlockDepth = 1u << 16,
+    };
+    // Returns which checks the region fails, without formatting any errors
+    auto region_violations = [&](const VkImageCopy &region, RegionExtents *extents) {
+        extents->dst_copy = GetAdjustedDestImageExtent(src_format, dst_format, region.extent);
 
         // Special case for copying between a 1D/2D array and a 3D image
         // TBD: This seems like the only way to reconcile 3 mutually-exclusive VU checks for 2D/3D copies. Heads up.
-        if ((VK_IMAGE_TYPE_3D == src_state->createInfo.imageType) && (VK_IMAGE_TYPE_3D != dst_state->createInfo.imageType)) {
+        bool slice_override = false;
+        uint32_t depth_slices = 0;
+        if ((VK_IMAGE_TYPE_3D == src_type) && (VK_IMAGE_TYPE_3D != dst_type)) {
             depth_slices = region.dstSubresource.layerCount;  // Slice count from 2D subresource
             slice_override = (depth_slices != 1);
-        } else if ((VK_IMAGE_TYPE_3D == dst_state->createInfo.imageType) && (VK_IMAGE_TYPE_3D != src_state->createInfo.imageType)) {
+        } else if ((VK_IMAGE_TYPE_3D == dst_type) && (VK_IMAGE_TYPE_3D != src_type)) {
             depth_slices = region.srcSubresource.layerCount;  // Slice count from 2D subresource
             slice_override = (depth_slices != 1);
         }
+        extents->src_copy_depth = slice_override ? depth_slices : region.extent.depth;
+        extents->dst_copy_depth = slice_override ? depth_slices : extents->dst_copy.depth;
 
-        // Do all checks on source image
-        //
-        if (src_state->createInfo.imageType == VK_IMAGE_TYPE_1D) {
-            if ((0 != region.srcOffset.y) || (1 != src_copy_extent.height)) {
-                skip |=
-                    LogError(src_state->image, "VUID-VkImageCopy-srcImage-00146",
+        uint32_t violations = 0;
+        // Source image
+        if ((src_type == VK_IMAGE_TYPE_1D) && ((0 != region.srcOffset.y) || (1 != region.extent.height))) {
+            violations |= kSrc1DOffsetY;
+        }
+        if ((src_type == VK_IMAGE_TYPE_1D) && ((0 != region.srcOffset.z) || (1 != region.extent.depth))) {
+            violations |= kSrc1DOffsetZ;
+        }
+        if ((src_type == VK_IMAGE_TYPE_2D) && (0 != region.srcOffset.z)) violations |= kSrc2DOffsetZ;
+        if (src_single_layer && ((0 != region.srcSubresource.baseArrayLayer) || (1 != region.srcSubresource.layerCount))) {
+            violations |= kSrcSingleLayer;
+        }
+        if (src_blocked) {
+            extents->src_mip = GetImageSubresourceExtent(src_state, &(region.srcSubresource));
+            //  image offsets must be multiples of block dimensions
+            if ((SafeModulo(region.srcOffset.x, src_block.width) != 0) || (SafeModulo(region.srcOffset.y, src_block.height) != 0) ||
+                (SafeModulo(region.srcOffset.z, src_block.depth) != 0)) {
+                violations |= kSrcBlockOffset;
+            }
+            // Extent must be a multiple of the block size, or extent+offset must equal the subresource size
+            if ((SafeModulo(region.extent.width, src_block.width) != 0) &&
+                (region.extent.width + region.srcOffset.x != extents->src_mip.width)) {
+                violations |= kSrcBlockWidth;
+            }
+            if ((SafeModulo(region.extent.height, src_block.height) != 0) &&
+                (region.extent.height + region.srcOffset.y != extents->src_mip.height)) {
+                violations |= kSrcBlockHeight;
+            }
+            if ((SafeModulo(extents->src_copy_depth, src_block.depth) != 0) &&
+                (extents->src_copy_depth + region.srcOffset.z != extents->src_mip.depth)) {
+                violations |= kSrcBlockDepth;
+            }
+        }
+
+        // Dest image
+        if ((dst_type == VK_IMAGE_TYPE_1D) && ((0 != region.dstOffset.y) || (1 != extents->dst_copy.height))) {
+            violations |= kDst1DOffsetY;
+        }
+        if ((dst_type == VK_IMAGE_TYPE_1D) && ((0 != region.dstOffset.z) || (1 != extents->dst_copy.depth))) {
+            violations |= kDst1DOffsetZ;
+        }
+        if ((dst_type == VK_IMAGE_TYPE_2D) && (0 != region.dstOffset.z)) violations |= kDst2DOffsetZ;
+        const bool dst_multiple_layers = (0 != region.dstSubresource.baseArrayLayer) || (1 != region.dstSubresource.layerCount);
+        if ((dst_type == VK_IMAGE_TYPE_3D) && dst_multiple_layers) violations |= kDst3DSingleLayer;
+        if (dst_single_layer && dst_multiple_layers) violations |= kDstSingleLayer;
+        if (dst_blocked) {
+            extents->dst_mip = GetImageSubresourceExtent(dst_state, &(region.dstSubresource));
+            if ((SafeModulo(region.dstOffset.x, dst_block.width) != 0) || (SafeModulo(region.dstOffset.y, dst_block.height) != 0) ||
+                (SafeModulo(region.dstOffset.z, dst_block.depth) != 0)) {
+                violations |= kDstBlockOffset;
+            }
+            if ((SafeModulo(extents->dst_copy.width, dst_block.width) != 0) &&
+                (extents->dst_copy.width + region.dstOffset.x != extents->dst_mip.width)) {
+                violations |= kDstBlockWidth;
+            }
+            if ((SafeModulo(extents->dst_copy.height, dst_block.height) != 0) &&
+                (extents->dst_copy.height + region.dstOffset.y != extents->dst_mip.height)) {
+                violations |= kDstBlockHeight;
+            }
+            if ((SafeModulo(extents->dst_copy_depth, dst_block.depth) != 0) &&
+                (extents->dst_copy_depth + region.dstOffset.z != extents->dst_mip.depth)) {
+                violations |= kDstBlockDepth;
+            }
+        }
+        return violations;
+    };
+
+    // First pass: only find out whether any region fails a check, as for vkCmdCopyBuffer
+    uint32_t any_violations = 0;
+    for (uint32_t i = 0; i < regionCount; i++) {
+        RegionExtents extents;
+        any_violations |= region_violations(ic_regions[i], &extents);
+    }
+
+    // Second pass: format errors for the regions that failed
+    for (uint32_t i = 0; any_violations && i < regionCount; i++) {
+        const VkImageCopy &region = ic_regions[i];
+        RegionExtents extents;
+        const uint32_t violations = region_violations(region, &extents);
+        if (!violations) continue;
+
+        if (violations & kSrc1DOffsetY) {
+            skip |= LogError(src_state->image, "VUID-VkImageCopy-srcImage-00146",
                              "vkCmdCopyImage(): pRegion[%d] srcOffset.y is %d and extent.height is %d. For 1D images these must "
                              "be 0 and 1, respectively.",
-                             i, region.srcOffset.y, src_copy_extent.height);
-            }
+                             i, region.srcOffset.y, region.extent.height);
         }
 
-        // VUID-VkImageCopy-srcImage-01785
-        if ((src_state->createInfo.imageType == VK_IMAGE_TYPE_1D) && ((0 != region.srcOffset.z) || (1 != src_copy_extent.depth))) {
+        if (violations & kSrc1DOffsetZ) {
             skip |= LogError(src_state->image, "VUID-VkImageCopy-srcImage-01785",
                              "vkCmdCopyImage(): pRegion[%d] srcOffset.z is %d and extent.depth is %d. For 1D images "
                              "these must be 0 and 1, respectively.",
-                             i, region.srcOffset.z, src_copy_extent.depth);
+                             i, region.srcOffset.z, region.extent.depth);
         }
 
-        // VUID-VkImageCopy-srcImage-01787
-        if ((src_state->createInfo.imageType == VK_IMAGE_TYPE_2D) && (0 != region.srcOffset.z)) {
+        if (violations & kSrc2DOffsetZ) {
             skip |= LogError(src_state->image, "VUID-VkImageCopy-srcImage-01787",
                              "vkCmdCopyImage(): pRegion[%d] srcOffset.z is %d. For 2D images the z-offset must be 0.", i,
                              region.srcOffset.z);
         }
 
-        if (device_extensions.vk_khr_maintenance1) {
-            if (src_state->createInfo.imageType == VK_IMAGE_TYPE_3D) {
-                if ((0 != region.srcSubresource.baseArrayLayer) || (1 != region.srcSubresource.layerCount)) {
-                    skip |=
-                        LogError(src_state->image, "VUID-VkImageCopy-srcImage-00141",
+        if (violations & kSrcSingleLayer) {
+            if (maintenance1) {
+                skip |= LogError(src_state->image, "VUID-VkImageCopy-srcImage-00141",
                                  "vkCmdCopyImage(): pRegion[%d] srcSubresource.baseArrayLayer is %d and srcSubresource.layerCount "
                                  "is %d. For VK_IMAGE_TYPE_3D images these must be 0 and 1, respectively.",
                                  i, region.srcSubresource.baseArrayLayer, region.srcSubresource.layerCount);
-                }
-            }
-        } else {  // Pre maint 1
-            if (src_state->createInfo.imageType == VK_IMAGE_TYPE_3D || dst_state->createInfo.imageType == VK_IMAGE_TYPE_3D) {
-                if ((0 != region.srcSubresource.baseArrayLayer) || (1 != region.srcSubresource.layerCount)) {
-                    skip |= LogError(src_state->image, "VUID-VkImageCopy-srcImage-00141",
-                                     "vkCmdCopyImage(): pRegion[%d] srcSubresource.baseArrayLayer is %d and "
-                                     "srcSubresource.layerCount is %d. For copies with either source or dest of type "
-                                     "VK_IMAGE_TYPE_3D, these must be 0 and 1, respectively.",
-                                     i, region.srcSubresource.baseArrayLayer, region.srcSubresource.layerCount);
-                }
+            } else {
+                skip |= LogError(src_state->image, "VUID-VkImageCopy-srcImage-00141",
+                                 "vkCmdCopyImage(): pRegion[%d] srcSubresource.baseArrayLayer is %d and "
+                                 "srcSubresource.layerCount is %d. For copies with either source or dest of type "
+                                 "VK_IMAGE_TYPE_3D, these must be 0 and 1, respectively.",
+                                 i, region.srcSubresource.baseArrayLayer, region.srcSubresource.layerCount);
             }
         }
 
-        // Source checks that apply only to compressed images (or to _422 images if ycbcr enabled)
-        bool ext_ycbcr = IsExtEnabled(device_extensions.vk_khr_sampler_ycbcr_conversion);
-        if (FormatIsCompressed(src_state->createInfo.format) ||
-            (ext_ycbcr && FormatIsSinglePlane_422(src_state->createInfo.format))) {
-            const VkExtent3D block_size = FormatTexelBlockExtent(src_state->createInfo.format);
-            //  image offsets must be multiples of block dimensions
-            if ((SafeModulo(region.srcOffset.x, block_size.width) != 0) ||
-                (SafeModulo(region.srcOffset.y, block_size.height) != 0) ||
-                (SafeModulo(region.srcOffset.z, block_size.depth) != 0)) {
-                const char *vuid = ext_ycbcr ? "VUID-VkImageCopy-srcImage-01727" : "VUID-VkImageCopy-srcOffset-00157";
-                skip |= LogError(src_state->image, vuid,
-                                 "vkCmdCopyImage(): pRegion[%d] srcOffset (%d, %d) must be multiples of the compressed image's "
-                                 "texel width & height (%d, %d).",
-                                 i, region.srcOffset.x, region.srcOffset.y, block_size.width, block_size.height);
-            }
+        if (violations & kSrcBlockOffset) {
+            const char *vuid = ext_ycbcr ? "VUID-VkImageCopy-srcImage-01727" : "VUID-VkImageCopy-srcOffset-00157";
+            skip |= LogError(src_state->image, vuid,
+                             "vkCmdCopyImage(): pRegion[%d] srcOffset (%d, %d) must be multiples of the compressed image's "
+                             "texel width & height (%d, %d).",
+                             i, region.srcOffset.x, region.srcOffset.y, src_block.width, src_block.height);
+        }
 
-            const VkExtent3D mip_extent = GetImageSubresourceExtent(src_state, &(region.srcSubresource));
-            if ((SafeModulo(src_copy_extent.width, block_size.width) != 0) &&
-                (src_copy_extent.width + region.srcOffset.x != mip_extent.width)) {
-                const char *vuid = ext_ycbcr ? "VUID-VkImageCopy-srcImage-01728" : "VUID-VkImageCopy-extent-00158";
-                skip |=
-                    LogError(src_state->image, vuid,
+        if (violations & kSrcBlockWidth) {
+            const char *vuid = ext_ycbcr ? "VUID-VkImageCopy-srcImage-01728" : "VUID-VkImageCopy-extent-00158";
+            skip |= LogError(src_state->image, vuid,
                              "vkCmdCopyImage(): pRegion[%d] extent width (%d) must be a multiple of the compressed texture block "
                              "width (%d), or when added to srcOffset.x (%d) must equal the image subresource width (%d).",
-                             i, src_copy_extent.width, block_size.width, region.srcOffset.x, mip_extent.width);
-            }
+                             i, region.extent.width, src_block.width, region.srcOffset.x, extents.src_mip.width);
+        }
 
-            // Extent height must be a multiple of block height, or extent+offset height must equal subresource height
-            if ((SafeModulo(src_copy_extent.height, block_size.height) != 0) &&
-                (src_copy_extent.height + region.srcOffset.y != mip_extent.height)) {
-                const char *vuid = ext_ycbcr ? "VUID-VkImageCopy-srcImage-01729" : "VUID-VkImageCopy-extent-00159";
-                skip |=
-                    LogError(src_state->image, vuid,
+        if (violations & kSrcBlockHeight) {
+            const char *vuid = ext_ycbcr ? "VUID-VkImageCopy-srcImage-01729" : "VUID-VkImageCopy-extent-00159";
+            skip |= LogError(src_state->image, vuid,
                              "vkCmdCopyImage(): pRegion[%d] extent height (%d) must be a multiple of the compressed texture block "
                              "height (%d), or when added to srcOffset.y (%d) must equal the image subresource height (%d).",
-                             i, src_copy_extent.height, block_size.height, region.srcOffset.y, mip_extent.height);
-            }
+                             i, region.extent.height, src_block.height, region.srcOffset.y, extents.src_mip.height);
+        }
 
-            // Extent depth must be a multiple of block depth, or extent+offset depth must equal subresource depth
-            uint32_t copy_depth = (slice_override ? depth_slices : src_copy_extent.depth);
-            if ((SafeModulo(copy_depth, block_size.depth) != 0) && (copy_depth + region.srcOffset.z != mip_extent.depth)) {
-                const char *vuid = ext_ycbcr ? "VUID-VkImageCopy-srcImage-01730" : "VUID-VkImageCopy-extent-00160";
-                skip |=
-                    LogError(src_state->image, vuid,
+        if (violations & kSrcBlockDepth) {
+            const char *vuid = ext_ycbcr ? "VUID-VkImageCopy-srcImage-01730" : "VUID-VkImageCopy-extent-00160";
+            skip |= LogError(src_state->image, vuid,
                              "vkCmdCopyImage(): pRegion[%d] extent width (%d) must be a multiple of the compressed texture block "
                              "depth (%d), or when added to srcOffset.z (%d) must equal the image subresource depth (%d).",
-                             i, src_copy_extent.depth, block_size.depth, region.srcOffset.z, mip_extent.depth);
-            }
-        }  // Compressed
+                             i, region.extent.depth, src_block.depth, region.srcOffset.z, extents.src_mip.depth);
+        }
 
-        // Do all checks on dest image
-        //
-        if (dst_state->createInfo.imageType == VK_IMAGE_TYPE_1D) {
-            if ((0 != region.dstOffset.y) || (1 != dst_copy_extent.height)) {
-                skip |= LogError(dst_state->image, "VUID-VkImageCopy-dstImage-00152",
-                                 "vkCmdCopyImage(): pRegion[%d] dstOffset.y is %d and dst_copy_extent.height is %d. For 1D images "
-                                 "these must be 0 and 1, respectively.",
-                                 i, region.dstOffset.y, dst_copy_extent.height);
-            }
+        if (violations & kDst1DOffsetY) {
+            skip |= LogError(dst_state->image, "VUID-VkImageCopy-dstImage-00152",
+                             "vkCmdCopyImage(): pRegion[%d] dstOffset.y is %d and dst_copy_extent.height is %d. For 1D images "
+                             "these must be 0 and 1, respectively.",
+                             i, region.dstOffset.y, extents.dst_copy.height);
         }
 
-        // VUID-VkImageCopy-dstImage-01786
-        if ((dst_state->createInfo.imageType == VK_IMAGE_TYPE_1D) && ((0 != region.dstOffset.z) || (1 != dst_copy_extent.depth))) {
+        if (violations & kDst1DOffsetZ) {
             skip |=
                 LogError(dst_state->image, "VUID-VkImageCopy-dstImage-01786",
                          "vkCmdCopyImage(): pRegion[%d] dstOffset.z is %d and extent.depth is %d. For 1D images these must be 0 "
                          "and 1, respectively.",
-                         i, region.dstOffset.z, dst_copy_extent.depth);
+                         i, region.dstOffset.z, extents.dst_copy.depth);
         }
 
-        // VUID-VkImageCopy-dstImage-01788
-        if ((dst_state->createInfo.imageType == VK_IMAGE_TYPE_2D) && (0 != region.dstOffset.z)) {
+        if (violations & kDst2DOffsetZ) {
             skip |= LogError(dst_state->image, "VUID-VkImageCopy-dstImage-01788",
                              "vkCmdCopyImage(): pRegion[%d] dstOffset.z is %d. For 2D images the z-offset must be 0.", i,
                              region.dstOffset.z);
         }
 
-        if (dst_state->createInfo.imageType == VK_IMAGE_TYPE_3D) {
-            if ((0 != region.dstSubresource.baseArrayLayer) || (1 != region.dstSubresource.layerCount)) {
+        if (violations & kDst3DSingleLayer) {
+            skip |= LogError(dst_state->image, "VUID-VkImageCopy-srcImage-00141",
+                             "vkCmdCopyImage(): pRegion[%d] dstSubresource.baseArrayLayer is %d and dstSubresource.layerCount "
+                             "is %d. For VK_IMAGE_TYPE_3D images these must be 0 and 1, respectively.",
+                             i, region.dstSubresource.baseArrayLayer, region.dstSubresource.layerCount);
+        }
+
+        if (violations & kDstSingleLayer) {
+            if (maintenance1) {
                 skip |= LogError(dst_state->image, "VUID-VkImageCopy-srcImage-00141",
                                  "vkCmdCopyImage(): pRegion[%d] dstSubresource.baseArrayLayer is %d and dstSubresource.layerCount "
                                  "is %d. For VK_IMAGE_TYPE_3D images these must be 0 and 1, respectively.",
                                  i, region.dstSubresource.baseArrayLayer, region.dstSubresource.layerCount);
-            }
-        }
-        // VU01199 changed with mnt1
-        if (device_extensions.vk_khr_maintenance1) {
-            if (dst_state->createInfo.imageType == VK_IMAGE_TYPE_3D) {
-                if ((0 != region.dstSubresource.baseArrayLayer) || (1 != region.dstSubresource.layerCount)) {
-                    skip |=
-                        LogError(dst_state->image, "VUID-VkImageCopy-srcImage-00141",
-                                 "vkCmdCopyImage(): pRegion[%d] dstSubresource.baseArrayLayer is %d and dstSubresource.layerCount "
-                                 "is %d. For VK_IMAGE_TYPE_3D images these must be 0 and 1, respectively.",
+            } else {
+                skip |= LogError(dst_state->image, "VUID-VkImageCopy-srcImage-00141",
+                                 "vkCmdCopyImage(): pRegion[%d] dstSubresource.baseArrayLayer is %d and "
+                                 "dstSubresource.layerCount is %d. For copies with either source or dest of type "
+                                 "VK_IMAGE_TYPE_3D, these must be 0 and 1, respectively.",
                                  i, region.dstSubresource.baseArrayLayer, region.dstSubresource.layerCount);
-                }
-            }
-        } else {  // Pre maint 1
-            if (src_state->createInfo.imageType == VK_IMAGE_TYPE_3D || dst_state->createInfo.imageType == VK_IMAGE_TYPE_3D) {
-                if ((0 != region.dstSubresource.baseArrayLayer) || (1 != region.dstSubresource.layerCount)) {
-                    skip |= LogError(dst_state->image, "VUID-VkImageCopy-srcImage-00141",
-                                     "vkCmdCopyImage(): pRegion[%d] dstSubresource.baseArrayLayer is %d and "
-                                     "dstSubresource.layerCount is %d. For copies with either source or dest of type "
-                                     "VK_IMAGE_TYPE_3D, these must be 0 and 1, respectively.",
-                                     i, region.dstSubresource.baseArrayLayer, region.dstSubresource.layerCount);
-                }
             }
         }
 
-        // Dest checks that apply only to compressed images (or to _422 images if ycbcr enabled)
-        if (FormatIsCompressed(dst_state->createInfo.format) ||
-            (ext_ycbcr && FormatIsSinglePlane_422(dst_state->createInfo.format))) {
-            const VkExtent3D block_size = FormatTexelBlockExtent(dst_state->createInfo.format);
-
-            //  image offsets must be multiples of block dimensions
-            if ((SafeModulo(region.dstOffset.x, block_size.width) != 0) ||
-                (SafeModulo(region.dstOffset.y, block_size.height) != 0) ||
-                (SafeModulo(region.dstOffset.z, block_size.depth) != 0)) {
-                const char *vuid = ext_ycbcr ? "VUID-VkImageCopy-dstImage-01731" : "VUID-VkImageCopy-dstOffset-00162";
-                skip |= LogError(dst_state->image, vuid,
-                                 "vkCmdCopyImage(): pRegion[%d] dstOffset (%d, %d) must be multiples of the compressed image's "
-                                 "texel width & height (%d, %d).",
-                                 i, region.dstOffset.x, region.dstOffset.y, block_size.width, block_size.height);
-            }
+        if (violations & kDstBlockOffset) {
+            const char *vuid = ext_ycbcr ? "VUID-VkImageCopy-dstImage-01731" : "VUID-VkImageCopy-dstOffset-00162";
+            skip |= LogError(dst_state->image, vuid,
+                             "vkCmdCopyImage(): pRegion[%d] dstOffset (%d, %d) must be multiples of the compressed image's "
+                             "texel width & height (%d, %d).",
+                             i, region.dstOffset.x, region.dstOffset.y, dst_block.width, dst_block.height);
+        }
 
-            const VkExtent3D mip_extent = GetImageSubresourceExtent(dst_state, &(region.dstSubresource));
-            if ((SafeModulo(dst_copy_extent.width, block_size.width) != 0) &&
-                (dst_copy_extent.width + region.dstOffset.x != mip_extent.width)) {
-                const char *vuid = ext_ycbcr ? "VUID-VkImageCopy-dstImage-01732" : "VUID-VkImageCopy-extent-00163";
-                skip |= LogError(
-                    dst_state->image, vuid,
-                    "vkCmdCopyImage(): pRegion[%d] dst_copy_extent width (%d) must be a multiple of the compressed texture "
-                    "block width (%d), or when added to dstOffset.x (%d) must equal the image subresource width (%d).",
-                    i, dst_copy_extent.width, block_size.width, region.dstOffset.x, mip_extent.width);
-            }
+        if (violations & kDstBlockWidth) {
+            const char *vuid = ext_ycbcr ? "VUID-VkImageCopy-dstImage-01732" : "VUID-VkImageCopy-extent-00163";
+            skip |= LogError(
+                dst_state->image, vuid,
+                "vkCmdCopyImage(): pRegion[%d] dst_copy_extent width (%d) must be a multiple of the compressed texture "
+                "block width (%d), or when added to dstOffset.x (%d) must equal the image subresource width (%d).",
+                i, extents.dst_copy.width, dst_block.width, region.dstOffset.x, extents.dst_mip.width);
+        }
 
-            // Extent height must be a multiple of block height, or dst_copy_extent+offset height must equal subresource height
-            if ((SafeModulo(dst_copy_extent.height, block_size.height) != 0) &&
-                (dst_copy_extent.height + region.dstOffset.y != mip_extent.height)) {
-                const char *vuid = ext_ycbcr ? "VUID-VkImageCopy-dstImage-01733" : "VUID-VkImageCopy-extent-00164";
-                skip |= LogError(dst_state->image, vuid,
-                                 "vkCmdCopyImage(): pRegion[%d] dst_copy_extent height (%d) must be a multiple of the compressed "
-                                 "texture block height (%d), or when added to dstOffset.y (%d) must equal the image subresource "
-                                 "height (%d).",
-                                 i, dst_copy_extent.height, block_size.height, region.dstOffset.y, mip_extent.height);
-            }
+        if (violations & kDstBlockHeight) {
+            const char *vuid = ext_ycbcr ? "VUID-VkImageCopy-dstImage-01733" : "VUID-VkImageCopy-extent-00164";
+            skip |= LogError(dst_state->image, vuid,
+                             "vkCmdCopyImage(): pRegion[%d] dst_copy_extent height (%d) must be a multiple of the compressed "
+                             "texture block height (%d), or when added to dstOffset.y (%d) must equal the image subresource "
+                             "height (%d).",
+                             i, extents.dst_copy.height, dst_block.height, region.dstOffset.y, extents.dst_mip.height);
+        }
 
-            // Extent depth must be a multiple of block depth, or dst_copy_extent+offset depth must equal subresource depth
-            uint32_t copy_depth = (slice_override ? depth_slices : dst_copy_extent.depth);
-            if ((SafeModulo(copy_depth, block_size.depth) != 0) && (copy_depth + region.dstOffset.z != mip_extent.depth)) {
-                const char *vuid = ext_ycbcr ? "VUID-VkImageCopy-dstImage-01734" : "VUID-VkImageCopy-extent-00165";
-                skip |= LogError(
-                    dst_state->image, vuid,
-                    "vkCmdCopyImage(): pRegion[%d] dst_copy_extent width (%d) must be a multiple of the compressed texture "
-                    "block depth (%d), or when added to dstOffset.z (%d) must equal the image subresource depth (%d).",
-                    i, dst_copy_extent.depth, block_size.depth, region.dstOffset.z, mip_extent.depth);
-            }
-        }  // Compressed
+        if (violations & kDstBlockDepth) {
+            const char *vuid = ext_ycbcr ? "VUID-VkImageCopy-dstImage-01734" : "VUID-VkImageCopy-extent-00165";
+            skip |= LogError(
+                dst_state->image, vuid,
+                "vkCmdCopyImage(): pRegion[%d] dst_copy_extent width (%d) must be a multiple of the compressed texture "
+                "block depth (%d), or when added to dstOffset.z (%d) must equal the image subresource depth (%d).",
+                i, extents.dst_copy.depth, dst_block.depth, region.dstOffset.z, extents.dst_mip.depth);
+        }
     }
     return skip;
 }
@@ -2426,6 +2542,15 @@ bool CoreChecks::PreCallValidateCmdCopyImage(VkCommandBuffer commandBuffer, VkIm
 
     VkCommandBuffer command_buffer = cb_node->commandBuffer;
 
+    // The union of all source regions, and the union of all destination regions, specified by the elements of regions,
+    // must not overlap in memory
+    std::vector<std::pair<uint32_t, uint32_t>> region_intersections;
+    if (src_image_state->image == dst_image_state->image) {
+        region_intersections = FindIntersectingRegions(regionCount, pRegions, src_image_state->createInfo.imageType,
+                                                       FormatIsMultiplane(src_format));
+    }
+    auto next_intersection = region_intersections.cbegin();
+
     for (uint32_t i = 0; i < regionCount; i++) {
         const VkImageCopy region = pRegions[i];
 
@@ -2594,17 +2719,10 @@ bool CoreChecks::PreCallValidateCmdCopyImage(VkCommandBuffer commandBuffer, VkIm
                              i, region.dstOffset.z, dst_copy_extent.depth, subresource_extent.depth);
         }
 
-        // The union of all source regions, and the union of all destination regions, specified by the elements of regions,
-        // must not overlap in memory
-        if (src_image_state->image == dst_image_state->image) {
-            for (uint32_t j = 0; j < regionCount; j++) {
-                if (RegionIntersects(&region, &pRegions[j], src_image_state->createInfo.imageType,
-                                     FormatIsMultiplane(src_format))) {
-                    std::stringstream ss;
-                    ss << "vkCmdCopyImage(): pRegions[" << i << "] src overlaps with pRegions[" << j << "].";
-                    skip |= LogError(command_buffer, "VUID-vkCmdCopyImage-pRegions-00124", "%s.", ss.str().c_str());
-                }
-            }
+        for (; next_intersection != region_intersections.cend() && next_intersection->first == i; ++next_intersection) {
+            std::stringstream ss;
+            ss << "vkCmdCopyImage(): pRegions[" << i << "] src overlaps with pRegions[" << next_intersection->second << "].";
+            skip |= LogError(command_buffer, "VUID-vkCmdCopyImage-pRegions-00124", "%s.", ss.str().c_str());
         }
 
         // Check depth for 2D as post Maintaince 1 requires both while prior only required one to be 2D
@@ -3322,12 +3440,33 @@ const GlobalImageLayoutRangeMap *GetLayoutRangeMap(const GlobalImageLayoutMap &m
     return nullptr;
 }
 
+const GlobalImageLayoutRangeMap *SubmitImageLayoutOverlay::Get(VkImage image) const {
+    auto it = layers_.find(image);
+    if (it == layers_.end()) return nullptr;
+    return it->second.merged ? it->second.merged.get() : it->second.single;
+}
+
+void SubmitImageLayoutOverlay::Push(const IMAGE_STATE &image_state, const GlobalImageLayoutRangeMap &current_layouts) {
+    auto &layer = layers_[image_state.image];
+    if (!layer.single && !layer.merged) {
+        layer.single = &current_layouts;
+        return;
+    }
+    if (!layer.merged) {
+        // A second command buffer changes this image, so the layers have to be combined
+        layer.merged.reset(new GlobalImageLayoutRangeMap(image_state.range_encoder.SubresourceCount()));
+        sparse_container::splice(layer.merged.get(), *layer.single, sparse_container::value_precedence::prefer_source);
+        layer.single = nullptr;
+    }
+    sparse_container::splice(layer.merged.get(), current_layouts, sparse_container::value_precedence::prefer_source);
+}
+
 // This validates that the initial layout specified in the command buffer for the IMAGE is the same as the global IMAGE layout
 bool CoreChecks::ValidateCmdBufImageLayouts(const CMD_BUFFER_STATE *pCB, const GlobalImageLayoutMap &globalImageLayoutMap,
-                                            GlobalImageLayoutMap *overlayLayoutMap_arg) const {
+                                            SubmitImageLayoutOverlay *overlay_arg) const {
     if (disabled.image_layout_validation) return false;
     bool skip = false;
-    GlobalImageLayoutMap &overlayLayoutMap = *overlayLayoutMap_arg;
+    SubmitImageLayoutOverlay &overlay = *overlay_arg;
     // Iterate over the layout maps for each referenced image
     GlobalImageLayoutRangeMap empty_map(1);
     for (const auto &layout_map_entry : pCB->image_layout_map) {
@@ -3339,7 +3478,10 @@ bool CoreChecks::ValidateCmdBufImageLayouts(const CMD_BUFFER_STATE *pCB, const G
         // Validate the initial_uses for each subresource referenced
         if (initial_layout_map.empty()) continue;
 
-        auto *overlay_map = GetLayoutRangeMap(&overlayLayoutMap, *image_state);
+        const auto *overlay_map = overlay.Get(image);
+        if (overlay_map == nullptr) {
+            overlay_map = &empty_map;
+        }
         const auto *global_map = GetLayoutRangeMap(globalImageLayoutMap, image);
         if (global_map == nullptr) {
             global_map = &empty_map;
@@ -3394,8 +3536,8 @@ bool CoreChecks::ValidateCmdBufImageLayouts(const CMD_BUFFER_STATE *pCB, const G
             }
         }
 
-        // Update all layout set operations (which will be a subset of the initial_layouts)
-        sparse_container::splice(overlay_map, subres_map->GetCurrentLayoutMap(), sparse_container::value_precedence::prefer_source);
+        // Layer all layout set operations (which will be a subset of the initial_layouts) over the submission's earlier changes
+        overlay.Push(*image_state, subres_map->GetCurrentLayoutMap());
     }
 
     return skip;
@@ -4679,14 +4821,36 @@ bool CoreChecks::ValidateCmdCopyBufferBounds(const BUFFER_STATE *src_buffer_stat
     VkDeviceSize dst_min = UINT64_MAX;
     VkDeviceSize dst_max = 0;
 
+    // First pass: a branch-free scan that only accumulates the union bounds and which checks failed in any region. Large
+    // region arrays are almost always valid, so the per-region error reporting below is usually skipped entirely.
+    enum : uint32_t {
+        kSrcOffsetOutOfBounds = 0x1,
+        kDstOffsetOutOfBounds = 0x2,
+        kSrcSizeOutOfBounds = 0x4,
+        kDstSizeOutOfBounds = 0x8,
+    };
+    auto region_violations = [src_buffer_size, dst_buffer_size](const VkBufferCopy &region) {
+        return (region.srcOffset >= src_buffer_size ? kSrcOffsetOutOfBounds : 0u) |
+               (region.dstOffset >= dst_buffer_size ? kDstOffsetOutOfBounds : 0u) |
+               (region.size > (src_buffer_size - region.srcOffset) ? kSrcSizeOutOfBounds : 0u) |
+               (region.size > (dst_buffer_size - region.dstOffset) ? kDstSizeOutOfBounds : 0u);
+    };
+    uint32_t any_violations = 0;
     for (uint32_t i = 0; i < regionCount; i++) {
         src_min = std::min(src_min, pRegions[i].srcOffset);
         src_max = std::max(src_max, (pRegions[i].srcOffset + pRegions[i].size));
         dst_min = std::min(dst_min, pRegions[i].dstOffset);
         dst_max = std::max(dst_max, (pRegions[i].dstOffset + pRegions[i].size));
+        any_violations |= region_violations(pRegions[i]);
+    }
+
+    // Second pass: format errors for the regions that failed
+    for (uint32_t i = 0; any_violations && i < regionCount; i++) {
+        const uint32_t violations = region_violations(pRegions[i]);
+        if (!violations) continue;
 
         // The srcOffset member of each element of pRegions must be less than the size of srcBuffer
-        if (pRegions[i].srcOffset >= src_buffer_size) {
+        if (violations & kSrcOffsetOutOfBounds) {
             skip |= LogError(src_buffer_state->buffer, "VUID-vkCmdCopyBuffer-srcOffset-00113",
                              "vkCmdCopyBuffer(): pRegions[%d].srcOffset (%" PRIuLEAST64
                              ") is greater than pRegions[%d].size (%" PRIuLEAST64 ").",
@@ -4694,7 +4858,7 @@ bool CoreChecks::ValidateCmdCopyBufferBounds(const BUFFER_STATE *src_buffer_stat
         }
 
         // The dstOffset member of each element of pRegions must be less than the size of dstBuffer
-        if (pRegions[i].dstOffset >= dst_buffer_size) {
+        if (violations & kDstOffsetOutOfBounds) {
             skip |= LogError(dst_buffer_state->buffer, "VUID-vkCmdCopyBuffer-dstOffset-00114",
                              "vkCmdCopyBuffer(): pRegions[%d].dstOffset (%" PRIuLEAST64
                              ") is greater than pRegions[%d].size (%" PRIuLEAST64 ").",
@@ -4702,7 +4866,7 @@ bool CoreChecks::ValidateCmdCopyBufferBounds(const BUFFER_STATE *src_buffer_stat
         }
 
         // The size member of each element of pRegions must be less than or equal to the size of srcBuffer minus srcOffset
-        if (pRegions[i].size > (src_buffer_size - pRegions[i].srcOffset)) {
+        if (violations & kSrcSizeOutOfBounds) {
             skip |= LogError(src_buffer_state->buffer, "VUID-vkCmdCopyBuffer-size-00115",
                              "vkCmdCopyBuffer(): pRegions[%d].size (%" PRIuLEAST64
                              ") is greater than the source buffer size (%" PRIuLEAST64
@@ -4711,7 +4875,7 @@ bool CoreChecks::ValidateCmdCopyBufferBounds(const BUFFER_STATE *src_buffer_stat
         }
 
         // The size member of each element of pRegions must be less than or equal to the size of dstBuffer minus dstOffset
-        if (pRegions[i].size > (dst_buffer_size - pRegions[i].dstOffset)) {
+        if (violations & kDstSizeOutOfBounds) {
             skip |= LogError(dst_buffer_state->buffer, "VUID-vkCmdCopyBuffer-size-00116",
                              "vkCmdCopyBuffer(): pRegions[%d].size (%" PRIuLEAST64
                              ") is greater than the destination buffer size (%" PRIuLEAST64
@@ -4763,7 +4927,7 @@ bool CoreChecks::ValidateIdleBuffer(VkBuffer buffer) const {
         skip |= LogError(buffer, kVUID_Core_DrawState_DoubleDestroy, "Cannot free %s that has not been allocated.",
                          report_data->FormatHandle(buffer).c_str());
     } else {
-        if (buffer_state->in_use.load()) {
+        if (buffer_state->InUse()) {
             skip |= LogError(buffer, "VUID-vkDestroyBuffer-buffer-00922", "Cannot free %s that is in use by a command buffer.",
                              report_data->FormatHandle(buffer).c_str());
         }
@@ -4842,208 +5006,295 @@ bool CoreChecks::ValidateBufferImageCopyData(uint32_t regionCount, const VkBuffe
                                              const IMAGE_STATE *image_state, const char *function) const {
     bool skip = false;
 
+    const VkImageType image_type = image_state->createInfo.imageType;
+    const VkFormat image_format = image_state->createInfo.format;
+    const bool depth_and_stencil = FormatIsDepthAndStencil(image_format);
+    // Checks that apply only to compressed images
+    const bool blocked = FormatIsCompressed(image_format) || FormatIsSinglePlane_422(image_format);
+    const VkExtent3D block_size = FormatTexelBlockExtent(image_format);
+    const uint32_t block_size_in_bytes = blocked ? FormatElementSize(image_format) : 0;
+    const bool multiplane = FormatIsMultiplane(image_format);
+
+    struct RegionExtents {
+        uint32_t element_size;
+        VkExtent3D image_extent;  // Subresource extent, accounting for multiplane image factors
+    };
+    enum : uint32_t {
+        k1DOffsetY = 1u << 0,
+        k1D2DOffsetZ = 1u << 1,
+        k3DSingleLayer = 1u << 2,
+        kOffsetTexelSize = 1u << 3,
+        kOffsetFour = 1u << 4,
+        kRowLength = 1u << 5,
+        kImageHeight = 1u << 6,
+        kImageOffsetX = 1u << 7,
+        kImageOffsetY = 1u << 8,
+        kImageOffsetZ = 1u << 9,
+        kAspectCount = 1u << 10,
+        kAspectFormat = 1u << 11,
+        kBlockRowLength = 1u << 12,
+        kBlockImageHeight = 1u << 13,
+        kBlockImageOffset = 1u << 14,
+        kBlockBufferOffset = 1u << 15,
+        kBlockWidth = 1u << 16,
+        kBlockHeight = 1u << 17,
+        kBlockDepth = 1u << 18,
+        kPlane2 = 1u << 19,
+        kPlaneAspect = 1u << 20,
+    };
+    // Returns which checks the region fails, without formatting any errors
+    auto region_violations = [&](const VkBufferImageCopy &region, RegionExtents *extents) {
+        uint32_t violations = 0;
+        if ((image_type == VK_IMAGE_TYPE_1D) && ((region.imageOffset.y != 0) || (region.imageExtent.height != 1))) {
+            violations |= k1DOffsetY;
+        }
+        if (((image_type == VK_IMAGE_TYPE_1D) || (image_type == VK_IMAGE_TYPE_2D)) &&
+            ((region.imageOffset.z != 0) || (region.imageExtent.depth != 1))) {
+            violations |= k1D2DOffsetZ;
+        }
+        if ((image_type == VK_IMAGE_TYPE_3D) &&
+            ((0 != region.imageSubresource.baseArrayLayer) || (1 != region.imageSubresource.layerCount))) {
+            violations |= k3DSingleLayer;
+        }
+
+        // If the the calling command's VkImage parameter's format is not a depth/stencil format,
+        // then bufferOffset must be a multiple of the calling command's VkImage parameter's element size
+        extents->element_size = FormatElementSize(image_format, region.imageSubresource.aspectMask);
+        if (!depth_and_stencil && SafeModulo(region.bufferOffset, extents->element_size) != 0) violations |= kOffsetTexelSize;
+        //  BufferOffset must be a multiple of 4
+        if (SafeModulo(region.bufferOffset, 4) != 0) violations |= kOffsetFour;
+        //  BufferRowLength must be 0, or greater than or equal to the width member of imageExtent
+        if ((region.bufferRowLength != 0) && (region.bufferRowLength < region.imageExtent.width)) violations |= kRowLength;
+        //  BufferImageHeight must be 0, or greater than or equal to the height member of imageExtent
+        if ((region.bufferImageHeight != 0) && (region.bufferImageHeight < region.imageExtent.height)) violations |= kImageHeight;
+
+        // imageOffset and (imageExtent + imageOffset) must both be >= 0 and <= image subresource extent
+        extents->image_extent = GetImageSubresourceExtent(image_state, &region.imageSubresource);
+        const VkExtent3D &image_extent = extents->image_extent;
+        if ((region.imageOffset.x < 0) || (region.imageOffset.x > static_cast<int32_t>(image_extent.width)) ||
+            ((region.imageOffset.x + region.imageExtent.width) > static_cast<int32_t>(image_extent.width))) {
+            violations |= kImageOffsetX;
+        }
+        if ((region.imageOffset.y < 0) || (region.imageOffset.y > static_cast<int32_t>(image_extent.height)) ||
+            ((region.imageOffset.y + region.imageExtent.height) > static_cast<int32_t>(image_extent.height))) {
+            violations |= kImageOffsetY;
+        }
+        if ((region.imageOffset.z < 0) || (region.imageOffset.z > static_cast<int32_t>(image_extent.depth)) ||
+            ((region.imageOffset.z + region.imageExtent.depth) > static_cast<int32_t>(image_extent.depth))) {
+            violations |= kImageOffsetZ;
+        }
+
+        // subresource aspectMask must have exactly 1 bit set
+        const int num_bits = sizeof(VkFlags) * CHAR_BIT;
+        std::bitset<num_bits> aspect_mask_bits(region.imageSubresource.aspectMask);
+        if (aspect_mask_bits.count() != 1) violations |= kAspectCount;
+        // image subresource aspect bit must match format
+        if (!VerifyAspectsPresent(region.imageSubresource.aspectMask, image_format)) violations |= kAspectFormat;
+
+        if (blocked) {
+            //  BufferRowLength and BufferRowHeight must be multiples of block width and height
+            if (SafeModulo(region.bufferRowLength, block_size.width) != 0) violations |= kBlockRowLength;
+            if (SafeModulo(region.bufferImageHeight, block_size.height) != 0) violations |= kBlockImageHeight;
+            //  image offsets must be multiples of block dimensions
+            if ((SafeModulo(region.imageOffset.x, block_size.width) != 0) ||
+                (SafeModulo(region.imageOffset.y, block_size.height) != 0) ||
+                (SafeModulo(region.imageOffset.z, block_size.depth) != 0)) {
+                violations |= kBlockImageOffset;
+            }
+            // bufferOffset must be a multiple of block size (linear bytes)
+            if (SafeModulo(region.bufferOffset, block_size_in_bytes) != 0) violations |= kBlockBufferOffset;
+            // imageExtent must be a multiple of the block size, or extent+offset must equal the subresource size
+            if ((SafeModulo(region.imageExtent.width, block_size.width) != 0) &&
+                (region.imageExtent.width + region.imageOffset.x != image_extent.width)) {
+                violations |= kBlockWidth;
+            }
+            if ((SafeModulo(region.imageExtent.height, block_size.height) != 0) &&
+                (region.imageExtent.height + region.imageOffset.y != image_extent.height)) {
+                violations |= kBlockHeight;
+            }
+            if ((SafeModulo(region.imageExtent.depth, block_size.depth) != 0) &&
+                (region.imageExtent.depth + region.imageOffset.z != image_extent.depth)) {
+                violations |= kBlockDepth;
+            }
+        }
+
+        if (multiplane) {
+            // VK_IMAGE_ASPECT_PLANE_2_BIT valid only for image formats with three planes
+            if ((FormatPlaneCount(image_format) < 3) && (region.imageSubresource.aspectMask == VK_IMAGE_ASPECT_PLANE_2_BIT)) {
+                violations |= kPlane2;
+            }
+            // image subresource aspectMask must be VK_IMAGE_ASPECT_PLANE_*_BIT
+            if (0 == (region.imageSubresource.aspectMask &
+                      (VK_IMAGE_ASPECT_PLANE_0_BIT | VK_IMAGE_ASPECT_PLANE_1_BIT | VK_IMAGE_ASPECT_PLANE_2_BIT))) {
+                violations |= kPlaneAspect;
+            }
+        }
+        return violations;
+    };
+
+    // First pass: only find out whether any region fails a check, as for vkCmdCopyBuffer
+    uint32_t any_violations = 0;
     for (uint32_t i = 0; i < regionCount; i++) {
-        if (image_state->createInfo.imageType == VK_IMAGE_TYPE_1D) {
-            if ((pRegions[i].imageOffset.y != 0) || (pRegions[i].imageExtent.height != 1)) {
-                skip |=
-                    LogError(image_state->image, "VUID-VkBufferImageCopy-srcImage-00199",
+        RegionExtents extents;
+        any_violations |= region_violations(pRegions[i], &extents);
+    }
+
+    // Second pass: format errors for the regions that failed
+    for (uint32_t i = 0; any_violations && i < regionCount; i++) {
+        RegionExtents extents;
+        const uint32_t violations = region_violations(pRegions[i], &extents);
+        if (!violations) continue;
+        const VkExtent3D &image_extent = extents.image_extent;
+
+        if (violations & k1DOffsetY) {
+            skip |= LogError(image_state->image, "VUID-VkBufferImageCopy-srcImage-00199",
                              "%s(): pRegion[%d] imageOffset.y is %d and imageExtent.height is %d. For 1D images these must be 0 "
                              "and 1, respectively.",
                              function, i, pRegions[i].imageOffset.y, pRegions[i].imageExtent.height);
-            }
         }
 
-        if ((image_state->createInfo.imageType == VK_IMAGE_TYPE_1D) || (image_state->createInfo.imageType == VK_IMAGE_TYPE_2D)) {
-            if ((pRegions[i].imageOffset.z != 0) || (pRegions[i].imageExtent.depth != 1)) {
-                skip |= LogError(image_state->image, "VUID-VkBufferImageCopy-srcImage-00201",
-                                 "%s(): pRegion[%d] imageOffset.z is %d and imageExtent.depth is %d. For 1D and 2D images these "
-                                 "must be 0 and 1, respectively.",
-                                 function, i, pRegions[i].imageOffset.z, pRegions[i].imageExtent.depth);
-            }
+        if (violations & k1D2DOffsetZ) {
+            skip |= LogError(image_state->image, "VUID-VkBufferImageCopy-srcImage-00201",
+                             "%s(): pRegion[%d] imageOffset.z is %d and imageExtent.depth is %d. For 1D and 2D images these "
+                             "must be 0 and 1, respectively.",
+                             function, i, pRegions[i].imageOffset.z, pRegions[i].imageExtent.depth);
         }
 
-        if (image_state->createInfo.imageType == VK_IMAGE_TYPE_3D) {
-            if ((0 != pRegions[i].imageSubresource.baseArrayLayer) || (1 != pRegions[i].imageSubresource.layerCount)) {
-                skip |= LogError(image_state->image, "VUID-VkBufferImageCopy-baseArrayLayer-00213",
-                                 "%s(): pRegion[%d] imageSubresource.baseArrayLayer is %d and imageSubresource.layerCount is %d. "
-                                 "For 3D images these must be 0 and 1, respectively.",
-                                 function, i, pRegions[i].imageSubresource.baseArrayLayer, pRegions[i].imageSubresource.layerCount);
-            }
+        if (violations & k3DSingleLayer) {
+            skip |= LogError(image_state->image, "VUID-VkBufferImageCopy-baseArrayLayer-00213",
+                             "%s(): pRegion[%d] imageSubresource.baseArrayLayer is %d and imageSubresource.layerCount is %d. "
+                             "For 3D images these must be 0 and 1, respectively.",
+                             function, i, pRegions[i].imageSubresource.baseArrayLayer, pRegions[i].imageSubresource.layerCount);
         }
 
-        // If the the calling command's VkImage parameter's format is not a depth/stencil format,
-        // then bufferOffset must be a multiple of the calling command's VkImage parameter's element size
-        uint32_t element_size = FormatElementSize(image_state->createInfo.format, pRegions[i].imageSubresource.aspectMask);
-
-        if (!FormatIsDepthAndStencil(image_state->createInfo.format) && SafeModulo(pRegions[i].bufferOffset, element_size) != 0) {
+        if (violations & kOffsetTexelSize) {
             skip |= LogError(image_state->image, "VUID-VkBufferImageCopy-bufferOffset-00193",
                              "%s(): pRegion[%d] bufferOffset 0x%" PRIxLEAST64
                              " must be a multiple of this format's texel size (%" PRIu32 ").",
-                             function, i, pRegions[i].bufferOffset, element_size);
+                             function, i, pRegions[i].bufferOffset, extents.element_size);
         }
 
-        //  BufferOffset must be a multiple of 4
-        if (SafeModulo(pRegions[i].bufferOffset, 4) != 0) {
+        if (violations & kOffsetFour) {
             skip |= LogError(image_state->image, "VUID-VkBufferImageCopy-bufferOffset-00194",
                              "%s(): pRegion[%d] bufferOffset 0x%" PRIxLEAST64 " must be a multiple of 4.", function, i,
                              pRegions[i].bufferOffset);
         }
 
-        //  BufferRowLength must be 0, or greater than or equal to the width member of imageExtent
-        if ((pRegions[i].bufferRowLength != 0) && (pRegions[i].bufferRowLength < pRegions[i].imageExtent.width)) {
+        if (violations & kRowLength) {
             skip |=
                 LogError(image_state->image, "VUID-VkBufferImageCopy-bufferRowLength-00195",
                          "%s(): pRegion[%d] bufferRowLength (%d) must be zero or greater-than-or-equal-to imageExtent.width (%d).",
                          function, i, pRegions[i].bufferRowLength, pRegions[i].imageExtent.width);
         }
 
-        //  BufferImageHeight must be 0, or greater than or equal to the height member of imageExtent
-        if ((pRegions[i].bufferImageHeight != 0) && (pRegions[i].bufferImageHeight < pRegions[i].imageExtent.height)) {
+        if (violations & kImageHeight) {
             skip |= LogError(
                 image_state->image, "VUID-VkBufferImageCopy-bufferImageHeight-00196",
                 "%s(): pRegion[%d] bufferImageHeight (%d) must be zero or greater-than-or-equal-to imageExtent.height (%d).",
                 function, i, pRegions[i].bufferImageHeight, pRegions[i].imageExtent.height);
         }
 
-        // Calculate adjusted image extent, accounting for multiplane image factors
-        VkExtent3D adusted_image_extent = GetImageSubresourceExtent(image_state, &pRegions[i].imageSubresource);
-        // imageOffset.x and (imageExtent.width + imageOffset.x) must both be >= 0 and <= image subresource width
-        if ((pRegions[i].imageOffset.x < 0) || (pRegions[i].imageOffset.x > static_cast<int32_t>(adusted_image_extent.width)) ||
-            ((pRegions[i].imageOffset.x + pRegions[i].imageExtent.width) > static_cast<int32_t>(adusted_image_extent.width))) {
+        if (violations & kImageOffsetX) {
             skip |= LogError(image_state->image, "VUID-VkBufferImageCopy-imageOffset-00197",
                              "%s(): Both pRegion[%d] imageoffset.x (%d) and (imageExtent.width + imageOffset.x) (%d) must be >= "
                              "zero or <= image subresource width (%d).",
                              function, i, pRegions[i].imageOffset.x, (pRegions[i].imageOffset.x + pRegions[i].imageExtent.width),
-                             adusted_image_extent.width);
+                             image_extent.width);
         }
 
-        // imageOffset.y and (imageExtent.height + imageOffset.y) must both be >= 0 and <= image subresource height
-        if ((pRegions[i].imageOffset.y < 0) || (pRegions[i].imageOffset.y > static_cast<int32_t>(adusted_image_extent.height)) ||
-            ((pRegions[i].imageOffset.y + pRegions[i].imageExtent.height) > static_cast<int32_t>(adusted_image_extent.height))) {
+        if (violations & kImageOffsetY) {
             skip |= LogError(image_state->image, "VUID-VkBufferImageCopy-imageOffset-00198",
                              "%s(): Both pRegion[%d] imageoffset.y (%d) and (imageExtent.height + imageOffset.y) (%d) must be >= "
                              "zero or <= image subresource height (%d).",
                              function, i, pRegions[i].imageOffset.y, (pRegions[i].imageOffset.y + pRegions[i].imageExtent.height),
-                             adusted_image_extent.height);
+                             image_extent.height);
         }
 
-        // imageOffset.z and (imageExtent.depth + imageOffset.z) must both be >= 0 and <= image subresource depth
-        if ((pRegions[i].imageOffset.z < 0) || (pRegions[i].imageOffset.z > static_cast<int32_t>(adusted_image_extent.depth)) ||
-            ((pRegions[i].imageOffset.z + pRegions[i].imageExtent.depth) > static_cast<int32_t>(adusted_image_extent.depth))) {
+        if (violations & kImageOffsetZ) {
             skip |= LogError(image_state->image, "VUID-VkBufferImageCopy-imageOffset-00200",
                              "%s(): Both pRegion[%d] imageoffset.z (%d) and (imageExtent.depth + imageOffset.z) (%d) must be >= "
                              "zero or <= image subresource depth (%d).",
                              function, i, pRegions[i].imageOffset.z, (pRegions[i].imageOffset.z + pRegions[i].imageExtent.depth),
-                             adusted_image_extent.depth);
+                             image_extent.depth);
         }
 
-        // subresource aspectMask must have exactly 1 bit set
-        const int num_bits = sizeof(VkFlags) * CHAR_BIT;
-        std::bitset<num_bits> aspect_mask_bits(pRegions[i].imageSubresource.aspectMask);
-        if (aspect_mask_bits.count() != 1) {
+        if (violations & kAspectCount) {
             skip |= LogError(image_state->image, "VUID-VkBufferImageCopy-aspectMask-00212",
                              "%s: aspectMasks for imageSubresource in each region must have only a single bit set.", function);
         }
 
-        // image subresource aspect bit must match format
-        if (!VerifyAspectsPresent(pRegions[i].imageSubresource.aspectMask, image_state->createInfo.format)) {
+        if (violations & kAspectFormat) {
             skip |= LogError(
                 image_state->image, "VUID-VkBufferImageCopy-aspectMask-00211",
                 "%s(): pRegion[%d] subresource aspectMask 0x%x specifies aspects that are not present in image format 0x%x.",
-                function, i, pRegions[i].imageSubresource.aspectMask, image_state->createInfo.format);
+                function, i, pRegions[i].imageSubresource.aspectMask, image_format);
         }
 
-        // Checks that apply only to compressed images
-        if (FormatIsCompressed(image_state->createInfo.format) || FormatIsSinglePlane_422(image_state->createInfo.format)) {
-            auto block_size = FormatTexelBlockExtent(image_state->createInfo.format);
-
-            //  BufferRowLength must be a multiple of block width
-            if (SafeModulo(pRegions[i].bufferRowLength, block_size.width) != 0) {
-                skip |= LogError(
-                    image_state->image, "VUID-VkBufferImageCopy-bufferRowLength-00203",
-                    "%s(): pRegion[%d] bufferRowLength (%d) must be a multiple of the compressed image's texel width (%d)..",
-                    function, i, pRegions[i].bufferRowLength, block_size.width);
-            }
+        if (violations & kBlockRowLength) {
+            skip |= LogError(
+                image_state->image, "VUID-VkBufferImageCopy-bufferRowLength-00203",
+                "%s(): pRegion[%d] bufferRowLength (%d) must be a multiple of the compressed image's texel width (%d)..",
+                function, i, pRegions[i].bufferRowLength, block_size.width);
+        }
 
-            //  BufferRowHeight must be a multiple of block height
-            if (SafeModulo(pRegions[i].bufferImageHeight, block_size.height) != 0) {
-                skip |= LogError(
-                    image_state->image, "VUID-VkBufferImageCopy-bufferImageHeight-00204",
-                    "%s(): pRegion[%d] bufferImageHeight (%d) must be a multiple of the compressed image's texel height (%d)..",
-                    function, i, pRegions[i].bufferImageHeight, block_size.height);
-            }
+        if (violations & kBlockImageHeight) {
+            skip |= LogError(
+                image_state->image, "VUID-VkBufferImageCopy-bufferImageHeight-00204",
+                "%s(): pRegion[%d] bufferImageHeight (%d) must be a multiple of the compressed image's texel height (%d)..",
+                function, i, pRegions[i].bufferImageHeight, block_size.height);
+        }
 
-            //  image offsets must be multiples of block dimensions
-            if ((SafeModulo(pRegions[i].imageOffset.x, block_size.width) != 0) ||
-                (SafeModulo(pRegions[i].imageOffset.y, block_size.height) != 0) ||
-                (SafeModulo(pRegions[i].imageOffset.z, block_size.depth) != 0)) {
-                skip |= LogError(image_state->image, "VUID-VkBufferImageCopy-imageOffset-00205",
-                                 "%s(): pRegion[%d] imageOffset(x,y) (%d, %d) must be multiples of the compressed image's texel "
-                                 "width & height (%d, %d)..",
-                                 function, i, pRegions[i].imageOffset.x, pRegions[i].imageOffset.y, block_size.width,
-                                 block_size.height);
-            }
+        if (violations & kBlockImageOffset) {
+            skip |= LogError(image_state->image, "VUID-VkBufferImageCopy-imageOffset-00205",
+                             "%s(): pRegion[%d] imageOffset(x,y) (%d, %d) must be multiples of the compressed image's texel "
+                             "width & height (%d, %d)..",
+                             function, i, pRegions[i].imageOffset.x, pRegions[i].imageOffset.y, block_size.width,
+                             block_size.height);
+        }
 
-            // bufferOffset must be a multiple of block size (linear bytes)
-            uint32_t block_size_in_bytes = FormatElementSize(image_state->createInfo.format);
-            if (SafeModulo(pRegions[i].bufferOffset, block_size_in_bytes) != 0) {
-                skip |= LogError(image_state->image, "VUID-VkBufferImageCopy-bufferOffset-00206",
-                                 "%s(): pRegion[%d] bufferOffset (0x%" PRIxLEAST64
-                                 ") must be a multiple of the compressed image's texel block size (%" PRIu32 ")..",
-                                 function, i, pRegions[i].bufferOffset, block_size_in_bytes);
-            }
+        if (violations & kBlockBufferOffset) {
+            skip |= LogError(image_state->image, "VUID-VkBufferImageCopy-bufferOffset-00206",
+                             "%s(): pRegion[%d] bufferOffset (0x%" PRIxLEAST64
+                             ") must be a multiple of the compressed image's texel block size (%" PRIu32 ")..",
+                             function, i, pRegions[i].bufferOffset, block_size_in_bytes);
+        }
 
-            // imageExtent width must be a multiple of block width, or extent+offset width must equal subresource width
-            VkExtent3D mip_extent = GetImageSubresourceExtent(image_state, &(pRegions[i].imageSubresource));
-            if ((SafeModulo(pRegions[i].imageExtent.width, block_size.width) != 0) &&
-                (pRegions[i].imageExtent.width + pRegions[i].imageOffset.x != mip_extent.width)) {
-                skip |= LogError(image_state->image, "VUID-VkBufferImageCopy-imageExtent-00207",
-                                 "%s(): pRegion[%d] extent width (%d) must be a multiple of the compressed texture block width "
-                                 "(%d), or when added to offset.x (%d) must equal the image subresource width (%d)..",
-                                 function, i, pRegions[i].imageExtent.width, block_size.width, pRegions[i].imageOffset.x,
-                                 mip_extent.width);
-            }
+        if (violations & kBlockWidth) {
+            skip |= LogError(image_state->image, "VUID-VkBufferImageCopy-imageExtent-00207",
+                             "%s(): pRegion[%d] extent width (%d) must be a multiple of the compressed texture block width "
+                             "(%d), or when added to offset.x (%d) must equal the image subresource width (%d)..",
+                             function, i, pRegions[i].imageExtent.width, block_size.width, pRegions[i].imageOffset.x,
+                             image_extent.width);
+        }
 
-            // imageExtent height must be a multiple of block height, or extent+offset height must equal subresource height
-            if ((SafeModulo(pRegions[i].imageExtent.height, block_size.height) != 0) &&
-                (pRegions[i].imageExtent.height + pRegions[i].imageOffset.y != mip_extent.height)) {
-                skip |= LogError(image_state->image, "VUID-VkBufferImageCopy-imageExtent-00208",
-                                 "%s(): pRegion[%d] extent height (%d) must be a multiple of the compressed texture block height "
-                                 "(%d), or when added to offset.y (%d) must equal the image subresource height (%d)..",
-                                 function, i, pRegions[i].imageExtent.height, block_size.height, pRegions[i].imageOffset.y,
-                                 mip_extent.height);
-            }
+        if (violations & kBlockHeight) {
+            skip |= LogError(image_state->image, "VUID-VkBufferImageCopy-imageExtent-00208",
+                             "%s(): pRegion[%d] extent height (%d) must be a multiple of the compressed texture block height "
+                             "(%d), or when added to offset.y (%d) must equal the image subresource height (%d)..",
+                             function, i, pRegions[i].imageExtent.height, block_size.height, pRegions[i].imageOffset.y,
+                             image_extent.height);
+        }
 
-            // imageExtent depth must be a multiple of block depth, or extent+offset depth must equal subresource depth
-            if ((SafeModulo(pRegions[i].imageExtent.depth, block_size.depth) != 0) &&
-                (pRegions[i].imageExtent.depth + pRegions[i].imageOffset.z != mip_extent.depth)) {
-                skip |= LogError(image_state->image, "VUID-VkBufferImageCopy-imageExtent-00209",
-                                 "%s(): pRegion[%d] extent width (%d) must be a multiple of the compressed texture block depth "
-                                 "(%d), or when added to offset.z (%d) must equal the image subresource depth (%d)..",
-                                 function, i, pRegions[i].imageExtent.depth, block_size.depth, pRegions[i].imageOffset.z,
-                                 mip_extent.depth);
-            }
+        if (violations & kBlockDepth) {
+            skip |= LogError(image_state->image, "VUID-VkBufferImageCopy-imageExtent-00209",
+                             "%s(): pRegion[%d] extent width (%d) must be a multiple of the compressed texture block depth "
+                             "(%d), or when added to offset.z (%d) must equal the image subresource depth (%d)..",
+                             function, i, pRegions[i].imageExtent.depth, block_size.depth, pRegions[i].imageOffset.z,
+                             image_extent.depth);
         }
 
-        // Checks that apply only to multi-planar format images
-        if (FormatIsMultiplane(image_state->createInfo.format)) {
-            // VK_IMAGE_ASPECT_PLANE_2_BIT valid only for image formats with three planes
-            if ((FormatPlaneCount(image_state->createInfo.format) < 3) &&
-                (pRegions[i].imageSubresource.aspectMask == VK_IMAGE_ASPECT_PLANE_2_BIT)) {
-                skip |= LogError(image_state->image, "VUID-VkBufferImageCopy-aspectMask-01560",
-                                 "%s(): pRegion[%d] subresource aspectMask cannot be VK_IMAGE_ASPECT_PLANE_2_BIT unless image "
-                                 "format has three planes.",
-                                 function, i);
-            }
+        if (violations & kPlane2) {
+            skip |= LogError(image_state->image, "VUID-VkBufferImageCopy-aspectMask-01560",
+                             "%s(): pRegion[%d] subresource aspectMask cannot be VK_IMAGE_ASPECT_PLANE_2_BIT unless image "
+                             "format has three planes.",
+                             function, i);
+        }
 
-            // image subresource aspectMask must be VK_IMAGE_ASPECT_PLANE_*_BIT
-            if (0 == (pRegions[i].imageSubresource.aspectMask &
-                      (VK_IMAGE_ASPECT_PLANE_0_BIT | VK_IMAGE_ASPECT_PLANE_1_BIT | VK_IMAGE_ASPECT_PLANE_2_BIT))) {
-                skip |= LogError(image_state->image, "VUID-VkBufferImageCopy-aspectMask-01560",
-                                 "%s(): pRegion[%d] subresource aspectMask for multi-plane image formats must have a "
-                                 "VK_IMAGE_ASPECT_PLANE_*_BIT when copying to or from.",
-                                 function, i);
-            }
+        if (violations & kPlaneAspect) {
+            skip |= LogError(image_state->image, "VUID-VkBufferImageCopy-aspectMask-01560",
+                             "%s(): pRegion[%d] subresource aspectMask for multi-plane image formats must have a "
+                             "VK_IMAGE_ASPECT_PLANE_*_BIT when copying to or from.",
+                             function, i);
         }
     }
 
@@ -5054,6 +5305,8 @@ bool CoreChecks::ValidateImageBounds(const IMAGE_STATE *image_state, const uint3
                                      const char *func_name, const char *msg_code) const {
     bool skip = false;
     const VkImageCreateInfo *image_info = &(image_state->createInfo);
+    const bool is_block_format = FormatIsCompressed(image_info->format) || FormatIsSinglePlane_422(image_info->format);
+    const auto block_extent = FormatTexelBlockExtent(image_info->format);
 
     for (uint32_t i = 0; i < regionCount; i++) {
         VkExtent3D extent = pRegions[i].imageExtent;
@@ -5069,8 +5322,7 @@ bool CoreChecks::ValidateImageBounds(const IMAGE_STATE *image_state, const uint3
         VkExtent3D image_extent = GetImageSubresourceExtent(image_state, &(pRegions[i].imageSubresource));
 
         // If we're using a compressed format, valid extent is rounded up to multiple of block size (per 18.1)
-        if (FormatIsCompressed(image_info->format) || FormatIsSinglePlane_422(image_state->createInfo.format)) {
-            auto block_extent = FormatTexelBlockExtent(image_info->format);
+        if (is_block_format) {
             if (image_extent.width % block_extent.width) {
                 image_extent.width += (block_extent.width - (image_extent.width % block_extent.width));
             }
@@ -5095,18 +5347,20 @@ bool CoreChecks::ValidateBufferBounds(const IMAGE_STATE *image_state, const BUFF
     bool skip = false;
 
     VkDeviceSize buffer_size = buff_state->createInfo.size;
+    const VkFormat image_format = image_state->createInfo.format;
+    const bool is_block_format = FormatIsCompressed(image_format) || FormatIsSinglePlane_422(image_format);
+    const auto block_dim = FormatTexelBlockExtent(image_format);
 
     for (uint32_t i = 0; i < regionCount; i++) {
         VkExtent3D copy_extent = pRegions[i].imageExtent;
 
         VkDeviceSize buffer_width = (0 == pRegions[i].bufferRowLength ? copy_extent.width : pRegions[i].bufferRowLength);
         VkDeviceSize buffer_height = (0 == pRegions[i].bufferImageHeight ? copy_extent.height : pRegions[i].bufferImageHeight);
-        VkDeviceSize unit_size = FormatElementSize(image_state->createInfo.format,
-                                                   pRegions[i].imageSubresource.aspectMask);  // size (bytes) of texel or block
+        VkDeviceSize unit_size =
+            FormatElementSize(image_format, pRegions[i].imageSubresource.aspectMask);  // size (bytes) of texel or block
 
-        if (FormatIsCompressed(image_state->createInfo.format) || FormatIsSinglePlane_422(image_state->createInfo.format)) {
+        if (is_block_format) {
             // Switch to texel block units, rounding up for any partially-used blocks
-            auto block_dim = FormatTexelBlockExtent(image_state->createInfo.format);
             buffer_width = (buffer_width + block_dim.width - 1) / block_dim.width;
             buffer_height = (buffer_height + block_dim.height - 1) / block_dim.height;
 
@@ -782,11 +782,8 @@ static const char *string_VuidNotCompatibleForSet(CMD_TYPE cmd_type) {
 bool CoreChecks::ValidateCmdBufDrawState(const CMD_BUFFER_STATE *cb_node, CMD_TYPE cmd_type, const bool indexed,
                                          const VkPipelineBindPoint bind_point, const char *function, const char *pipe_err_code,
                                          const char *state_err_code, const char *vtx_binding_err_code) const {
-    const auto last_bound_it = cb_node->lastBound.find(bind_point);
-    const PIPELINE_STATE *pPipe = nullptr;
-    if (last_bound_it != cb_node->lastBound.cend()) {
-        pPipe = last_bound_it->second.pipeline_state;
-    }
+    auto const &state = cb_node->lastBound[ConvertToLvlBindPoint(bind_point)];
+    const PIPELINE_STATE *pPipe = state.pipeline_state;
 
     if (nullptr == pPipe) {
         return LogError(cb_node->commandBuffer, pipe_err_code,
@@ -795,7 +792,6 @@ bool CoreChecks::ValidateCmdBufDrawState(const CMD_BUFFER_STATE *cb_node, CMD_TY
     }
 
     bool result = false;
-    auto const &state = last_bound_it->second;
 
     // First check flag states
     if (VK_PIPELINE_BIND_POINT_GRAPHICS == bind_point) result = ValidateDrawStateFlags(cb_node, pPipe, indexed, state_err_code);
@@ -870,7 +866,7 @@ bool CoreChecks::ValidateCmdBufDrawState(const CMD_BUFFER_STATE *cb_node, CMD_TY
                         std::set_difference(binding_req_map.begin(), binding_req_map.end(),
                                             state.per_set[setIndex].validated_set_binding_req_map.begin(),
                                             state.per_set[setIndex].validated_set_binding_req_map.end(),
-                                            std::inserter(delta_reqs, delta_reqs.begin()));
+                                            std::back_inserter(delta_reqs));
                         success = ValidateDrawState(descriptor_set, delta_reqs, state.per_set[setIndex].dynamicOffsets, cb_node,
                                                     function, &err_str);
                     } else {
@@ -1427,7 +1423,7 @@ bool CoreChecks::ValidateIdleDescriptorSet(VkDescriptorSet set, const char *func
                          report_data->FormatHandle(set).c_str());
     } else {
         // TODO : This covers various error cases so should pass error enum into this function and use passed in enum here
-        if (set_node->second->in_use.load()) {
+        if (set_node->second->InUse()) {
             skip |= LogError(set, "VUID-vkFreeDescriptorSets-pDescriptorSets-00309",
                              "Cannot call %s() on %s that is in use by a command buffer.", func_str,
                              report_data->FormatHandle(set).c_str());
@@ -2032,17 +2028,14 @@ void CoreChecks::PostCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount,
         }
     }
 }
-bool CoreChecks::ValidateSemaphoresForSubmit(VkQueue queue, const VkSubmitInfo *submit,
-                                             unordered_set<VkSemaphore> *unsignaled_sema_arg,
-                                             unordered_set<VkSemaphore> *signaled_sema_arg,
-                                             unordered_set<VkSemaphore> *internal_sema_arg,
-                                             unordered_map<VkSemaphore, std::set<uint64_t>> *timeline_values_arg) const {
+bool CoreChecks::ValidateSemaphoresForSubmit(VkQueue queue, const VkSubmitInfo *submit, SubmitSemaphoreSet *unsignaled_sema_arg,
+                                             SubmitSemaphoreSet *signaled_sema_arg, SubmitSemaphoreSet *internal_sema_arg,
+                                             SubmitTimelineValueMap *timeline_values_arg) const {
     bool skip = false;
     auto &signaled_semaphores = *signaled_sema_arg;
     auto &unsignaled_semaphores = *unsignaled_sema_arg;
     auto &internal_semaphores = *internal_sema_arg;
     auto &timeline_values = *timeline_values_arg;
-    unordered_map<VkSemaphore, std::set<uint64_t>>::iterator it;
     auto *timeline_semaphore_submit_info = lvl_find_in_chain<VkTimelineSemaphoreSubmitInfoKHR>(submit->pNext);
 
     for (uint32_t i = 0; i < submit->waitSemaphoreCount; ++i) {
@@ -2137,8 +2130,8 @@ bool CoreChecks::ValidateSemaphoresForSubmit(VkQueue queue, const VkSubmitInfo *
 }
 
 bool CoreChecks::ValidateMaxTimelineSemaphoreValueDifference(VkQueue queue, VkSemaphore semaphore, uint64_t semaphoreTriggerValue,
-                                                             unordered_map<VkSemaphore, std::set<uint64_t>> *timeline_values_arg,
-                                                             const char *func_name, const char *vuid) const {
+                                                             SubmitTimelineValueMap *timeline_values_arg, const char *func_name,
+                                                             const char *vuid) const {
     bool skip = false;
 
     auto &timeline_values = *timeline_values_arg;
@@ -2154,7 +2147,7 @@ bool CoreChecks::ValidateMaxTimelineSemaphoreValueDifference(VkQueue queue, VkSe
         // than allowed
         auto it = values.find(semaphoreTriggerValue);
 
-        if (it == begin(values)) {
+        if (it == values.begin()) {
             return false;
         }
 
@@ -2169,14 +2162,12 @@ bool CoreChecks::ValidateMaxTimelineSemaphoreValueDifference(VkQueue queue, VkSe
     return skip;
 }
 
-bool CoreChecks::ValidateCommandBuffersForSubmit(VkQueue queue, const VkSubmitInfo *submit,
-                                                 GlobalImageLayoutMap *overlayImageLayoutMap_arg,
+bool CoreChecks::ValidateCommandBuffersForSubmit(VkQueue queue, const VkSubmitInfo *submit, SubmitImageLayoutOverlay *overlay_arg,
                                                  QueryMap *local_query_to_state_map,
                                                  vector<VkCommandBuffer> *current_cmds_arg) const {
     bool skip = false;
     auto queue_state = GetQueueState(queue);
 
-    GlobalImageLayoutMap &overlayLayoutMap = *overlayImageLayoutMap_arg;
     vector<VkCommandBuffer> &current_cmds = *current_cmds_arg;
 
     QFOTransferCBScoreboards<VkImageMemoryBarrier> qfo_image_scoreboards;
@@ -2188,7 +2179,7 @@ bool CoreChecks::ValidateCommandBuffersForSubmit(VkQueue queue, const VkSubmitIn
     for (uint32_t i = 0; i < submit->commandBufferCount; i++) {
         const auto *cb_node = GetCBState(submit->pCommandBuffers[i]);
         if (cb_node) {
-            skip |= ValidateCmdBufImageLayouts(cb_node, imageLayoutMap, &overlayLayoutMap);
+            skip |= ValidateCmdBufImageLayouts(cb_node, imageLayoutMap, overlay_arg);
             current_cmds.push_back(submit->pCommandBuffers[i]);
             skip |= ValidatePrimaryCommandBufferState(
                 cb_node, (int)std::count(current_cmds.begin(), current_cmds.end(), submit->pCommandBuffers[i]),
@@ -2245,12 +2236,12 @@ bool CoreChecks::PreCallValidateQueueSubmit(VkQueue queue, uint32_t submitCount,
         return true;
     }
 
-    unordered_set<VkSemaphore> signaled_semaphores;
-    unordered_set<VkSemaphore> unsignaled_semaphores;
-    unordered_set<VkSemaphore> internal_semaphores;
-    unordered_map<VkSemaphore, std::set<uint64_t>> timeline_values;
+    SubmitSemaphoreSet signaled_semaphores;
+    SubmitSemaphoreSet unsignaled_semaphores;
+    SubmitSemaphoreSet internal_semaphores;
+    SubmitTimelineValueMap timeline_values;
     vector<VkCommandBuffer> current_cmds;
-    GlobalImageLayoutMap overlayImageLayoutMap;
+    SubmitImageLayoutOverlay image_layout_overlay;
     QueryMap local_query_to_state_map;
 
     // Now verify each individual submit
@@ -2258,7 +2249,7 @@ bool CoreChecks::PreCallValidateQueueSubmit(VkQueue queue, uint32_t submitCount,
         const VkSubmitInfo *submit = &pSubmits[submit_idx];
         skip |= ValidateSemaphoresForSubmit(queue, submit, &unsignaled_semaphores, &signaled_semaphores, &internal_semaphores,
                                             &timeline_values);
-        skip |= ValidateCommandBuffersForSubmit(queue, submit, &overlayImageLayoutMap, &local_query_to_state_map, &current_cmds);
+        skip |= ValidateCommandBuffersForSubmit(queue, submit, &image_layout_overlay, &local_query_to_state_map, &current_cmds);
 
         auto chained_device_group_struct = lvl_find_in_chain<VkDeviceGroupSubmitInfo>(submit->pNext);
         if (chained_device_group_struct && chained_device_group_struct->commandBufferCount > 0) {
@@ -2848,7 +2839,7 @@ bool CoreChecks::ValidateObjectNotInUse(const BASE_NODE *obj_node, const VulkanT
                                         const char *error_code) const {
     if (disabled.object_in_use) return false;
     bool skip = false;
-    if (obj_node->in_use.load()) {
+    if (obj_node->InUse()) {
         skip |= LogError(device, error_code, "Cannot call %s on %s that is currently in use by a command buffer.", caller_name,
                          report_data->FormatHandle(obj_struct).c_str());
     }
@@ -4386,7 +4377,7 @@ bool CoreChecks::PreCallValidateResetDescriptorPool(VkDevice device, VkDescripto
     const DESCRIPTOR_POOL_STATE *pPool = GetDescriptorPoolState(descriptorPool);
     if (pPool != nullptr) {
         for (auto ds : pPool->sets) {
-            if (ds && ds->in_use.load()) {
+            if (ds && ds->InUse()) {
                 skip |= LogError(descriptorPool, "VUID-vkResetDescriptorPool-descriptorPool-00313",
                                  "It is invalid to call vkResetDescriptorPool() with descriptor sets in use by a command buffer.");
                 if (skip) break;
@@ -7394,17 +7385,6 @@ bool CoreChecks::CheckPreserved(const VkRenderPass renderpass, const VkRenderPas
     return result;
 }
 
-template <class T>
-bool IsRangeOverlapping(T offset1, T size1, T offset2, T size2) {
-    return (((offset1 + size1) > offset2) && ((offset1 + size1) < (offset2 + size2))) ||
-           ((offset1 > offset2) && (offset1 < (offset2 + size2)));
-}
-
-bool IsRegionOverlapping(VkImageSubresourceRange range1, VkImageSubresourceRange range2) {
-    return (IsRangeOverlapping(range1.baseMipLevel, range1.levelCount, range2.baseMipLevel, range2.levelCount) &&
-            IsRangeOverlapping(range1.baseArrayLayer, range1.layerCount, range2.baseArrayLayer, range2.layerCount));
-}
-
 bool CoreChecks::ValidateDependencies(FRAMEBUFFER_STATE const *framebuffer, RENDER_PASS_STATE const *renderPass) const {
     bool skip = false;
     auto const pFramebufferInfo = framebuffer->createInfo.ptr();
@@ -7420,40 +7400,12 @@ bool CoreChecks::ValidateDependencies(FRAMEBUFFER_STATE const *framebuffer, REND
     std::vector<Attachment> attachments(pCreateInfo->attachmentCount);
 
     if (!(pFramebufferInfo->flags & VK_FRAMEBUFFER_CREATE_IMAGELESS_BIT)) {
-        // Find overlapping attachments
-        for (uint32_t i = 0; i < pCreateInfo->attachmentCount; ++i) {
-            for (uint32_t j = i + 1; j < pCreateInfo->attachmentCount; ++j) {
-                VkImageView viewi = pFramebufferInfo->pAttachments[i];
-                VkImageView viewj = pFramebufferInfo->pAttachments[j];
-                if (viewi == viewj) {
-                    attachments[i].overlapping.emplace_back(j);
-                    attachments[j].overlapping.emplace_back(i);
-                    continue;
-                }
-                auto view_state_i = GetImageViewState(viewi);
-                auto view_state_j = GetImageViewState(viewj);
-                if (!view_state_i || !view_state_j) {
-                    continue;
-                }
-                auto view_ci_i = view_state_i->create_info;
-                auto view_ci_j = view_state_j->create_info;
-                if (view_ci_i.image == view_ci_j.image &&
-                    IsRegionOverlapping(view_ci_i.subresourceRange, view_ci_j.subresourceRange)) {
-                    attachments[i].overlapping.emplace_back(j);
-                    attachments[j].overlapping.emplace_back(i);
-                    continue;
-                }
-                auto image_data_i = GetImageState(view_ci_i.image);
-                auto image_data_j = GetImageState(view_ci_j.image);
-                if (!image_data_i || !image_data_j) {
-                    continue;
-                }
-                if (image_data_i->binding.mem_state == image_data_j->binding.mem_state &&
-                    IsRangeOverlapping(image_data_i->binding.offset, image_data_i->binding.size, image_data_j->binding.offset,
-                                       image_data_j->binding.size)) {
-                    attachments[i].overlapping.emplace_back(j);
-                    attachments[j].overlapping.emplace_back(i);
-                }
+        // Overlapping attachments are found once when the framebuffer is created
+        const auto &overlaps = framebuffer->attachment_overlaps;
+        const uint32_t attachment_count = std::min(pCreateInfo->attachmentCount, static_cast<uint32_t>(overlaps.size()));
+        for (uint32_t i = 0; i < attachment_count; ++i) {
+            for (const auto j : overlaps[i]) {
+                if (j < pCreateInfo->attachmentCount) attachments[i].overlapping.emplace_back(j);
             }
         }
     }
@@ -9356,10 +9308,10 @@ bool CoreChecks::PreCallValidateQueueBindSparse(VkQueue queue, uint32_t bindInfo
             "Attempting vkQueueBindSparse on a non-memory-management capable queue -- VK_QUEUE_SPARSE_BINDING_BIT not set.");
     }
 
-    unordered_set<VkSemaphore> signaled_semaphores;
-    unordered_set<VkSemaphore> unsignaled_semaphores;
-    unordered_set<VkSemaphore> internal_semaphores;
-    unordered_map<VkSemaphore, std::set<uint64_t>> timeline_values;
+    SubmitSemaphoreSet signaled_semaphores;
+    SubmitSemaphoreSet unsignaled_semaphores;
+    SubmitSemaphoreSet internal_semaphores;
+    SubmitTimelineValueMap timeline_values;
     for (uint32_t bindIdx = 0; bindIdx < bindInfoCount; ++bindIdx) {
         const VkBindSparseInfo &bindInfo = pBindInfo[bindIdx];
 
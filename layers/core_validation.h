@@ -56,15 +56,13 @@ class CoreChecks : public ValidationStateTracker {
     bool ValidImageBufferQueue(const CMD_BUFFER_STATE* cb_node, const VulkanTypedHandle& object, uint32_t queueFamilyIndex,
                                uint32_t count, const uint32_t* indices) const;
     bool ValidateFenceForSubmit(const FENCE_STATE* pFence) const;
-    bool ValidateSemaphoresForSubmit(VkQueue queue, const VkSubmitInfo* submit,
-                                     std::unordered_set<VkSemaphore>* unsignaled_sema_arg,
-                                     std::unordered_set<VkSemaphore>* signaled_sema_arg,
-                                     std::unordered_set<VkSemaphore>* internal_sema_arg,
-                                     unordered_map<VkSemaphore, std::set<uint64_t>>* timeline_values_arg) const;
+    bool ValidateSemaphoresForSubmit(VkQueue queue, const VkSubmitInfo* submit, SubmitSemaphoreSet* unsignaled_sema_arg,
+                                     SubmitSemaphoreSet* signaled_sema_arg, SubmitSemaphoreSet* internal_sema_arg,
+                                     SubmitTimelineValueMap* timeline_values_arg) const;
     bool ValidateMaxTimelineSemaphoreValueDifference(VkQueue queue, VkSemaphore semaphore, const uint64_t semaphoreHandleValue,
-                                                     unordered_map<VkSemaphore, std::set<uint64_t>>* timeline_values_arg,
-                                                     const char* func_name, const char* vuid) const;
-    bool ValidateCommandBuffersForSubmit(VkQueue queue, const VkSubmitInfo* submit, GlobalImageLayoutMap* localImageLayoutMap_arg,
+                                                     SubmitTimelineValueMap* timeline_values_arg, const char* func_name,
+                                                     const char* vuid) const;
+    bool ValidateCommandBuffersForSubmit(VkQueue queue, const VkSubmitInfo* submit, SubmitImageLayoutOverlay* overlay_arg,
                                          QueryMap* local_query_to_state_map, std::vector<VkCommandBuffer>* current_cmds_arg) const;
     bool ValidateStatus(const CMD_BUFFER_STATE* pNode, CBStatusFlags status_mask, const char* fail_msg, const char* msg_code) const;
     bool ValidateDrawStateFlags(const CMD_BUFFER_STATE* pCB, const PIPELINE_STATE* pPipe, bool indexed, const char* msg_code) const;
@@ -304,7 +302,7 @@ class CoreChecks : public ValidationStateTracker {
     VkResult CoreLayerGetValidationCacheDataEXT(VkDevice device, VkValidationCacheEXT validationCache, size_t* pDataSize,
                                                 void* pData);
     // For given bindings validate state at time of draw is correct, returning false on error and writing error details into string*
-    bool ValidateDrawState(const cvdescriptorset::DescriptorSet* descriptor_set, const std::map<uint32_t, descriptor_req>& bindings,
+    bool ValidateDrawState(const cvdescriptorset::DescriptorSet* descriptor_set, const BindingReqMap& bindings,
                            const std::vector<uint32_t>& dynamic_offsets, const CMD_BUFFER_STATE* cb_node, const char* caller,
                            std::string* error) const;
     bool ValidateDescriptorSetBindingData(const CMD_BUFFER_STATE* cb_node, const cvdescriptorset::DescriptorSet* descriptor_set,
@@ -543,7 +541,7 @@ class CoreChecks : public ValidationStateTracker {
                                    VkFilter filter);
 
     bool ValidateCmdBufImageLayouts(const CMD_BUFFER_STATE* pCB, const GlobalImageLayoutMap& globalImageLayoutMap,
-                                    GlobalImageLayoutMap* overlayLayoutMap_arg) const;
+                                    SubmitImageLayoutOverlay* overlay_arg) const;
 
     void UpdateCmdBufImageLayouts(CMD_BUFFER_STATE* pCB);
 
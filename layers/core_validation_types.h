@@ -38,6 +38,7 @@
 #include "layer_chassis_dispatch.h"
 #include "image_layout_map.h"
 
+#include <algorithm>
 #include <array>
 #include <atomic>
 #include <functional>
@@ -79,7 +80,8 @@ enum CALL_STATE {
 
 class BASE_NODE {
   public:
-    // Track when object is being used by an in-flight command buffer
+    // Count of in-flight submissions that reference this object directly: command buffers and semaphores.
+    // Objects bound to a command buffer are not counted here, see InUse().
     std::atomic_int in_use;
     // Track command buffers that this object is bound to
     //  binding initialized when cmd referencing object is bound to command buffer
@@ -96,6 +98,10 @@ class BASE_NODE {
         in_use.store(0);
         destroyed = false;
     };
+
+    // True while this object is referenced by pending work. Objects bound to command buffers are in use while any of
+    // those command buffers is in flight, so submit and retire only touch the command buffers, not everything they bind.
+    bool InUse() const;
 };
 
 // Track command pools and their command buffers
@@ -163,7 +169,19 @@ enum descriptor_req {
 
 extern unsigned DescriptorRequirementsBitsFromFormat(VkFormat fmt);
 
-typedef std::map<uint32_t, descriptor_req> BindingReqMap;
+// Requirements for each binding used from a descriptor set, kept sorted by binding number. A flat vector keeps the
+// std::includes and std::set_difference checks made on every draw contiguous and allocation free.
+typedef std::vector<std::pair<uint32_t, descriptor_req>> BindingReqMap;
+
+// Returns the requirements for the binding, inserting an empty entry in sorted position if it isn't present
+static inline descriptor_req &FindOrInsertBindingReq(BindingReqMap *reqs, uint32_t binding) {
+    auto it = std::lower_bound(reqs->begin(), reqs->end(), binding,
+                               [](const BindingReqMap::value_type &entry, uint32_t key) { return entry.first < key; });
+    if (it == reqs->end() || it->first != binding) {
+        it = reqs->emplace(it, binding, descriptor_req(0));
+    }
+    return it->second;
+}
 
 struct DESCRIPTOR_POOL_STATE : BASE_NODE {
     VkDescriptorPool pool;
@@ -827,6 +845,23 @@ class PIPELINE_STATE : public BASE_NODE {
     }
 };
 
+// Index of each pipeline bind point's state in CMD_BUFFER_STATE::lastBound
+enum LvlBindPoint { BindPoint_Graphics = 0, BindPoint_Compute = 1, BindPoint_Ray_Tracing = 2, BindPoint_Count = 3 };
+
+static inline LvlBindPoint ConvertToLvlBindPoint(VkPipelineBindPoint bind_point) {
+    switch (bind_point) {
+        case VK_PIPELINE_BIND_POINT_GRAPHICS:
+            return BindPoint_Graphics;
+        case VK_PIPELINE_BIND_POINT_COMPUTE:
+            return BindPoint_Compute;
+        case VK_PIPELINE_BIND_POINT_RAY_TRACING_NV:
+            return BindPoint_Ray_Tracing;
+        default:
+            assert(0);
+            return BindPoint_Graphics;
+    }
+}
+
 // Track last states that are bound per pipeline bind point (Gfx & Compute)
 struct LAST_BOUND_STATE {
     LAST_BOUND_STATE() { reset(); }  // must define default constructor for portability reasons
@@ -845,7 +880,7 @@ struct LAST_BOUND_STATE {
               validated_set_binding_req_map() {}
 
         cvdescriptorset::DescriptorSet *bound_descriptor_set;
-        // one dynamic offset per dynamic descriptor bound to this CB
+        // one dynamic offset per dynamic descriptor bound to this CB, reassigned in place so rebinding reuses the storage
         std::vector<uint32_t> dynamicOffsets;
         PipelineLayoutCompatId compat_id_for_set;
 
@@ -1020,10 +1055,36 @@ struct QFOTransferCBScoreboards {
 typedef std::map<QueryObject, QueryState> QueryMap;
 typedef std::map<QueryObjectPass, QueryState> QueryPassMap;
 typedef std::unordered_map<VkEvent, VkPipelineStageFlags> EventToStageMap;
+
+// Semaphore state local to a single vkQueueSubmit or vkQueueBindSparse call. Submits rarely reference more than a few
+// semaphores, so these stay inline and only fall back to hashed containers for large batches.
+static const int kSubmitSemaphoreInlineCount = 4;
+typedef small_unordered_set<VkSemaphore, kSubmitSemaphoreInlineCount> SubmitSemaphoreSet;
+// Current payload of each timeline semaphore plus the values it is waited on or signaled with, in order
+typedef small_unordered_map<VkSemaphore, small_flat_set<uint64_t, kSubmitSemaphoreInlineCount>, kSubmitSemaphoreInlineCount>
+    SubmitTimelineValueMap;
 typedef ImageSubresourceLayoutMap::LayoutMap GlobalImageLayoutRangeMap;
 typedef std::unordered_map<VkImage, std::unique_ptr<GlobalImageLayoutRangeMap>> GlobalImageLayoutMap;
 typedef std::unordered_map<VkImage, std::unique_ptr<ImageSubresourceLayoutMap>> CommandBufferImageLayoutMap;
 
+// Layout changes made by the command buffers already validated in a queue submission, layered over the global layout map.
+// An image changed by a single command buffer refers to that command buffer's current layout map rather than a copy, so only
+// images changed by more than one command buffer in the same submission are ever merged into a map of their own.
+class SubmitImageLayoutOverlay {
+  public:
+    // Layouts set earlier in the submission, or nullptr if no earlier command buffer changed the image
+    const GlobalImageLayoutRangeMap *Get(VkImage image) const;
+    // The referenced map must outlive the overlay
+    void Push(const IMAGE_STATE &image_state, const GlobalImageLayoutRangeMap &current_layouts);
+
+  private:
+    struct Layer {
+        const GlobalImageLayoutRangeMap *single = nullptr;
+        std::unique_ptr<GlobalImageLayoutRangeMap> merged;
+    };
+    std::unordered_map<VkImage, Layer> layers_;
+};
+
 // Cmd Buffer Wrapper Struct - TODO : This desperately needs its own class
 struct CMD_BUFFER_STATE : public BASE_NODE {
     VkCommandBuffer commandBuffer;
@@ -1048,8 +1109,8 @@ struct CMD_BUFFER_STATE : public BASE_NODE {
     // Currently storing "lastBound" objects on per-CB basis
     //  long-term may want to create caches of "lastBound" states and could have
     //  each individual CMD_NODE referencing its own "lastBound" state
-    // Store last bound state for Gfx & Compute pipeline bind points
-    std::map<uint32_t, LAST_BOUND_STATE> lastBound;
+    // Store last bound state for each pipeline bind point, indexed by ConvertToLvlBindPoint()
+    std::array<LAST_BOUND_STATE, BindPoint_Count> lastBound;
 
     using Bindings = std::map<uint32_t, descriptor_req>;
     using Pipelines_Bindings = std::map<VkPipeline, Bindings>;
@@ -1112,6 +1173,14 @@ struct CMD_BUFFER_STATE : public BASE_NODE {
     uint32_t small_indexed_draw_call_count;
 };
 
+inline bool BASE_NODE::InUse() const {
+    if (in_use.load()) return true;
+    for (const auto &cb_binding : cb_bindings) {
+        if (cb_binding.first->in_use.load()) return true;
+    }
+    return false;
+}
+
 static inline const QFOTransferBarrierSets<VkImageMemoryBarrier> &GetQFOBarrierSets(
     const CMD_BUFFER_STATE *cb, const QFOTransferBarrier<VkImageMemoryBarrier>::Tag &type_tag) {
     return cb->qfo_transfer_image_barriers;
@@ -1170,6 +1239,8 @@ class FRAMEBUFFER_STATE : public BASE_NODE {
     VkFramebuffer framebuffer;
     safe_VkFramebufferCreateInfo createInfo;
     std::shared_ptr<const RENDER_PASS_STATE> rp_state;
+    // For each attachment, the ascending indices of the other attachments that alias it
+    std::vector<std::vector<uint32_t>> attachment_overlaps;
     FRAMEBUFFER_STATE(VkFramebuffer fb, const VkFramebufferCreateInfo *pCreateInfo, std::shared_ptr<RENDER_PASS_STATE> &&rpstate)
         : framebuffer(fb), createInfo(pCreateInfo), rp_state(rpstate){};
 };
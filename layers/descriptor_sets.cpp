@@ -564,6 +564,37 @@ bool cvdescriptorset::ValidateDescriptorSetLayoutCreateInfo(
 cvdescriptorset::AllocateDescriptorSetsData::AllocateDescriptorSetsData(uint32_t count)
     : required_descriptors_by_type{}, layout_nodes(count, nullptr) {}
 
+// Construct an unwritten descriptor of the given type in store.  Only valid for bindings without immutable samplers.
+static cvdescriptorset::Descriptor *ConstructDescriptor(cvdescriptorset::DescriptorBackingStore *store, VkDescriptorType type,
+                                                        const ValidationStateTracker *state_data) {
+    using namespace cvdescriptorset;
+    switch (type) {
+        case VK_DESCRIPTOR_TYPE_SAMPLER:
+            return new (store->Sampler()) SamplerDescriptor(state_data, nullptr);
+        case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+            return new (store->ImageSampler()) ImageSamplerDescriptor(state_data, nullptr);
+        case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+        case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+        case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+            return new (store->Image()) ImageDescriptor(type);
+        case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+        case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+            return new (store->Texel()) TexelDescriptor(type);
+        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
+            return new (store->Buffer()) BufferDescriptor(type);
+        case VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK_EXT:
+            return new (store->InlineUniform()) InlineUniformDescriptor(type);
+        case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_NV:
+            return new (store->AccelerationStructure()) AccelerationStructureDescriptor(type);
+        default:
+            assert(0);  // Bad descriptor type specified
+            return nullptr;
+    }
+}
+
 cvdescriptorset::DescriptorSet::DescriptorSet(const VkDescriptorSet set, DESCRIPTOR_POOL_STATE *pool_state,
                                               const std::shared_ptr<DescriptorSetLayout const> &layout, uint32_t variable_count,
                                               const cvdescriptorset::DescriptorSet::StateTracker *state_data)
@@ -574,12 +605,29 @@ cvdescriptorset::DescriptorSet::DescriptorSet(const VkDescriptorSet set, DESCRIP
       state_data_(state_data),
       variable_count_(variable_count),
       change_count_(0) {
+    // Large bindings only get a single unwritten descriptor up front, see MaterializeDescriptor
+    auto is_lazy = [this](uint32_t index) {
+        return p_layout_->GetDescriptorCountFromIndex(index) >= kLazyDescriptorThreshold &&
+               p_layout_->GetTypeFromIndex(index) != VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK_EXT &&
+               !p_layout_->GetImmutableSamplerPtrFromIndex(index);
+    };
+    uint32_t store_count = 0;
+    for (uint32_t i = 0; i < p_layout_->GetBindingCount(); ++i) {
+        store_count += is_lazy(i) ? 1 : p_layout_->GetDescriptorCountFromIndex(i);
+    }
+
     // Foreach binding, create default descriptors of given type
     descriptors_.reserve(p_layout_->GetTotalDescriptorCount());
-    descriptor_store_.resize(p_layout_->GetTotalDescriptorCount());
+    descriptor_store_.resize(store_count);
     auto free_descriptor = descriptor_store_.data();
     for (uint32_t i = 0; i < p_layout_->GetBindingCount(); ++i) {
         auto type = p_layout_->GetTypeFromIndex(i);
+        if (is_lazy(i)) {
+            unwritten_descriptors_.emplace_back(ConstructDescriptor(free_descriptor++, type, state_data));
+            lazy_bindings_.push_back({p_layout_->GetGlobalIndexRangeFromIndex(i), type, unwritten_descriptors_.back().get()});
+            descriptors_.resize(descriptors_.size() + p_layout_->GetDescriptorCountFromIndex(i));
+            continue;
+        }
         switch (type) {
             case VK_DESCRIPTOR_TYPE_SAMPLER: {
                 auto immut_sampler = p_layout_->GetImmutableSamplerPtrFromIndex(i);
@@ -643,6 +691,38 @@ cvdescriptorset::DescriptorSet::DescriptorSet(const VkDescriptorSet set, DESCRIP
 
 cvdescriptorset::DescriptorSet::~DescriptorSet() {}
 
+const cvdescriptorset::DescriptorSet::LazyBinding &cvdescriptorset::DescriptorSet::GetLazyBinding(uint32_t index) const {
+    // Only lazy bindings have null descriptors, so one of them must contain index
+    auto it = std::upper_bound(lazy_bindings_.cbegin(), lazy_bindings_.cend(), index,
+                               [](uint32_t value, const LazyBinding &binding) { return value < binding.global_range.end; });
+    assert(it != lazy_bindings_.cend() && it->global_range.start <= index);
+    return *it;
+}
+
+const cvdescriptorset::Descriptor *cvdescriptorset::DescriptorSet::GetUnwrittenDescriptor(uint32_t index) const {
+    return GetLazyBinding(index).unwritten;
+}
+
+cvdescriptorset::Descriptor *cvdescriptorset::DescriptorSet::MaterializeDescriptor(uint32_t index) {
+    auto &descriptor = descriptors_[index];
+    if (descriptor) {
+        return descriptor.get();
+    }
+    const auto &lazy_binding = GetLazyBinding(index);
+    const auto &range = lazy_binding.global_range;
+    const uint32_t page_start = range.start + ((index - range.start) / kLazyDescriptorPageSize) * kLazyDescriptorPageSize;
+    uint32_t page_end = page_start + kLazyDescriptorPageSize;
+    if (page_end > range.end) {
+        page_end = range.end;
+    }
+    std::unique_ptr<DescriptorBackingStore[]> page(new DescriptorBackingStore[page_end - page_start]);
+    for (uint32_t i = page_start; i < page_end; ++i) {
+        descriptors_[i].reset(ConstructDescriptor(&page[i - page_start], lazy_binding.type, state_data_));
+    }
+    lazy_pages_.emplace_back(std::move(page));
+    return descriptor.get();
+}
+
 static std::string StringDescriptorReqViewType(descriptor_req req) {
     std::string result("");
     for (unsigned i = 0; i <= VK_IMAGE_VIEW_TYPE_CUBE_ARRAY; i++) {
@@ -677,7 +757,7 @@ unsigned DescriptorRequirementsBitsFromFormat(VkFormat fmt) {
 //  This includes validating that all descriptors in the given bindings are updated,
 //  that any update buffers are valid, and that any dynamic offsets are within the bounds of their buffers.
 // Return true if state is acceptable, or false and write an error message into error string
-bool CoreChecks::ValidateDrawState(const DescriptorSet *descriptor_set, const std::map<uint32_t, descriptor_req> &bindings,
+bool CoreChecks::ValidateDrawState(const DescriptorSet *descriptor_set, const BindingReqMap &bindings,
                                    const std::vector<uint32_t> &dynamic_offsets, const CMD_BUFFER_STATE *cb_node,
                                    const char *caller, std::string *error) const {
     for (auto binding_pair : bindings) {
@@ -980,7 +1060,7 @@ void cvdescriptorset::DescriptorSet::PerformWriteUpdate(ValidationStateTracker *
         // Loop over the updates for a single binding at a time
         uint32_t update_count = std::min(descriptors_remaining, current_binding.GetDescriptorCount() - offset);
         for (uint32_t di = 0; di < update_count; ++di, ++update_index) {
-            descriptors_[global_idx + di]->WriteUpdate(state_data_, update, update_index);
+            MaterializeDescriptor(global_idx + di)->WriteUpdate(state_data_, update, update_index);
         }
         // Roll over to next binding in case of consecutive update
         descriptors_remaining -= update_count;
@@ -1047,7 +1127,7 @@ bool CoreChecks::ValidateCopyUpdate(const VkCopyDescriptorSet *update, const Des
         return false;
     }
     // Verify idle ds
-    if (dst_set->in_use.load() &&
+    if (dst_set->InUse() &&
         !(dst_layout->GetDescriptorBindingFlagsFromBinding(update->dstBinding) &
           (VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT_EXT | VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT_EXT))) {
         // TODO : Re-using Free Idle error code, need copy update idle error code
@@ -1211,14 +1291,14 @@ void cvdescriptorset::DescriptorSet::PerformCopyUpdate(ValidationStateTracker *d
     auto dst_start_idx = p_layout_->GetGlobalIndexRangeFromBinding(update->dstBinding).start + update->dstArrayElement;
     // Update parameters all look good so perform update
     for (uint32_t di = 0; di < update->descriptorCount; ++di) {
-        auto src = src_set->descriptors_[src_start_idx + di].get();
-        auto dst = descriptors_[dst_start_idx + di].get();
+        auto src = src_set->GetDescriptorFromGlobalIndex(src_start_idx + di);
         if (src->updated) {
-            dst->CopyUpdate(state_data_, src);
+            MaterializeDescriptor(dst_start_idx + di)->CopyUpdate(state_data_, src);
             some_update_ = true;
             change_count_++;
-        } else {
-            dst->updated = false;
+        } else if (descriptors_[dst_start_idx + di]) {
+            // A descriptor that was never materialized is already unwritten
+            descriptors_[dst_start_idx + di]->updated = false;
         }
     }
 
@@ -1236,8 +1316,7 @@ void cvdescriptorset::DescriptorSet::PerformCopyUpdate(ValidationStateTracker *d
 // Prereq: This should be called for a set that has been confirmed to be active for the given cb_node, meaning it's going
 //   to be used in a draw by the given cb_node
 void cvdescriptorset::DescriptorSet::UpdateDrawState(ValidationStateTracker *device_data, CMD_BUFFER_STATE *cb_node,
-                                                     const PIPELINE_STATE *pipe,
-                                                     const std::map<uint32_t, descriptor_req> &binding_req_map) {
+                                                     const PIPELINE_STATE *pipe, const BindingReqMap &binding_req_map) {
     if (!device_data->disabled.command_buffer_state) {
         // bind cb to this descriptor set
         // Add bindings for descriptor set, the set's pool, and individual objects in the set
@@ -1271,7 +1350,8 @@ void cvdescriptorset::DescriptorSet::UpdateDrawState(ValidationStateTracker *dev
         }
         auto range = p_layout_->GetGlobalIndexRangeFromIndex(index);
         for (uint32_t i = range.start; i < range.end; ++i) {
-            descriptors_[i]->UpdateDrawState(device_data, cb_node);
+            // Unwritten descriptors reference no resources
+            if (descriptors_[i]) descriptors_[i]->UpdateDrawState(device_data, cb_node);
         }
     }
 }
@@ -1280,7 +1360,7 @@ void cvdescriptorset::DescriptorSet::FilterOneBindingReq(const BindingReqMap::va
                                                          const TrackedBindings &bindings, uint32_t limit) {
     if (bindings.size() < limit) {
         const auto it = bindings.find(binding_req_pair.first);
-        if (it == bindings.cend()) out_req->emplace(binding_req_pair);
+        if (it == bindings.cend()) out_req->emplace_back(binding_req_pair);
     }
 }
 
@@ -1290,9 +1370,7 @@ void cvdescriptorset::DescriptorSet::FilterBindingReqs(const CMD_BUFFER_STATE &c
     const auto validated_it = cached_validation_.find(&cb_state);
     if (validated_it == cached_validation_.cend()) {
         // We have nothing validated, copy in to out
-        for (const auto &binding_req_pair : in_req) {
-            out_req->emplace(binding_req_pair);
-        }
+        *out_req = in_req;
         return;
     }
     const auto &validated = validated_it->second;
@@ -1330,7 +1408,7 @@ void cvdescriptorset::DescriptorSet::FilterBindingReqs(const CMD_BUFFER_STATE &c
                 }
             }
             if (stale) {
-                out_req->emplace(binding_req_pair);
+                out_req->emplace_back(binding_req_pair);
             }
         }
     }
@@ -2326,7 +2404,8 @@ bool CoreChecks::ValidateAllocateDescriptorSets(const VkDescriptorSetAllocateInf
 const BindingReqMap &cvdescriptorset::PrefilterBindRequestMap::FilteredMap(const CMD_BUFFER_STATE &cb_state,
                                                                            const PIPELINE_STATE &pipeline) {
     if (IsManyDescriptors()) {
-        filtered_map_.reset(new std::map<uint32_t, descriptor_req>());
+        filtered_map_.reset(new BindingReqMap());
+        filtered_map_->reserve(orig_map_.size());
         descriptor_set_.FilterBindingReqs(cb_state, pipeline, orig_map_, filtered_map_.get());
         return *filtered_map_;
     }
@@ -2426,7 +2505,7 @@ bool CoreChecks::ValidateWriteUpdate(const DescriptorSet *dest_set, const VkWrit
     }
 
     // Verify idle ds
-    if (dest_set->in_use.load() && !(dest.GetDescriptorBindingFlags() & (VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT_EXT |
+    if (dest_set->InUse() && !(dest.GetDescriptorBindingFlags() & (VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT_EXT |
                                                                          VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT_EXT))) {
         // TODO : Re-using Free Idle error code, need write update idle error code
         *error_code = "VUID-vkFreeDescriptorSets-pDescriptorSets-00309";
@@ -579,7 +579,11 @@ struct DecodedTemplateUpdate {
  *   index, binding, and global index.
  *
  * At construction a vector of Descriptor* is created with types corresponding to the
- *   layout. The primary operation performed on the descriptors is to update them
+ *   layout. Bindings of at least kLazyDescriptorThreshold descriptors (typically large
+ *   descriptor indexing arrays) are the exception: their entries start out null, reads
+ *   see a shared unwritten descriptor of the binding's type, and concrete descriptors are
+ *   only constructed, a page at a time, when a range is first written.
+ *   The primary operation performed on the descriptors is to update them
  *   via write or copy updates, and validate that the update contents are correct.
  *   In order to validate update contents, the DescriptorSet stores a bunch of ptrs
  *   to data maps where various Vulkan objects can be looked up. The management of
@@ -623,8 +627,7 @@ class DescriptorSet : public BASE_NODE {
     VkDescriptorSet GetSet() const { return set_; };
     // Bind given cmd_buffer to this descriptor set and
     // update CB image layout map with image/imagesampler descriptor image layouts
-    void UpdateDrawState(ValidationStateTracker *, CMD_BUFFER_STATE *, const PIPELINE_STATE *,
-                         const std::map<uint32_t, descriptor_req> &);
+    void UpdateDrawState(ValidationStateTracker *, CMD_BUFFER_STATE *, const PIPELINE_STATE *, const BindingReqMap &);
 
     // Track work that has been bound or validated to avoid duplicate work, important when large descriptor arrays
     // are present
@@ -661,7 +664,10 @@ class DescriptorSet : public BASE_NODE {
     }
     uint32_t GetVariableDescriptorCount() const { return variable_count_; }
     DESCRIPTOR_POOL_STATE *GetPoolState() const { return pool_state_; }
-    const Descriptor *GetDescriptorFromGlobalIndex(const uint32_t index) const { return descriptors_[index].get(); }
+    const Descriptor *GetDescriptorFromGlobalIndex(const uint32_t index) const {
+        const Descriptor *descriptor = descriptors_[index].get();
+        return descriptor ? descriptor : GetUnwrittenDescriptor(index);
+    }
     uint64_t GetChangeCount() const { return change_count_; }
 
     const std::vector<safe_VkWriteDescriptorSet> &GetWrites() const { return push_descriptor_set_writes; }
@@ -672,8 +678,21 @@ class DescriptorSet : public BASE_NODE {
     };
 
   private:
+    // Bindings with at least this many descriptors are materialized lazily, kLazyDescriptorPageSize descriptors at a time
+    static const uint32_t kLazyDescriptorThreshold = 1024;
+    static const uint32_t kLazyDescriptorPageSize = 64;
+    struct LazyBinding {
+        IndexRange global_range;
+        VkDescriptorType type;
+        const Descriptor *unwritten;  // Returned for every index of the binding that has not been materialized
+    };
+
     // Private helper to set all bound cmd buffers to INVALID state
     void InvalidateBoundCmdBuffers(ValidationStateTracker *state_data);
+    const LazyBinding &GetLazyBinding(uint32_t index) const;
+    const Descriptor *GetUnwrittenDescriptor(uint32_t index) const;
+    // Return the descriptor at index, constructing the page of its lazy binding that holds it if needed
+    Descriptor *MaterializeDescriptor(uint32_t index);
     bool some_update_;  // has any part of the set ever been updated?
     VkDescriptorSet set_;
     DESCRIPTOR_POOL_STATE *pool_state_;
@@ -681,7 +700,10 @@ class DescriptorSet : public BASE_NODE {
     // NOTE: the the backing store for the descriptors must be declared *before* it so it will be destructed *after* it
     // "Destructors for nonstatic member objects are called in the reverse order in which they appear in the class declaration."
     std::vector<DescriptorBackingStore> descriptor_store_;
-    std::vector<std::unique_ptr<Descriptor, DescriptorDeleter>> descriptors_;
+    std::vector<std::unique_ptr<DescriptorBackingStore[]>> lazy_pages_;
+    std::vector<std::unique_ptr<Descriptor, DescriptorDeleter>> unwritten_descriptors_;  // One per lazy binding
+    std::vector<LazyBinding> lazy_bindings_;                                            // Sorted by global_range
+    std::vector<std::unique_ptr<Descriptor, DescriptorDeleter>> descriptors_;            // Null where not yet materialized
     const StateTracker *state_data_;
     uint32_t variable_count_;
     uint64_t change_count_;
@@ -0,0 +1,105 @@
+/* Copyright (c) 2020 The Khronos Group Inc.
+ * Copyright (c) 2020 Valve Corporation
+ * Copyright (c) 2020 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "entry_point_costs.h"
+
+#include <algorithm>
+#include <functional>
+#include <thread>
+
+EntryPointCosts::EntryPointCosts(uint32_t entry_point_count, const char *const *entry_point_names, uint32_t object_type_count,
+                                 const char *const *object_type_names)
+    : entry_point_count_(entry_point_count),
+      entry_point_names_(entry_point_names),
+      object_type_count_(object_type_count),
+      object_type_names_(object_type_names) {
+    for (auto &shard : shards_) {
+        shard.store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+EntryPointCosts::~EntryPointCosts() {
+    for (auto &shard : shards_) {
+        delete shard.load(std::memory_order_acquire);
+    }
+}
+
+EntryPointCosts::Shard &EntryPointCosts::GetShard() {
+    // Thread ids are often aligned addresses, so mix the hash before taking the top bits
+    const uint64_t hash = static_cast<uint64_t>(std::hash<std::thread::id>()(std::this_thread::get_id())) * 0x9E3779B97F4A7C15ULL;
+    auto &slot = shards_[hash >> (64 - kShardCountLog2)];
+    Shard *shard = slot.load(std::memory_order_acquire);
+    if (shard) return *shard;
+
+    Shard *new_shard = new Shard;
+    new_shard->calls.reset(new std::atomic<uint64_t>[entry_point_count_]());
+    new_shard->nanoseconds.reset(new std::atomic<uint64_t>[entry_point_count_ * kEntryPointPhaseCount * object_type_count_]());
+    if (slot.compare_exchange_strong(shard, new_shard, std::memory_order_acq_rel)) {
+        return *new_shard;
+    }
+    // Another thread of the same shard got there first
+    delete new_shard;
+    return *shard;
+}
+
+std::vector<LayerEntryPointCost> EntryPointCosts::Collect(uint32_t object_type_mask) const {
+    std::vector<LayerEntryPointCost> costs;
+    for (uint32_t entry_point = 0; entry_point < entry_point_count_; ++entry_point) {
+        uint64_t call_count = 0;
+        for (const auto &slot : shards_) {
+            const Shard *shard = slot.load(std::memory_order_acquire);
+            if (shard) call_count += shard->calls[entry_point].load(std::memory_order_relaxed);
+        }
+        if (!call_count) continue;
+
+        for (uint32_t object_type = 0; object_type < object_type_count_; ++object_type) {
+            if (!(object_type_mask & (1u << object_type))) continue;
+            LayerEntryPointCost cost = {entry_point_names_[entry_point], object_type_names_[object_type], call_count, {}};
+            for (uint32_t phase = 0; phase < kEntryPointPhaseCount; ++phase) {
+                const size_t index = (entry_point * kEntryPointPhaseCount + phase) * object_type_count_ + object_type;
+                for (const auto &slot : shards_) {
+                    const Shard *shard = slot.load(std::memory_order_acquire);
+                    if (shard) cost.nanoseconds[phase] += shard->nanoseconds[index].load(std::memory_order_relaxed);
+                }
+            }
+            costs.push_back(cost);
+        }
+    }
+    return costs;
+}
+
+void EntryPointCosts::Dump(FILE *out, uint32_t object_type_mask) const {
+    auto costs = Collect(object_type_mask);
+    auto total = [](const LayerEntryPointCost &cost) {
+        return cost.nanoseconds[kEntryPointPreCallValidate] + cost.nanoseconds[kEntryPointPreCallRecord] +
+               cost.nanoseconds[kEntryPointPostCallRecord];
+    };
+    std::stable_sort(costs.begin(), costs.end(),
+                     [&total](const LayerEntryPointCost &a, const LayerEntryPointCost &b) { return total(a) > total(b); });
+
+    fprintf(out, "%-48s %-20s %12s %18s %18s %18s\n", "Entry point", "Validation object", "Calls", "PreCallValidate ns",
+            "PreCallRecord ns", "PostCallRecord ns");
+    for (const auto &cost : costs) {
+        fprintf(out, "%-48s %-20s %12llu %18llu %18llu %18llu\n", cost.entry_point, cost.validation_object,
+                static_cast<unsigned long long>(cost.call_count),
+                static_cast<unsigned long long>(cost.nanoseconds[kEntryPointPreCallValidate]),
+                static_cast<unsigned long long>(cost.nanoseconds[kEntryPointPreCallRecord]),
+                static_cast<unsigned long long>(cost.nanoseconds[kEntryPointPostCallRecord]));
+    }
+    fflush(out);
+}
@@ -0,0 +1,114 @@
+/* Copyright (c) 2020 The Khronos Group Inc.
+ * Copyright (c) 2020 Valve Corporation
+ * Copyright (c) 2020 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#pragma once
+#ifndef ENTRY_POINT_COSTS_H_
+#define ENTRY_POINT_COSTS_H_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+#include "vulkan/vulkan.h"
+
+// Phases of an intercepted call that entry point costs are split by
+enum EntryPointPhase {
+    kEntryPointPreCallValidate,
+    kEntryPointPreCallRecord,
+    kEntryPointPostCallRecord,
+    kEntryPointPhaseCount,
+};
+
+// The cost of one entry point in one validation object of a device, as returned by vkGetEntryPointCostsLAYER
+struct LayerEntryPointCost {
+    const char *entry_point;        // Command name, e.g. "vkQueueSubmit"
+    const char *validation_object;  // Validation object name, e.g. "CoreValidation"
+    uint64_t call_count;            // Calls of the entry point, the same in each of its rows
+    uint64_t nanoseconds[kEntryPointPhaseCount];
+};
+
+// Layer-specific device command, available through vkGetDeviceProcAddr. With pCosts null, the number of rows is returned in
+// pCostCount. Otherwise up to *pCostCount rows are written, returning VK_INCOMPLETE if there were more. Returns
+// VK_ERROR_FEATURE_NOT_PRESENT unless VALIDATION_CHECK_ENABLE_ENTRY_POINT_COSTS is set.
+typedef VkResult(VKAPI_PTR *PFN_vkGetEntryPointCostsLAYER)(VkDevice device, uint32_t *pCostCount, LayerEntryPointCost *pCosts);
+
+// Call counts and time spent in each validation object, split by phase, for every entry point intercepted on a device.
+// Counters live in a few lazily allocated shards picked by thread id, so concurrent threads rarely touch the same counters
+// and the intercepts never take a lock. Time is measured with steady_clock, in nanoseconds.
+class EntryPointCosts {
+  public:
+    EntryPointCosts(uint32_t entry_point_count, const char *const *entry_point_names, uint32_t object_type_count,
+                    const char *const *object_type_names);
+    ~EntryPointCosts();
+
+    void AddCall(uint32_t entry_point) { GetShard().calls[entry_point].fetch_add(1, std::memory_order_relaxed); }
+    void AddTime(uint32_t entry_point, EntryPointPhase phase, uint32_t object_type, uint64_t nanoseconds) {
+        const size_t index = (entry_point * kEntryPointPhaseCount + phase) * object_type_count_ + object_type;
+        GetShard().nanoseconds[index].fetch_add(nanoseconds, std::memory_order_relaxed);
+    }
+
+    // Sums up the shards. Every entry point called so far gets a row for each validation object in object_type_mask.
+    std::vector<LayerEntryPointCost> Collect(uint32_t object_type_mask) const;
+    // Writes Collect() as a text table, most expensive entry points first
+    void Dump(FILE *out, uint32_t object_type_mask) const;
+
+  private:
+    static const int kShardCountLog2 = 4;
+    static const int kShardCount = 1 << kShardCountLog2;
+
+    struct Shard {
+        std::unique_ptr<std::atomic<uint64_t>[]> calls;
+        std::unique_ptr<std::atomic<uint64_t>[]> nanoseconds;
+    };
+    Shard &GetShard();
+
+    const uint32_t entry_point_count_;
+    const char *const *entry_point_names_;
+    const uint32_t object_type_count_;
+    const char *const *object_type_names_;
+    std::atomic<Shard *> shards_[kShardCount];
+};
+
+// Charges the time spent in the enclosing scope to one validation object and phase of an entry point. Does nothing, not even
+// read the clock, when costs is null.
+class EntryPointTimer {
+  public:
+    EntryPointTimer(EntryPointCosts *costs, uint32_t entry_point, EntryPointPhase phase, uint32_t object_type)
+        : costs_(costs), entry_point_(entry_point), phase_(phase), object_type_(object_type) {
+        if (costs_) start_ = std::chrono::steady_clock::now();
+    }
+    ~EntryPointTimer() {
+        if (!costs_) return;
+        const auto elapsed = std::chrono::steady_clock::now() - start_;
+        costs_->AddTime(entry_point_, phase_, object_type_,
+                        static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+    }
+    EntryPointTimer(const EntryPointTimer &) = delete;
+    EntryPointTimer &operator=(const EntryPointTimer &) = delete;
+
+  private:
+    EntryPointCosts *costs_;
+    uint32_t entry_point_;
+    EntryPointPhase phase_;
+    uint32_t object_type_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+#endif  // ENTRY_POINT_COSTS_H_
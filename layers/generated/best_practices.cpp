@@ -34,8 +34,8 @@ void BestPractices::PostCallRecordvkCreateInstance(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordCreateInstance(pCreateInfo, pAllocator, pInstance, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY,VK_ERROR_INITIALIZATION_FAILED,VK_ERROR_LAYER_NOT_PRESENT,VK_ERROR_EXTENSION_NOT_PRESENT,VK_ERROR_INCOMPATIBLE_DRIVER};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY) | VkResultBit(VK_ERROR_INITIALIZATION_FAILED) | VkResultBit(VK_ERROR_LAYER_NOT_PRESENT) | VkResultBit(VK_ERROR_EXTENSION_NOT_PRESENT) | VkResultBit(VK_ERROR_INCOMPATIBLE_DRIVER);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkCreateInstance", result, error_codes, success_codes);
     }
 }
@@ -47,8 +47,8 @@ void BestPractices::PostCallRecordvkEnumeratePhysicalDevices(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordEnumeratePhysicalDevices(instance, pPhysicalDeviceCount, pPhysicalDevices, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY,VK_ERROR_INITIALIZATION_FAILED};
-        static const std::vector<VkResult> success_codes = {VK_INCOMPLETE};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY) | VkResultBit(VK_ERROR_INITIALIZATION_FAILED);
+        static constexpr uint64_t success_codes = VkResultBit(VK_INCOMPLETE);
         ValidateReturnCodes("vkEnumeratePhysicalDevices", result, error_codes, success_codes);
     }
 }
@@ -64,8 +64,8 @@ void BestPractices::PostCallRecordvkGetPhysicalDeviceImageFormatProperties(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordGetPhysicalDeviceImageFormatProperties(physicalDevice, format, type, tiling, usage, flags, pImageFormatProperties, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY,VK_ERROR_FORMAT_NOT_SUPPORTED};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY) | VkResultBit(VK_ERROR_FORMAT_NOT_SUPPORTED);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkGetPhysicalDeviceImageFormatProperties", result, error_codes, success_codes);
     }
 }
@@ -78,8 +78,8 @@ void BestPractices::PostCallRecordvkCreateDevice(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordCreateDevice(physicalDevice, pCreateInfo, pAllocator, pDevice, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY,VK_ERROR_INITIALIZATION_FAILED,VK_ERROR_EXTENSION_NOT_PRESENT,VK_ERROR_FEATURE_NOT_PRESENT,VK_ERROR_TOO_MANY_OBJECTS,VK_ERROR_DEVICE_LOST};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY) | VkResultBit(VK_ERROR_INITIALIZATION_FAILED) | VkResultBit(VK_ERROR_EXTENSION_NOT_PRESENT) | VkResultBit(VK_ERROR_FEATURE_NOT_PRESENT) | VkResultBit(VK_ERROR_TOO_MANY_OBJECTS) | VkResultBit(VK_ERROR_DEVICE_LOST);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkCreateDevice", result, error_codes, success_codes);
     }
 }
@@ -91,8 +91,8 @@ void BestPractices::PostCallRecordvkEnumerateInstanceExtensionProperties(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordEnumerateInstanceExtensionProperties(pLayerName, pPropertyCount, pProperties, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY,VK_ERROR_LAYER_NOT_PRESENT};
-        static const std::vector<VkResult> success_codes = {VK_INCOMPLETE};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY) | VkResultBit(VK_ERROR_LAYER_NOT_PRESENT);
+        static constexpr uint64_t success_codes = VkResultBit(VK_INCOMPLETE);
         ValidateReturnCodes("vkEnumerateInstanceExtensionProperties", result, error_codes, success_codes);
     }
 }
@@ -105,8 +105,8 @@ void BestPractices::PostCallRecordvkEnumerateDeviceExtensionProperties(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordEnumerateDeviceExtensionProperties(physicalDevice, pLayerName, pPropertyCount, pProperties, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY,VK_ERROR_LAYER_NOT_PRESENT};
-        static const std::vector<VkResult> success_codes = {VK_INCOMPLETE};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY) | VkResultBit(VK_ERROR_LAYER_NOT_PRESENT);
+        static constexpr uint64_t success_codes = VkResultBit(VK_INCOMPLETE);
         ValidateReturnCodes("vkEnumerateDeviceExtensionProperties", result, error_codes, success_codes);
     }
 }
@@ -117,8 +117,8 @@ void BestPractices::PostCallRecordvkEnumerateInstanceLayerProperties(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordEnumerateInstanceLayerProperties(pPropertyCount, pProperties, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {VK_INCOMPLETE};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = VkResultBit(VK_INCOMPLETE);
         ValidateReturnCodes("vkEnumerateInstanceLayerProperties", result, error_codes, success_codes);
     }
 }
@@ -130,8 +130,8 @@ void BestPractices::PostCallRecordvkEnumerateDeviceLayerProperties(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordEnumerateDeviceLayerProperties(physicalDevice, pPropertyCount, pProperties, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {VK_INCOMPLETE};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = VkResultBit(VK_INCOMPLETE);
         ValidateReturnCodes("vkEnumerateDeviceLayerProperties", result, error_codes, success_codes);
     }
 }
@@ -144,8 +144,8 @@ void BestPractices::PostCallRecordvkQueueSubmit(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordQueueSubmit(queue, submitCount, pSubmits, fence, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY,VK_ERROR_DEVICE_LOST};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY) | VkResultBit(VK_ERROR_DEVICE_LOST);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkQueueSubmit", result, error_codes, success_codes);
     }
 }
@@ -155,8 +155,8 @@ void BestPractices::PostCallRecordvkQueueWaitIdle(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordQueueWaitIdle(queue, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY,VK_ERROR_DEVICE_LOST};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY) | VkResultBit(VK_ERROR_DEVICE_LOST);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkQueueWaitIdle", result, error_codes, success_codes);
     }
 }
@@ -166,8 +166,8 @@ void BestPractices::PostCallRecordvkDeviceWaitIdle(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordDeviceWaitIdle(device, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY,VK_ERROR_DEVICE_LOST};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY) | VkResultBit(VK_ERROR_DEVICE_LOST);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkDeviceWaitIdle", result, error_codes, success_codes);
     }
 }
@@ -184,8 +184,8 @@ void BestPractices::PostCallRecordvkMapMemory(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordMapMemory(device, memory, offset, size, flags, ppData, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY,VK_ERROR_MEMORY_MAP_FAILED};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY) | VkResultBit(VK_ERROR_MEMORY_MAP_FAILED);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkMapMemory", result, error_codes, success_codes);
     }
 }
@@ -197,8 +197,8 @@ void BestPractices::PostCallRecordvkFlushMappedMemoryRanges(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordFlushMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkFlushMappedMemoryRanges", result, error_codes, success_codes);
     }
 }
@@ -210,8 +210,8 @@ void BestPractices::PostCallRecordvkInvalidateMappedMemoryRanges(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordInvalidateMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkInvalidateMappedMemoryRanges", result, error_codes, success_codes);
     }
 }
@@ -224,8 +224,8 @@ void BestPractices::PostCallRecordvkBindBufferMemory(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordBindBufferMemory(device, buffer, memory, memoryOffset, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY,VK_ERROR_INVALID_OPAQUE_CAPTURE_ADDRESS_KHR};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY) | VkResultBit(VK_ERROR_INVALID_OPAQUE_CAPTURE_ADDRESS_KHR);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkBindBufferMemory", result, error_codes, success_codes);
     }
 }
@@ -238,8 +238,8 @@ void BestPractices::PostCallRecordvkBindImageMemory(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordBindImageMemory(device, image, memory, memoryOffset, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkBindImageMemory", result, error_codes, success_codes);
     }
 }
@@ -254,8 +254,8 @@ void BestPractices::PostCallRecordvkCreateFence(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordCreateFence(device, pCreateInfo, pAllocator, pFence, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkCreateFence", result, error_codes, success_codes);
     }
 }
@@ -267,8 +267,8 @@ void BestPractices::PostCallRecordvkResetFences(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordResetFences(device, fenceCount, pFences, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkResetFences", result, error_codes, success_codes);
     }
 }
@@ -279,8 +279,8 @@ void BestPractices::PostCallRecordvkGetFenceStatus(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordGetFenceStatus(device, fence, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY,VK_ERROR_DEVICE_LOST};
-        static const std::vector<VkResult> success_codes = {VK_NOT_READY};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY) | VkResultBit(VK_ERROR_DEVICE_LOST);
+        static constexpr uint64_t success_codes = VkResultBit(VK_NOT_READY);
         ValidateReturnCodes("vkGetFenceStatus", result, error_codes, success_codes);
     }
 }
@@ -294,8 +294,8 @@ void BestPractices::PostCallRecordvkWaitForFences(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordWaitForFences(device, fenceCount, pFences, waitAll, timeout, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY,VK_ERROR_DEVICE_LOST};
-        static const std::vector<VkResult> success_codes = {VK_TIMEOUT};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY) | VkResultBit(VK_ERROR_DEVICE_LOST);
+        static constexpr uint64_t success_codes = VkResultBit(VK_TIMEOUT);
         ValidateReturnCodes("vkWaitForFences", result, error_codes, success_codes);
     }
 }
@@ -308,8 +308,8 @@ void BestPractices::PostCallRecordvkCreateSemaphore(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordCreateSemaphore(device, pCreateInfo, pAllocator, pSemaphore, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkCreateSemaphore", result, error_codes, success_codes);
     }
 }
@@ -322,8 +322,8 @@ void BestPractices::PostCallRecordvkCreateEvent(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordCreateEvent(device, pCreateInfo, pAllocator, pEvent, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkCreateEvent", result, error_codes, success_codes);
     }
 }
@@ -334,8 +334,8 @@ void BestPractices::PostCallRecordvkGetEventStatus(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordGetEventStatus(device, event, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY,VK_ERROR_DEVICE_LOST};
-        static const std::vector<VkResult> success_codes = {VK_EVENT_SET,VK_EVENT_RESET};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY) | VkResultBit(VK_ERROR_DEVICE_LOST);
+        static constexpr uint64_t success_codes = VkResultBit(VK_EVENT_SET) | VkResultBit(VK_EVENT_RESET);
         ValidateReturnCodes("vkGetEventStatus", result, error_codes, success_codes);
     }
 }
@@ -346,8 +346,8 @@ void BestPractices::PostCallRecordvkSetEvent(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordSetEvent(device, event, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkSetEvent", result, error_codes, success_codes);
     }
 }
@@ -358,8 +358,8 @@ void BestPractices::PostCallRecordvkResetEvent(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordResetEvent(device, event, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkResetEvent", result, error_codes, success_codes);
     }
 }
@@ -372,8 +372,8 @@ void BestPractices::PostCallRecordvkCreateQueryPool(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordCreateQueryPool(device, pCreateInfo, pAllocator, pQueryPool, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkCreateQueryPool", result, error_codes, success_codes);
     }
 }
@@ -390,8 +390,8 @@ void BestPractices::PostCallRecordvkGetQueryPoolResults(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordGetQueryPoolResults(device, queryPool, firstQuery, queryCount, dataSize, pData, stride, flags, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY,VK_ERROR_DEVICE_LOST};
-        static const std::vector<VkResult> success_codes = {VK_NOT_READY};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY) | VkResultBit(VK_ERROR_DEVICE_LOST);
+        static constexpr uint64_t success_codes = VkResultBit(VK_NOT_READY);
         ValidateReturnCodes("vkGetQueryPoolResults", result, error_codes, success_codes);
     }
 }
@@ -404,8 +404,8 @@ void BestPractices::PostCallRecordvkCreateBuffer(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordCreateBuffer(device, pCreateInfo, pAllocator, pBuffer, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY,VK_ERROR_INVALID_OPAQUE_CAPTURE_ADDRESS_KHR};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY) | VkResultBit(VK_ERROR_INVALID_OPAQUE_CAPTURE_ADDRESS_KHR);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkCreateBuffer", result, error_codes, success_codes);
     }
 }
@@ -418,8 +418,8 @@ void BestPractices::PostCallRecordvkCreateBufferView(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordCreateBufferView(device, pCreateInfo, pAllocator, pView, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkCreateBufferView", result, error_codes, success_codes);
     }
 }
@@ -432,8 +432,8 @@ void BestPractices::PostCallRecordvkCreateImage(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordCreateImage(device, pCreateInfo, pAllocator, pImage, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkCreateImage", result, error_codes, success_codes);
     }
 }
@@ -446,8 +446,8 @@ void BestPractices::PostCallRecordvkCreateImageView(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordCreateImageView(device, pCreateInfo, pAllocator, pView, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkCreateImageView", result, error_codes, success_codes);
     }
 }
@@ -461,8 +461,8 @@ void BestPractices::PostCallRecordvkCreateShaderModule(
     void*                                       state_data) {
     ValidationStateTracker::PostCallRecordCreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule, result, state_data);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY,VK_ERROR_INVALID_SHADER_NV};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY) | VkResultBit(VK_ERROR_INVALID_SHADER_NV);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkCreateShaderModule", result, error_codes, success_codes);
     }
 }
@@ -475,8 +475,8 @@ void BestPractices::PostCallRecordvkCreatePipelineCache(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordCreatePipelineCache(device, pCreateInfo, pAllocator, pPipelineCache, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkCreatePipelineCache", result, error_codes, success_codes);
     }
 }
@@ -489,8 +489,8 @@ void BestPractices::PostCallRecordvkGetPipelineCacheData(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordGetPipelineCacheData(device, pipelineCache, pDataSize, pData, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {VK_INCOMPLETE};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = VkResultBit(VK_INCOMPLETE);
         ValidateReturnCodes("vkGetPipelineCacheData", result, error_codes, success_codes);
     }
 }
@@ -503,8 +503,8 @@ void BestPractices::PostCallRecordvkMergePipelineCaches(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordMergePipelineCaches(device, dstCache, srcCacheCount, pSrcCaches, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkMergePipelineCaches", result, error_codes, success_codes);
     }
 }
@@ -520,8 +520,8 @@ void BestPractices::PostCallRecordvkCreateGraphicsPipelines(
     void*                                       state_data) {
     ValidationStateTracker::PostCallRecordCreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, result, state_data);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY,VK_ERROR_INVALID_SHADER_NV};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY) | VkResultBit(VK_ERROR_INVALID_SHADER_NV);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkCreateGraphicsPipelines", result, error_codes, success_codes);
     }
 }
@@ -537,8 +537,8 @@ void BestPractices::PostCallRecordvkCreateComputePipelines(
     void*                                       state_data) {
     ValidationStateTracker::PostCallRecordCreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, result, state_data);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY,VK_ERROR_INVALID_SHADER_NV};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY) | VkResultBit(VK_ERROR_INVALID_SHADER_NV);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkCreateComputePipelines", result, error_codes, success_codes);
     }
 }
@@ -551,8 +551,8 @@ void BestPractices::PostCallRecordvkCreatePipelineLayout(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordCreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkCreatePipelineLayout", result, error_codes, success_codes);
     }
 }
@@ -565,8 +565,8 @@ void BestPractices::PostCallRecordvkCreateSampler(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordCreateSampler(device, pCreateInfo, pAllocator, pSampler, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY,VK_ERROR_TOO_MANY_OBJECTS};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY) | VkResultBit(VK_ERROR_TOO_MANY_OBJECTS);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkCreateSampler", result, error_codes, success_codes);
     }
 }
@@ -579,8 +579,8 @@ void BestPractices::PostCallRecordvkCreateDescriptorSetLayout(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordCreateDescriptorSetLayout(device, pCreateInfo, pAllocator, pSetLayout, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkCreateDescriptorSetLayout", result, error_codes, success_codes);
     }
 }
@@ -593,8 +593,8 @@ void BestPractices::PostCallRecordvkCreateDescriptorPool(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordCreateDescriptorPool(device, pCreateInfo, pAllocator, pDescriptorPool, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY,VK_ERROR_FRAGMENTATION_EXT};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY) | VkResultBit(VK_ERROR_FRAGMENTATION_EXT);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkCreateDescriptorPool", result, error_codes, success_codes);
     }
 }
@@ -607,8 +607,8 @@ void BestPractices::PostCallRecordvkAllocateDescriptorSets(
     void*                                       state_data) {
     ValidationStateTracker::PostCallRecordAllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets, result, state_data);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY,VK_ERROR_FRAGMENTED_POOL,VK_ERROR_OUT_OF_POOL_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY) | VkResultBit(VK_ERROR_FRAGMENTED_POOL) | VkResultBit(VK_ERROR_OUT_OF_POOL_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkAllocateDescriptorSets", result, error_codes, success_codes);
     }
 }
@@ -621,8 +621,8 @@ void BestPractices::PostCallRecordvkCreateFramebuffer(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordCreateFramebuffer(device, pCreateInfo, pAllocator, pFramebuffer, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkCreateFramebuffer", result, error_codes, success_codes);
     }
 }
@@ -635,8 +635,8 @@ void BestPractices::PostCallRecordvkCreateRenderPass(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordCreateRenderPass(device, pCreateInfo, pAllocator, pRenderPass, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkCreateRenderPass", result, error_codes, success_codes);
     }
 }
@@ -649,8 +649,8 @@ void BestPractices::PostCallRecordvkCreateCommandPool(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordCreateCommandPool(device, pCreateInfo, pAllocator, pCommandPool, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkCreateCommandPool", result, error_codes, success_codes);
     }
 }
@@ -662,8 +662,8 @@ void BestPractices::PostCallRecordvkResetCommandPool(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordResetCommandPool(device, commandPool, flags, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkResetCommandPool", result, error_codes, success_codes);
     }
 }
@@ -675,8 +675,8 @@ void BestPractices::PostCallRecordvkAllocateCommandBuffers(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordAllocateCommandBuffers(device, pAllocateInfo, pCommandBuffers, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkAllocateCommandBuffers", result, error_codes, success_codes);
     }
 }
@@ -687,8 +687,8 @@ void BestPractices::PostCallRecordvkBeginCommandBuffer(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordBeginCommandBuffer(commandBuffer, pBeginInfo, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkBeginCommandBuffer", result, error_codes, success_codes);
     }
 }
@@ -698,8 +698,8 @@ void BestPractices::PostCallRecordvkEndCommandBuffer(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordEndCommandBuffer(commandBuffer, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkEndCommandBuffer", result, error_codes, success_codes);
     }
 }
@@ -710,8 +710,8 @@ void BestPractices::PostCallRecordvkResetCommandBuffer(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordResetCommandBuffer(commandBuffer, flags, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkResetCommandBuffer", result, error_codes, success_codes);
     }
 }
@@ -723,8 +723,8 @@ void BestPractices::PostCallRecordvkBindBufferMemory2(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordBindBufferMemory2(device, bindInfoCount, pBindInfos, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY,VK_ERROR_INVALID_OPAQUE_CAPTURE_ADDRESS_KHR};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY) | VkResultBit(VK_ERROR_INVALID_OPAQUE_CAPTURE_ADDRESS_KHR);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkBindBufferMemory2", result, error_codes, success_codes);
     }
 }
@@ -736,8 +736,8 @@ void BestPractices::PostCallRecordvkBindImageMemory2(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordBindImageMemory2(device, bindInfoCount, pBindInfos, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkBindImageMemory2", result, error_codes, success_codes);
     }
 }
@@ -749,8 +749,8 @@ void BestPractices::PostCallRecordvkEnumeratePhysicalDeviceGroups(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordEnumeratePhysicalDeviceGroups(instance, pPhysicalDeviceGroupCount, pPhysicalDeviceGroupProperties, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY,VK_ERROR_INITIALIZATION_FAILED};
-        static const std::vector<VkResult> success_codes = {VK_INCOMPLETE};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY) | VkResultBit(VK_ERROR_INITIALIZATION_FAILED);
+        static constexpr uint64_t success_codes = VkResultBit(VK_INCOMPLETE);
         ValidateReturnCodes("vkEnumeratePhysicalDeviceGroups", result, error_codes, success_codes);
     }
 }
@@ -762,8 +762,8 @@ void BestPractices::PostCallRecordvkGetPhysicalDeviceImageFormatProperties2(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordGetPhysicalDeviceImageFormatProperties2(physicalDevice, pImageFormatInfo, pImageFormatProperties, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY,VK_ERROR_FORMAT_NOT_SUPPORTED};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY) | VkResultBit(VK_ERROR_FORMAT_NOT_SUPPORTED);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkGetPhysicalDeviceImageFormatProperties2", result, error_codes, success_codes);
     }
 }
@@ -776,8 +776,8 @@ void BestPractices::PostCallRecordvkCreateSamplerYcbcrConversion(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordCreateSamplerYcbcrConversion(device, pCreateInfo, pAllocator, pYcbcrConversion, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkCreateSamplerYcbcrConversion", result, error_codes, success_codes);
     }
 }
@@ -790,8 +790,8 @@ void BestPractices::PostCallRecordvkCreateDescriptorUpdateTemplate(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordCreateDescriptorUpdateTemplate(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkCreateDescriptorUpdateTemplate", result, error_codes, success_codes);
     }
 }
@@ -804,8 +804,8 @@ void BestPractices::PostCallRecordvkCreateRenderPass2(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordCreateRenderPass2(device, pCreateInfo, pAllocator, pRenderPass, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkCreateRenderPass2", result, error_codes, success_codes);
     }
 }
@@ -817,8 +817,8 @@ void BestPractices::PostCallRecordvkGetSemaphoreCounterValue(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordGetSemaphoreCounterValue(device, semaphore, pValue, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY,VK_ERROR_DEVICE_LOST};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY) | VkResultBit(VK_ERROR_DEVICE_LOST);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkGetSemaphoreCounterValue", result, error_codes, success_codes);
     }
 }
@@ -830,8 +830,8 @@ void BestPractices::PostCallRecordvkWaitSemaphores(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordWaitSemaphores(device, pWaitInfo, timeout, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY,VK_ERROR_DEVICE_LOST};
-        static const std::vector<VkResult> success_codes = {VK_TIMEOUT};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY) | VkResultBit(VK_ERROR_DEVICE_LOST);
+        static constexpr uint64_t success_codes = VkResultBit(VK_TIMEOUT);
         ValidateReturnCodes("vkWaitSemaphores", result, error_codes, success_codes);
     }
 }
@@ -842,8 +842,8 @@ void BestPractices::PostCallRecordvkSignalSemaphore(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordSignalSemaphore(device, pSignalInfo, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkSignalSemaphore", result, error_codes, success_codes);
     }
 }
@@ -856,8 +856,8 @@ void BestPractices::PostCallRecordvkGetPhysicalDeviceSurfaceSupportKHR(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordGetPhysicalDeviceSurfaceSupportKHR(physicalDevice, queueFamilyIndex, surface, pSupported, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY,VK_ERROR_SURFACE_LOST_KHR};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY) | VkResultBit(VK_ERROR_SURFACE_LOST_KHR);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkGetPhysicalDeviceSurfaceSupportKHR", result, error_codes, success_codes);
     }
 }
@@ -869,8 +869,8 @@ void BestPractices::PostCallRecordvkGetPhysicalDeviceSurfaceCapabilitiesKHR(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordGetPhysicalDeviceSurfaceCapabilitiesKHR(physicalDevice, surface, pSurfaceCapabilities, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY,VK_ERROR_SURFACE_LOST_KHR};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY) | VkResultBit(VK_ERROR_SURFACE_LOST_KHR);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkGetPhysicalDeviceSurfaceCapabilitiesKHR", result, error_codes, success_codes);
     }
 }
@@ -883,8 +883,8 @@ void BestPractices::PostCallRecordvkGetPhysicalDeviceSurfaceFormatsKHR(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordGetPhysicalDeviceSurfaceFormatsKHR(physicalDevice, surface, pSurfaceFormatCount, pSurfaceFormats, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY,VK_ERROR_SURFACE_LOST_KHR};
-        static const std::vector<VkResult> success_codes = {VK_INCOMPLETE};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY) | VkResultBit(VK_ERROR_SURFACE_LOST_KHR);
+        static constexpr uint64_t success_codes = VkResultBit(VK_INCOMPLETE);
         ValidateReturnCodes("vkGetPhysicalDeviceSurfaceFormatsKHR", result, error_codes, success_codes);
     }
 }
@@ -897,8 +897,8 @@ void BestPractices::PostCallRecordvkGetPhysicalDeviceSurfacePresentModesKHR(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordGetPhysicalDeviceSurfacePresentModesKHR(physicalDevice, surface, pPresentModeCount, pPresentModes, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY,VK_ERROR_SURFACE_LOST_KHR};
-        static const std::vector<VkResult> success_codes = {VK_INCOMPLETE};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY) | VkResultBit(VK_ERROR_SURFACE_LOST_KHR);
+        static constexpr uint64_t success_codes = VkResultBit(VK_INCOMPLETE);
         ValidateReturnCodes("vkGetPhysicalDeviceSurfacePresentModesKHR", result, error_codes, success_codes);
     }
 }
@@ -911,8 +911,8 @@ void BestPractices::PostCallRecordvkCreateSwapchainKHR(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordCreateSwapchainKHR(device, pCreateInfo, pAllocator, pSwapchain, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY,VK_ERROR_DEVICE_LOST,VK_ERROR_SURFACE_LOST_KHR,VK_ERROR_NATIVE_WINDOW_IN_USE_KHR,VK_ERROR_INITIALIZATION_FAILED};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY) | VkResultBit(VK_ERROR_DEVICE_LOST) | VkResultBit(VK_ERROR_SURFACE_LOST_KHR) | VkResultBit(VK_ERROR_NATIVE_WINDOW_IN_USE_KHR) | VkResultBit(VK_ERROR_INITIALIZATION_FAILED);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkCreateSwapchainKHR", result, error_codes, success_codes);
     }
 }
@@ -925,8 +925,8 @@ void BestPractices::PostCallRecordvkGetSwapchainImagesKHR(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordGetSwapchainImagesKHR(device, swapchain, pSwapchainImageCount, pSwapchainImages, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {VK_INCOMPLETE};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = VkResultBit(VK_INCOMPLETE);
         ValidateReturnCodes("vkGetSwapchainImagesKHR", result, error_codes, success_codes);
     }
 }
@@ -941,8 +941,8 @@ void BestPractices::PostCallRecordvkAcquireNextImageKHR(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordAcquireNextImageKHR(device, swapchain, timeout, semaphore, fence, pImageIndex, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY,VK_ERROR_DEVICE_LOST,VK_ERROR_OUT_OF_DATE_KHR,VK_ERROR_SURFACE_LOST_KHR,VK_ERROR_FULL_SCREEN_EXCLUSIVE_MODE_LOST_EXT};
-        static const std::vector<VkResult> success_codes = {VK_TIMEOUT,VK_NOT_READY,VK_SUBOPTIMAL_KHR};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY) | VkResultBit(VK_ERROR_DEVICE_LOST) | VkResultBit(VK_ERROR_OUT_OF_DATE_KHR) | VkResultBit(VK_ERROR_SURFACE_LOST_KHR) | VkResultBit(VK_ERROR_FULL_SCREEN_EXCLUSIVE_MODE_LOST_EXT);
+        static constexpr uint64_t success_codes = VkResultBit(VK_TIMEOUT) | VkResultBit(VK_NOT_READY) | VkResultBit(VK_SUBOPTIMAL_KHR);
         ValidateReturnCodes("vkAcquireNextImageKHR", result, error_codes, success_codes);
     }
 }
@@ -953,8 +953,8 @@ void BestPractices::PostCallRecordvkQueuePresentKHR(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordQueuePresentKHR(queue, pPresentInfo, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY,VK_ERROR_DEVICE_LOST,VK_ERROR_OUT_OF_DATE_KHR,VK_ERROR_SURFACE_LOST_KHR,VK_ERROR_FULL_SCREEN_EXCLUSIVE_MODE_LOST_EXT};
-        static const std::vector<VkResult> success_codes = {VK_SUBOPTIMAL_KHR};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY) | VkResultBit(VK_ERROR_DEVICE_LOST) | VkResultBit(VK_ERROR_OUT_OF_DATE_KHR) | VkResultBit(VK_ERROR_SURFACE_LOST_KHR) | VkResultBit(VK_ERROR_FULL_SCREEN_EXCLUSIVE_MODE_LOST_EXT);
+        static constexpr uint64_t success_codes = VkResultBit(VK_SUBOPTIMAL_KHR);
         ValidateReturnCodes("vkQueuePresentKHR", result, error_codes, success_codes);
     }
 }
@@ -965,8 +965,8 @@ void BestPractices::PostCallRecordvkGetDeviceGroupPresentCapabilitiesKHR(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordGetDeviceGroupPresentCapabilitiesKHR(device, pDeviceGroupPresentCapabilities, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkGetDeviceGroupPresentCapabilitiesKHR", result, error_codes, success_codes);
     }
 }
@@ -978,8 +978,8 @@ void BestPractices::PostCallRecordvkGetDeviceGroupSurfacePresentModesKHR(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordGetDeviceGroupSurfacePresentModesKHR(device, surface, pModes, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY,VK_ERROR_SURFACE_LOST_KHR};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY) | VkResultBit(VK_ERROR_SURFACE_LOST_KHR);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkGetDeviceGroupSurfacePresentModesKHR", result, error_codes, success_codes);
     }
 }
@@ -992,8 +992,8 @@ void BestPractices::PostCallRecordvkGetPhysicalDevicePresentRectanglesKHR(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordGetPhysicalDevicePresentRectanglesKHR(physicalDevice, surface, pRectCount, pRects, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {VK_INCOMPLETE};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = VkResultBit(VK_INCOMPLETE);
         ValidateReturnCodes("vkGetPhysicalDevicePresentRectanglesKHR", result, error_codes, success_codes);
     }
 }
@@ -1005,8 +1005,8 @@ void BestPractices::PostCallRecordvkAcquireNextImage2KHR(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordAcquireNextImage2KHR(device, pAcquireInfo, pImageIndex, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY,VK_ERROR_DEVICE_LOST,VK_ERROR_OUT_OF_DATE_KHR,VK_ERROR_SURFACE_LOST_KHR,VK_ERROR_FULL_SCREEN_EXCLUSIVE_MODE_LOST_EXT};
-        static const std::vector<VkResult> success_codes = {VK_TIMEOUT,VK_NOT_READY,VK_SUBOPTIMAL_KHR};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY) | VkResultBit(VK_ERROR_DEVICE_LOST) | VkResultBit(VK_ERROR_OUT_OF_DATE_KHR) | VkResultBit(VK_ERROR_SURFACE_LOST_KHR) | VkResultBit(VK_ERROR_FULL_SCREEN_EXCLUSIVE_MODE_LOST_EXT);
+        static constexpr uint64_t success_codes = VkResultBit(VK_TIMEOUT) | VkResultBit(VK_NOT_READY) | VkResultBit(VK_SUBOPTIMAL_KHR);
         ValidateReturnCodes("vkAcquireNextImage2KHR", result, error_codes, success_codes);
     }
 }
@@ -1018,8 +1018,8 @@ void BestPractices::PostCallRecordvkGetPhysicalDeviceDisplayPropertiesKHR(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordGetPhysicalDeviceDisplayPropertiesKHR(physicalDevice, pPropertyCount, pProperties, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {VK_INCOMPLETE};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = VkResultBit(VK_INCOMPLETE);
         ValidateReturnCodes("vkGetPhysicalDeviceDisplayPropertiesKHR", result, error_codes, success_codes);
     }
 }
@@ -1031,8 +1031,8 @@ void BestPractices::PostCallRecordvkGetPhysicalDeviceDisplayPlanePropertiesKHR(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordGetPhysicalDeviceDisplayPlanePropertiesKHR(physicalDevice, pPropertyCount, pProperties, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {VK_INCOMPLETE};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = VkResultBit(VK_INCOMPLETE);
         ValidateReturnCodes("vkGetPhysicalDeviceDisplayPlanePropertiesKHR", result, error_codes, success_codes);
     }
 }
@@ -1045,8 +1045,8 @@ void BestPractices::PostCallRecordvkGetDisplayPlaneSupportedDisplaysKHR(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordGetDisplayPlaneSupportedDisplaysKHR(physicalDevice, planeIndex, pDisplayCount, pDisplays, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {VK_INCOMPLETE};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = VkResultBit(VK_INCOMPLETE);
         ValidateReturnCodes("vkGetDisplayPlaneSupportedDisplaysKHR", result, error_codes, success_codes);
     }
 }
@@ -1059,8 +1059,8 @@ void BestPractices::PostCallRecordvkGetDisplayModePropertiesKHR(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordGetDisplayModePropertiesKHR(physicalDevice, display, pPropertyCount, pProperties, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {VK_INCOMPLETE};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = VkResultBit(VK_INCOMPLETE);
         ValidateReturnCodes("vkGetDisplayModePropertiesKHR", result, error_codes, success_codes);
     }
 }
@@ -1074,8 +1074,8 @@ void BestPractices::PostCallRecordvkCreateDisplayModeKHR(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordCreateDisplayModeKHR(physicalDevice, display, pCreateInfo, pAllocator, pMode, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY,VK_ERROR_INITIALIZATION_FAILED};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY) | VkResultBit(VK_ERROR_INITIALIZATION_FAILED);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkCreateDisplayModeKHR", result, error_codes, success_codes);
     }
 }
@@ -1088,8 +1088,8 @@ void BestPractices::PostCallRecordvkGetDisplayPlaneCapabilitiesKHR(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordGetDisplayPlaneCapabilitiesKHR(physicalDevice, mode, planeIndex, pCapabilities, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkGetDisplayPlaneCapabilitiesKHR", result, error_codes, success_codes);
     }
 }
@@ -1102,8 +1102,8 @@ void BestPractices::PostCallRecordvkCreateDisplayPlaneSurfaceKHR(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordCreateDisplayPlaneSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkCreateDisplayPlaneSurfaceKHR", result, error_codes, success_codes);
     }
 }
@@ -1117,8 +1117,8 @@ void BestPractices::PostCallRecordvkCreateSharedSwapchainsKHR(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordCreateSharedSwapchainsKHR(device, swapchainCount, pCreateInfos, pAllocator, pSwapchains, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY,VK_ERROR_INCOMPATIBLE_DISPLAY_KHR,VK_ERROR_DEVICE_LOST,VK_ERROR_SURFACE_LOST_KHR};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY) | VkResultBit(VK_ERROR_INCOMPATIBLE_DISPLAY_KHR) | VkResultBit(VK_ERROR_DEVICE_LOST) | VkResultBit(VK_ERROR_SURFACE_LOST_KHR);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkCreateSharedSwapchainsKHR", result, error_codes, success_codes);
     }
 }
@@ -1133,8 +1133,8 @@ void BestPractices::PostCallRecordvkCreateXlibSurfaceKHR(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordCreateXlibSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkCreateXlibSurfaceKHR", result, error_codes, success_codes);
     }
 }
@@ -1151,8 +1151,8 @@ void BestPractices::PostCallRecordvkCreateXcbSurfaceKHR(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordCreateXcbSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkCreateXcbSurfaceKHR", result, error_codes, success_codes);
     }
 }
@@ -1169,8 +1169,8 @@ void BestPractices::PostCallRecordvkCreateWaylandSurfaceKHR(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordCreateWaylandSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkCreateWaylandSurfaceKHR", result, error_codes, success_codes);
     }
 }
@@ -1187,8 +1187,8 @@ void BestPractices::PostCallRecordvkCreateAndroidSurfaceKHR(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordCreateAndroidSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY,VK_ERROR_NATIVE_WINDOW_IN_USE_KHR};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY) | VkResultBit(VK_ERROR_NATIVE_WINDOW_IN_USE_KHR);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkCreateAndroidSurfaceKHR", result, error_codes, success_codes);
     }
 }
@@ -1205,8 +1205,8 @@ void BestPractices::PostCallRecordvkCreateWin32SurfaceKHR(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordCreateWin32SurfaceKHR(instance, pCreateInfo, pAllocator, pSurface, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkCreateWin32SurfaceKHR", result, error_codes, success_codes);
     }
 }
@@ -1220,8 +1220,8 @@ void BestPractices::PostCallRecordvkGetPhysicalDeviceImageFormatProperties2KHR(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordGetPhysicalDeviceImageFormatProperties2KHR(physicalDevice, pImageFormatInfo, pImageFormatProperties, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY,VK_ERROR_FORMAT_NOT_SUPPORTED};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY) | VkResultBit(VK_ERROR_FORMAT_NOT_SUPPORTED);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkGetPhysicalDeviceImageFormatProperties2KHR", result, error_codes, success_codes);
     }
 }
@@ -1233,8 +1233,8 @@ void BestPractices::PostCallRecordvkEnumeratePhysicalDeviceGroupsKHR(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordEnumeratePhysicalDeviceGroupsKHR(instance, pPhysicalDeviceGroupCount, pPhysicalDeviceGroupProperties, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY,VK_ERROR_INITIALIZATION_FAILED};
-        static const std::vector<VkResult> success_codes = {VK_INCOMPLETE};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY) | VkResultBit(VK_ERROR_INITIALIZATION_FAILED);
+        static constexpr uint64_t success_codes = VkResultBit(VK_INCOMPLETE);
         ValidateReturnCodes("vkEnumeratePhysicalDeviceGroupsKHR", result, error_codes, success_codes);
     }
 }
@@ -1248,8 +1248,8 @@ void BestPractices::PostCallRecordvkGetMemoryWin32HandleKHR(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordGetMemoryWin32HandleKHR(device, pGetWin32HandleInfo, pHandle, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_TOO_MANY_OBJECTS,VK_ERROR_OUT_OF_HOST_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_TOO_MANY_OBJECTS) | VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkGetMemoryWin32HandleKHR", result, error_codes, success_codes);
     }
 }
@@ -1266,8 +1266,8 @@ void BestPractices::PostCallRecordvkGetMemoryWin32HandlePropertiesKHR(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordGetMemoryWin32HandlePropertiesKHR(device, handleType, handle, pMemoryWin32HandleProperties, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_INVALID_EXTERNAL_HANDLE};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_INVALID_EXTERNAL_HANDLE);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkGetMemoryWin32HandlePropertiesKHR", result, error_codes, success_codes);
     }
 }
@@ -1281,8 +1281,8 @@ void BestPractices::PostCallRecordvkGetMemoryFdKHR(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordGetMemoryFdKHR(device, pGetFdInfo, pFd, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_TOO_MANY_OBJECTS,VK_ERROR_OUT_OF_HOST_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_TOO_MANY_OBJECTS) | VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkGetMemoryFdKHR", result, error_codes, success_codes);
     }
 }
@@ -1295,8 +1295,8 @@ void BestPractices::PostCallRecordvkGetMemoryFdPropertiesKHR(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordGetMemoryFdPropertiesKHR(device, handleType, fd, pMemoryFdProperties, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_INVALID_EXTERNAL_HANDLE};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_INVALID_EXTERNAL_HANDLE);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkGetMemoryFdPropertiesKHR", result, error_codes, success_codes);
     }
 }
@@ -1309,8 +1309,8 @@ void BestPractices::PostCallRecordvkImportSemaphoreWin32HandleKHR(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordImportSemaphoreWin32HandleKHR(device, pImportSemaphoreWin32HandleInfo, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_INVALID_EXTERNAL_HANDLE};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_INVALID_EXTERNAL_HANDLE);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkImportSemaphoreWin32HandleKHR", result, error_codes, success_codes);
     }
 }
@@ -1326,8 +1326,8 @@ void BestPractices::PostCallRecordvkGetSemaphoreWin32HandleKHR(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordGetSemaphoreWin32HandleKHR(device, pGetWin32HandleInfo, pHandle, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_TOO_MANY_OBJECTS,VK_ERROR_OUT_OF_HOST_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_TOO_MANY_OBJECTS) | VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkGetSemaphoreWin32HandleKHR", result, error_codes, success_codes);
     }
 }
@@ -1340,8 +1340,8 @@ void BestPractices::PostCallRecordvkImportSemaphoreFdKHR(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordImportSemaphoreFdKHR(device, pImportSemaphoreFdInfo, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_INVALID_EXTERNAL_HANDLE};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_INVALID_EXTERNAL_HANDLE);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkImportSemaphoreFdKHR", result, error_codes, success_codes);
     }
 }
@@ -1353,8 +1353,8 @@ void BestPractices::PostCallRecordvkGetSemaphoreFdKHR(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordGetSemaphoreFdKHR(device, pGetFdInfo, pFd, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_TOO_MANY_OBJECTS,VK_ERROR_OUT_OF_HOST_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_TOO_MANY_OBJECTS) | VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkGetSemaphoreFdKHR", result, error_codes, success_codes);
     }
 }
@@ -1367,8 +1367,8 @@ void BestPractices::PostCallRecordvkCreateDescriptorUpdateTemplateKHR(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordCreateDescriptorUpdateTemplateKHR(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkCreateDescriptorUpdateTemplateKHR", result, error_codes, success_codes);
     }
 }
@@ -1381,8 +1381,8 @@ void BestPractices::PostCallRecordvkCreateRenderPass2KHR(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordCreateRenderPass2KHR(device, pCreateInfo, pAllocator, pRenderPass, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkCreateRenderPass2KHR", result, error_codes, success_codes);
     }
 }
@@ -1393,8 +1393,8 @@ void BestPractices::PostCallRecordvkGetSwapchainStatusKHR(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordGetSwapchainStatusKHR(device, swapchain, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY,VK_ERROR_DEVICE_LOST,VK_ERROR_OUT_OF_DATE_KHR,VK_ERROR_SURFACE_LOST_KHR,VK_ERROR_FULL_SCREEN_EXCLUSIVE_MODE_LOST_EXT};
-        static const std::vector<VkResult> success_codes = {VK_SUBOPTIMAL_KHR};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY) | VkResultBit(VK_ERROR_DEVICE_LOST) | VkResultBit(VK_ERROR_OUT_OF_DATE_KHR) | VkResultBit(VK_ERROR_SURFACE_LOST_KHR) | VkResultBit(VK_ERROR_FULL_SCREEN_EXCLUSIVE_MODE_LOST_EXT);
+        static constexpr uint64_t success_codes = VkResultBit(VK_SUBOPTIMAL_KHR);
         ValidateReturnCodes("vkGetSwapchainStatusKHR", result, error_codes, success_codes);
     }
 }
@@ -1407,8 +1407,8 @@ void BestPractices::PostCallRecordvkImportFenceWin32HandleKHR(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordImportFenceWin32HandleKHR(device, pImportFenceWin32HandleInfo, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_INVALID_EXTERNAL_HANDLE};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_INVALID_EXTERNAL_HANDLE);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkImportFenceWin32HandleKHR", result, error_codes, success_codes);
     }
 }
@@ -1424,8 +1424,8 @@ void BestPractices::PostCallRecordvkGetFenceWin32HandleKHR(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordGetFenceWin32HandleKHR(device, pGetWin32HandleInfo, pHandle, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_TOO_MANY_OBJECTS,VK_ERROR_OUT_OF_HOST_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_TOO_MANY_OBJECTS) | VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkGetFenceWin32HandleKHR", result, error_codes, success_codes);
     }
 }
@@ -1438,8 +1438,8 @@ void BestPractices::PostCallRecordvkImportFenceFdKHR(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordImportFenceFdKHR(device, pImportFenceFdInfo, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_INVALID_EXTERNAL_HANDLE};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_INVALID_EXTERNAL_HANDLE);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkImportFenceFdKHR", result, error_codes, success_codes);
     }
 }
@@ -1451,8 +1451,8 @@ void BestPractices::PostCallRecordvkGetFenceFdKHR(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordGetFenceFdKHR(device, pGetFdInfo, pFd, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_TOO_MANY_OBJECTS,VK_ERROR_OUT_OF_HOST_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_TOO_MANY_OBJECTS) | VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkGetFenceFdKHR", result, error_codes, success_codes);
     }
 }
@@ -1466,8 +1466,8 @@ void BestPractices::PostCallRecordvkEnumeratePhysicalDeviceQueueFamilyPerformanc
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR(physicalDevice, queueFamilyIndex, pCounterCount, pCounters, pCounterDescriptions, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY,VK_ERROR_INITIALIZATION_FAILED};
-        static const std::vector<VkResult> success_codes = {VK_INCOMPLETE};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY) | VkResultBit(VK_ERROR_INITIALIZATION_FAILED);
+        static constexpr uint64_t success_codes = VkResultBit(VK_INCOMPLETE);
         ValidateReturnCodes("vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR", result, error_codes, success_codes);
     }
 }
@@ -1478,8 +1478,8 @@ void BestPractices::PostCallRecordvkAcquireProfilingLockKHR(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordAcquireProfilingLockKHR(device, pInfo, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_TIMEOUT};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_TIMEOUT);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkAcquireProfilingLockKHR", result, error_codes, success_codes);
     }
 }
@@ -1491,8 +1491,8 @@ void BestPractices::PostCallRecordvkGetPhysicalDeviceSurfaceCapabilities2KHR(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordGetPhysicalDeviceSurfaceCapabilities2KHR(physicalDevice, pSurfaceInfo, pSurfaceCapabilities, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY,VK_ERROR_SURFACE_LOST_KHR};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY) | VkResultBit(VK_ERROR_SURFACE_LOST_KHR);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkGetPhysicalDeviceSurfaceCapabilities2KHR", result, error_codes, success_codes);
     }
 }
@@ -1505,8 +1505,8 @@ void BestPractices::PostCallRecordvkGetPhysicalDeviceSurfaceFormats2KHR(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordGetPhysicalDeviceSurfaceFormats2KHR(physicalDevice, pSurfaceInfo, pSurfaceFormatCount, pSurfaceFormats, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY,VK_ERROR_SURFACE_LOST_KHR};
-        static const std::vector<VkResult> success_codes = {VK_INCOMPLETE};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY) | VkResultBit(VK_ERROR_SURFACE_LOST_KHR);
+        static constexpr uint64_t success_codes = VkResultBit(VK_INCOMPLETE);
         ValidateReturnCodes("vkGetPhysicalDeviceSurfaceFormats2KHR", result, error_codes, success_codes);
     }
 }
@@ -1518,8 +1518,8 @@ void BestPractices::PostCallRecordvkGetPhysicalDeviceDisplayProperties2KHR(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordGetPhysicalDeviceDisplayProperties2KHR(physicalDevice, pPropertyCount, pProperties, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {VK_INCOMPLETE};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = VkResultBit(VK_INCOMPLETE);
         ValidateReturnCodes("vkGetPhysicalDeviceDisplayProperties2KHR", result, error_codes, success_codes);
     }
 }
@@ -1531,8 +1531,8 @@ void BestPractices::PostCallRecordvkGetPhysicalDeviceDisplayPlaneProperties2KHR(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordGetPhysicalDeviceDisplayPlaneProperties2KHR(physicalDevice, pPropertyCount, pProperties, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {VK_INCOMPLETE};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = VkResultBit(VK_INCOMPLETE);
         ValidateReturnCodes("vkGetPhysicalDeviceDisplayPlaneProperties2KHR", result, error_codes, success_codes);
     }
 }
@@ -1545,8 +1545,8 @@ void BestPractices::PostCallRecordvkGetDisplayModeProperties2KHR(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordGetDisplayModeProperties2KHR(physicalDevice, display, pPropertyCount, pProperties, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {VK_INCOMPLETE};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = VkResultBit(VK_INCOMPLETE);
         ValidateReturnCodes("vkGetDisplayModeProperties2KHR", result, error_codes, success_codes);
     }
 }
@@ -1558,8 +1558,8 @@ void BestPractices::PostCallRecordvkGetDisplayPlaneCapabilities2KHR(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordGetDisplayPlaneCapabilities2KHR(physicalDevice, pDisplayPlaneInfo, pCapabilities, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkGetDisplayPlaneCapabilities2KHR", result, error_codes, success_codes);
     }
 }
@@ -1572,8 +1572,8 @@ void BestPractices::PostCallRecordvkCreateSamplerYcbcrConversionKHR(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordCreateSamplerYcbcrConversionKHR(device, pCreateInfo, pAllocator, pYcbcrConversion, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkCreateSamplerYcbcrConversionKHR", result, error_codes, success_codes);
     }
 }
@@ -1585,8 +1585,8 @@ void BestPractices::PostCallRecordvkBindBufferMemory2KHR(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordBindBufferMemory2KHR(device, bindInfoCount, pBindInfos, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY,VK_ERROR_INVALID_OPAQUE_CAPTURE_ADDRESS_KHR};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY) | VkResultBit(VK_ERROR_INVALID_OPAQUE_CAPTURE_ADDRESS_KHR);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkBindBufferMemory2KHR", result, error_codes, success_codes);
     }
 }
@@ -1598,8 +1598,8 @@ void BestPractices::PostCallRecordvkBindImageMemory2KHR(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordBindImageMemory2KHR(device, bindInfoCount, pBindInfos, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkBindImageMemory2KHR", result, error_codes, success_codes);
     }
 }
@@ -1611,8 +1611,8 @@ void BestPractices::PostCallRecordvkGetSemaphoreCounterValueKHR(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordGetSemaphoreCounterValueKHR(device, semaphore, pValue, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY,VK_ERROR_DEVICE_LOST};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY) | VkResultBit(VK_ERROR_DEVICE_LOST);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkGetSemaphoreCounterValueKHR", result, error_codes, success_codes);
     }
 }
@@ -1624,8 +1624,8 @@ void BestPractices::PostCallRecordvkWaitSemaphoresKHR(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordWaitSemaphoresKHR(device, pWaitInfo, timeout, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY,VK_ERROR_DEVICE_LOST};
-        static const std::vector<VkResult> success_codes = {VK_TIMEOUT};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY) | VkResultBit(VK_ERROR_DEVICE_LOST);
+        static constexpr uint64_t success_codes = VkResultBit(VK_TIMEOUT);
         ValidateReturnCodes("vkWaitSemaphoresKHR", result, error_codes, success_codes);
     }
 }
@@ -1636,8 +1636,8 @@ void BestPractices::PostCallRecordvkSignalSemaphoreKHR(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordSignalSemaphoreKHR(device, pSignalInfo, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkSignalSemaphoreKHR", result, error_codes, success_codes);
     }
 }
@@ -1650,8 +1650,8 @@ void BestPractices::PostCallRecordvkGetPipelineExecutablePropertiesKHR(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordGetPipelineExecutablePropertiesKHR(device, pPipelineInfo, pExecutableCount, pProperties, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {VK_INCOMPLETE};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = VkResultBit(VK_INCOMPLETE);
         ValidateReturnCodes("vkGetPipelineExecutablePropertiesKHR", result, error_codes, success_codes);
     }
 }
@@ -1664,8 +1664,8 @@ void BestPractices::PostCallRecordvkGetPipelineExecutableStatisticsKHR(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordGetPipelineExecutableStatisticsKHR(device, pExecutableInfo, pStatisticCount, pStatistics, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {VK_INCOMPLETE};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = VkResultBit(VK_INCOMPLETE);
         ValidateReturnCodes("vkGetPipelineExecutableStatisticsKHR", result, error_codes, success_codes);
     }
 }
@@ -1678,8 +1678,8 @@ void BestPractices::PostCallRecordvkGetPipelineExecutableInternalRepresentations
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordGetPipelineExecutableInternalRepresentationsKHR(device, pExecutableInfo, pInternalRepresentationCount, pInternalRepresentations, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {VK_INCOMPLETE};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = VkResultBit(VK_INCOMPLETE);
         ValidateReturnCodes("vkGetPipelineExecutableInternalRepresentationsKHR", result, error_codes, success_codes);
     }
 }
@@ -1692,8 +1692,8 @@ void BestPractices::PostCallRecordvkCreateDebugReportCallbackEXT(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordCreateDebugReportCallbackEXT(instance, pCreateInfo, pAllocator, pCallback, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkCreateDebugReportCallbackEXT", result, error_codes, success_codes);
     }
 }
@@ -1704,8 +1704,8 @@ void BestPractices::PostCallRecordvkDebugMarkerSetObjectTagEXT(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordDebugMarkerSetObjectTagEXT(device, pTagInfo, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkDebugMarkerSetObjectTagEXT", result, error_codes, success_codes);
     }
 }
@@ -1716,8 +1716,8 @@ void BestPractices::PostCallRecordvkDebugMarkerSetObjectNameEXT(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordDebugMarkerSetObjectNameEXT(device, pNameInfo, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkDebugMarkerSetObjectNameEXT", result, error_codes, success_codes);
     }
 }
@@ -1732,8 +1732,8 @@ void BestPractices::PostCallRecordvkGetShaderInfoAMD(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordGetShaderInfoAMD(device, pipeline, shaderStage, infoType, pInfoSize, pInfo, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_FEATURE_NOT_PRESENT,VK_ERROR_OUT_OF_HOST_MEMORY};
-        static const std::vector<VkResult> success_codes = {VK_INCOMPLETE};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_FEATURE_NOT_PRESENT) | VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY);
+        static constexpr uint64_t success_codes = VkResultBit(VK_INCOMPLETE);
         ValidateReturnCodes("vkGetShaderInfoAMD", result, error_codes, success_codes);
     }
 }
@@ -1748,8 +1748,8 @@ void BestPractices::PostCallRecordvkCreateStreamDescriptorSurfaceGGP(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordCreateStreamDescriptorSurfaceGGP(instance, pCreateInfo, pAllocator, pSurface, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY,VK_ERROR_NATIVE_WINDOW_IN_USE_KHR};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY) | VkResultBit(VK_ERROR_NATIVE_WINDOW_IN_USE_KHR);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkCreateStreamDescriptorSurfaceGGP", result, error_codes, success_codes);
     }
 }
@@ -1768,8 +1768,8 @@ void BestPractices::PostCallRecordvkGetPhysicalDeviceExternalImageFormatProperti
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordGetPhysicalDeviceExternalImageFormatPropertiesNV(physicalDevice, format, type, tiling, usage, flags, externalHandleType, pExternalImageFormatProperties, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY,VK_ERROR_FORMAT_NOT_SUPPORTED};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY) | VkResultBit(VK_ERROR_FORMAT_NOT_SUPPORTED);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkGetPhysicalDeviceExternalImageFormatPropertiesNV", result, error_codes, success_codes);
     }
 }
@@ -1784,8 +1784,8 @@ void BestPractices::PostCallRecordvkGetMemoryWin32HandleNV(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordGetMemoryWin32HandleNV(device, memory, handleType, pHandle, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_TOO_MANY_OBJECTS,VK_ERROR_OUT_OF_HOST_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_TOO_MANY_OBJECTS) | VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkGetMemoryWin32HandleNV", result, error_codes, success_codes);
     }
 }
@@ -1802,8 +1802,8 @@ void BestPractices::PostCallRecordvkCreateViSurfaceNN(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordCreateViSurfaceNN(instance, pCreateInfo, pAllocator, pSurface, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY,VK_ERROR_NATIVE_WINDOW_IN_USE_KHR};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY) | VkResultBit(VK_ERROR_NATIVE_WINDOW_IN_USE_KHR);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkCreateViSurfaceNN", result, error_codes, success_codes);
     }
 }
@@ -1818,8 +1818,8 @@ void BestPractices::PostCallRecordvkCreateIndirectCommandsLayoutNVX(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordCreateIndirectCommandsLayoutNVX(device, pCreateInfo, pAllocator, pIndirectCommandsLayout, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkCreateIndirectCommandsLayoutNVX", result, error_codes, success_codes);
     }
 }
@@ -1832,8 +1832,8 @@ void BestPractices::PostCallRecordvkCreateObjectTableNVX(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordCreateObjectTableNVX(device, pCreateInfo, pAllocator, pObjectTable, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkCreateObjectTableNVX", result, error_codes, success_codes);
     }
 }
@@ -1847,8 +1847,8 @@ void BestPractices::PostCallRecordvkRegisterObjectsNVX(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordRegisterObjectsNVX(device, objectTable, objectCount, ppObjectTableEntries, pObjectIndices, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkRegisterObjectsNVX", result, error_codes, success_codes);
     }
 }
@@ -1862,8 +1862,8 @@ void BestPractices::PostCallRecordvkUnregisterObjectsNVX(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordUnregisterObjectsNVX(device, objectTable, objectCount, pObjectEntryTypes, pObjectIndices, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkUnregisterObjectsNVX", result, error_codes, success_codes);
     }
 }
@@ -1877,8 +1877,8 @@ void BestPractices::PostCallRecordvkAcquireXlibDisplayEXT(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordAcquireXlibDisplayEXT(physicalDevice, dpy, display, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_INITIALIZATION_FAILED};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_INITIALIZATION_FAILED);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkAcquireXlibDisplayEXT", result, error_codes, success_codes);
     }
 }
@@ -1892,8 +1892,8 @@ void BestPractices::PostCallRecordvkGetPhysicalDeviceSurfaceCapabilities2EXT(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordGetPhysicalDeviceSurfaceCapabilities2EXT(physicalDevice, surface, pSurfaceCapabilities, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY,VK_ERROR_SURFACE_LOST_KHR};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY) | VkResultBit(VK_ERROR_SURFACE_LOST_KHR);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkGetPhysicalDeviceSurfaceCapabilities2EXT", result, error_codes, success_codes);
     }
 }
@@ -1906,8 +1906,8 @@ void BestPractices::PostCallRecordvkGetSwapchainCounterEXT(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordGetSwapchainCounterEXT(device, swapchain, counter, pCounterValue, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_DEVICE_LOST,VK_ERROR_OUT_OF_DATE_KHR};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_DEVICE_LOST) | VkResultBit(VK_ERROR_OUT_OF_DATE_KHR);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkGetSwapchainCounterEXT", result, error_codes, success_codes);
     }
 }
@@ -1919,8 +1919,8 @@ void BestPractices::PostCallRecordvkGetRefreshCycleDurationGOOGLE(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordGetRefreshCycleDurationGOOGLE(device, swapchain, pDisplayTimingProperties, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_DEVICE_LOST,VK_ERROR_SURFACE_LOST_KHR};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_DEVICE_LOST) | VkResultBit(VK_ERROR_SURFACE_LOST_KHR);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkGetRefreshCycleDurationGOOGLE", result, error_codes, success_codes);
     }
 }
@@ -1933,8 +1933,8 @@ void BestPractices::PostCallRecordvkGetPastPresentationTimingGOOGLE(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordGetPastPresentationTimingGOOGLE(device, swapchain, pPresentationTimingCount, pPresentationTimings, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_DEVICE_LOST,VK_ERROR_OUT_OF_DATE_KHR,VK_ERROR_SURFACE_LOST_KHR};
-        static const std::vector<VkResult> success_codes = {VK_INCOMPLETE};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_DEVICE_LOST) | VkResultBit(VK_ERROR_OUT_OF_DATE_KHR) | VkResultBit(VK_ERROR_SURFACE_LOST_KHR);
+        static constexpr uint64_t success_codes = VkResultBit(VK_INCOMPLETE);
         ValidateReturnCodes("vkGetPastPresentationTimingGOOGLE", result, error_codes, success_codes);
     }
 }
@@ -1949,8 +1949,8 @@ void BestPractices::PostCallRecordvkCreateIOSSurfaceMVK(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordCreateIOSSurfaceMVK(instance, pCreateInfo, pAllocator, pSurface, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY,VK_ERROR_NATIVE_WINDOW_IN_USE_KHR};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY) | VkResultBit(VK_ERROR_NATIVE_WINDOW_IN_USE_KHR);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkCreateIOSSurfaceMVK", result, error_codes, success_codes);
     }
 }
@@ -1967,8 +1967,8 @@ void BestPractices::PostCallRecordvkCreateMacOSSurfaceMVK(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordCreateMacOSSurfaceMVK(instance, pCreateInfo, pAllocator, pSurface, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY,VK_ERROR_NATIVE_WINDOW_IN_USE_KHR};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY) | VkResultBit(VK_ERROR_NATIVE_WINDOW_IN_USE_KHR);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkCreateMacOSSurfaceMVK", result, error_codes, success_codes);
     }
 }
@@ -1981,8 +1981,8 @@ void BestPractices::PostCallRecordvkSetDebugUtilsObjectNameEXT(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordSetDebugUtilsObjectNameEXT(device, pNameInfo, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkSetDebugUtilsObjectNameEXT", result, error_codes, success_codes);
     }
 }
@@ -1993,8 +1993,8 @@ void BestPractices::PostCallRecordvkSetDebugUtilsObjectTagEXT(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordSetDebugUtilsObjectTagEXT(device, pTagInfo, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkSetDebugUtilsObjectTagEXT", result, error_codes, success_codes);
     }
 }
@@ -2007,8 +2007,8 @@ void BestPractices::PostCallRecordvkCreateDebugUtilsMessengerEXT(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordCreateDebugUtilsMessengerEXT(instance, pCreateInfo, pAllocator, pMessenger, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkCreateDebugUtilsMessengerEXT", result, error_codes, success_codes);
     }
 }
@@ -2022,8 +2022,8 @@ void BestPractices::PostCallRecordvkGetAndroidHardwareBufferPropertiesANDROID(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordGetAndroidHardwareBufferPropertiesANDROID(device, buffer, pProperties, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_INVALID_EXTERNAL_HANDLE_KHR};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_INVALID_EXTERNAL_HANDLE_KHR);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkGetAndroidHardwareBufferPropertiesANDROID", result, error_codes, success_codes);
     }
 }
@@ -2039,8 +2039,8 @@ void BestPractices::PostCallRecordvkGetMemoryAndroidHardwareBufferANDROID(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordGetMemoryAndroidHardwareBufferANDROID(device, pInfo, pBuffer, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_TOO_MANY_OBJECTS,VK_ERROR_OUT_OF_HOST_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_TOO_MANY_OBJECTS) | VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkGetMemoryAndroidHardwareBufferANDROID", result, error_codes, success_codes);
     }
 }
@@ -2063,8 +2063,8 @@ void BestPractices::PostCallRecordvkCreateAccelerationStructureNV(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordCreateAccelerationStructureNV(device, pCreateInfo, pAllocator, pAccelerationStructure, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkCreateAccelerationStructureNV", result, error_codes, success_codes);
     }
 }
@@ -2076,8 +2076,8 @@ void BestPractices::PostCallRecordvkBindAccelerationStructureMemoryNV(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordBindAccelerationStructureMemoryNV(device, bindInfoCount, pBindInfos, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkBindAccelerationStructureMemoryNV", result, error_codes, success_codes);
     }
 }
@@ -2093,8 +2093,8 @@ void BestPractices::PostCallRecordvkCreateRayTracingPipelinesNV(
     void*                                       state_data) {
     ValidationStateTracker::PostCallRecordCreateRayTracingPipelinesNV(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, result, state_data);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY,VK_ERROR_INVALID_SHADER_NV};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY) | VkResultBit(VK_ERROR_INVALID_SHADER_NV);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkCreateRayTracingPipelinesNV", result, error_codes, success_codes);
     }
 }
@@ -2109,8 +2109,8 @@ void BestPractices::PostCallRecordvkGetRayTracingShaderGroupHandlesNV(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordGetRayTracingShaderGroupHandlesNV(device, pipeline, firstGroup, groupCount, dataSize, pData, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkGetRayTracingShaderGroupHandlesNV", result, error_codes, success_codes);
     }
 }
@@ -2123,8 +2123,8 @@ void BestPractices::PostCallRecordvkGetAccelerationStructureHandleNV(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordGetAccelerationStructureHandleNV(device, accelerationStructure, dataSize, pData, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkGetAccelerationStructureHandleNV", result, error_codes, success_codes);
     }
 }
@@ -2136,8 +2136,8 @@ void BestPractices::PostCallRecordvkCompileDeferredNV(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordCompileDeferredNV(device, pipeline, shader, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkCompileDeferredNV", result, error_codes, success_codes);
     }
 }
@@ -2150,8 +2150,8 @@ void BestPractices::PostCallRecordvkGetMemoryHostPointerPropertiesEXT(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordGetMemoryHostPointerPropertiesEXT(device, handleType, pHostPointer, pMemoryHostPointerProperties, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_INVALID_EXTERNAL_HANDLE};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_INVALID_EXTERNAL_HANDLE);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkGetMemoryHostPointerPropertiesEXT", result, error_codes, success_codes);
     }
 }
@@ -2163,8 +2163,8 @@ void BestPractices::PostCallRecordvkGetPhysicalDeviceCalibrateableTimeDomainsEXT
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordGetPhysicalDeviceCalibrateableTimeDomainsEXT(physicalDevice, pTimeDomainCount, pTimeDomains, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {VK_INCOMPLETE};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = VkResultBit(VK_INCOMPLETE);
         ValidateReturnCodes("vkGetPhysicalDeviceCalibrateableTimeDomainsEXT", result, error_codes, success_codes);
     }
 }
@@ -2178,8 +2178,8 @@ void BestPractices::PostCallRecordvkGetCalibratedTimestampsEXT(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordGetCalibratedTimestampsEXT(device, timestampCount, pTimestampInfos, pTimestamps, pMaxDeviation, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkGetCalibratedTimestampsEXT", result, error_codes, success_codes);
     }
 }
@@ -2190,8 +2190,8 @@ void BestPractices::PostCallRecordvkInitializePerformanceApiINTEL(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordInitializePerformanceApiINTEL(device, pInitializeInfo, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_TOO_MANY_OBJECTS,VK_ERROR_OUT_OF_HOST_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_TOO_MANY_OBJECTS) | VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkInitializePerformanceApiINTEL", result, error_codes, success_codes);
     }
 }
@@ -2202,8 +2202,8 @@ void BestPractices::PostCallRecordvkCmdSetPerformanceMarkerINTEL(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordCmdSetPerformanceMarkerINTEL(commandBuffer, pMarkerInfo, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_TOO_MANY_OBJECTS,VK_ERROR_OUT_OF_HOST_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_TOO_MANY_OBJECTS) | VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkCmdSetPerformanceMarkerINTEL", result, error_codes, success_codes);
     }
 }
@@ -2214,8 +2214,8 @@ void BestPractices::PostCallRecordvkCmdSetPerformanceStreamMarkerINTEL(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordCmdSetPerformanceStreamMarkerINTEL(commandBuffer, pMarkerInfo, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_TOO_MANY_OBJECTS,VK_ERROR_OUT_OF_HOST_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_TOO_MANY_OBJECTS) | VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkCmdSetPerformanceStreamMarkerINTEL", result, error_codes, success_codes);
     }
 }
@@ -2226,8 +2226,8 @@ void BestPractices::PostCallRecordvkCmdSetPerformanceOverrideINTEL(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordCmdSetPerformanceOverrideINTEL(commandBuffer, pOverrideInfo, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_TOO_MANY_OBJECTS,VK_ERROR_OUT_OF_HOST_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_TOO_MANY_OBJECTS) | VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkCmdSetPerformanceOverrideINTEL", result, error_codes, success_codes);
     }
 }
@@ -2239,8 +2239,8 @@ void BestPractices::PostCallRecordvkAcquirePerformanceConfigurationINTEL(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordAcquirePerformanceConfigurationINTEL(device, pAcquireInfo, pConfiguration, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_TOO_MANY_OBJECTS,VK_ERROR_OUT_OF_HOST_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_TOO_MANY_OBJECTS) | VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkAcquirePerformanceConfigurationINTEL", result, error_codes, success_codes);
     }
 }
@@ -2251,8 +2251,8 @@ void BestPractices::PostCallRecordvkReleasePerformanceConfigurationINTEL(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordReleasePerformanceConfigurationINTEL(device, configuration, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_TOO_MANY_OBJECTS,VK_ERROR_OUT_OF_HOST_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_TOO_MANY_OBJECTS) | VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkReleasePerformanceConfigurationINTEL", result, error_codes, success_codes);
     }
 }
@@ -2263,8 +2263,8 @@ void BestPractices::PostCallRecordvkQueueSetPerformanceConfigurationINTEL(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordQueueSetPerformanceConfigurationINTEL(queue, configuration, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_TOO_MANY_OBJECTS,VK_ERROR_OUT_OF_HOST_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_TOO_MANY_OBJECTS) | VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkQueueSetPerformanceConfigurationINTEL", result, error_codes, success_codes);
     }
 }
@@ -2276,8 +2276,8 @@ void BestPractices::PostCallRecordvkGetPerformanceParameterINTEL(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordGetPerformanceParameterINTEL(device, parameter, pValue, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_TOO_MANY_OBJECTS,VK_ERROR_OUT_OF_HOST_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_TOO_MANY_OBJECTS) | VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkGetPerformanceParameterINTEL", result, error_codes, success_codes);
     }
 }
@@ -2292,8 +2292,8 @@ void BestPractices::PostCallRecordvkCreateImagePipeSurfaceFUCHSIA(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordCreateImagePipeSurfaceFUCHSIA(instance, pCreateInfo, pAllocator, pSurface, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkCreateImagePipeSurfaceFUCHSIA", result, error_codes, success_codes);
     }
 }
@@ -2310,8 +2310,8 @@ void BestPractices::PostCallRecordvkCreateMetalSurfaceEXT(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordCreateMetalSurfaceEXT(instance, pCreateInfo, pAllocator, pSurface, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY,VK_ERROR_NATIVE_WINDOW_IN_USE_KHR};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY) | VkResultBit(VK_ERROR_NATIVE_WINDOW_IN_USE_KHR);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkCreateMetalSurfaceEXT", result, error_codes, success_codes);
     }
 }
@@ -2325,8 +2325,8 @@ void BestPractices::PostCallRecordvkGetPhysicalDeviceToolPropertiesEXT(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordGetPhysicalDeviceToolPropertiesEXT(physicalDevice, pToolCount, pToolProperties, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {};
-        static const std::vector<VkResult> success_codes = {VK_INCOMPLETE};
+        static constexpr uint64_t error_codes = 0;
+        static constexpr uint64_t success_codes = VkResultBit(VK_INCOMPLETE);
         ValidateReturnCodes("vkGetPhysicalDeviceToolPropertiesEXT", result, error_codes, success_codes);
     }
 }
@@ -2338,8 +2338,8 @@ void BestPractices::PostCallRecordvkGetPhysicalDeviceCooperativeMatrixProperties
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordGetPhysicalDeviceCooperativeMatrixPropertiesNV(physicalDevice, pPropertyCount, pProperties, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {VK_INCOMPLETE};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = VkResultBit(VK_INCOMPLETE);
         ValidateReturnCodes("vkGetPhysicalDeviceCooperativeMatrixPropertiesNV", result, error_codes, success_codes);
     }
 }
@@ -2351,8 +2351,8 @@ void BestPractices::PostCallRecordvkGetPhysicalDeviceSupportedFramebufferMixedSa
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV(physicalDevice, pCombinationCount, pCombinations, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {VK_INCOMPLETE};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = VkResultBit(VK_INCOMPLETE);
         ValidateReturnCodes("vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV", result, error_codes, success_codes);
     }
 }
@@ -2367,8 +2367,8 @@ void BestPractices::PostCallRecordvkGetPhysicalDeviceSurfacePresentModes2EXT(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordGetPhysicalDeviceSurfacePresentModes2EXT(physicalDevice, pSurfaceInfo, pPresentModeCount, pPresentModes, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY,VK_ERROR_SURFACE_LOST_KHR};
-        static const std::vector<VkResult> success_codes = {VK_INCOMPLETE};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY) | VkResultBit(VK_ERROR_SURFACE_LOST_KHR);
+        static constexpr uint64_t success_codes = VkResultBit(VK_INCOMPLETE);
         ValidateReturnCodes("vkGetPhysicalDeviceSurfacePresentModes2EXT", result, error_codes, success_codes);
     }
 }
@@ -2383,8 +2383,8 @@ void BestPractices::PostCallRecordvkAcquireFullScreenExclusiveModeEXT(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordAcquireFullScreenExclusiveModeEXT(device, swapchain, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY,VK_ERROR_INITIALIZATION_FAILED,VK_ERROR_SURFACE_LOST_KHR};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY) | VkResultBit(VK_ERROR_INITIALIZATION_FAILED) | VkResultBit(VK_ERROR_SURFACE_LOST_KHR);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkAcquireFullScreenExclusiveModeEXT", result, error_codes, success_codes);
     }
 }
@@ -2399,8 +2399,8 @@ void BestPractices::PostCallRecordvkReleaseFullScreenExclusiveModeEXT(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordReleaseFullScreenExclusiveModeEXT(device, swapchain, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY,VK_ERROR_SURFACE_LOST_KHR};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY) | VkResultBit(VK_ERROR_SURFACE_LOST_KHR);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkReleaseFullScreenExclusiveModeEXT", result, error_codes, success_codes);
     }
 }
@@ -2416,8 +2416,8 @@ void BestPractices::PostCallRecordvkGetDeviceGroupSurfacePresentModes2EXT(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordGetDeviceGroupSurfacePresentModes2EXT(device, pSurfaceInfo, pModes, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY,VK_ERROR_SURFACE_LOST_KHR};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY) | VkResultBit(VK_ERROR_SURFACE_LOST_KHR);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkGetDeviceGroupSurfacePresentModes2EXT", result, error_codes, success_codes);
     }
 }
@@ -2432,8 +2432,8 @@ void BestPractices::PostCallRecordvkCreateHeadlessSurfaceEXT(
     VkResult                                    result) {
     ValidationStateTracker::PostCallRecordCreateHeadlessSurfaceEXT(instance, pCreateInfo, pAllocator, pSurface, result);
     if (result != VK_SUCCESS) {
-        static const std::vector<VkResult> error_codes = {VK_ERROR_OUT_OF_HOST_MEMORY,VK_ERROR_OUT_OF_DEVICE_MEMORY};
-        static const std::vector<VkResult> success_codes = {};
+        static constexpr uint64_t error_codes = VkResultBit(VK_ERROR_OUT_OF_HOST_MEMORY) | VkResultBit(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        static constexpr uint64_t success_codes = 0;
         ValidateReturnCodes("vkCreateHeadlessSurfaceEXT", result, error_codes, success_codes);
     }
 }
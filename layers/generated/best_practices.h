@@ -1474,3 +1474,78 @@ const std::unordered_map<std::string, DeprecationData>  deprecated_extensions =
     {"VK_NV_win32_keyed_mutex", {kExtPromoted, "VK_KHR_win32_keyed_mutex"}},
 };
 
+// VkResult core codes lie in [kResultCoreMin, kResultCoreMax] and extension codes are
+// +/-(kResultExtBase + extension_number * 1000 + offset). Each kind maps to its return code mask bit through a dense
+// table of bit index plus one, with 0 for VK_SUCCESS and unknown codes.
+static constexpr int32_t kResultCoreMin = -13;
+static constexpr int32_t kResultCoreMax = 5;
+static constexpr uint8_t kResultCoreBits[] = {
+    25,  // VK_ERROR_UNKNOWN
+    6,  // VK_ERROR_FRAGMENTED_POOL
+    4,  // VK_ERROR_FORMAT_NOT_SUPPORTED
+    24,  // VK_ERROR_TOO_MANY_OBJECTS
+    9,  // VK_ERROR_INCOMPATIBLE_DRIVER
+    3,  // VK_ERROR_FEATURE_NOT_PRESENT
+    2,  // VK_ERROR_EXTENSION_NOT_PRESENT
+    15,  // VK_ERROR_LAYER_NOT_PRESENT
+    16,  // VK_ERROR_MEMORY_MAP_FAILED
+    1,  // VK_ERROR_DEVICE_LOST
+    10,  // VK_ERROR_INITIALIZATION_FAILED
+    20,  // VK_ERROR_OUT_OF_DEVICE_MEMORY
+    21,  // VK_ERROR_OUT_OF_HOST_MEMORY
+    0,
+    30,  // VK_NOT_READY
+    32,  // VK_TIMEOUT
+    28,  // VK_EVENT_SET
+    27,  // VK_EVENT_RESET
+    29,  // VK_INCOMPLETE
+};
+static constexpr int32_t kResultExtBase = 1000000000;
+static constexpr uint32_t kResultExtCount = 258;
+static constexpr uint32_t kResultExtOffsets = 5;
+// Row of kResultExtBits plus one for each extension number, 0 for extensions without result codes
+static constexpr uint8_t kResultExtRows[kResultExtCount] = {
+    1, 2, 0, 3, 0, 0, 0, 0, 0, 0, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 6, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0,
+    0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11,
+    0, 12,
+};
+// Indexed by offset * 2, plus one for error codes
+static constexpr uint8_t kResultExtBits[][kResultExtOffsets * 2] = {
+    {0, 23, 0, 17, 0, 0, 0, 0, 0, 0},  // VK_ERROR_SURFACE_LOST_KHR, VK_ERROR_NATIVE_WINDOW_IN_USE_KHR
+    {0, 0, 0, 0, 0, 0, 31, 0, 0, 19},  // VK_SUBOPTIMAL_KHR, VK_ERROR_OUT_OF_DATE_KHR
+    {0, 0, 0, 8, 0, 0, 0, 0, 0, 0},  // VK_ERROR_INCOMPATIBLE_DISPLAY_KHR
+    {0, 0, 0, 26, 0, 0, 0, 0, 0, 0},  // VK_ERROR_VALIDATION_FAILED_EXT
+    {0, 14, 0, 0, 0, 0, 0, 0, 0, 0},  // VK_ERROR_INVALID_SHADER_NV
+    {0, 22, 0, 0, 0, 0, 0, 0, 0, 0},  // VK_ERROR_OUT_OF_POOL_MEMORY
+    {0, 0, 0, 0, 0, 0, 0, 12, 0, 0},  // VK_ERROR_INVALID_EXTERNAL_HANDLE
+    {0, 11, 0, 0, 0, 0, 0, 0, 0, 0},  // VK_ERROR_INVALID_DRM_FORMAT_MODIFIER_PLANE_LAYOUT_EXT
+    {0, 5, 0, 0, 0, 0, 0, 0, 0, 0},  // VK_ERROR_FRAGMENTATION
+    {0, 0, 0, 18, 0, 0, 0, 0, 0, 0},  // VK_ERROR_NOT_PERMITTED_EXT
+    {0, 7, 0, 0, 0, 0, 0, 0, 0, 0},  // VK_ERROR_FULL_SCREEN_EXCLUSIVE_MODE_LOST_EXT
+    {0, 13, 0, 0, 0, 0, 0, 0, 0, 0},  // VK_ERROR_INVALID_OPAQUE_CAPTURE_ADDRESS
+};
+
+static constexpr uint64_t ResultBitFromEntry(uint32_t entry) { return entry ? 1ULL << (entry - 1) : 0; }
+
+// code is the absolute value of the result less kResultExtBase
+static constexpr uint64_t ResultExtBit(uint32_t code, bool error) {
+    return (code / 1000 < kResultExtCount && code % 1000 < kResultExtOffsets && kResultExtRows[code / 1000])
+               ? ResultBitFromEntry(kResultExtBits[kResultExtRows[code / 1000] - 1][(code % 1000) * 2 + error])
+               : 0;
+}
+
+// Bit of a VkResult code in the return code masks passed to ValidateReturnCodes, 0 for VK_SUCCESS and unknown codes
+static constexpr uint64_t VkResultBit(VkResult result) {
+    return (result >= kResultCoreMin && result <= kResultCoreMax)
+               ? ResultBitFromEntry(kResultCoreBits[result - kResultCoreMin])
+               : (result >= kResultExtBase)
+                     ? ResultExtBit(static_cast<uint32_t>(result - kResultExtBase), false)
+                     : (result <= -kResultExtBase) ? ResultExtBit(static_cast<uint32_t>(-(result + kResultExtBase)), true) : 0;
+}
+
@@ -23,6 +23,7 @@
  */
 
 
+#include <stdlib.h>
 #include <string.h>
 #include <mutex>
 
@@ -81,6 +82,7 @@ typedef struct {
 } function_data;
 
 extern const std::unordered_map<std::string, function_data> name_to_funcptr_map;
+extern const char *const kEntryPointNames[kEntryPointCount];
 
 // Manually written functions
 
@@ -141,6 +143,8 @@ static const std::unordered_map<std::string, ValidationCheckDisables> Validation
 static const std::unordered_map<std::string, ValidationCheckEnables> ValidationEnableLookup = {
     {"VALIDATION_CHECK_ENABLE_VENDOR_SPECIFIC_ARM", VALIDATION_CHECK_ENABLE_VENDOR_SPECIFIC_ARM},
     {"VALIDATION_CHECK_ENABLE_VENDOR_SPECIFIC_ALL", VALIDATION_CHECK_ENABLE_VENDOR_SPECIFIC_ALL},
+    {"VALIDATION_CHECK_ENABLE_UNIFIED_HANDLE_REGISTRY", VALIDATION_CHECK_ENABLE_UNIFIED_HANDLE_REGISTRY},
+    {"VALIDATION_CHECK_ENABLE_ENTRY_POINT_COSTS", VALIDATION_CHECK_ENABLE_ENTRY_POINT_COSTS},
 };
 
 // Set the local disable flag for the appropriate VALIDATION_CHECK_DISABLE enum
@@ -208,6 +212,12 @@ void SetValidationEnable(CHECK_ENABLED* enable_data, const ValidationCheckEnable
         case VALIDATION_CHECK_ENABLE_VENDOR_SPECIFIC_ALL:
             enable_data->SetAllVendorSpecific(true);
             break;
+        case VALIDATION_CHECK_ENABLE_UNIFIED_HANDLE_REGISTRY:
+            enable_data->unified_handle_registry = true;
+            break;
+        case VALIDATION_CHECK_ENABLE_ENTRY_POINT_COSTS:
+            enable_data->entry_point_costs = true;
+            break;
         default:
             assert(true);
     }
@@ -313,16 +323,44 @@ void SetLocalDisableSetting(std::string list_of_disables, std::string delimiter,
     }
 }
 
+// Given a string representation of a list of message ids, add them to the set of muted messages
+void SetLocalMessageIdFilter(std::string list_of_ids, std::string delimiter, debug_report_data* debug_data) {
+    size_t pos = 0;
+    std::string token;
+    while (list_of_ids.length() != 0) {
+        pos = list_of_ids.find(delimiter);
+        if (pos != std::string::npos) {
+            token = list_of_ids.substr(0, pos);
+        } else {
+            pos = list_of_ids.length() - delimiter.length();
+            token = list_of_ids;
+        }
+        if (!token.empty()) {
+            debug_data->filter_message_ids.emplace(HashMessageId(token), token);
+        }
+        list_of_ids.erase(0, pos + delimiter.length());
+    }
+}
+
 // Process enables and disables set though the vk_layer_settings.txt config file or through an environment variable
-void ProcessConfigAndEnvSettings(const char* layer_description, CHECK_ENABLED* enables, CHECK_DISABLED* disables) {
+void ProcessConfigAndEnvSettings(const char* layer_description, CHECK_ENABLED* enables, CHECK_DISABLED* disables,
+                                 debug_report_data* debug_data) {
     std::string enable_key = layer_description;
     std::string disable_key = layer_description;
+    std::string message_id_filter_key = layer_description;
+    std::string duplicate_message_limit_key = layer_description;
     enable_key.append(".enables");
     disable_key.append(".disables");
+    message_id_filter_key.append(".message_id_filter");
+    duplicate_message_limit_key.append(".duplicate_message_limit");
     std::string list_of_config_enables = getLayerOption(enable_key.c_str());
     std::string list_of_env_enables = GetLayerEnvVar("VK_LAYER_ENABLES");
     std::string list_of_config_disables = getLayerOption(disable_key.c_str());
     std::string list_of_env_disables = GetLayerEnvVar("VK_LAYER_DISABLES");
+    std::string list_of_config_filter_ids = getLayerOption(message_id_filter_key.c_str());
+    std::string list_of_env_filter_ids = GetLayerEnvVar("VK_LAYER_MESSAGE_ID_FILTER");
+    std::string config_duplicate_message_limit = getLayerOption(duplicate_message_limit_key.c_str());
+    std::string env_duplicate_message_limit = GetLayerEnvVar("VK_LAYER_DUPLICATE_MESSAGE_LIMIT");
 #if defined(_WIN32)
     std::string env_delimiter = ";";
 #else
@@ -332,6 +370,43 @@ void ProcessConfigAndEnvSettings(const char* layer_description, CHECK_ENABLED* e
     SetLocalEnableSetting(list_of_env_enables, env_delimiter, enables);
     SetLocalDisableSetting(list_of_config_disables, ",", disables);
     SetLocalDisableSetting(list_of_env_disables, env_delimiter, disables);
+    SetLocalMessageIdFilter(list_of_config_filter_ids, ",", debug_data);
+    SetLocalMessageIdFilter(list_of_env_filter_ids, env_delimiter, debug_data);
+    // The environment variable overrides the config file limit
+    const std::string &duplicate_message_limit =
+        env_duplicate_message_limit.empty() ? config_duplicate_message_limit : env_duplicate_message_limit;
+    if (!duplicate_message_limit.empty()) {
+        debug_data->duplicate_message_limit = static_cast<uint32_t>(strtoul(duplicate_message_limit.c_str(), nullptr, 10));
+    }
+}
+
+// Names of the validation objects entry point costs are reported for, indexed by LayerObjectTypeId. The command counter is
+// the only object dispatched to as LayerObjectTypeDevice.
+static const char *const kLayerObjectTypeNames[LayerObjectTypeMaxEnum] = {
+    "Instance", "CommandCounter", "Threading", "ParameterValidation",
+    "ObjectTracker", "CoreValidation", "BestPractices", "GpuAssisted",
+};
+
+// The validation objects a device dispatches to, as a mask of LayerObjectTypeId bits
+static uint32_t DispatchedObjectTypeMask(const ValidationObject *layer_data) {
+    uint32_t mask = 0;
+    for (auto intercept : layer_data->object_dispatch) {
+        mask |= 1u << intercept->container_type;
+    }
+    return mask;
+}
+
+// Appends the entry point costs of a device to the file named by the entry_point_costs_file setting, if there is one
+static void DumpEntryPointCosts(const ValidationObject *layer_data) {
+    std::string costs_file_key = OBJECT_LAYER_DESCRIPTION;
+    costs_file_key.append(".entry_point_costs_file");
+    const std::string costs_file = getLayerOption(costs_file_key.c_str());
+    if (costs_file.empty()) return;
+    FILE *out = (costs_file == "stdout") ? stdout : fopen(costs_file.c_str(), "a");
+    if (!out) return;
+    fprintf(out, "Entry point costs of %s:\n", layer_data->report_data->FormatHandle(layer_data->device).c_str());
+    layer_data->entry_point_costs->Dump(out, DispatchedObjectTypeMask(layer_data));
+    if (out != stdout) fclose(out);
 }
 
 
@@ -437,7 +512,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo *pCreat
     if (validation_flags_ext) {
         SetValidationFlags(&local_disables, validation_flags_ext);
     }
-    ProcessConfigAndEnvSettings(OBJECT_LAYER_DESCRIPTION, &local_enables, &local_disables);
+    ProcessConfigAndEnvSettings(OBJECT_LAYER_DESCRIPTION, &local_enables, &local_disables, report_data);
 
     // Create temporary dispatch vector for pre-calls until instance is created
     std::vector<ValidationObject*> local_object_dispatch;
@@ -698,6 +773,18 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice gpu, const VkDevice
         dev_intercept->device_extensions = device_interceptor->device_extensions;
     }
 
+    if (instance_interceptor->enabled.unified_handle_registry) {
+        device_interceptor->handle_registry.reset(new HandleRegistry);
+        for (auto dev_intercept : device_interceptor->object_dispatch) {
+            dev_intercept->AttachHandleRegistry(device_interceptor->handle_registry.get());
+        }
+    }
+
+    if (instance_interceptor->enabled.entry_point_costs) {
+        device_interceptor->entry_point_costs.reset(
+            new EntryPointCosts(kEntryPointCount, kEntryPointNames, LayerObjectTypeMaxEnum, kLayerObjectTypeNames));
+    }
+
     for (auto intercept : instance_interceptor->object_dispatch) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateDevice(gpu, pCreateInfo, pAllocator, pDevice, result);
@@ -727,6 +814,10 @@ VKAPI_ATTR void VKAPI_CALL DestroyDevice(VkDevice device, const VkAllocationCall
         intercept->PostCallRecordDestroyDevice(device, pAllocator);
     }
 
+    if (layer_data->entry_point_costs) {
+        DumpEntryPointCosts(layer_data);
+    }
+
     for (auto item = layer_data->object_dispatch.begin(); item != layer_data->object_dispatch.end(); item++) {
         delete *item;
     }
@@ -744,6 +835,8 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateGraphicsPipelines(
     const VkAllocationCallbacks*                pAllocator,
     VkPipeline*                                 pPipelines) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCreateGraphicsPipelines);
     bool skip = false;
 
     create_graphics_pipeline_api_state cgpl_state[LayerObjectTypeMaxEnum]{};
@@ -751,11 +844,13 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateGraphicsPipelines(
     for (auto intercept : layer_data->object_dispatch) {
         cgpl_state[intercept->container_type].pCreateInfos = pCreateInfos;
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateGraphicsPipelines, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, &(cgpl_state[intercept->container_type]));
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateGraphicsPipelines, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, &(cgpl_state[intercept->container_type]));
     }
 
@@ -765,6 +860,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateGraphicsPipelines(
 
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateGraphicsPipelines, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, result, &(cgpl_state[intercept->container_type]));
     }
     return result;
@@ -779,6 +875,8 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateComputePipelines(
     const VkAllocationCallbacks*                pAllocator,
     VkPipeline*                                 pPipelines) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCreateComputePipelines);
     bool skip = false;
 
     create_compute_pipeline_api_state ccpl_state[LayerObjectTypeMaxEnum]{};
@@ -786,11 +884,13 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateComputePipelines(
     for (auto intercept : layer_data->object_dispatch) {
         ccpl_state[intercept->container_type].pCreateInfos = pCreateInfos;
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateComputePipelines, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, &(ccpl_state[intercept->container_type]));
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateComputePipelines, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, &(ccpl_state[intercept->container_type]));
     }
 
@@ -800,6 +900,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateComputePipelines(
 
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateComputePipelines, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, result, &(ccpl_state[intercept->container_type]));
     }
     return result;
@@ -813,6 +914,8 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRayTracingPipelinesNV(
     const VkAllocationCallbacks*                pAllocator,
     VkPipeline*                                 pPipelines) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCreateRayTracingPipelinesNV);
     bool skip = false;
 
     create_ray_tracing_pipeline_api_state crtpl_state[LayerObjectTypeMaxEnum]{};
@@ -820,12 +923,14 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRayTracingPipelinesNV(
     for (auto intercept : layer_data->object_dispatch) {
         crtpl_state[intercept->container_type].pCreateInfos = pCreateInfos;
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateRayTracingPipelinesNV, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateRayTracingPipelinesNV(device, pipelineCache, createInfoCount, pCreateInfos,
                                                                       pAllocator, pPipelines, &(crtpl_state[intercept->container_type]));
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateRayTracingPipelinesNV, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCreateRayTracingPipelinesNV(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                             pPipelines, &(crtpl_state[intercept->container_type]));
     }
@@ -834,6 +939,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRayTracingPipelinesNV(
 
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateRayTracingPipelinesNV, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCreateRayTracingPipelinesNV(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                              pPipelines, result, &(crtpl_state[intercept->container_type]));
     }
@@ -847,6 +953,8 @@ VKAPI_ATTR VkResult VKAPI_CALL CreatePipelineLayout(
     const VkAllocationCallbacks*                pAllocator,
     VkPipelineLayout*                           pPipelineLayout) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCreatePipelineLayout);
     bool skip = false;
 
     create_pipeline_layout_api_state cpl_state{};
@@ -854,16 +962,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreatePipelineLayout(
 
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreatePipelineLayout, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreatePipelineLayout, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout, &cpl_state);
     }
     VkResult result = DispatchCreatePipelineLayout(device, &cpl_state.modified_create_info, pAllocator, pPipelineLayout);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreatePipelineLayout, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout, result);
     }
     return result;
@@ -876,6 +987,8 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateShaderModule(
     const VkAllocationCallbacks*                pAllocator,
     VkShaderModule*                             pShaderModule) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCreateShaderModule);
     bool skip = false;
 
     create_shader_module_api_state csm_state{};
@@ -883,16 +996,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateShaderModule(
 
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateShaderModule, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule, &csm_state);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateShaderModule, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule, &csm_state);
     }
     VkResult result = DispatchCreateShaderModule(device, &csm_state.instrumented_create_info, pAllocator, pShaderModule);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateShaderModule, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule, result, &csm_state);
     }
     return result;
@@ -903,22 +1019,27 @@ VKAPI_ATTR VkResult VKAPI_CALL AllocateDescriptorSets(
     const VkDescriptorSetAllocateInfo*          pAllocateInfo,
     VkDescriptorSet*                            pDescriptorSets) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointAllocateDescriptorSets);
     bool skip = false;
 
     cvdescriptorset::AllocateDescriptorSetsData ads_state(pAllocateInfo->descriptorSetCount);
 
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointAllocateDescriptorSets, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateAllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets, &ads_state);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointAllocateDescriptorSets, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordAllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets);
     }
     VkResult result = DispatchAllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointAllocateDescriptorSets, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordAllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets, result, &ads_state);
     }
     return result;
@@ -931,6 +1052,8 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateBuffer(
     const VkAllocationCallbacks*                pAllocator,
     VkBuffer*                                   pBuffer) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCreateBuffer);
     bool skip = false;
 
     create_buffer_api_state cb_state{};
@@ -938,16 +1061,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateBuffer(
 
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateBuffer, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateBuffer(device, pCreateInfo, pAllocator, pBuffer);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateBuffer, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCreateBuffer(device, pCreateInfo, pAllocator, pBuffer, &cb_state);
     }
     VkResult result = DispatchCreateBuffer(device, &cb_state.modified_create_info, pAllocator, pBuffer);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateBuffer, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCreateBuffer(device, pCreateInfo, pAllocator, pBuffer, result);
     }
     return result;
@@ -1072,6 +1198,22 @@ VKAPI_ATTR VkResult VKAPI_CALL GetValidationCacheDataEXT(
 
 }
 
+// Layer-specific query of a device's entry point costs, see entry_point_costs.h
+VKAPI_ATTR VkResult VKAPI_CALL GetEntryPointCostsLAYER(VkDevice device, uint32_t *pCostCount, LayerEntryPointCost *pCosts) {
+    auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    if (!layer_data->entry_point_costs) return VK_ERROR_FEATURE_NOT_PRESENT;
+
+    const auto costs = layer_data->entry_point_costs->Collect(DispatchedObjectTypeMask(layer_data));
+    if (!pCosts) {
+        *pCostCount = static_cast<uint32_t>(costs.size());
+        return VK_SUCCESS;
+    }
+    const uint32_t count = std::min(*pCostCount, static_cast<uint32_t>(costs.size()));
+    std::copy(costs.begin(), costs.begin() + count, pCosts);
+    *pCostCount = count;
+    return (count < costs.size()) ? VK_INCOMPLETE : VK_SUCCESS;
+}
+
 
 VKAPI_ATTR VkResult VKAPI_CALL EnumeratePhysicalDevices(
     VkInstance                                  instance,
@@ -1236,19 +1378,24 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceQueue(
     uint32_t                                    queueIndex,
     VkQueue*                                    pQueue) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointGetDeviceQueue);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetDeviceQueue, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceQueue(device, queueFamilyIndex, queueIndex, pQueue);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetDeviceQueue, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordGetDeviceQueue(device, queueFamilyIndex, queueIndex, pQueue);
     }
     DispatchGetDeviceQueue(device, queueFamilyIndex, queueIndex, pQueue);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetDeviceQueue, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordGetDeviceQueue(device, queueFamilyIndex, queueIndex, pQueue);
     }
 }
@@ -1259,19 +1406,24 @@ VKAPI_ATTR VkResult VKAPI_CALL QueueSubmit(
     const VkSubmitInfo*                         pSubmits,
     VkFence                                     fence) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointQueueSubmit);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointQueueSubmit, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateQueueSubmit(queue, submitCount, pSubmits, fence);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointQueueSubmit, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordQueueSubmit(queue, submitCount, pSubmits, fence);
     }
     VkResult result = DispatchQueueSubmit(queue, submitCount, pSubmits, fence);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointQueueSubmit, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordQueueSubmit(queue, submitCount, pSubmits, fence, result);
     }
     return result;
@@ -1280,19 +1432,24 @@ VKAPI_ATTR VkResult VKAPI_CALL QueueSubmit(
 VKAPI_ATTR VkResult VKAPI_CALL QueueWaitIdle(
     VkQueue                                     queue) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointQueueWaitIdle);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointQueueWaitIdle, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateQueueWaitIdle(queue);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointQueueWaitIdle, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordQueueWaitIdle(queue);
     }
     VkResult result = DispatchQueueWaitIdle(queue);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointQueueWaitIdle, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordQueueWaitIdle(queue, result);
     }
     return result;
@@ -1301,19 +1458,24 @@ VKAPI_ATTR VkResult VKAPI_CALL QueueWaitIdle(
 VKAPI_ATTR VkResult VKAPI_CALL DeviceWaitIdle(
     VkDevice                                    device) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointDeviceWaitIdle);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDeviceWaitIdle, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDeviceWaitIdle(device);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDeviceWaitIdle, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordDeviceWaitIdle(device);
     }
     VkResult result = DispatchDeviceWaitIdle(device);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDeviceWaitIdle, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordDeviceWaitIdle(device, result);
     }
     return result;
@@ -1325,19 +1487,24 @@ VKAPI_ATTR VkResult VKAPI_CALL AllocateMemory(
     const VkAllocationCallbacks*                pAllocator,
     VkDeviceMemory*                             pMemory) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointAllocateMemory);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointAllocateMemory, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateAllocateMemory(device, pAllocateInfo, pAllocator, pMemory);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointAllocateMemory, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordAllocateMemory(device, pAllocateInfo, pAllocator, pMemory);
     }
     VkResult result = DispatchAllocateMemory(device, pAllocateInfo, pAllocator, pMemory);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointAllocateMemory, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordAllocateMemory(device, pAllocateInfo, pAllocator, pMemory, result);
     }
     return result;
@@ -1348,19 +1515,24 @@ VKAPI_ATTR void VKAPI_CALL FreeMemory(
     VkDeviceMemory                              memory,
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointFreeMemory);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointFreeMemory, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateFreeMemory(device, memory, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointFreeMemory, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordFreeMemory(device, memory, pAllocator);
     }
     DispatchFreeMemory(device, memory, pAllocator);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointFreeMemory, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordFreeMemory(device, memory, pAllocator);
     }
 }
@@ -1373,19 +1545,24 @@ VKAPI_ATTR VkResult VKAPI_CALL MapMemory(
     VkMemoryMapFlags                            flags,
     void**                                      ppData) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointMapMemory);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointMapMemory, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateMapMemory(device, memory, offset, size, flags, ppData);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointMapMemory, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordMapMemory(device, memory, offset, size, flags, ppData);
     }
     VkResult result = DispatchMapMemory(device, memory, offset, size, flags, ppData);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointMapMemory, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordMapMemory(device, memory, offset, size, flags, ppData, result);
     }
     return result;
@@ -1395,19 +1572,24 @@ VKAPI_ATTR void VKAPI_CALL UnmapMemory(
     VkDevice                                    device,
     VkDeviceMemory                              memory) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointUnmapMemory);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointUnmapMemory, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateUnmapMemory(device, memory);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointUnmapMemory, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordUnmapMemory(device, memory);
     }
     DispatchUnmapMemory(device, memory);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointUnmapMemory, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordUnmapMemory(device, memory);
     }
 }
@@ -1417,19 +1599,24 @@ VKAPI_ATTR VkResult VKAPI_CALL FlushMappedMemoryRanges(
     uint32_t                                    memoryRangeCount,
     const VkMappedMemoryRange*                  pMemoryRanges) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointFlushMappedMemoryRanges);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointFlushMappedMemoryRanges, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateFlushMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointFlushMappedMemoryRanges, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordFlushMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
     }
     VkResult result = DispatchFlushMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointFlushMappedMemoryRanges, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordFlushMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges, result);
     }
     return result;
@@ -1440,19 +1627,24 @@ VKAPI_ATTR VkResult VKAPI_CALL InvalidateMappedMemoryRanges(
     uint32_t                                    memoryRangeCount,
     const VkMappedMemoryRange*                  pMemoryRanges) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointInvalidateMappedMemoryRanges);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointInvalidateMappedMemoryRanges, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateInvalidateMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointInvalidateMappedMemoryRanges, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordInvalidateMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
     }
     VkResult result = DispatchInvalidateMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointInvalidateMappedMemoryRanges, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordInvalidateMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges, result);
     }
     return result;
@@ -1463,19 +1655,24 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceMemoryCommitment(
     VkDeviceMemory                              memory,
     VkDeviceSize*                               pCommittedMemoryInBytes) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointGetDeviceMemoryCommitment);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetDeviceMemoryCommitment, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceMemoryCommitment(device, memory, pCommittedMemoryInBytes);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetDeviceMemoryCommitment, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordGetDeviceMemoryCommitment(device, memory, pCommittedMemoryInBytes);
     }
     DispatchGetDeviceMemoryCommitment(device, memory, pCommittedMemoryInBytes);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetDeviceMemoryCommitment, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordGetDeviceMemoryCommitment(device, memory, pCommittedMemoryInBytes);
     }
 }
@@ -1486,19 +1683,24 @@ VKAPI_ATTR VkResult VKAPI_CALL BindBufferMemory(
     VkDeviceMemory                              memory,
     VkDeviceSize                                memoryOffset) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointBindBufferMemory);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointBindBufferMemory, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateBindBufferMemory(device, buffer, memory, memoryOffset);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointBindBufferMemory, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordBindBufferMemory(device, buffer, memory, memoryOffset);
     }
     VkResult result = DispatchBindBufferMemory(device, buffer, memory, memoryOffset);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointBindBufferMemory, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordBindBufferMemory(device, buffer, memory, memoryOffset, result);
     }
     return result;
@@ -1510,19 +1712,24 @@ VKAPI_ATTR VkResult VKAPI_CALL BindImageMemory(
     VkDeviceMemory                              memory,
     VkDeviceSize                                memoryOffset) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointBindImageMemory);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointBindImageMemory, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateBindImageMemory(device, image, memory, memoryOffset);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointBindImageMemory, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordBindImageMemory(device, image, memory, memoryOffset);
     }
     VkResult result = DispatchBindImageMemory(device, image, memory, memoryOffset);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointBindImageMemory, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordBindImageMemory(device, image, memory, memoryOffset, result);
     }
     return result;
@@ -1533,19 +1740,24 @@ VKAPI_ATTR void VKAPI_CALL GetBufferMemoryRequirements(
     VkBuffer                                    buffer,
     VkMemoryRequirements*                       pMemoryRequirements) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointGetBufferMemoryRequirements);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetBufferMemoryRequirements, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetBufferMemoryRequirements(device, buffer, pMemoryRequirements);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetBufferMemoryRequirements, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordGetBufferMemoryRequirements(device, buffer, pMemoryRequirements);
     }
     DispatchGetBufferMemoryRequirements(device, buffer, pMemoryRequirements);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetBufferMemoryRequirements, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordGetBufferMemoryRequirements(device, buffer, pMemoryRequirements);
     }
 }
@@ -1555,19 +1767,24 @@ VKAPI_ATTR void VKAPI_CALL GetImageMemoryRequirements(
     VkImage                                     image,
     VkMemoryRequirements*                       pMemoryRequirements) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointGetImageMemoryRequirements);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetImageMemoryRequirements, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetImageMemoryRequirements(device, image, pMemoryRequirements);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetImageMemoryRequirements, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordGetImageMemoryRequirements(device, image, pMemoryRequirements);
     }
     DispatchGetImageMemoryRequirements(device, image, pMemoryRequirements);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetImageMemoryRequirements, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordGetImageMemoryRequirements(device, image, pMemoryRequirements);
     }
 }
@@ -1578,19 +1795,24 @@ VKAPI_ATTR void VKAPI_CALL GetImageSparseMemoryRequirements(
     uint32_t*                                   pSparseMemoryRequirementCount,
     VkSparseImageMemoryRequirements*            pSparseMemoryRequirements) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointGetImageSparseMemoryRequirements);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetImageSparseMemoryRequirements, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetImageSparseMemoryRequirements(device, image, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetImageSparseMemoryRequirements, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordGetImageSparseMemoryRequirements(device, image, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
     }
     DispatchGetImageSparseMemoryRequirements(device, image, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetImageSparseMemoryRequirements, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordGetImageSparseMemoryRequirements(device, image, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
     }
 }
@@ -1628,19 +1850,24 @@ VKAPI_ATTR VkResult VKAPI_CALL QueueBindSparse(
     const VkBindSparseInfo*                     pBindInfo,
     VkFence                                     fence) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointQueueBindSparse);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointQueueBindSparse, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateQueueBindSparse(queue, bindInfoCount, pBindInfo, fence);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointQueueBindSparse, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordQueueBindSparse(queue, bindInfoCount, pBindInfo, fence);
     }
     VkResult result = DispatchQueueBindSparse(queue, bindInfoCount, pBindInfo, fence);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointQueueBindSparse, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordQueueBindSparse(queue, bindInfoCount, pBindInfo, fence, result);
     }
     return result;
@@ -1652,19 +1879,24 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateFence(
     const VkAllocationCallbacks*                pAllocator,
     VkFence*                                    pFence) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCreateFence);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateFence, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateFence(device, pCreateInfo, pAllocator, pFence);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateFence, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCreateFence(device, pCreateInfo, pAllocator, pFence);
     }
     VkResult result = DispatchCreateFence(device, pCreateInfo, pAllocator, pFence);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateFence, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCreateFence(device, pCreateInfo, pAllocator, pFence, result);
     }
     return result;
@@ -1675,19 +1907,24 @@ VKAPI_ATTR void VKAPI_CALL DestroyFence(
     VkFence                                     fence,
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointDestroyFence);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroyFence, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyFence(device, fence, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroyFence, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordDestroyFence(device, fence, pAllocator);
     }
     DispatchDestroyFence(device, fence, pAllocator);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroyFence, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordDestroyFence(device, fence, pAllocator);
     }
 }
@@ -1697,19 +1934,24 @@ VKAPI_ATTR VkResult VKAPI_CALL ResetFences(
     uint32_t                                    fenceCount,
     const VkFence*                              pFences) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointResetFences);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointResetFences, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateResetFences(device, fenceCount, pFences);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointResetFences, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordResetFences(device, fenceCount, pFences);
     }
     VkResult result = DispatchResetFences(device, fenceCount, pFences);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointResetFences, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordResetFences(device, fenceCount, pFences, result);
     }
     return result;
@@ -1719,19 +1961,24 @@ VKAPI_ATTR VkResult VKAPI_CALL GetFenceStatus(
     VkDevice                                    device,
     VkFence                                     fence) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointGetFenceStatus);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetFenceStatus, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetFenceStatus(device, fence);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetFenceStatus, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordGetFenceStatus(device, fence);
     }
     VkResult result = DispatchGetFenceStatus(device, fence);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetFenceStatus, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordGetFenceStatus(device, fence, result);
     }
     return result;
@@ -1744,19 +1991,24 @@ VKAPI_ATTR VkResult VKAPI_CALL WaitForFences(
     VkBool32                                    waitAll,
     uint64_t                                    timeout) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointWaitForFences);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointWaitForFences, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateWaitForFences(device, fenceCount, pFences, waitAll, timeout);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointWaitForFences, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordWaitForFences(device, fenceCount, pFences, waitAll, timeout);
     }
     VkResult result = DispatchWaitForFences(device, fenceCount, pFences, waitAll, timeout);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointWaitForFences, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordWaitForFences(device, fenceCount, pFences, waitAll, timeout, result);
     }
     return result;
@@ -1768,19 +2020,24 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSemaphore(
     const VkAllocationCallbacks*                pAllocator,
     VkSemaphore*                                pSemaphore) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCreateSemaphore);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateSemaphore, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateSemaphore(device, pCreateInfo, pAllocator, pSemaphore);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateSemaphore, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCreateSemaphore(device, pCreateInfo, pAllocator, pSemaphore);
     }
     VkResult result = DispatchCreateSemaphore(device, pCreateInfo, pAllocator, pSemaphore);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateSemaphore, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCreateSemaphore(device, pCreateInfo, pAllocator, pSemaphore, result);
     }
     return result;
@@ -1791,19 +2048,24 @@ VKAPI_ATTR void VKAPI_CALL DestroySemaphore(
     VkSemaphore                                 semaphore,
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointDestroySemaphore);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroySemaphore, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroySemaphore(device, semaphore, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroySemaphore, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordDestroySemaphore(device, semaphore, pAllocator);
     }
     DispatchDestroySemaphore(device, semaphore, pAllocator);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroySemaphore, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordDestroySemaphore(device, semaphore, pAllocator);
     }
 }
@@ -1814,19 +2076,24 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateEvent(
     const VkAllocationCallbacks*                pAllocator,
     VkEvent*                                    pEvent) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCreateEvent);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateEvent, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateEvent(device, pCreateInfo, pAllocator, pEvent);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateEvent, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCreateEvent(device, pCreateInfo, pAllocator, pEvent);
     }
     VkResult result = DispatchCreateEvent(device, pCreateInfo, pAllocator, pEvent);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateEvent, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCreateEvent(device, pCreateInfo, pAllocator, pEvent, result);
     }
     return result;
@@ -1837,19 +2104,24 @@ VKAPI_ATTR void VKAPI_CALL DestroyEvent(
     VkEvent                                     event,
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointDestroyEvent);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroyEvent, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyEvent(device, event, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroyEvent, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordDestroyEvent(device, event, pAllocator);
     }
     DispatchDestroyEvent(device, event, pAllocator);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroyEvent, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordDestroyEvent(device, event, pAllocator);
     }
 }
@@ -1858,19 +2130,24 @@ VKAPI_ATTR VkResult VKAPI_CALL GetEventStatus(
     VkDevice                                    device,
     VkEvent                                     event) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointGetEventStatus);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetEventStatus, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetEventStatus(device, event);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetEventStatus, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordGetEventStatus(device, event);
     }
     VkResult result = DispatchGetEventStatus(device, event);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetEventStatus, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordGetEventStatus(device, event, result);
     }
     return result;
@@ -1880,19 +2157,24 @@ VKAPI_ATTR VkResult VKAPI_CALL SetEvent(
     VkDevice                                    device,
     VkEvent                                     event) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointSetEvent);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointSetEvent, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateSetEvent(device, event);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointSetEvent, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordSetEvent(device, event);
     }
     VkResult result = DispatchSetEvent(device, event);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointSetEvent, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordSetEvent(device, event, result);
     }
     return result;
@@ -1902,19 +2184,24 @@ VKAPI_ATTR VkResult VKAPI_CALL ResetEvent(
     VkDevice                                    device,
     VkEvent                                     event) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointResetEvent);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointResetEvent, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateResetEvent(device, event);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointResetEvent, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordResetEvent(device, event);
     }
     VkResult result = DispatchResetEvent(device, event);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointResetEvent, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordResetEvent(device, event, result);
     }
     return result;
@@ -1926,19 +2213,24 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateQueryPool(
     const VkAllocationCallbacks*                pAllocator,
     VkQueryPool*                                pQueryPool) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCreateQueryPool);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateQueryPool, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateQueryPool(device, pCreateInfo, pAllocator, pQueryPool);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateQueryPool, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCreateQueryPool(device, pCreateInfo, pAllocator, pQueryPool);
     }
     VkResult result = DispatchCreateQueryPool(device, pCreateInfo, pAllocator, pQueryPool);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateQueryPool, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCreateQueryPool(device, pCreateInfo, pAllocator, pQueryPool, result);
     }
     return result;
@@ -1949,19 +2241,24 @@ VKAPI_ATTR void VKAPI_CALL DestroyQueryPool(
     VkQueryPool                                 queryPool,
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointDestroyQueryPool);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroyQueryPool, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyQueryPool(device, queryPool, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroyQueryPool, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordDestroyQueryPool(device, queryPool, pAllocator);
     }
     DispatchDestroyQueryPool(device, queryPool, pAllocator);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroyQueryPool, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordDestroyQueryPool(device, queryPool, pAllocator);
     }
 }
@@ -1976,19 +2273,24 @@ VKAPI_ATTR VkResult VKAPI_CALL GetQueryPoolResults(
     VkDeviceSize                                stride,
     VkQueryResultFlags                          flags) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointGetQueryPoolResults);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetQueryPoolResults, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetQueryPoolResults(device, queryPool, firstQuery, queryCount, dataSize, pData, stride, flags);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetQueryPoolResults, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordGetQueryPoolResults(device, queryPool, firstQuery, queryCount, dataSize, pData, stride, flags);
     }
     VkResult result = DispatchGetQueryPoolResults(device, queryPool, firstQuery, queryCount, dataSize, pData, stride, flags);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetQueryPoolResults, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordGetQueryPoolResults(device, queryPool, firstQuery, queryCount, dataSize, pData, stride, flags, result);
     }
     return result;
@@ -1999,19 +2301,24 @@ VKAPI_ATTR void VKAPI_CALL DestroyBuffer(
     VkBuffer                                    buffer,
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointDestroyBuffer);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroyBuffer, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyBuffer(device, buffer, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroyBuffer, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordDestroyBuffer(device, buffer, pAllocator);
     }
     DispatchDestroyBuffer(device, buffer, pAllocator);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroyBuffer, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordDestroyBuffer(device, buffer, pAllocator);
     }
 }
@@ -2022,19 +2329,24 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateBufferView(
     const VkAllocationCallbacks*                pAllocator,
     VkBufferView*                               pView) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCreateBufferView);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateBufferView, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateBufferView(device, pCreateInfo, pAllocator, pView);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateBufferView, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCreateBufferView(device, pCreateInfo, pAllocator, pView);
     }
     VkResult result = DispatchCreateBufferView(device, pCreateInfo, pAllocator, pView);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateBufferView, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCreateBufferView(device, pCreateInfo, pAllocator, pView, result);
     }
     return result;
@@ -2045,19 +2357,24 @@ VKAPI_ATTR void VKAPI_CALL DestroyBufferView(
     VkBufferView                                bufferView,
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointDestroyBufferView);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroyBufferView, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyBufferView(device, bufferView, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroyBufferView, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordDestroyBufferView(device, bufferView, pAllocator);
     }
     DispatchDestroyBufferView(device, bufferView, pAllocator);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroyBufferView, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordDestroyBufferView(device, bufferView, pAllocator);
     }
 }
@@ -2068,19 +2385,24 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateImage(
     const VkAllocationCallbacks*                pAllocator,
     VkImage*                                    pImage) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCreateImage);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateImage, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateImage(device, pCreateInfo, pAllocator, pImage);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateImage, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCreateImage(device, pCreateInfo, pAllocator, pImage);
     }
     VkResult result = DispatchCreateImage(device, pCreateInfo, pAllocator, pImage);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateImage, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCreateImage(device, pCreateInfo, pAllocator, pImage, result);
     }
     return result;
@@ -2091,19 +2413,24 @@ VKAPI_ATTR void VKAPI_CALL DestroyImage(
     VkImage                                     image,
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointDestroyImage);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroyImage, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyImage(device, image, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroyImage, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordDestroyImage(device, image, pAllocator);
     }
     DispatchDestroyImage(device, image, pAllocator);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroyImage, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordDestroyImage(device, image, pAllocator);
     }
 }
@@ -2114,19 +2441,24 @@ VKAPI_ATTR void VKAPI_CALL GetImageSubresourceLayout(
     const VkImageSubresource*                   pSubresource,
     VkSubresourceLayout*                        pLayout) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointGetImageSubresourceLayout);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetImageSubresourceLayout, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetImageSubresourceLayout(device, image, pSubresource, pLayout);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetImageSubresourceLayout, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordGetImageSubresourceLayout(device, image, pSubresource, pLayout);
     }
     DispatchGetImageSubresourceLayout(device, image, pSubresource, pLayout);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetImageSubresourceLayout, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordGetImageSubresourceLayout(device, image, pSubresource, pLayout);
     }
 }
@@ -2137,19 +2469,24 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateImageView(
     const VkAllocationCallbacks*                pAllocator,
     VkImageView*                                pView) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCreateImageView);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateImageView, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateImageView(device, pCreateInfo, pAllocator, pView);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateImageView, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCreateImageView(device, pCreateInfo, pAllocator, pView);
     }
     VkResult result = DispatchCreateImageView(device, pCreateInfo, pAllocator, pView);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateImageView, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCreateImageView(device, pCreateInfo, pAllocator, pView, result);
     }
     return result;
@@ -2160,19 +2497,24 @@ VKAPI_ATTR void VKAPI_CALL DestroyImageView(
     VkImageView                                 imageView,
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointDestroyImageView);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroyImageView, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyImageView(device, imageView, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroyImageView, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordDestroyImageView(device, imageView, pAllocator);
     }
     DispatchDestroyImageView(device, imageView, pAllocator);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroyImageView, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordDestroyImageView(device, imageView, pAllocator);
     }
 }
@@ -2182,19 +2524,24 @@ VKAPI_ATTR void VKAPI_CALL DestroyShaderModule(
     VkShaderModule                              shaderModule,
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointDestroyShaderModule);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroyShaderModule, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyShaderModule(device, shaderModule, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroyShaderModule, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordDestroyShaderModule(device, shaderModule, pAllocator);
     }
     DispatchDestroyShaderModule(device, shaderModule, pAllocator);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroyShaderModule, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordDestroyShaderModule(device, shaderModule, pAllocator);
     }
 }
@@ -2205,19 +2552,24 @@ VKAPI_ATTR VkResult VKAPI_CALL CreatePipelineCache(
     const VkAllocationCallbacks*                pAllocator,
     VkPipelineCache*                            pPipelineCache) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCreatePipelineCache);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreatePipelineCache, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreatePipelineCache(device, pCreateInfo, pAllocator, pPipelineCache);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreatePipelineCache, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCreatePipelineCache(device, pCreateInfo, pAllocator, pPipelineCache);
     }
     VkResult result = DispatchCreatePipelineCache(device, pCreateInfo, pAllocator, pPipelineCache);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreatePipelineCache, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCreatePipelineCache(device, pCreateInfo, pAllocator, pPipelineCache, result);
     }
     return result;
@@ -2228,19 +2580,24 @@ VKAPI_ATTR void VKAPI_CALL DestroyPipelineCache(
     VkPipelineCache                             pipelineCache,
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointDestroyPipelineCache);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroyPipelineCache, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyPipelineCache(device, pipelineCache, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroyPipelineCache, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordDestroyPipelineCache(device, pipelineCache, pAllocator);
     }
     DispatchDestroyPipelineCache(device, pipelineCache, pAllocator);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroyPipelineCache, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordDestroyPipelineCache(device, pipelineCache, pAllocator);
     }
 }
@@ -2251,19 +2608,24 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPipelineCacheData(
     size_t*                                     pDataSize,
     void*                                       pData) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointGetPipelineCacheData);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetPipelineCacheData, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPipelineCacheData(device, pipelineCache, pDataSize, pData);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetPipelineCacheData, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordGetPipelineCacheData(device, pipelineCache, pDataSize, pData);
     }
     VkResult result = DispatchGetPipelineCacheData(device, pipelineCache, pDataSize, pData);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetPipelineCacheData, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordGetPipelineCacheData(device, pipelineCache, pDataSize, pData, result);
     }
     return result;
@@ -2275,19 +2637,24 @@ VKAPI_ATTR VkResult VKAPI_CALL MergePipelineCaches(
     uint32_t                                    srcCacheCount,
     const VkPipelineCache*                      pSrcCaches) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointMergePipelineCaches);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointMergePipelineCaches, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateMergePipelineCaches(device, dstCache, srcCacheCount, pSrcCaches);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointMergePipelineCaches, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordMergePipelineCaches(device, dstCache, srcCacheCount, pSrcCaches);
     }
     VkResult result = DispatchMergePipelineCaches(device, dstCache, srcCacheCount, pSrcCaches);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointMergePipelineCaches, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordMergePipelineCaches(device, dstCache, srcCacheCount, pSrcCaches, result);
     }
     return result;
@@ -2298,19 +2665,24 @@ VKAPI_ATTR void VKAPI_CALL DestroyPipeline(
     VkPipeline                                  pipeline,
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointDestroyPipeline);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroyPipeline, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyPipeline(device, pipeline, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroyPipeline, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordDestroyPipeline(device, pipeline, pAllocator);
     }
     DispatchDestroyPipeline(device, pipeline, pAllocator);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroyPipeline, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordDestroyPipeline(device, pipeline, pAllocator);
     }
 }
@@ -2320,19 +2692,24 @@ VKAPI_ATTR void VKAPI_CALL DestroyPipelineLayout(
     VkPipelineLayout                            pipelineLayout,
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointDestroyPipelineLayout);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroyPipelineLayout, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyPipelineLayout(device, pipelineLayout, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroyPipelineLayout, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordDestroyPipelineLayout(device, pipelineLayout, pAllocator);
     }
     DispatchDestroyPipelineLayout(device, pipelineLayout, pAllocator);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroyPipelineLayout, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordDestroyPipelineLayout(device, pipelineLayout, pAllocator);
     }
 }
@@ -2343,19 +2720,24 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSampler(
     const VkAllocationCallbacks*                pAllocator,
     VkSampler*                                  pSampler) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCreateSampler);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateSampler, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateSampler(device, pCreateInfo, pAllocator, pSampler);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateSampler, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCreateSampler(device, pCreateInfo, pAllocator, pSampler);
     }
     VkResult result = DispatchCreateSampler(device, pCreateInfo, pAllocator, pSampler);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateSampler, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCreateSampler(device, pCreateInfo, pAllocator, pSampler, result);
     }
     return result;
@@ -2366,19 +2748,24 @@ VKAPI_ATTR void VKAPI_CALL DestroySampler(
     VkSampler                                   sampler,
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointDestroySampler);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroySampler, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroySampler(device, sampler, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroySampler, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordDestroySampler(device, sampler, pAllocator);
     }
     DispatchDestroySampler(device, sampler, pAllocator);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroySampler, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordDestroySampler(device, sampler, pAllocator);
     }
 }
@@ -2389,19 +2776,24 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDescriptorSetLayout(
     const VkAllocationCallbacks*                pAllocator,
     VkDescriptorSetLayout*                      pSetLayout) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCreateDescriptorSetLayout);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateDescriptorSetLayout, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateDescriptorSetLayout(device, pCreateInfo, pAllocator, pSetLayout);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateDescriptorSetLayout, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCreateDescriptorSetLayout(device, pCreateInfo, pAllocator, pSetLayout);
     }
     VkResult result = DispatchCreateDescriptorSetLayout(device, pCreateInfo, pAllocator, pSetLayout);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateDescriptorSetLayout, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCreateDescriptorSetLayout(device, pCreateInfo, pAllocator, pSetLayout, result);
     }
     return result;
@@ -2412,19 +2804,24 @@ VKAPI_ATTR void VKAPI_CALL DestroyDescriptorSetLayout(
     VkDescriptorSetLayout                       descriptorSetLayout,
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointDestroyDescriptorSetLayout);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroyDescriptorSetLayout, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyDescriptorSetLayout(device, descriptorSetLayout, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroyDescriptorSetLayout, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordDestroyDescriptorSetLayout(device, descriptorSetLayout, pAllocator);
     }
     DispatchDestroyDescriptorSetLayout(device, descriptorSetLayout, pAllocator);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroyDescriptorSetLayout, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordDestroyDescriptorSetLayout(device, descriptorSetLayout, pAllocator);
     }
 }
@@ -2435,19 +2832,24 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDescriptorPool(
     const VkAllocationCallbacks*                pAllocator,
     VkDescriptorPool*                           pDescriptorPool) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCreateDescriptorPool);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateDescriptorPool, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateDescriptorPool(device, pCreateInfo, pAllocator, pDescriptorPool);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateDescriptorPool, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCreateDescriptorPool(device, pCreateInfo, pAllocator, pDescriptorPool);
     }
     VkResult result = DispatchCreateDescriptorPool(device, pCreateInfo, pAllocator, pDescriptorPool);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateDescriptorPool, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCreateDescriptorPool(device, pCreateInfo, pAllocator, pDescriptorPool, result);
     }
     return result;
@@ -2458,19 +2860,24 @@ VKAPI_ATTR void VKAPI_CALL DestroyDescriptorPool(
     VkDescriptorPool                            descriptorPool,
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointDestroyDescriptorPool);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroyDescriptorPool, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyDescriptorPool(device, descriptorPool, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroyDescriptorPool, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordDestroyDescriptorPool(device, descriptorPool, pAllocator);
     }
     DispatchDestroyDescriptorPool(device, descriptorPool, pAllocator);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroyDescriptorPool, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordDestroyDescriptorPool(device, descriptorPool, pAllocator);
     }
 }
@@ -2480,19 +2887,24 @@ VKAPI_ATTR VkResult VKAPI_CALL ResetDescriptorPool(
     VkDescriptorPool                            descriptorPool,
     VkDescriptorPoolResetFlags                  flags) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointResetDescriptorPool);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointResetDescriptorPool, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateResetDescriptorPool(device, descriptorPool, flags);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointResetDescriptorPool, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordResetDescriptorPool(device, descriptorPool, flags);
     }
     VkResult result = DispatchResetDescriptorPool(device, descriptorPool, flags);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointResetDescriptorPool, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordResetDescriptorPool(device, descriptorPool, flags, result);
     }
     return result;
@@ -2504,19 +2916,24 @@ VKAPI_ATTR VkResult VKAPI_CALL FreeDescriptorSets(
     uint32_t                                    descriptorSetCount,
     const VkDescriptorSet*                      pDescriptorSets) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointFreeDescriptorSets);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointFreeDescriptorSets, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateFreeDescriptorSets(device, descriptorPool, descriptorSetCount, pDescriptorSets);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointFreeDescriptorSets, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordFreeDescriptorSets(device, descriptorPool, descriptorSetCount, pDescriptorSets);
     }
     VkResult result = DispatchFreeDescriptorSets(device, descriptorPool, descriptorSetCount, pDescriptorSets);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointFreeDescriptorSets, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordFreeDescriptorSets(device, descriptorPool, descriptorSetCount, pDescriptorSets, result);
     }
     return result;
@@ -2529,19 +2946,24 @@ VKAPI_ATTR void VKAPI_CALL UpdateDescriptorSets(
     uint32_t                                    descriptorCopyCount,
     const VkCopyDescriptorSet*                  pDescriptorCopies) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointUpdateDescriptorSets);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointUpdateDescriptorSets, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateUpdateDescriptorSets(device, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount, pDescriptorCopies);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointUpdateDescriptorSets, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordUpdateDescriptorSets(device, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount, pDescriptorCopies);
     }
     DispatchUpdateDescriptorSets(device, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount, pDescriptorCopies);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointUpdateDescriptorSets, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordUpdateDescriptorSets(device, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount, pDescriptorCopies);
     }
 }
@@ -2552,19 +2974,24 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateFramebuffer(
     const VkAllocationCallbacks*                pAllocator,
     VkFramebuffer*                              pFramebuffer) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCreateFramebuffer);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateFramebuffer, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateFramebuffer(device, pCreateInfo, pAllocator, pFramebuffer);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateFramebuffer, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCreateFramebuffer(device, pCreateInfo, pAllocator, pFramebuffer);
     }
     VkResult result = DispatchCreateFramebuffer(device, pCreateInfo, pAllocator, pFramebuffer);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateFramebuffer, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCreateFramebuffer(device, pCreateInfo, pAllocator, pFramebuffer, result);
     }
     return result;
@@ -2575,19 +3002,24 @@ VKAPI_ATTR void VKAPI_CALL DestroyFramebuffer(
     VkFramebuffer                               framebuffer,
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointDestroyFramebuffer);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroyFramebuffer, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyFramebuffer(device, framebuffer, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroyFramebuffer, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordDestroyFramebuffer(device, framebuffer, pAllocator);
     }
     DispatchDestroyFramebuffer(device, framebuffer, pAllocator);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroyFramebuffer, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordDestroyFramebuffer(device, framebuffer, pAllocator);
     }
 }
@@ -2598,19 +3030,24 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRenderPass(
     const VkAllocationCallbacks*                pAllocator,
     VkRenderPass*                               pRenderPass) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCreateRenderPass);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateRenderPass, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateRenderPass(device, pCreateInfo, pAllocator, pRenderPass);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateRenderPass, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCreateRenderPass(device, pCreateInfo, pAllocator, pRenderPass);
     }
     VkResult result = DispatchCreateRenderPass(device, pCreateInfo, pAllocator, pRenderPass);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateRenderPass, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCreateRenderPass(device, pCreateInfo, pAllocator, pRenderPass, result);
     }
     return result;
@@ -2621,19 +3058,24 @@ VKAPI_ATTR void VKAPI_CALL DestroyRenderPass(
     VkRenderPass                                renderPass,
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointDestroyRenderPass);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroyRenderPass, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyRenderPass(device, renderPass, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroyRenderPass, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordDestroyRenderPass(device, renderPass, pAllocator);
     }
     DispatchDestroyRenderPass(device, renderPass, pAllocator);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroyRenderPass, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordDestroyRenderPass(device, renderPass, pAllocator);
     }
 }
@@ -2643,19 +3085,24 @@ VKAPI_ATTR void VKAPI_CALL GetRenderAreaGranularity(
     VkRenderPass                                renderPass,
     VkExtent2D*                                 pGranularity) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointGetRenderAreaGranularity);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetRenderAreaGranularity, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetRenderAreaGranularity(device, renderPass, pGranularity);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetRenderAreaGranularity, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordGetRenderAreaGranularity(device, renderPass, pGranularity);
     }
     DispatchGetRenderAreaGranularity(device, renderPass, pGranularity);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetRenderAreaGranularity, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordGetRenderAreaGranularity(device, renderPass, pGranularity);
     }
 }
@@ -2666,19 +3113,24 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateCommandPool(
     const VkAllocationCallbacks*                pAllocator,
     VkCommandPool*                              pCommandPool) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCreateCommandPool);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateCommandPool, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateCommandPool(device, pCreateInfo, pAllocator, pCommandPool);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateCommandPool, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCreateCommandPool(device, pCreateInfo, pAllocator, pCommandPool);
     }
     VkResult result = DispatchCreateCommandPool(device, pCreateInfo, pAllocator, pCommandPool);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateCommandPool, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCreateCommandPool(device, pCreateInfo, pAllocator, pCommandPool, result);
     }
     return result;
@@ -2689,19 +3141,24 @@ VKAPI_ATTR void VKAPI_CALL DestroyCommandPool(
     VkCommandPool                               commandPool,
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointDestroyCommandPool);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroyCommandPool, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyCommandPool(device, commandPool, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroyCommandPool, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordDestroyCommandPool(device, commandPool, pAllocator);
     }
     DispatchDestroyCommandPool(device, commandPool, pAllocator);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroyCommandPool, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordDestroyCommandPool(device, commandPool, pAllocator);
     }
 }
@@ -2711,19 +3168,24 @@ VKAPI_ATTR VkResult VKAPI_CALL ResetCommandPool(
     VkCommandPool                               commandPool,
     VkCommandPoolResetFlags                     flags) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointResetCommandPool);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointResetCommandPool, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateResetCommandPool(device, commandPool, flags);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointResetCommandPool, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordResetCommandPool(device, commandPool, flags);
     }
     VkResult result = DispatchResetCommandPool(device, commandPool, flags);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointResetCommandPool, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordResetCommandPool(device, commandPool, flags, result);
     }
     return result;
@@ -2734,19 +3196,24 @@ VKAPI_ATTR VkResult VKAPI_CALL AllocateCommandBuffers(
     const VkCommandBufferAllocateInfo*          pAllocateInfo,
     VkCommandBuffer*                            pCommandBuffers) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointAllocateCommandBuffers);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointAllocateCommandBuffers, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateAllocateCommandBuffers(device, pAllocateInfo, pCommandBuffers);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointAllocateCommandBuffers, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordAllocateCommandBuffers(device, pAllocateInfo, pCommandBuffers);
     }
     VkResult result = DispatchAllocateCommandBuffers(device, pAllocateInfo, pCommandBuffers);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointAllocateCommandBuffers, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordAllocateCommandBuffers(device, pAllocateInfo, pCommandBuffers, result);
     }
     return result;
@@ -2758,19 +3225,24 @@ VKAPI_ATTR void VKAPI_CALL FreeCommandBuffers(
     uint32_t                                    commandBufferCount,
     const VkCommandBuffer*                      pCommandBuffers) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointFreeCommandBuffers);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointFreeCommandBuffers, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateFreeCommandBuffers(device, commandPool, commandBufferCount, pCommandBuffers);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointFreeCommandBuffers, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordFreeCommandBuffers(device, commandPool, commandBufferCount, pCommandBuffers);
     }
     DispatchFreeCommandBuffers(device, commandPool, commandBufferCount, pCommandBuffers);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointFreeCommandBuffers, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordFreeCommandBuffers(device, commandPool, commandBufferCount, pCommandBuffers);
     }
 }
@@ -2779,19 +3251,24 @@ VKAPI_ATTR VkResult VKAPI_CALL BeginCommandBuffer(
     VkCommandBuffer                             commandBuffer,
     const VkCommandBufferBeginInfo*             pBeginInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointBeginCommandBuffer);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointBeginCommandBuffer, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateBeginCommandBuffer(commandBuffer, pBeginInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointBeginCommandBuffer, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordBeginCommandBuffer(commandBuffer, pBeginInfo);
     }
     VkResult result = DispatchBeginCommandBuffer(commandBuffer, pBeginInfo);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointBeginCommandBuffer, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordBeginCommandBuffer(commandBuffer, pBeginInfo, result);
     }
     return result;
@@ -2800,19 +3277,24 @@ VKAPI_ATTR VkResult VKAPI_CALL BeginCommandBuffer(
 VKAPI_ATTR VkResult VKAPI_CALL EndCommandBuffer(
     VkCommandBuffer                             commandBuffer) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointEndCommandBuffer);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointEndCommandBuffer, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateEndCommandBuffer(commandBuffer);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointEndCommandBuffer, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordEndCommandBuffer(commandBuffer);
     }
     VkResult result = DispatchEndCommandBuffer(commandBuffer);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointEndCommandBuffer, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordEndCommandBuffer(commandBuffer, result);
     }
     return result;
@@ -2822,19 +3304,24 @@ VKAPI_ATTR VkResult VKAPI_CALL ResetCommandBuffer(
     VkCommandBuffer                             commandBuffer,
     VkCommandBufferResetFlags                   flags) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointResetCommandBuffer);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointResetCommandBuffer, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateResetCommandBuffer(commandBuffer, flags);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointResetCommandBuffer, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordResetCommandBuffer(commandBuffer, flags);
     }
     VkResult result = DispatchResetCommandBuffer(commandBuffer, flags);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointResetCommandBuffer, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordResetCommandBuffer(commandBuffer, flags, result);
     }
     return result;
@@ -2845,19 +3332,24 @@ VKAPI_ATTR void VKAPI_CALL CmdBindPipeline(
     VkPipelineBindPoint                         pipelineBindPoint,
     VkPipeline                                  pipeline) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdBindPipeline);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdBindPipeline, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBindPipeline(commandBuffer, pipelineBindPoint, pipeline);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdBindPipeline, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdBindPipeline(commandBuffer, pipelineBindPoint, pipeline);
     }
     DispatchCmdBindPipeline(commandBuffer, pipelineBindPoint, pipeline);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdBindPipeline, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdBindPipeline(commandBuffer, pipelineBindPoint, pipeline);
     }
 }
@@ -2868,19 +3360,24 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewport(
     uint32_t                                    viewportCount,
     const VkViewport*                           pViewports) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdSetViewport);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdSetViewport, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetViewport(commandBuffer, firstViewport, viewportCount, pViewports);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdSetViewport, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdSetViewport(commandBuffer, firstViewport, viewportCount, pViewports);
     }
     DispatchCmdSetViewport(commandBuffer, firstViewport, viewportCount, pViewports);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdSetViewport, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdSetViewport(commandBuffer, firstViewport, viewportCount, pViewports);
     }
 }
@@ -2891,19 +3388,24 @@ VKAPI_ATTR void VKAPI_CALL CmdSetScissor(
     uint32_t                                    scissorCount,
     const VkRect2D*                             pScissors) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdSetScissor);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdSetScissor, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetScissor(commandBuffer, firstScissor, scissorCount, pScissors);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdSetScissor, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdSetScissor(commandBuffer, firstScissor, scissorCount, pScissors);
     }
     DispatchCmdSetScissor(commandBuffer, firstScissor, scissorCount, pScissors);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdSetScissor, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdSetScissor(commandBuffer, firstScissor, scissorCount, pScissors);
     }
 }
@@ -2912,19 +3414,24 @@ VKAPI_ATTR void VKAPI_CALL CmdSetLineWidth(
     VkCommandBuffer                             commandBuffer,
     float                                       lineWidth) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdSetLineWidth);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdSetLineWidth, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetLineWidth(commandBuffer, lineWidth);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdSetLineWidth, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdSetLineWidth(commandBuffer, lineWidth);
     }
     DispatchCmdSetLineWidth(commandBuffer, lineWidth);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdSetLineWidth, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdSetLineWidth(commandBuffer, lineWidth);
     }
 }
@@ -2935,19 +3442,24 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthBias(
     float                                       depthBiasClamp,
     float                                       depthBiasSlopeFactor) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdSetDepthBias);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdSetDepthBias, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetDepthBias(commandBuffer, depthBiasConstantFactor, depthBiasClamp, depthBiasSlopeFactor);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdSetDepthBias, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdSetDepthBias(commandBuffer, depthBiasConstantFactor, depthBiasClamp, depthBiasSlopeFactor);
     }
     DispatchCmdSetDepthBias(commandBuffer, depthBiasConstantFactor, depthBiasClamp, depthBiasSlopeFactor);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdSetDepthBias, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdSetDepthBias(commandBuffer, depthBiasConstantFactor, depthBiasClamp, depthBiasSlopeFactor);
     }
 }
@@ -2956,19 +3468,24 @@ VKAPI_ATTR void VKAPI_CALL CmdSetBlendConstants(
     VkCommandBuffer                             commandBuffer,
     const float                                 blendConstants[4]) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdSetBlendConstants);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdSetBlendConstants, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetBlendConstants(commandBuffer, blendConstants);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdSetBlendConstants, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdSetBlendConstants(commandBuffer, blendConstants);
     }
     DispatchCmdSetBlendConstants(commandBuffer, blendConstants);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdSetBlendConstants, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdSetBlendConstants(commandBuffer, blendConstants);
     }
 }
@@ -2978,19 +3495,24 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthBounds(
     float                                       minDepthBounds,
     float                                       maxDepthBounds) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdSetDepthBounds);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdSetDepthBounds, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetDepthBounds(commandBuffer, minDepthBounds, maxDepthBounds);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdSetDepthBounds, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdSetDepthBounds(commandBuffer, minDepthBounds, maxDepthBounds);
     }
     DispatchCmdSetDepthBounds(commandBuffer, minDepthBounds, maxDepthBounds);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdSetDepthBounds, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdSetDepthBounds(commandBuffer, minDepthBounds, maxDepthBounds);
     }
 }
@@ -3000,19 +3522,24 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilCompareMask(
     VkStencilFaceFlags                          faceMask,
     uint32_t                                    compareMask) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdSetStencilCompareMask);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdSetStencilCompareMask, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetStencilCompareMask(commandBuffer, faceMask, compareMask);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdSetStencilCompareMask, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdSetStencilCompareMask(commandBuffer, faceMask, compareMask);
     }
     DispatchCmdSetStencilCompareMask(commandBuffer, faceMask, compareMask);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdSetStencilCompareMask, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdSetStencilCompareMask(commandBuffer, faceMask, compareMask);
     }
 }
@@ -3022,19 +3549,24 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilWriteMask(
     VkStencilFaceFlags                          faceMask,
     uint32_t                                    writeMask) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdSetStencilWriteMask);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdSetStencilWriteMask, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetStencilWriteMask(commandBuffer, faceMask, writeMask);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdSetStencilWriteMask, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdSetStencilWriteMask(commandBuffer, faceMask, writeMask);
     }
     DispatchCmdSetStencilWriteMask(commandBuffer, faceMask, writeMask);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdSetStencilWriteMask, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdSetStencilWriteMask(commandBuffer, faceMask, writeMask);
     }
 }
@@ -3044,19 +3576,24 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilReference(
     VkStencilFaceFlags                          faceMask,
     uint32_t                                    reference) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdSetStencilReference);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdSetStencilReference, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetStencilReference(commandBuffer, faceMask, reference);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdSetStencilReference, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdSetStencilReference(commandBuffer, faceMask, reference);
     }
     DispatchCmdSetStencilReference(commandBuffer, faceMask, reference);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdSetStencilReference, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdSetStencilReference(commandBuffer, faceMask, reference);
     }
 }
@@ -3071,19 +3608,24 @@ VKAPI_ATTR void VKAPI_CALL CmdBindDescriptorSets(
     uint32_t                                    dynamicOffsetCount,
     const uint32_t*                             pDynamicOffsets) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdBindDescriptorSets);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdBindDescriptorSets, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBindDescriptorSets(commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdBindDescriptorSets, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdBindDescriptorSets(commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
     }
     DispatchCmdBindDescriptorSets(commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdBindDescriptorSets, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdBindDescriptorSets(commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
     }
 }
@@ -3094,19 +3636,24 @@ VKAPI_ATTR void VKAPI_CALL CmdBindIndexBuffer(
     VkDeviceSize                                offset,
     VkIndexType                                 indexType) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdBindIndexBuffer);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdBindIndexBuffer, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBindIndexBuffer(commandBuffer, buffer, offset, indexType);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdBindIndexBuffer, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdBindIndexBuffer(commandBuffer, buffer, offset, indexType);
     }
     DispatchCmdBindIndexBuffer(commandBuffer, buffer, offset, indexType);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdBindIndexBuffer, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdBindIndexBuffer(commandBuffer, buffer, offset, indexType);
     }
 }
@@ -3118,19 +3665,24 @@ VKAPI_ATTR void VKAPI_CALL CmdBindVertexBuffers(
     const VkBuffer*                             pBuffers,
     const VkDeviceSize*                         pOffsets) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdBindVertexBuffers);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdBindVertexBuffers, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBindVertexBuffers(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdBindVertexBuffers, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdBindVertexBuffers(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets);
     }
     DispatchCmdBindVertexBuffers(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdBindVertexBuffers, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdBindVertexBuffers(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets);
     }
 }
@@ -3142,19 +3694,24 @@ VKAPI_ATTR void VKAPI_CALL CmdDraw(
     uint32_t                                    firstVertex,
     uint32_t                                    firstInstance) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdDraw);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdDraw, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDraw(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdDraw, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdDraw(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
     }
     DispatchCmdDraw(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdDraw, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdDraw(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
     }
 }
@@ -3167,19 +3724,24 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexed(
     int32_t                                     vertexOffset,
     uint32_t                                    firstInstance) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdDrawIndexed);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdDrawIndexed, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawIndexed(commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdDrawIndexed, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdDrawIndexed(commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
     }
     DispatchCmdDrawIndexed(commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdDrawIndexed, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdDrawIndexed(commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
     }
 }
@@ -3191,19 +3753,24 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirect(
     uint32_t                                    drawCount,
     uint32_t                                    stride) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdDrawIndirect);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdDrawIndirect, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawIndirect(commandBuffer, buffer, offset, drawCount, stride);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdDrawIndirect, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdDrawIndirect(commandBuffer, buffer, offset, drawCount, stride);
     }
     DispatchCmdDrawIndirect(commandBuffer, buffer, offset, drawCount, stride);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdDrawIndirect, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdDrawIndirect(commandBuffer, buffer, offset, drawCount, stride);
     }
 }
@@ -3215,19 +3782,24 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexedIndirect(
     uint32_t                                    drawCount,
     uint32_t                                    stride) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdDrawIndexedIndirect);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdDrawIndexedIndirect, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawIndexedIndirect(commandBuffer, buffer, offset, drawCount, stride);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdDrawIndexedIndirect, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdDrawIndexedIndirect(commandBuffer, buffer, offset, drawCount, stride);
     }
     DispatchCmdDrawIndexedIndirect(commandBuffer, buffer, offset, drawCount, stride);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdDrawIndexedIndirect, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdDrawIndexedIndirect(commandBuffer, buffer, offset, drawCount, stride);
     }
 }
@@ -3238,19 +3810,24 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatch(
     uint32_t                                    groupCountY,
     uint32_t                                    groupCountZ) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdDispatch);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdDispatch, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDispatch(commandBuffer, groupCountX, groupCountY, groupCountZ);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdDispatch, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdDispatch(commandBuffer, groupCountX, groupCountY, groupCountZ);
     }
     DispatchCmdDispatch(commandBuffer, groupCountX, groupCountY, groupCountZ);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdDispatch, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdDispatch(commandBuffer, groupCountX, groupCountY, groupCountZ);
     }
 }
@@ -3260,19 +3837,24 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatchIndirect(
     VkBuffer                                    buffer,
     VkDeviceSize                                offset) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdDispatchIndirect);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdDispatchIndirect, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDispatchIndirect(commandBuffer, buffer, offset);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdDispatchIndirect, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdDispatchIndirect(commandBuffer, buffer, offset);
     }
     DispatchCmdDispatchIndirect(commandBuffer, buffer, offset);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdDispatchIndirect, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdDispatchIndirect(commandBuffer, buffer, offset);
     }
 }
@@ -3284,19 +3866,24 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBuffer(
     uint32_t                                    regionCount,
     const VkBufferCopy*                         pRegions) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdCopyBuffer);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdCopyBuffer, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdCopyBuffer, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions);
     }
     DispatchCmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdCopyBuffer, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions);
     }
 }
@@ -3310,19 +3897,24 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyImage(
     uint32_t                                    regionCount,
     const VkImageCopy*                          pRegions) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdCopyImage);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdCopyImage, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdCopyImage, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdCopyImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
     }
     DispatchCmdCopyImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdCopyImage, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdCopyImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
     }
 }
@@ -3337,19 +3929,24 @@ VKAPI_ATTR void VKAPI_CALL CmdBlitImage(
     const VkImageBlit*                          pRegions,
     VkFilter                                    filter) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdBlitImage);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdBlitImage, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBlitImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions, filter);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdBlitImage, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdBlitImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions, filter);
     }
     DispatchCmdBlitImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions, filter);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdBlitImage, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdBlitImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions, filter);
     }
 }
@@ -3362,19 +3959,24 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBufferToImage(
     uint32_t                                    regionCount,
     const VkBufferImageCopy*                    pRegions) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdCopyBufferToImage);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdCopyBufferToImage, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyBufferToImage(commandBuffer, srcBuffer, dstImage, dstImageLayout, regionCount, pRegions);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdCopyBufferToImage, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdCopyBufferToImage(commandBuffer, srcBuffer, dstImage, dstImageLayout, regionCount, pRegions);
     }
     DispatchCmdCopyBufferToImage(commandBuffer, srcBuffer, dstImage, dstImageLayout, regionCount, pRegions);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdCopyBufferToImage, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdCopyBufferToImage(commandBuffer, srcBuffer, dstImage, dstImageLayout, regionCount, pRegions);
     }
 }
@@ -3387,19 +3989,24 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyImageToBuffer(
     uint32_t                                    regionCount,
     const VkBufferImageCopy*                    pRegions) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdCopyImageToBuffer);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdCopyImageToBuffer, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyImageToBuffer(commandBuffer, srcImage, srcImageLayout, dstBuffer, regionCount, pRegions);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdCopyImageToBuffer, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdCopyImageToBuffer(commandBuffer, srcImage, srcImageLayout, dstBuffer, regionCount, pRegions);
     }
     DispatchCmdCopyImageToBuffer(commandBuffer, srcImage, srcImageLayout, dstBuffer, regionCount, pRegions);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdCopyImageToBuffer, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdCopyImageToBuffer(commandBuffer, srcImage, srcImageLayout, dstBuffer, regionCount, pRegions);
     }
 }
@@ -3411,19 +4018,24 @@ VKAPI_ATTR void VKAPI_CALL CmdUpdateBuffer(
     VkDeviceSize                                dataSize,
     const void*                                 pData) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdUpdateBuffer);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdUpdateBuffer, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdUpdateBuffer(commandBuffer, dstBuffer, dstOffset, dataSize, pData);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdUpdateBuffer, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdUpdateBuffer(commandBuffer, dstBuffer, dstOffset, dataSize, pData);
     }
     DispatchCmdUpdateBuffer(commandBuffer, dstBuffer, dstOffset, dataSize, pData);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdUpdateBuffer, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdUpdateBuffer(commandBuffer, dstBuffer, dstOffset, dataSize, pData);
     }
 }
@@ -3435,19 +4047,24 @@ VKAPI_ATTR void VKAPI_CALL CmdFillBuffer(
     VkDeviceSize                                size,
     uint32_t                                    data) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdFillBuffer);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdFillBuffer, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdFillBuffer(commandBuffer, dstBuffer, dstOffset, size, data);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdFillBuffer, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdFillBuffer(commandBuffer, dstBuffer, dstOffset, size, data);
     }
     DispatchCmdFillBuffer(commandBuffer, dstBuffer, dstOffset, size, data);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdFillBuffer, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdFillBuffer(commandBuffer, dstBuffer, dstOffset, size, data);
     }
 }
@@ -3460,19 +4077,24 @@ VKAPI_ATTR void VKAPI_CALL CmdClearColorImage(
     uint32_t                                    rangeCount,
     const VkImageSubresourceRange*              pRanges) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdClearColorImage);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdClearColorImage, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdClearColorImage(commandBuffer, image, imageLayout, pColor, rangeCount, pRanges);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdClearColorImage, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdClearColorImage(commandBuffer, image, imageLayout, pColor, rangeCount, pRanges);
     }
     DispatchCmdClearColorImage(commandBuffer, image, imageLayout, pColor, rangeCount, pRanges);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdClearColorImage, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdClearColorImage(commandBuffer, image, imageLayout, pColor, rangeCount, pRanges);
     }
 }
@@ -3485,19 +4107,24 @@ VKAPI_ATTR void VKAPI_CALL CmdClearDepthStencilImage(
     uint32_t                                    rangeCount,
     const VkImageSubresourceRange*              pRanges) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdClearDepthStencilImage);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdClearDepthStencilImage, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdClearDepthStencilImage(commandBuffer, image, imageLayout, pDepthStencil, rangeCount, pRanges);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdClearDepthStencilImage, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdClearDepthStencilImage(commandBuffer, image, imageLayout, pDepthStencil, rangeCount, pRanges);
     }
     DispatchCmdClearDepthStencilImage(commandBuffer, image, imageLayout, pDepthStencil, rangeCount, pRanges);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdClearDepthStencilImage, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdClearDepthStencilImage(commandBuffer, image, imageLayout, pDepthStencil, rangeCount, pRanges);
     }
 }
@@ -3509,19 +4136,24 @@ VKAPI_ATTR void VKAPI_CALL CmdClearAttachments(
     uint32_t                                    rectCount,
     const VkClearRect*                          pRects) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdClearAttachments);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdClearAttachments, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdClearAttachments(commandBuffer, attachmentCount, pAttachments, rectCount, pRects);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdClearAttachments, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdClearAttachments(commandBuffer, attachmentCount, pAttachments, rectCount, pRects);
     }
     DispatchCmdClearAttachments(commandBuffer, attachmentCount, pAttachments, rectCount, pRects);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdClearAttachments, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdClearAttachments(commandBuffer, attachmentCount, pAttachments, rectCount, pRects);
     }
 }
@@ -3535,19 +4167,24 @@ VKAPI_ATTR void VKAPI_CALL CmdResolveImage(
     uint32_t                                    regionCount,
     const VkImageResolve*                       pRegions) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdResolveImage);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdResolveImage, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdResolveImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdResolveImage, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdResolveImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
     }
     DispatchCmdResolveImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdResolveImage, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdResolveImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
     }
 }
@@ -3557,19 +4194,24 @@ VKAPI_ATTR void VKAPI_CALL CmdSetEvent(
     VkEvent                                     event,
     VkPipelineStageFlags                        stageMask) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdSetEvent);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdSetEvent, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetEvent(commandBuffer, event, stageMask);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdSetEvent, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdSetEvent(commandBuffer, event, stageMask);
     }
     DispatchCmdSetEvent(commandBuffer, event, stageMask);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdSetEvent, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdSetEvent(commandBuffer, event, stageMask);
     }
 }
@@ -3579,19 +4221,24 @@ VKAPI_ATTR void VKAPI_CALL CmdResetEvent(
     VkEvent                                     event,
     VkPipelineStageFlags                        stageMask) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdResetEvent);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdResetEvent, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdResetEvent(commandBuffer, event, stageMask);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdResetEvent, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdResetEvent(commandBuffer, event, stageMask);
     }
     DispatchCmdResetEvent(commandBuffer, event, stageMask);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdResetEvent, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdResetEvent(commandBuffer, event, stageMask);
     }
 }
@@ -3609,19 +4256,24 @@ VKAPI_ATTR void VKAPI_CALL CmdWaitEvents(
     uint32_t                                    imageMemoryBarrierCount,
     const VkImageMemoryBarrier*                 pImageMemoryBarriers) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdWaitEvents);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdWaitEvents, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdWaitEvents(commandBuffer, eventCount, pEvents, srcStageMask, dstStageMask, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdWaitEvents, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdWaitEvents(commandBuffer, eventCount, pEvents, srcStageMask, dstStageMask, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
     }
     DispatchCmdWaitEvents(commandBuffer, eventCount, pEvents, srcStageMask, dstStageMask, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdWaitEvents, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdWaitEvents(commandBuffer, eventCount, pEvents, srcStageMask, dstStageMask, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
     }
 }
@@ -3638,19 +4290,24 @@ VKAPI_ATTR void VKAPI_CALL CmdPipelineBarrier(
     uint32_t                                    imageMemoryBarrierCount,
     const VkImageMemoryBarrier*                 pImageMemoryBarriers) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdPipelineBarrier);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdPipelineBarrier, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdPipelineBarrier(commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdPipelineBarrier, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdPipelineBarrier(commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
     }
     DispatchCmdPipelineBarrier(commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdPipelineBarrier, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdPipelineBarrier(commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
     }
 }
@@ -3661,19 +4318,24 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginQuery(
     uint32_t                                    query,
     VkQueryControlFlags                         flags) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdBeginQuery);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdBeginQuery, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBeginQuery(commandBuffer, queryPool, query, flags);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdBeginQuery, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdBeginQuery(commandBuffer, queryPool, query, flags);
     }
     DispatchCmdBeginQuery(commandBuffer, queryPool, query, flags);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdBeginQuery, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdBeginQuery(commandBuffer, queryPool, query, flags);
     }
 }
@@ -3683,19 +4345,24 @@ VKAPI_ATTR void VKAPI_CALL CmdEndQuery(
     VkQueryPool                                 queryPool,
     uint32_t                                    query) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdEndQuery);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdEndQuery, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdEndQuery(commandBuffer, queryPool, query);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdEndQuery, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdEndQuery(commandBuffer, queryPool, query);
     }
     DispatchCmdEndQuery(commandBuffer, queryPool, query);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdEndQuery, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdEndQuery(commandBuffer, queryPool, query);
     }
 }
@@ -3706,19 +4373,24 @@ VKAPI_ATTR void VKAPI_CALL CmdResetQueryPool(
     uint32_t                                    firstQuery,
     uint32_t                                    queryCount) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdResetQueryPool);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdResetQueryPool, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdResetQueryPool(commandBuffer, queryPool, firstQuery, queryCount);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdResetQueryPool, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdResetQueryPool(commandBuffer, queryPool, firstQuery, queryCount);
     }
     DispatchCmdResetQueryPool(commandBuffer, queryPool, firstQuery, queryCount);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdResetQueryPool, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdResetQueryPool(commandBuffer, queryPool, firstQuery, queryCount);
     }
 }
@@ -3729,19 +4401,24 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteTimestamp(
     VkQueryPool                                 queryPool,
     uint32_t                                    query) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdWriteTimestamp);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdWriteTimestamp, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdWriteTimestamp(commandBuffer, pipelineStage, queryPool, query);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdWriteTimestamp, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdWriteTimestamp(commandBuffer, pipelineStage, queryPool, query);
     }
     DispatchCmdWriteTimestamp(commandBuffer, pipelineStage, queryPool, query);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdWriteTimestamp, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdWriteTimestamp(commandBuffer, pipelineStage, queryPool, query);
     }
 }
@@ -3756,19 +4433,24 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyQueryPoolResults(
     VkDeviceSize                                stride,
     VkQueryResultFlags                          flags) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdCopyQueryPoolResults);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdCopyQueryPoolResults, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyQueryPoolResults(commandBuffer, queryPool, firstQuery, queryCount, dstBuffer, dstOffset, stride, flags);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdCopyQueryPoolResults, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdCopyQueryPoolResults(commandBuffer, queryPool, firstQuery, queryCount, dstBuffer, dstOffset, stride, flags);
     }
     DispatchCmdCopyQueryPoolResults(commandBuffer, queryPool, firstQuery, queryCount, dstBuffer, dstOffset, stride, flags);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdCopyQueryPoolResults, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdCopyQueryPoolResults(commandBuffer, queryPool, firstQuery, queryCount, dstBuffer, dstOffset, stride, flags);
     }
 }
@@ -3781,19 +4463,24 @@ VKAPI_ATTR void VKAPI_CALL CmdPushConstants(
     uint32_t                                    size,
     const void*                                 pValues) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdPushConstants);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdPushConstants, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdPushConstants(commandBuffer, layout, stageFlags, offset, size, pValues);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdPushConstants, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdPushConstants(commandBuffer, layout, stageFlags, offset, size, pValues);
     }
     DispatchCmdPushConstants(commandBuffer, layout, stageFlags, offset, size, pValues);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdPushConstants, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdPushConstants(commandBuffer, layout, stageFlags, offset, size, pValues);
     }
 }
@@ -3803,19 +4490,24 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginRenderPass(
     const VkRenderPassBeginInfo*                pRenderPassBegin,
     VkSubpassContents                           contents) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdBeginRenderPass);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdBeginRenderPass, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBeginRenderPass(commandBuffer, pRenderPassBegin, contents);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdBeginRenderPass, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdBeginRenderPass(commandBuffer, pRenderPassBegin, contents);
     }
     DispatchCmdBeginRenderPass(commandBuffer, pRenderPassBegin, contents);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdBeginRenderPass, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdBeginRenderPass(commandBuffer, pRenderPassBegin, contents);
     }
 }
@@ -3824,19 +4516,24 @@ VKAPI_ATTR void VKAPI_CALL CmdNextSubpass(
     VkCommandBuffer                             commandBuffer,
     VkSubpassContents                           contents) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdNextSubpass);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdNextSubpass, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdNextSubpass(commandBuffer, contents);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdNextSubpass, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdNextSubpass(commandBuffer, contents);
     }
     DispatchCmdNextSubpass(commandBuffer, contents);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdNextSubpass, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdNextSubpass(commandBuffer, contents);
     }
 }
@@ -3844,19 +4541,24 @@ VKAPI_ATTR void VKAPI_CALL CmdNextSubpass(
 VKAPI_ATTR void VKAPI_CALL CmdEndRenderPass(
     VkCommandBuffer                             commandBuffer) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdEndRenderPass);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdEndRenderPass, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdEndRenderPass(commandBuffer);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdEndRenderPass, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdEndRenderPass(commandBuffer);
     }
     DispatchCmdEndRenderPass(commandBuffer);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdEndRenderPass, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdEndRenderPass(commandBuffer);
     }
 }
@@ -3866,19 +4568,24 @@ VKAPI_ATTR void VKAPI_CALL CmdExecuteCommands(
     uint32_t                                    commandBufferCount,
     const VkCommandBuffer*                      pCommandBuffers) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdExecuteCommands);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdExecuteCommands, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdExecuteCommands(commandBuffer, commandBufferCount, pCommandBuffers);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdExecuteCommands, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdExecuteCommands(commandBuffer, commandBufferCount, pCommandBuffers);
     }
     DispatchCmdExecuteCommands(commandBuffer, commandBufferCount, pCommandBuffers);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdExecuteCommands, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdExecuteCommands(commandBuffer, commandBufferCount, pCommandBuffers);
     }
 }
@@ -3889,19 +4596,24 @@ VKAPI_ATTR VkResult VKAPI_CALL BindBufferMemory2(
     uint32_t                                    bindInfoCount,
     const VkBindBufferMemoryInfo*               pBindInfos) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointBindBufferMemory2);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointBindBufferMemory2, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateBindBufferMemory2(device, bindInfoCount, pBindInfos);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointBindBufferMemory2, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordBindBufferMemory2(device, bindInfoCount, pBindInfos);
     }
     VkResult result = DispatchBindBufferMemory2(device, bindInfoCount, pBindInfos);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointBindBufferMemory2, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordBindBufferMemory2(device, bindInfoCount, pBindInfos, result);
     }
     return result;
@@ -3912,19 +4624,24 @@ VKAPI_ATTR VkResult VKAPI_CALL BindImageMemory2(
     uint32_t                                    bindInfoCount,
     const VkBindImageMemoryInfo*                pBindInfos) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointBindImageMemory2);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointBindImageMemory2, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateBindImageMemory2(device, bindInfoCount, pBindInfos);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointBindImageMemory2, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordBindImageMemory2(device, bindInfoCount, pBindInfos);
     }
     VkResult result = DispatchBindImageMemory2(device, bindInfoCount, pBindInfos);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointBindImageMemory2, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordBindImageMemory2(device, bindInfoCount, pBindInfos, result);
     }
     return result;
@@ -3937,19 +4654,24 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceGroupPeerMemoryFeatures(
     uint32_t                                    remoteDeviceIndex,
     VkPeerMemoryFeatureFlags*                   pPeerMemoryFeatures) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointGetDeviceGroupPeerMemoryFeatures);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetDeviceGroupPeerMemoryFeatures, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceGroupPeerMemoryFeatures(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetDeviceGroupPeerMemoryFeatures, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordGetDeviceGroupPeerMemoryFeatures(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
     }
     DispatchGetDeviceGroupPeerMemoryFeatures(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetDeviceGroupPeerMemoryFeatures, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordGetDeviceGroupPeerMemoryFeatures(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
     }
 }
@@ -3958,19 +4680,24 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDeviceMask(
     VkCommandBuffer                             commandBuffer,
     uint32_t                                    deviceMask) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdSetDeviceMask);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdSetDeviceMask, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetDeviceMask(commandBuffer, deviceMask);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdSetDeviceMask, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdSetDeviceMask(commandBuffer, deviceMask);
     }
     DispatchCmdSetDeviceMask(commandBuffer, deviceMask);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdSetDeviceMask, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdSetDeviceMask(commandBuffer, deviceMask);
     }
 }
@@ -3984,19 +4711,24 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatchBase(
     uint32_t                                    groupCountY,
     uint32_t                                    groupCountZ) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdDispatchBase);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdDispatchBase, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDispatchBase(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdDispatchBase, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdDispatchBase(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
     }
     DispatchCmdDispatchBase(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdDispatchBase, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdDispatchBase(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
     }
 }
@@ -4029,19 +4761,24 @@ VKAPI_ATTR void VKAPI_CALL GetImageMemoryRequirements2(
     const VkImageMemoryRequirementsInfo2*       pInfo,
     VkMemoryRequirements2*                      pMemoryRequirements) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointGetImageMemoryRequirements2);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetImageMemoryRequirements2, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetImageMemoryRequirements2(device, pInfo, pMemoryRequirements);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetImageMemoryRequirements2, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordGetImageMemoryRequirements2(device, pInfo, pMemoryRequirements);
     }
     DispatchGetImageMemoryRequirements2(device, pInfo, pMemoryRequirements);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetImageMemoryRequirements2, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordGetImageMemoryRequirements2(device, pInfo, pMemoryRequirements);
     }
 }
@@ -4051,19 +4788,24 @@ VKAPI_ATTR void VKAPI_CALL GetBufferMemoryRequirements2(
     const VkBufferMemoryRequirementsInfo2*      pInfo,
     VkMemoryRequirements2*                      pMemoryRequirements) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointGetBufferMemoryRequirements2);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetBufferMemoryRequirements2, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetBufferMemoryRequirements2(device, pInfo, pMemoryRequirements);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetBufferMemoryRequirements2, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordGetBufferMemoryRequirements2(device, pInfo, pMemoryRequirements);
     }
     DispatchGetBufferMemoryRequirements2(device, pInfo, pMemoryRequirements);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetBufferMemoryRequirements2, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordGetBufferMemoryRequirements2(device, pInfo, pMemoryRequirements);
     }
 }
@@ -4074,19 +4816,24 @@ VKAPI_ATTR void VKAPI_CALL GetImageSparseMemoryRequirements2(
     uint32_t*                                   pSparseMemoryRequirementCount,
     VkSparseImageMemoryRequirements2*           pSparseMemoryRequirements) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointGetImageSparseMemoryRequirements2);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetImageSparseMemoryRequirements2, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetImageSparseMemoryRequirements2(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetImageSparseMemoryRequirements2, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordGetImageSparseMemoryRequirements2(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
     }
     DispatchGetImageSparseMemoryRequirements2(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetImageSparseMemoryRequirements2, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordGetImageSparseMemoryRequirements2(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
     }
 }
@@ -4249,19 +4996,24 @@ VKAPI_ATTR void VKAPI_CALL TrimCommandPool(
     VkCommandPool                               commandPool,
     VkCommandPoolTrimFlags                      flags) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointTrimCommandPool);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointTrimCommandPool, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateTrimCommandPool(device, commandPool, flags);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointTrimCommandPool, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordTrimCommandPool(device, commandPool, flags);
     }
     DispatchTrimCommandPool(device, commandPool, flags);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointTrimCommandPool, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordTrimCommandPool(device, commandPool, flags);
     }
 }
@@ -4271,19 +5023,24 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceQueue2(
     const VkDeviceQueueInfo2*                   pQueueInfo,
     VkQueue*                                    pQueue) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointGetDeviceQueue2);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetDeviceQueue2, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceQueue2(device, pQueueInfo, pQueue);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetDeviceQueue2, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordGetDeviceQueue2(device, pQueueInfo, pQueue);
     }
     DispatchGetDeviceQueue2(device, pQueueInfo, pQueue);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetDeviceQueue2, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordGetDeviceQueue2(device, pQueueInfo, pQueue);
     }
 }
@@ -4294,19 +5051,24 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSamplerYcbcrConversion(
     const VkAllocationCallbacks*                pAllocator,
     VkSamplerYcbcrConversion*                   pYcbcrConversion) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCreateSamplerYcbcrConversion);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateSamplerYcbcrConversion, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateSamplerYcbcrConversion(device, pCreateInfo, pAllocator, pYcbcrConversion);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateSamplerYcbcrConversion, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCreateSamplerYcbcrConversion(device, pCreateInfo, pAllocator, pYcbcrConversion);
     }
     VkResult result = DispatchCreateSamplerYcbcrConversion(device, pCreateInfo, pAllocator, pYcbcrConversion);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateSamplerYcbcrConversion, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCreateSamplerYcbcrConversion(device, pCreateInfo, pAllocator, pYcbcrConversion, result);
     }
     return result;
@@ -4317,19 +5079,24 @@ VKAPI_ATTR void VKAPI_CALL DestroySamplerYcbcrConversion(
     VkSamplerYcbcrConversion                    ycbcrConversion,
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointDestroySamplerYcbcrConversion);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroySamplerYcbcrConversion, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroySamplerYcbcrConversion(device, ycbcrConversion, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroySamplerYcbcrConversion, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordDestroySamplerYcbcrConversion(device, ycbcrConversion, pAllocator);
     }
     DispatchDestroySamplerYcbcrConversion(device, ycbcrConversion, pAllocator);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroySamplerYcbcrConversion, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordDestroySamplerYcbcrConversion(device, ycbcrConversion, pAllocator);
     }
 }
@@ -4340,19 +5107,24 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDescriptorUpdateTemplate(
     const VkAllocationCallbacks*                pAllocator,
     VkDescriptorUpdateTemplate*                 pDescriptorUpdateTemplate) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCreateDescriptorUpdateTemplate);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateDescriptorUpdateTemplate, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateDescriptorUpdateTemplate(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateDescriptorUpdateTemplate, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCreateDescriptorUpdateTemplate(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
     }
     VkResult result = DispatchCreateDescriptorUpdateTemplate(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateDescriptorUpdateTemplate, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCreateDescriptorUpdateTemplate(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate, result);
     }
     return result;
@@ -4363,19 +5135,24 @@ VKAPI_ATTR void VKAPI_CALL DestroyDescriptorUpdateTemplate(
     VkDescriptorUpdateTemplate                  descriptorUpdateTemplate,
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointDestroyDescriptorUpdateTemplate);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroyDescriptorUpdateTemplate, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyDescriptorUpdateTemplate(device, descriptorUpdateTemplate, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroyDescriptorUpdateTemplate, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordDestroyDescriptorUpdateTemplate(device, descriptorUpdateTemplate, pAllocator);
     }
     DispatchDestroyDescriptorUpdateTemplate(device, descriptorUpdateTemplate, pAllocator);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroyDescriptorUpdateTemplate, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordDestroyDescriptorUpdateTemplate(device, descriptorUpdateTemplate, pAllocator);
     }
 }
@@ -4386,19 +5163,24 @@ VKAPI_ATTR void VKAPI_CALL UpdateDescriptorSetWithTemplate(
     VkDescriptorUpdateTemplate                  descriptorUpdateTemplate,
     const void*                                 pData) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointUpdateDescriptorSetWithTemplate);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointUpdateDescriptorSetWithTemplate, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateUpdateDescriptorSetWithTemplate(device, descriptorSet, descriptorUpdateTemplate, pData);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointUpdateDescriptorSetWithTemplate, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordUpdateDescriptorSetWithTemplate(device, descriptorSet, descriptorUpdateTemplate, pData);
     }
     DispatchUpdateDescriptorSetWithTemplate(device, descriptorSet, descriptorUpdateTemplate, pData);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointUpdateDescriptorSetWithTemplate, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordUpdateDescriptorSetWithTemplate(device, descriptorSet, descriptorUpdateTemplate, pData);
     }
 }
@@ -4474,19 +5256,24 @@ VKAPI_ATTR void VKAPI_CALL GetDescriptorSetLayoutSupport(
     const VkDescriptorSetLayoutCreateInfo*      pCreateInfo,
     VkDescriptorSetLayoutSupport*               pSupport) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointGetDescriptorSetLayoutSupport);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetDescriptorSetLayoutSupport, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDescriptorSetLayoutSupport(device, pCreateInfo, pSupport);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetDescriptorSetLayoutSupport, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordGetDescriptorSetLayoutSupport(device, pCreateInfo, pSupport);
     }
     DispatchGetDescriptorSetLayoutSupport(device, pCreateInfo, pSupport);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetDescriptorSetLayoutSupport, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordGetDescriptorSetLayoutSupport(device, pCreateInfo, pSupport);
     }
 }
@@ -4501,19 +5288,24 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirectCount(
     uint32_t                                    maxDrawCount,
     uint32_t                                    stride) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdDrawIndirectCount);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdDrawIndirectCount, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdDrawIndirectCount, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdDrawIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
     DispatchCmdDrawIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdDrawIndirectCount, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdDrawIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
 }
@@ -4527,19 +5319,24 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexedIndirectCount(
     uint32_t                                    maxDrawCount,
     uint32_t                                    stride) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdDrawIndexedIndirectCount);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdDrawIndexedIndirectCount, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawIndexedIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdDrawIndexedIndirectCount, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdDrawIndexedIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
     DispatchCmdDrawIndexedIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdDrawIndexedIndirectCount, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdDrawIndexedIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
 }
@@ -4550,19 +5347,24 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRenderPass2(
     const VkAllocationCallbacks*                pAllocator,
     VkRenderPass*                               pRenderPass) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCreateRenderPass2);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateRenderPass2, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateRenderPass2(device, pCreateInfo, pAllocator, pRenderPass);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateRenderPass2, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCreateRenderPass2(device, pCreateInfo, pAllocator, pRenderPass);
     }
     VkResult result = DispatchCreateRenderPass2(device, pCreateInfo, pAllocator, pRenderPass);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateRenderPass2, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCreateRenderPass2(device, pCreateInfo, pAllocator, pRenderPass, result);
     }
     return result;
@@ -4573,19 +5375,24 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginRenderPass2(
     const VkRenderPassBeginInfo*                pRenderPassBegin,
     const VkSubpassBeginInfo*                   pSubpassBeginInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdBeginRenderPass2);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdBeginRenderPass2, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBeginRenderPass2(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdBeginRenderPass2, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdBeginRenderPass2(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
     }
     DispatchCmdBeginRenderPass2(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdBeginRenderPass2, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdBeginRenderPass2(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
     }
 }
@@ -4595,19 +5402,24 @@ VKAPI_ATTR void VKAPI_CALL CmdNextSubpass2(
     const VkSubpassBeginInfo*                   pSubpassBeginInfo,
     const VkSubpassEndInfo*                     pSubpassEndInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdNextSubpass2);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdNextSubpass2, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdNextSubpass2(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdNextSubpass2, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdNextSubpass2(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
     }
     DispatchCmdNextSubpass2(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdNextSubpass2, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdNextSubpass2(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
     }
 }
@@ -4616,19 +5428,24 @@ VKAPI_ATTR void VKAPI_CALL CmdEndRenderPass2(
     VkCommandBuffer                             commandBuffer,
     const VkSubpassEndInfo*                     pSubpassEndInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdEndRenderPass2);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdEndRenderPass2, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdEndRenderPass2(commandBuffer, pSubpassEndInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdEndRenderPass2, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdEndRenderPass2(commandBuffer, pSubpassEndInfo);
     }
     DispatchCmdEndRenderPass2(commandBuffer, pSubpassEndInfo);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdEndRenderPass2, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdEndRenderPass2(commandBuffer, pSubpassEndInfo);
     }
 }
@@ -4639,19 +5456,24 @@ VKAPI_ATTR void VKAPI_CALL ResetQueryPool(
     uint32_t                                    firstQuery,
     uint32_t                                    queryCount) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointResetQueryPool);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointResetQueryPool, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateResetQueryPool(device, queryPool, firstQuery, queryCount);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointResetQueryPool, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordResetQueryPool(device, queryPool, firstQuery, queryCount);
     }
     DispatchResetQueryPool(device, queryPool, firstQuery, queryCount);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointResetQueryPool, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordResetQueryPool(device, queryPool, firstQuery, queryCount);
     }
 }
@@ -4661,19 +5483,24 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSemaphoreCounterValue(
     VkSemaphore                                 semaphore,
     uint64_t*                                   pValue) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointGetSemaphoreCounterValue);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetSemaphoreCounterValue, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetSemaphoreCounterValue(device, semaphore, pValue);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetSemaphoreCounterValue, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordGetSemaphoreCounterValue(device, semaphore, pValue);
     }
     VkResult result = DispatchGetSemaphoreCounterValue(device, semaphore, pValue);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetSemaphoreCounterValue, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordGetSemaphoreCounterValue(device, semaphore, pValue, result);
     }
     return result;
@@ -4684,19 +5511,24 @@ VKAPI_ATTR VkResult VKAPI_CALL WaitSemaphores(
     const VkSemaphoreWaitInfo*                  pWaitInfo,
     uint64_t                                    timeout) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointWaitSemaphores);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointWaitSemaphores, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateWaitSemaphores(device, pWaitInfo, timeout);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointWaitSemaphores, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordWaitSemaphores(device, pWaitInfo, timeout);
     }
     VkResult result = DispatchWaitSemaphores(device, pWaitInfo, timeout);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointWaitSemaphores, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordWaitSemaphores(device, pWaitInfo, timeout, result);
     }
     return result;
@@ -4706,19 +5538,24 @@ VKAPI_ATTR VkResult VKAPI_CALL SignalSemaphore(
     VkDevice                                    device,
     const VkSemaphoreSignalInfo*                pSignalInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointSignalSemaphore);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointSignalSemaphore, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateSignalSemaphore(device, pSignalInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointSignalSemaphore, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordSignalSemaphore(device, pSignalInfo);
     }
     VkResult result = DispatchSignalSemaphore(device, pSignalInfo);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointSignalSemaphore, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordSignalSemaphore(device, pSignalInfo, result);
     }
     return result;
@@ -4728,19 +5565,24 @@ VKAPI_ATTR VkDeviceAddress VKAPI_CALL GetBufferDeviceAddress(
     VkDevice                                    device,
     const VkBufferDeviceAddressInfo*            pInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointGetBufferDeviceAddress);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetBufferDeviceAddress, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetBufferDeviceAddress(device, pInfo);
         if (skip) return 0;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetBufferDeviceAddress, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordGetBufferDeviceAddress(device, pInfo);
     }
     VkDeviceAddress result = DispatchGetBufferDeviceAddress(device, pInfo);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetBufferDeviceAddress, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordGetBufferDeviceAddress(device, pInfo, result);
     }
     return result;
@@ -4750,19 +5592,24 @@ VKAPI_ATTR uint64_t VKAPI_CALL GetBufferOpaqueCaptureAddress(
     VkDevice                                    device,
     const VkBufferDeviceAddressInfo*            pInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointGetBufferOpaqueCaptureAddress);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetBufferOpaqueCaptureAddress, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetBufferOpaqueCaptureAddress(device, pInfo);
         if (skip) return 0;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetBufferOpaqueCaptureAddress, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordGetBufferOpaqueCaptureAddress(device, pInfo);
     }
     uint64_t result = DispatchGetBufferOpaqueCaptureAddress(device, pInfo);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetBufferOpaqueCaptureAddress, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordGetBufferOpaqueCaptureAddress(device, pInfo);
     }
     return result;
@@ -4772,19 +5619,24 @@ VKAPI_ATTR uint64_t VKAPI_CALL GetDeviceMemoryOpaqueCaptureAddress(
     VkDevice                                    device,
     const VkDeviceMemoryOpaqueCaptureAddressInfo* pInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointGetDeviceMemoryOpaqueCaptureAddress);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetDeviceMemoryOpaqueCaptureAddress, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceMemoryOpaqueCaptureAddress(device, pInfo);
         if (skip) return 0;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetDeviceMemoryOpaqueCaptureAddress, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordGetDeviceMemoryOpaqueCaptureAddress(device, pInfo);
     }
     uint64_t result = DispatchGetDeviceMemoryOpaqueCaptureAddress(device, pInfo);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetDeviceMemoryOpaqueCaptureAddress, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordGetDeviceMemoryOpaqueCaptureAddress(device, pInfo);
     }
     return result;
@@ -4915,19 +5767,24 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSwapchainKHR(
     const VkAllocationCallbacks*                pAllocator,
     VkSwapchainKHR*                             pSwapchain) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCreateSwapchainKHR);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateSwapchainKHR, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateSwapchainKHR(device, pCreateInfo, pAllocator, pSwapchain);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateSwapchainKHR, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCreateSwapchainKHR(device, pCreateInfo, pAllocator, pSwapchain);
     }
     VkResult result = DispatchCreateSwapchainKHR(device, pCreateInfo, pAllocator, pSwapchain);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateSwapchainKHR, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCreateSwapchainKHR(device, pCreateInfo, pAllocator, pSwapchain, result);
     }
     return result;
@@ -4938,19 +5795,24 @@ VKAPI_ATTR void VKAPI_CALL DestroySwapchainKHR(
     VkSwapchainKHR                              swapchain,
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointDestroySwapchainKHR);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroySwapchainKHR, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroySwapchainKHR(device, swapchain, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroySwapchainKHR, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordDestroySwapchainKHR(device, swapchain, pAllocator);
     }
     DispatchDestroySwapchainKHR(device, swapchain, pAllocator);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroySwapchainKHR, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordDestroySwapchainKHR(device, swapchain, pAllocator);
     }
 }
@@ -4961,19 +5823,24 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSwapchainImagesKHR(
     uint32_t*                                   pSwapchainImageCount,
     VkImage*                                    pSwapchainImages) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointGetSwapchainImagesKHR);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetSwapchainImagesKHR, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetSwapchainImagesKHR(device, swapchain, pSwapchainImageCount, pSwapchainImages);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetSwapchainImagesKHR, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordGetSwapchainImagesKHR(device, swapchain, pSwapchainImageCount, pSwapchainImages);
     }
     VkResult result = DispatchGetSwapchainImagesKHR(device, swapchain, pSwapchainImageCount, pSwapchainImages);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetSwapchainImagesKHR, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordGetSwapchainImagesKHR(device, swapchain, pSwapchainImageCount, pSwapchainImages, result);
     }
     return result;
@@ -4987,19 +5854,24 @@ VKAPI_ATTR VkResult VKAPI_CALL AcquireNextImageKHR(
     VkFence                                     fence,
     uint32_t*                                   pImageIndex) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointAcquireNextImageKHR);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointAcquireNextImageKHR, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateAcquireNextImageKHR(device, swapchain, timeout, semaphore, fence, pImageIndex);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointAcquireNextImageKHR, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordAcquireNextImageKHR(device, swapchain, timeout, semaphore, fence, pImageIndex);
     }
     VkResult result = DispatchAcquireNextImageKHR(device, swapchain, timeout, semaphore, fence, pImageIndex);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointAcquireNextImageKHR, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordAcquireNextImageKHR(device, swapchain, timeout, semaphore, fence, pImageIndex, result);
     }
     return result;
@@ -5009,19 +5881,24 @@ VKAPI_ATTR VkResult VKAPI_CALL QueuePresentKHR(
     VkQueue                                     queue,
     const VkPresentInfoKHR*                     pPresentInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointQueuePresentKHR);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointQueuePresentKHR, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateQueuePresentKHR(queue, pPresentInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointQueuePresentKHR, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordQueuePresentKHR(queue, pPresentInfo);
     }
     VkResult result = DispatchQueuePresentKHR(queue, pPresentInfo);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointQueuePresentKHR, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordQueuePresentKHR(queue, pPresentInfo, result);
     }
     return result;
@@ -5031,19 +5908,24 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDeviceGroupPresentCapabilitiesKHR(
     VkDevice                                    device,
     VkDeviceGroupPresentCapabilitiesKHR*        pDeviceGroupPresentCapabilities) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointGetDeviceGroupPresentCapabilitiesKHR);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetDeviceGroupPresentCapabilitiesKHR, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceGroupPresentCapabilitiesKHR(device, pDeviceGroupPresentCapabilities);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetDeviceGroupPresentCapabilitiesKHR, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordGetDeviceGroupPresentCapabilitiesKHR(device, pDeviceGroupPresentCapabilities);
     }
     VkResult result = DispatchGetDeviceGroupPresentCapabilitiesKHR(device, pDeviceGroupPresentCapabilities);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetDeviceGroupPresentCapabilitiesKHR, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordGetDeviceGroupPresentCapabilitiesKHR(device, pDeviceGroupPresentCapabilities, result);
     }
     return result;
@@ -5054,19 +5936,24 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDeviceGroupSurfacePresentModesKHR(
     VkSurfaceKHR                                surface,
     VkDeviceGroupPresentModeFlagsKHR*           pModes) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointGetDeviceGroupSurfacePresentModesKHR);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetDeviceGroupSurfacePresentModesKHR, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceGroupSurfacePresentModesKHR(device, surface, pModes);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetDeviceGroupSurfacePresentModesKHR, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordGetDeviceGroupSurfacePresentModesKHR(device, surface, pModes);
     }
     VkResult result = DispatchGetDeviceGroupSurfacePresentModesKHR(device, surface, pModes);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetDeviceGroupSurfacePresentModesKHR, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordGetDeviceGroupSurfacePresentModesKHR(device, surface, pModes, result);
     }
     return result;
@@ -5101,19 +5988,24 @@ VKAPI_ATTR VkResult VKAPI_CALL AcquireNextImage2KHR(
     const VkAcquireNextImageInfoKHR*            pAcquireInfo,
     uint32_t*                                   pImageIndex) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointAcquireNextImage2KHR);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointAcquireNextImage2KHR, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateAcquireNextImage2KHR(device, pAcquireInfo, pImageIndex);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointAcquireNextImage2KHR, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordAcquireNextImage2KHR(device, pAcquireInfo, pImageIndex);
     }
     VkResult result = DispatchAcquireNextImage2KHR(device, pAcquireInfo, pImageIndex);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointAcquireNextImage2KHR, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordAcquireNextImage2KHR(device, pAcquireInfo, pImageIndex, result);
     }
     return result;
@@ -5295,19 +6187,24 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSharedSwapchainsKHR(
     const VkAllocationCallbacks*                pAllocator,
     VkSwapchainKHR*                             pSwapchains) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCreateSharedSwapchainsKHR);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateSharedSwapchainsKHR, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateSharedSwapchainsKHR(device, swapchainCount, pCreateInfos, pAllocator, pSwapchains);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateSharedSwapchainsKHR, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCreateSharedSwapchainsKHR(device, swapchainCount, pCreateInfos, pAllocator, pSwapchains);
     }
     VkResult result = DispatchCreateSharedSwapchainsKHR(device, swapchainCount, pCreateInfos, pAllocator, pSwapchains);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateSharedSwapchainsKHR, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCreateSharedSwapchainsKHR(device, swapchainCount, pCreateInfos, pAllocator, pSwapchains, result);
     }
     return result;
@@ -5705,19 +6602,24 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceGroupPeerMemoryFeaturesKHR(
     uint32_t                                    remoteDeviceIndex,
     VkPeerMemoryFeatureFlags*                   pPeerMemoryFeatures) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointGetDeviceGroupPeerMemoryFeaturesKHR);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetDeviceGroupPeerMemoryFeaturesKHR, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceGroupPeerMemoryFeaturesKHR(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetDeviceGroupPeerMemoryFeaturesKHR, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordGetDeviceGroupPeerMemoryFeaturesKHR(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
     }
     DispatchGetDeviceGroupPeerMemoryFeaturesKHR(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetDeviceGroupPeerMemoryFeaturesKHR, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordGetDeviceGroupPeerMemoryFeaturesKHR(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
     }
 }
@@ -5726,19 +6628,24 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDeviceMaskKHR(
     VkCommandBuffer                             commandBuffer,
     uint32_t                                    deviceMask) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdSetDeviceMaskKHR);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdSetDeviceMaskKHR, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetDeviceMaskKHR(commandBuffer, deviceMask);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdSetDeviceMaskKHR, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdSetDeviceMaskKHR(commandBuffer, deviceMask);
     }
     DispatchCmdSetDeviceMaskKHR(commandBuffer, deviceMask);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdSetDeviceMaskKHR, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdSetDeviceMaskKHR(commandBuffer, deviceMask);
     }
 }
@@ -5752,19 +6659,24 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatchBaseKHR(
     uint32_t                                    groupCountY,
     uint32_t                                    groupCountZ) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdDispatchBaseKHR);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdDispatchBaseKHR, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDispatchBaseKHR(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdDispatchBaseKHR, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdDispatchBaseKHR(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
     }
     DispatchCmdDispatchBaseKHR(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdDispatchBaseKHR, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdDispatchBaseKHR(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
     }
 }
@@ -5776,19 +6688,24 @@ VKAPI_ATTR void VKAPI_CALL TrimCommandPoolKHR(
     VkCommandPool                               commandPool,
     VkCommandPoolTrimFlags                      flags) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointTrimCommandPoolKHR);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointTrimCommandPoolKHR, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateTrimCommandPoolKHR(device, commandPool, flags);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointTrimCommandPoolKHR, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordTrimCommandPoolKHR(device, commandPool, flags);
     }
     DispatchTrimCommandPoolKHR(device, commandPool, flags);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointTrimCommandPoolKHR, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordTrimCommandPoolKHR(device, commandPool, flags);
     }
 }
@@ -5848,19 +6765,24 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryWin32HandleKHR(
     const VkMemoryGetWin32HandleInfoKHR*        pGetWin32HandleInfo,
     HANDLE*                                     pHandle) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointGetMemoryWin32HandleKHR);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetMemoryWin32HandleKHR, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetMemoryWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetMemoryWin32HandleKHR, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordGetMemoryWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
     }
     VkResult result = DispatchGetMemoryWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetMemoryWin32HandleKHR, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordGetMemoryWin32HandleKHR(device, pGetWin32HandleInfo, pHandle, result);
     }
     return result;
@@ -5872,19 +6794,24 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryWin32HandlePropertiesKHR(
     HANDLE                                      handle,
     VkMemoryWin32HandlePropertiesKHR*           pMemoryWin32HandleProperties) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointGetMemoryWin32HandlePropertiesKHR);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetMemoryWin32HandlePropertiesKHR, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetMemoryWin32HandlePropertiesKHR(device, handleType, handle, pMemoryWin32HandleProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetMemoryWin32HandlePropertiesKHR, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordGetMemoryWin32HandlePropertiesKHR(device, handleType, handle, pMemoryWin32HandleProperties);
     }
     VkResult result = DispatchGetMemoryWin32HandlePropertiesKHR(device, handleType, handle, pMemoryWin32HandleProperties);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetMemoryWin32HandlePropertiesKHR, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordGetMemoryWin32HandlePropertiesKHR(device, handleType, handle, pMemoryWin32HandleProperties, result);
     }
     return result;
@@ -5897,19 +6824,24 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryFdKHR(
     const VkMemoryGetFdInfoKHR*                 pGetFdInfo,
     int*                                        pFd) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointGetMemoryFdKHR);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetMemoryFdKHR, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetMemoryFdKHR(device, pGetFdInfo, pFd);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetMemoryFdKHR, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordGetMemoryFdKHR(device, pGetFdInfo, pFd);
     }
     VkResult result = DispatchGetMemoryFdKHR(device, pGetFdInfo, pFd);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetMemoryFdKHR, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordGetMemoryFdKHR(device, pGetFdInfo, pFd, result);
     }
     return result;
@@ -5921,19 +6853,24 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryFdPropertiesKHR(
     int                                         fd,
     VkMemoryFdPropertiesKHR*                    pMemoryFdProperties) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointGetMemoryFdPropertiesKHR);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetMemoryFdPropertiesKHR, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetMemoryFdPropertiesKHR(device, handleType, fd, pMemoryFdProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetMemoryFdPropertiesKHR, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordGetMemoryFdPropertiesKHR(device, handleType, fd, pMemoryFdProperties);
     }
     VkResult result = DispatchGetMemoryFdPropertiesKHR(device, handleType, fd, pMemoryFdProperties);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetMemoryFdPropertiesKHR, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordGetMemoryFdPropertiesKHR(device, handleType, fd, pMemoryFdProperties, result);
     }
     return result;
@@ -5972,19 +6909,24 @@ VKAPI_ATTR VkResult VKAPI_CALL ImportSemaphoreWin32HandleKHR(
     VkDevice                                    device,
     const VkImportSemaphoreWin32HandleInfoKHR*  pImportSemaphoreWin32HandleInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointImportSemaphoreWin32HandleKHR);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointImportSemaphoreWin32HandleKHR, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateImportSemaphoreWin32HandleKHR(device, pImportSemaphoreWin32HandleInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointImportSemaphoreWin32HandleKHR, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordImportSemaphoreWin32HandleKHR(device, pImportSemaphoreWin32HandleInfo);
     }
     VkResult result = DispatchImportSemaphoreWin32HandleKHR(device, pImportSemaphoreWin32HandleInfo);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointImportSemaphoreWin32HandleKHR, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordImportSemaphoreWin32HandleKHR(device, pImportSemaphoreWin32HandleInfo, result);
     }
     return result;
@@ -5995,19 +6937,24 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSemaphoreWin32HandleKHR(
     const VkSemaphoreGetWin32HandleInfoKHR*     pGetWin32HandleInfo,
     HANDLE*                                     pHandle) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointGetSemaphoreWin32HandleKHR);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetSemaphoreWin32HandleKHR, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetSemaphoreWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetSemaphoreWin32HandleKHR, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordGetSemaphoreWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
     }
     VkResult result = DispatchGetSemaphoreWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetSemaphoreWin32HandleKHR, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordGetSemaphoreWin32HandleKHR(device, pGetWin32HandleInfo, pHandle, result);
     }
     return result;
@@ -6019,19 +6966,24 @@ VKAPI_ATTR VkResult VKAPI_CALL ImportSemaphoreFdKHR(
     VkDevice                                    device,
     const VkImportSemaphoreFdInfoKHR*           pImportSemaphoreFdInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointImportSemaphoreFdKHR);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointImportSemaphoreFdKHR, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateImportSemaphoreFdKHR(device, pImportSemaphoreFdInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointImportSemaphoreFdKHR, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordImportSemaphoreFdKHR(device, pImportSemaphoreFdInfo);
     }
     VkResult result = DispatchImportSemaphoreFdKHR(device, pImportSemaphoreFdInfo);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointImportSemaphoreFdKHR, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordImportSemaphoreFdKHR(device, pImportSemaphoreFdInfo, result);
     }
     return result;
@@ -6042,19 +6994,24 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSemaphoreFdKHR(
     const VkSemaphoreGetFdInfoKHR*              pGetFdInfo,
     int*                                        pFd) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointGetSemaphoreFdKHR);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetSemaphoreFdKHR, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetSemaphoreFdKHR(device, pGetFdInfo, pFd);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetSemaphoreFdKHR, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordGetSemaphoreFdKHR(device, pGetFdInfo, pFd);
     }
     VkResult result = DispatchGetSemaphoreFdKHR(device, pGetFdInfo, pFd);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetSemaphoreFdKHR, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordGetSemaphoreFdKHR(device, pGetFdInfo, pFd, result);
     }
     return result;
@@ -6069,19 +7026,24 @@ VKAPI_ATTR void VKAPI_CALL CmdPushDescriptorSetKHR(
     uint32_t                                    descriptorWriteCount,
     const VkWriteDescriptorSet*                 pDescriptorWrites) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdPushDescriptorSetKHR);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdPushDescriptorSetKHR, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdPushDescriptorSetKHR(commandBuffer, pipelineBindPoint, layout, set, descriptorWriteCount, pDescriptorWrites);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdPushDescriptorSetKHR, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdPushDescriptorSetKHR(commandBuffer, pipelineBindPoint, layout, set, descriptorWriteCount, pDescriptorWrites);
     }
     DispatchCmdPushDescriptorSetKHR(commandBuffer, pipelineBindPoint, layout, set, descriptorWriteCount, pDescriptorWrites);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdPushDescriptorSetKHR, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdPushDescriptorSetKHR(commandBuffer, pipelineBindPoint, layout, set, descriptorWriteCount, pDescriptorWrites);
     }
 }
@@ -6093,19 +7055,24 @@ VKAPI_ATTR void VKAPI_CALL CmdPushDescriptorSetWithTemplateKHR(
     uint32_t                                    set,
     const void*                                 pData) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdPushDescriptorSetWithTemplateKHR);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdPushDescriptorSetWithTemplateKHR, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdPushDescriptorSetWithTemplateKHR(commandBuffer, descriptorUpdateTemplate, layout, set, pData);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdPushDescriptorSetWithTemplateKHR, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdPushDescriptorSetWithTemplateKHR(commandBuffer, descriptorUpdateTemplate, layout, set, pData);
     }
     DispatchCmdPushDescriptorSetWithTemplateKHR(commandBuffer, descriptorUpdateTemplate, layout, set, pData);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdPushDescriptorSetWithTemplateKHR, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdPushDescriptorSetWithTemplateKHR(commandBuffer, descriptorUpdateTemplate, layout, set, pData);
     }
 }
@@ -6120,19 +7087,24 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDescriptorUpdateTemplateKHR(
     const VkAllocationCallbacks*                pAllocator,
     VkDescriptorUpdateTemplate*                 pDescriptorUpdateTemplate) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCreateDescriptorUpdateTemplateKHR);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateDescriptorUpdateTemplateKHR, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateDescriptorUpdateTemplateKHR(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateDescriptorUpdateTemplateKHR, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCreateDescriptorUpdateTemplateKHR(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
     }
     VkResult result = DispatchCreateDescriptorUpdateTemplateKHR(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateDescriptorUpdateTemplateKHR, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCreateDescriptorUpdateTemplateKHR(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate, result);
     }
     return result;
@@ -6143,19 +7115,24 @@ VKAPI_ATTR void VKAPI_CALL DestroyDescriptorUpdateTemplateKHR(
     VkDescriptorUpdateTemplate                  descriptorUpdateTemplate,
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointDestroyDescriptorUpdateTemplateKHR);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroyDescriptorUpdateTemplateKHR, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyDescriptorUpdateTemplateKHR(device, descriptorUpdateTemplate, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroyDescriptorUpdateTemplateKHR, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordDestroyDescriptorUpdateTemplateKHR(device, descriptorUpdateTemplate, pAllocator);
     }
     DispatchDestroyDescriptorUpdateTemplateKHR(device, descriptorUpdateTemplate, pAllocator);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroyDescriptorUpdateTemplateKHR, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordDestroyDescriptorUpdateTemplateKHR(device, descriptorUpdateTemplate, pAllocator);
     }
 }
@@ -6166,19 +7143,24 @@ VKAPI_ATTR void VKAPI_CALL UpdateDescriptorSetWithTemplateKHR(
     VkDescriptorUpdateTemplate                  descriptorUpdateTemplate,
     const void*                                 pData) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointUpdateDescriptorSetWithTemplateKHR);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointUpdateDescriptorSetWithTemplateKHR, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateUpdateDescriptorSetWithTemplateKHR(device, descriptorSet, descriptorUpdateTemplate, pData);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointUpdateDescriptorSetWithTemplateKHR, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordUpdateDescriptorSetWithTemplateKHR(device, descriptorSet, descriptorUpdateTemplate, pData);
     }
     DispatchUpdateDescriptorSetWithTemplateKHR(device, descriptorSet, descriptorUpdateTemplate, pData);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointUpdateDescriptorSetWithTemplateKHR, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordUpdateDescriptorSetWithTemplateKHR(device, descriptorSet, descriptorUpdateTemplate, pData);
     }
 }
@@ -6191,19 +7173,24 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRenderPass2KHR(
     const VkAllocationCallbacks*                pAllocator,
     VkRenderPass*                               pRenderPass) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCreateRenderPass2KHR);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateRenderPass2KHR, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateRenderPass2KHR(device, pCreateInfo, pAllocator, pRenderPass);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateRenderPass2KHR, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCreateRenderPass2KHR(device, pCreateInfo, pAllocator, pRenderPass);
     }
     VkResult result = DispatchCreateRenderPass2KHR(device, pCreateInfo, pAllocator, pRenderPass);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateRenderPass2KHR, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCreateRenderPass2KHR(device, pCreateInfo, pAllocator, pRenderPass, result);
     }
     return result;
@@ -6214,19 +7201,24 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginRenderPass2KHR(
     const VkRenderPassBeginInfo*                pRenderPassBegin,
     const VkSubpassBeginInfo*                   pSubpassBeginInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdBeginRenderPass2KHR);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdBeginRenderPass2KHR, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBeginRenderPass2KHR(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdBeginRenderPass2KHR, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdBeginRenderPass2KHR(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
     }
     DispatchCmdBeginRenderPass2KHR(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdBeginRenderPass2KHR, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdBeginRenderPass2KHR(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
     }
 }
@@ -6236,19 +7228,24 @@ VKAPI_ATTR void VKAPI_CALL CmdNextSubpass2KHR(
     const VkSubpassBeginInfo*                   pSubpassBeginInfo,
     const VkSubpassEndInfo*                     pSubpassEndInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdNextSubpass2KHR);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdNextSubpass2KHR, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdNextSubpass2KHR(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdNextSubpass2KHR, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdNextSubpass2KHR(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
     }
     DispatchCmdNextSubpass2KHR(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdNextSubpass2KHR, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdNextSubpass2KHR(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
     }
 }
@@ -6257,19 +7254,24 @@ VKAPI_ATTR void VKAPI_CALL CmdEndRenderPass2KHR(
     VkCommandBuffer                             commandBuffer,
     const VkSubpassEndInfo*                     pSubpassEndInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdEndRenderPass2KHR);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdEndRenderPass2KHR, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdEndRenderPass2KHR(commandBuffer, pSubpassEndInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdEndRenderPass2KHR, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdEndRenderPass2KHR(commandBuffer, pSubpassEndInfo);
     }
     DispatchCmdEndRenderPass2KHR(commandBuffer, pSubpassEndInfo);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdEndRenderPass2KHR, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdEndRenderPass2KHR(commandBuffer, pSubpassEndInfo);
     }
 }
@@ -6279,19 +7281,24 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSwapchainStatusKHR(
     VkDevice                                    device,
     VkSwapchainKHR                              swapchain) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointGetSwapchainStatusKHR);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetSwapchainStatusKHR, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetSwapchainStatusKHR(device, swapchain);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetSwapchainStatusKHR, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordGetSwapchainStatusKHR(device, swapchain);
     }
     VkResult result = DispatchGetSwapchainStatusKHR(device, swapchain);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetSwapchainStatusKHR, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordGetSwapchainStatusKHR(device, swapchain, result);
     }
     return result;
@@ -6327,19 +7334,24 @@ VKAPI_ATTR VkResult VKAPI_CALL ImportFenceWin32HandleKHR(
     VkDevice                                    device,
     const VkImportFenceWin32HandleInfoKHR*      pImportFenceWin32HandleInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointImportFenceWin32HandleKHR);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointImportFenceWin32HandleKHR, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateImportFenceWin32HandleKHR(device, pImportFenceWin32HandleInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointImportFenceWin32HandleKHR, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordImportFenceWin32HandleKHR(device, pImportFenceWin32HandleInfo);
     }
     VkResult result = DispatchImportFenceWin32HandleKHR(device, pImportFenceWin32HandleInfo);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointImportFenceWin32HandleKHR, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordImportFenceWin32HandleKHR(device, pImportFenceWin32HandleInfo, result);
     }
     return result;
@@ -6350,19 +7362,24 @@ VKAPI_ATTR VkResult VKAPI_CALL GetFenceWin32HandleKHR(
     const VkFenceGetWin32HandleInfoKHR*         pGetWin32HandleInfo,
     HANDLE*                                     pHandle) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointGetFenceWin32HandleKHR);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetFenceWin32HandleKHR, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetFenceWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetFenceWin32HandleKHR, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordGetFenceWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
     }
     VkResult result = DispatchGetFenceWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetFenceWin32HandleKHR, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordGetFenceWin32HandleKHR(device, pGetWin32HandleInfo, pHandle, result);
     }
     return result;
@@ -6374,19 +7391,24 @@ VKAPI_ATTR VkResult VKAPI_CALL ImportFenceFdKHR(
     VkDevice                                    device,
     const VkImportFenceFdInfoKHR*               pImportFenceFdInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointImportFenceFdKHR);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointImportFenceFdKHR, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateImportFenceFdKHR(device, pImportFenceFdInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointImportFenceFdKHR, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordImportFenceFdKHR(device, pImportFenceFdInfo);
     }
     VkResult result = DispatchImportFenceFdKHR(device, pImportFenceFdInfo);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointImportFenceFdKHR, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordImportFenceFdKHR(device, pImportFenceFdInfo, result);
     }
     return result;
@@ -6397,19 +7419,24 @@ VKAPI_ATTR VkResult VKAPI_CALL GetFenceFdKHR(
     const VkFenceGetFdInfoKHR*                  pGetFdInfo,
     int*                                        pFd) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointGetFenceFdKHR);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetFenceFdKHR, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetFenceFdKHR(device, pGetFdInfo, pFd);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetFenceFdKHR, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordGetFenceFdKHR(device, pGetFdInfo, pFd);
     }
     VkResult result = DispatchGetFenceFdKHR(device, pGetFdInfo, pFd);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetFenceFdKHR, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordGetFenceFdKHR(device, pGetFdInfo, pFd, result);
     }
     return result;
@@ -6467,19 +7494,24 @@ VKAPI_ATTR VkResult VKAPI_CALL AcquireProfilingLockKHR(
     VkDevice                                    device,
     const VkAcquireProfilingLockInfoKHR*        pInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointAcquireProfilingLockKHR);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointAcquireProfilingLockKHR, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateAcquireProfilingLockKHR(device, pInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointAcquireProfilingLockKHR, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordAcquireProfilingLockKHR(device, pInfo);
     }
     VkResult result = DispatchAcquireProfilingLockKHR(device, pInfo);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointAcquireProfilingLockKHR, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordAcquireProfilingLockKHR(device, pInfo, result);
     }
     return result;
@@ -6488,19 +7520,24 @@ VKAPI_ATTR VkResult VKAPI_CALL AcquireProfilingLockKHR(
 VKAPI_ATTR void VKAPI_CALL ReleaseProfilingLockKHR(
     VkDevice                                    device) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointReleaseProfilingLockKHR);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointReleaseProfilingLockKHR, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateReleaseProfilingLockKHR(device);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointReleaseProfilingLockKHR, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordReleaseProfilingLockKHR(device);
     }
     DispatchReleaseProfilingLockKHR(device);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointReleaseProfilingLockKHR, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordReleaseProfilingLockKHR(device);
     }
 }
@@ -6658,19 +7695,24 @@ VKAPI_ATTR void VKAPI_CALL GetImageMemoryRequirements2KHR(
     const VkImageMemoryRequirementsInfo2*       pInfo,
     VkMemoryRequirements2*                      pMemoryRequirements) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointGetImageMemoryRequirements2KHR);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetImageMemoryRequirements2KHR, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetImageMemoryRequirements2KHR(device, pInfo, pMemoryRequirements);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetImageMemoryRequirements2KHR, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordGetImageMemoryRequirements2KHR(device, pInfo, pMemoryRequirements);
     }
     DispatchGetImageMemoryRequirements2KHR(device, pInfo, pMemoryRequirements);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetImageMemoryRequirements2KHR, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordGetImageMemoryRequirements2KHR(device, pInfo, pMemoryRequirements);
     }
 }
@@ -6680,19 +7722,24 @@ VKAPI_ATTR void VKAPI_CALL GetBufferMemoryRequirements2KHR(
     const VkBufferMemoryRequirementsInfo2*      pInfo,
     VkMemoryRequirements2*                      pMemoryRequirements) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointGetBufferMemoryRequirements2KHR);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetBufferMemoryRequirements2KHR, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetBufferMemoryRequirements2KHR(device, pInfo, pMemoryRequirements);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetBufferMemoryRequirements2KHR, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordGetBufferMemoryRequirements2KHR(device, pInfo, pMemoryRequirements);
     }
     DispatchGetBufferMemoryRequirements2KHR(device, pInfo, pMemoryRequirements);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetBufferMemoryRequirements2KHR, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordGetBufferMemoryRequirements2KHR(device, pInfo, pMemoryRequirements);
     }
 }
@@ -6703,19 +7750,24 @@ VKAPI_ATTR void VKAPI_CALL GetImageSparseMemoryRequirements2KHR(
     uint32_t*                                   pSparseMemoryRequirementCount,
     VkSparseImageMemoryRequirements2*           pSparseMemoryRequirements) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointGetImageSparseMemoryRequirements2KHR);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetImageSparseMemoryRequirements2KHR, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetImageSparseMemoryRequirements2KHR(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetImageSparseMemoryRequirements2KHR, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordGetImageSparseMemoryRequirements2KHR(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
     }
     DispatchGetImageSparseMemoryRequirements2KHR(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetImageSparseMemoryRequirements2KHR, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordGetImageSparseMemoryRequirements2KHR(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
     }
 }
@@ -6728,19 +7780,24 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSamplerYcbcrConversionKHR(
     const VkAllocationCallbacks*                pAllocator,
     VkSamplerYcbcrConversion*                   pYcbcrConversion) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCreateSamplerYcbcrConversionKHR);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateSamplerYcbcrConversionKHR, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateSamplerYcbcrConversionKHR(device, pCreateInfo, pAllocator, pYcbcrConversion);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateSamplerYcbcrConversionKHR, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCreateSamplerYcbcrConversionKHR(device, pCreateInfo, pAllocator, pYcbcrConversion);
     }
     VkResult result = DispatchCreateSamplerYcbcrConversionKHR(device, pCreateInfo, pAllocator, pYcbcrConversion);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateSamplerYcbcrConversionKHR, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCreateSamplerYcbcrConversionKHR(device, pCreateInfo, pAllocator, pYcbcrConversion, result);
     }
     return result;
@@ -6751,19 +7808,24 @@ VKAPI_ATTR void VKAPI_CALL DestroySamplerYcbcrConversionKHR(
     VkSamplerYcbcrConversion                    ycbcrConversion,
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointDestroySamplerYcbcrConversionKHR);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroySamplerYcbcrConversionKHR, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroySamplerYcbcrConversionKHR(device, ycbcrConversion, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroySamplerYcbcrConversionKHR, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordDestroySamplerYcbcrConversionKHR(device, ycbcrConversion, pAllocator);
     }
     DispatchDestroySamplerYcbcrConversionKHR(device, ycbcrConversion, pAllocator);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroySamplerYcbcrConversionKHR, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordDestroySamplerYcbcrConversionKHR(device, ycbcrConversion, pAllocator);
     }
 }
@@ -6774,19 +7836,24 @@ VKAPI_ATTR VkResult VKAPI_CALL BindBufferMemory2KHR(
     uint32_t                                    bindInfoCount,
     const VkBindBufferMemoryInfo*               pBindInfos) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointBindBufferMemory2KHR);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointBindBufferMemory2KHR, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateBindBufferMemory2KHR(device, bindInfoCount, pBindInfos);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointBindBufferMemory2KHR, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordBindBufferMemory2KHR(device, bindInfoCount, pBindInfos);
     }
     VkResult result = DispatchBindBufferMemory2KHR(device, bindInfoCount, pBindInfos);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointBindBufferMemory2KHR, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordBindBufferMemory2KHR(device, bindInfoCount, pBindInfos, result);
     }
     return result;
@@ -6797,19 +7864,24 @@ VKAPI_ATTR VkResult VKAPI_CALL BindImageMemory2KHR(
     uint32_t                                    bindInfoCount,
     const VkBindImageMemoryInfo*                pBindInfos) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointBindImageMemory2KHR);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointBindImageMemory2KHR, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateBindImageMemory2KHR(device, bindInfoCount, pBindInfos);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointBindImageMemory2KHR, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordBindImageMemory2KHR(device, bindInfoCount, pBindInfos);
     }
     VkResult result = DispatchBindImageMemory2KHR(device, bindInfoCount, pBindInfos);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointBindImageMemory2KHR, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordBindImageMemory2KHR(device, bindInfoCount, pBindInfos, result);
     }
     return result;
@@ -6821,19 +7893,24 @@ VKAPI_ATTR void VKAPI_CALL GetDescriptorSetLayoutSupportKHR(
     const VkDescriptorSetLayoutCreateInfo*      pCreateInfo,
     VkDescriptorSetLayoutSupport*               pSupport) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointGetDescriptorSetLayoutSupportKHR);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetDescriptorSetLayoutSupportKHR, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDescriptorSetLayoutSupportKHR(device, pCreateInfo, pSupport);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetDescriptorSetLayoutSupportKHR, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordGetDescriptorSetLayoutSupportKHR(device, pCreateInfo, pSupport);
     }
     DispatchGetDescriptorSetLayoutSupportKHR(device, pCreateInfo, pSupport);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetDescriptorSetLayoutSupportKHR, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordGetDescriptorSetLayoutSupportKHR(device, pCreateInfo, pSupport);
     }
 }
@@ -6848,19 +7925,24 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirectCountKHR(
     uint32_t                                    maxDrawCount,
     uint32_t                                    stride) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdDrawIndirectCountKHR);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdDrawIndirectCountKHR, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdDrawIndirectCountKHR, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdDrawIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
     DispatchCmdDrawIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdDrawIndirectCountKHR, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdDrawIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
 }
@@ -6874,19 +7956,24 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexedIndirectCountKHR(
     uint32_t                                    maxDrawCount,
     uint32_t                                    stride) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdDrawIndexedIndirectCountKHR);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdDrawIndexedIndirectCountKHR, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawIndexedIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdDrawIndexedIndirectCountKHR, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdDrawIndexedIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
     DispatchCmdDrawIndexedIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdDrawIndexedIndirectCountKHR, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdDrawIndexedIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
 }
@@ -6905,19 +7992,24 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSemaphoreCounterValueKHR(
     VkSemaphore                                 semaphore,
     uint64_t*                                   pValue) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointGetSemaphoreCounterValueKHR);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetSemaphoreCounterValueKHR, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetSemaphoreCounterValueKHR(device, semaphore, pValue);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetSemaphoreCounterValueKHR, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordGetSemaphoreCounterValueKHR(device, semaphore, pValue);
     }
     VkResult result = DispatchGetSemaphoreCounterValueKHR(device, semaphore, pValue);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetSemaphoreCounterValueKHR, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordGetSemaphoreCounterValueKHR(device, semaphore, pValue, result);
     }
     return result;
@@ -6928,19 +8020,24 @@ VKAPI_ATTR VkResult VKAPI_CALL WaitSemaphoresKHR(
     const VkSemaphoreWaitInfo*                  pWaitInfo,
     uint64_t                                    timeout) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointWaitSemaphoresKHR);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointWaitSemaphoresKHR, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateWaitSemaphoresKHR(device, pWaitInfo, timeout);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointWaitSemaphoresKHR, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordWaitSemaphoresKHR(device, pWaitInfo, timeout);
     }
     VkResult result = DispatchWaitSemaphoresKHR(device, pWaitInfo, timeout);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointWaitSemaphoresKHR, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordWaitSemaphoresKHR(device, pWaitInfo, timeout, result);
     }
     return result;
@@ -6950,19 +8047,24 @@ VKAPI_ATTR VkResult VKAPI_CALL SignalSemaphoreKHR(
     VkDevice                                    device,
     const VkSemaphoreSignalInfo*                pSignalInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointSignalSemaphoreKHR);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointSignalSemaphoreKHR, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateSignalSemaphoreKHR(device, pSignalInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointSignalSemaphoreKHR, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordSignalSemaphoreKHR(device, pSignalInfo);
     }
     VkResult result = DispatchSignalSemaphoreKHR(device, pSignalInfo);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointSignalSemaphoreKHR, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordSignalSemaphoreKHR(device, pSignalInfo, result);
     }
     return result;
@@ -6978,19 +8080,24 @@ VKAPI_ATTR VkDeviceAddress VKAPI_CALL GetBufferDeviceAddressKHR(
     VkDevice                                    device,
     const VkBufferDeviceAddressInfo*            pInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointGetBufferDeviceAddressKHR);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetBufferDeviceAddressKHR, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetBufferDeviceAddressKHR(device, pInfo);
         if (skip) return 0;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetBufferDeviceAddressKHR, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordGetBufferDeviceAddressKHR(device, pInfo);
     }
     VkDeviceAddress result = DispatchGetBufferDeviceAddressKHR(device, pInfo);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetBufferDeviceAddressKHR, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordGetBufferDeviceAddressKHR(device, pInfo, result);
     }
     return result;
@@ -7000,19 +8107,24 @@ VKAPI_ATTR uint64_t VKAPI_CALL GetBufferOpaqueCaptureAddressKHR(
     VkDevice                                    device,
     const VkBufferDeviceAddressInfo*            pInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointGetBufferOpaqueCaptureAddressKHR);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetBufferOpaqueCaptureAddressKHR, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetBufferOpaqueCaptureAddressKHR(device, pInfo);
         if (skip) return 0;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetBufferOpaqueCaptureAddressKHR, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordGetBufferOpaqueCaptureAddressKHR(device, pInfo);
     }
     uint64_t result = DispatchGetBufferOpaqueCaptureAddressKHR(device, pInfo);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetBufferOpaqueCaptureAddressKHR, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordGetBufferOpaqueCaptureAddressKHR(device, pInfo);
     }
     return result;
@@ -7022,19 +8134,24 @@ VKAPI_ATTR uint64_t VKAPI_CALL GetDeviceMemoryOpaqueCaptureAddressKHR(
     VkDevice                                    device,
     const VkDeviceMemoryOpaqueCaptureAddressInfo* pInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointGetDeviceMemoryOpaqueCaptureAddressKHR);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetDeviceMemoryOpaqueCaptureAddressKHR, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceMemoryOpaqueCaptureAddressKHR(device, pInfo);
         if (skip) return 0;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetDeviceMemoryOpaqueCaptureAddressKHR, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordGetDeviceMemoryOpaqueCaptureAddressKHR(device, pInfo);
     }
     uint64_t result = DispatchGetDeviceMemoryOpaqueCaptureAddressKHR(device, pInfo);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetDeviceMemoryOpaqueCaptureAddressKHR, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordGetDeviceMemoryOpaqueCaptureAddressKHR(device, pInfo);
     }
     return result;
@@ -7047,19 +8164,24 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPipelineExecutablePropertiesKHR(
     uint32_t*                                   pExecutableCount,
     VkPipelineExecutablePropertiesKHR*          pProperties) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointGetPipelineExecutablePropertiesKHR);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetPipelineExecutablePropertiesKHR, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPipelineExecutablePropertiesKHR(device, pPipelineInfo, pExecutableCount, pProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetPipelineExecutablePropertiesKHR, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordGetPipelineExecutablePropertiesKHR(device, pPipelineInfo, pExecutableCount, pProperties);
     }
     VkResult result = DispatchGetPipelineExecutablePropertiesKHR(device, pPipelineInfo, pExecutableCount, pProperties);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetPipelineExecutablePropertiesKHR, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordGetPipelineExecutablePropertiesKHR(device, pPipelineInfo, pExecutableCount, pProperties, result);
     }
     return result;
@@ -7071,19 +8193,24 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPipelineExecutableStatisticsKHR(
     uint32_t*                                   pStatisticCount,
     VkPipelineExecutableStatisticKHR*           pStatistics) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointGetPipelineExecutableStatisticsKHR);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetPipelineExecutableStatisticsKHR, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPipelineExecutableStatisticsKHR(device, pExecutableInfo, pStatisticCount, pStatistics);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetPipelineExecutableStatisticsKHR, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordGetPipelineExecutableStatisticsKHR(device, pExecutableInfo, pStatisticCount, pStatistics);
     }
     VkResult result = DispatchGetPipelineExecutableStatisticsKHR(device, pExecutableInfo, pStatisticCount, pStatistics);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetPipelineExecutableStatisticsKHR, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordGetPipelineExecutableStatisticsKHR(device, pExecutableInfo, pStatisticCount, pStatistics, result);
     }
     return result;
@@ -7095,19 +8222,24 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPipelineExecutableInternalRepresentationsKHR(
     uint32_t*                                   pInternalRepresentationCount,
     VkPipelineExecutableInternalRepresentationKHR* pInternalRepresentations) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointGetPipelineExecutableInternalRepresentationsKHR);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetPipelineExecutableInternalRepresentationsKHR, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPipelineExecutableInternalRepresentationsKHR(device, pExecutableInfo, pInternalRepresentationCount, pInternalRepresentations);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetPipelineExecutableInternalRepresentationsKHR, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordGetPipelineExecutableInternalRepresentationsKHR(device, pExecutableInfo, pInternalRepresentationCount, pInternalRepresentations);
     }
     VkResult result = DispatchGetPipelineExecutableInternalRepresentationsKHR(device, pExecutableInfo, pInternalRepresentationCount, pInternalRepresentations);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetPipelineExecutableInternalRepresentationsKHR, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordGetPipelineExecutableInternalRepresentationsKHR(device, pExecutableInfo, pInternalRepresentationCount, pInternalRepresentations, result);
     }
     return result;
@@ -7201,19 +8333,24 @@ VKAPI_ATTR VkResult VKAPI_CALL DebugMarkerSetObjectTagEXT(
     VkDevice                                    device,
     const VkDebugMarkerObjectTagInfoEXT*        pTagInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointDebugMarkerSetObjectTagEXT);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDebugMarkerSetObjectTagEXT, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDebugMarkerSetObjectTagEXT(device, pTagInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDebugMarkerSetObjectTagEXT, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordDebugMarkerSetObjectTagEXT(device, pTagInfo);
     }
     VkResult result = DispatchDebugMarkerSetObjectTagEXT(device, pTagInfo);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDebugMarkerSetObjectTagEXT, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordDebugMarkerSetObjectTagEXT(device, pTagInfo, result);
     }
     return result;
@@ -7223,20 +8360,25 @@ VKAPI_ATTR VkResult VKAPI_CALL DebugMarkerSetObjectNameEXT(
     VkDevice                                    device,
     const VkDebugMarkerObjectNameInfoEXT*       pNameInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointDebugMarkerSetObjectNameEXT);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDebugMarkerSetObjectNameEXT, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDebugMarkerSetObjectNameEXT(device, pNameInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDebugMarkerSetObjectNameEXT, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordDebugMarkerSetObjectNameEXT(device, pNameInfo);
     }
     layer_data->report_data->DebugReportSetMarkerObjectName(pNameInfo);
     VkResult result = DispatchDebugMarkerSetObjectNameEXT(device, pNameInfo);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDebugMarkerSetObjectNameEXT, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordDebugMarkerSetObjectNameEXT(device, pNameInfo, result);
     }
     return result;
@@ -7246,19 +8388,24 @@ VKAPI_ATTR void VKAPI_CALL CmdDebugMarkerBeginEXT(
     VkCommandBuffer                             commandBuffer,
     const VkDebugMarkerMarkerInfoEXT*           pMarkerInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdDebugMarkerBeginEXT);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdDebugMarkerBeginEXT, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDebugMarkerBeginEXT(commandBuffer, pMarkerInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdDebugMarkerBeginEXT, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdDebugMarkerBeginEXT(commandBuffer, pMarkerInfo);
     }
     DispatchCmdDebugMarkerBeginEXT(commandBuffer, pMarkerInfo);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdDebugMarkerBeginEXT, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdDebugMarkerBeginEXT(commandBuffer, pMarkerInfo);
     }
 }
@@ -7266,19 +8413,24 @@ VKAPI_ATTR void VKAPI_CALL CmdDebugMarkerBeginEXT(
 VKAPI_ATTR void VKAPI_CALL CmdDebugMarkerEndEXT(
     VkCommandBuffer                             commandBuffer) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdDebugMarkerEndEXT);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdDebugMarkerEndEXT, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDebugMarkerEndEXT(commandBuffer);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdDebugMarkerEndEXT, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdDebugMarkerEndEXT(commandBuffer);
     }
     DispatchCmdDebugMarkerEndEXT(commandBuffer);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdDebugMarkerEndEXT, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdDebugMarkerEndEXT(commandBuffer);
     }
 }
@@ -7287,19 +8439,24 @@ VKAPI_ATTR void VKAPI_CALL CmdDebugMarkerInsertEXT(
     VkCommandBuffer                             commandBuffer,
     const VkDebugMarkerMarkerInfoEXT*           pMarkerInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdDebugMarkerInsertEXT);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdDebugMarkerInsertEXT, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDebugMarkerInsertEXT(commandBuffer, pMarkerInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdDebugMarkerInsertEXT, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdDebugMarkerInsertEXT(commandBuffer, pMarkerInfo);
     }
     DispatchCmdDebugMarkerInsertEXT(commandBuffer, pMarkerInfo);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdDebugMarkerInsertEXT, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdDebugMarkerInsertEXT(commandBuffer, pMarkerInfo);
     }
 }
@@ -7315,19 +8472,24 @@ VKAPI_ATTR void VKAPI_CALL CmdBindTransformFeedbackBuffersEXT(
     const VkDeviceSize*                         pOffsets,
     const VkDeviceSize*                         pSizes) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdBindTransformFeedbackBuffersEXT);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdBindTransformFeedbackBuffersEXT, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBindTransformFeedbackBuffersEXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdBindTransformFeedbackBuffersEXT, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdBindTransformFeedbackBuffersEXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes);
     }
     DispatchCmdBindTransformFeedbackBuffersEXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdBindTransformFeedbackBuffersEXT, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdBindTransformFeedbackBuffersEXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes);
     }
 }
@@ -7339,19 +8501,24 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginTransformFeedbackEXT(
     const VkBuffer*                             pCounterBuffers,
     const VkDeviceSize*                         pCounterBufferOffsets) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdBeginTransformFeedbackEXT);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdBeginTransformFeedbackEXT, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBeginTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdBeginTransformFeedbackEXT, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdBeginTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
     }
     DispatchCmdBeginTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdBeginTransformFeedbackEXT, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdBeginTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
     }
 }
@@ -7363,19 +8530,24 @@ VKAPI_ATTR void VKAPI_CALL CmdEndTransformFeedbackEXT(
     const VkBuffer*                             pCounterBuffers,
     const VkDeviceSize*                         pCounterBufferOffsets) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdEndTransformFeedbackEXT);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdEndTransformFeedbackEXT, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdEndTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdEndTransformFeedbackEXT, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdEndTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
     }
     DispatchCmdEndTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdEndTransformFeedbackEXT, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdEndTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
     }
 }
@@ -7387,19 +8559,24 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginQueryIndexedEXT(
     VkQueryControlFlags                         flags,
     uint32_t                                    index) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdBeginQueryIndexedEXT);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdBeginQueryIndexedEXT, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBeginQueryIndexedEXT(commandBuffer, queryPool, query, flags, index);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdBeginQueryIndexedEXT, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdBeginQueryIndexedEXT(commandBuffer, queryPool, query, flags, index);
     }
     DispatchCmdBeginQueryIndexedEXT(commandBuffer, queryPool, query, flags, index);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdBeginQueryIndexedEXT, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdBeginQueryIndexedEXT(commandBuffer, queryPool, query, flags, index);
     }
 }
@@ -7410,19 +8587,24 @@ VKAPI_ATTR void VKAPI_CALL CmdEndQueryIndexedEXT(
     uint32_t                                    query,
     uint32_t                                    index) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdEndQueryIndexedEXT);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdEndQueryIndexedEXT, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdEndQueryIndexedEXT(commandBuffer, queryPool, query, index);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdEndQueryIndexedEXT, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdEndQueryIndexedEXT(commandBuffer, queryPool, query, index);
     }
     DispatchCmdEndQueryIndexedEXT(commandBuffer, queryPool, query, index);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdEndQueryIndexedEXT, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdEndQueryIndexedEXT(commandBuffer, queryPool, query, index);
     }
 }
@@ -7436,19 +8618,24 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirectByteCountEXT(
     uint32_t                                    counterOffset,
     uint32_t                                    vertexStride) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdDrawIndirectByteCountEXT);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdDrawIndirectByteCountEXT, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawIndirectByteCountEXT(commandBuffer, instanceCount, firstInstance, counterBuffer, counterBufferOffset, counterOffset, vertexStride);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdDrawIndirectByteCountEXT, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdDrawIndirectByteCountEXT(commandBuffer, instanceCount, firstInstance, counterBuffer, counterBufferOffset, counterOffset, vertexStride);
     }
     DispatchCmdDrawIndirectByteCountEXT(commandBuffer, instanceCount, firstInstance, counterBuffer, counterBufferOffset, counterOffset, vertexStride);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdDrawIndirectByteCountEXT, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdDrawIndirectByteCountEXT(commandBuffer, instanceCount, firstInstance, counterBuffer, counterBufferOffset, counterOffset, vertexStride);
     }
 }
@@ -7458,19 +8645,24 @@ VKAPI_ATTR uint32_t VKAPI_CALL GetImageViewHandleNVX(
     VkDevice                                    device,
     const VkImageViewHandleInfoNVX*             pInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointGetImageViewHandleNVX);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetImageViewHandleNVX, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetImageViewHandleNVX(device, pInfo);
         if (skip) return 0;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetImageViewHandleNVX, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordGetImageViewHandleNVX(device, pInfo);
     }
     uint32_t result = DispatchGetImageViewHandleNVX(device, pInfo);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetImageViewHandleNVX, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordGetImageViewHandleNVX(device, pInfo);
     }
     return result;
@@ -7486,19 +8678,24 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirectCountAMD(
     uint32_t                                    maxDrawCount,
     uint32_t                                    stride) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdDrawIndirectCountAMD);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdDrawIndirectCountAMD, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdDrawIndirectCountAMD, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdDrawIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
     DispatchCmdDrawIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdDrawIndirectCountAMD, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdDrawIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
 }
@@ -7512,19 +8709,24 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexedIndirectCountAMD(
     uint32_t                                    maxDrawCount,
     uint32_t                                    stride) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdDrawIndexedIndirectCountAMD);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdDrawIndexedIndirectCountAMD, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawIndexedIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdDrawIndexedIndirectCountAMD, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdDrawIndexedIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
     DispatchCmdDrawIndexedIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdDrawIndexedIndirectCountAMD, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdDrawIndexedIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
 }
@@ -7542,19 +8744,24 @@ VKAPI_ATTR VkResult VKAPI_CALL GetShaderInfoAMD(
     size_t*                                     pInfoSize,
     void*                                       pInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointGetShaderInfoAMD);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetShaderInfoAMD, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetShaderInfoAMD(device, pipeline, shaderStage, infoType, pInfoSize, pInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetShaderInfoAMD, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordGetShaderInfoAMD(device, pipeline, shaderStage, infoType, pInfoSize, pInfo);
     }
     VkResult result = DispatchGetShaderInfoAMD(device, pipeline, shaderStage, infoType, pInfoSize, pInfo);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetShaderInfoAMD, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordGetShaderInfoAMD(device, pipeline, shaderStage, infoType, pInfoSize, pInfo, result);
     }
     return result;
@@ -7628,19 +8835,24 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryWin32HandleNV(
     VkExternalMemoryHandleTypeFlagsNV           handleType,
     HANDLE*                                     pHandle) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointGetMemoryWin32HandleNV);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetMemoryWin32HandleNV, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetMemoryWin32HandleNV(device, memory, handleType, pHandle);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetMemoryWin32HandleNV, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordGetMemoryWin32HandleNV(device, memory, handleType, pHandle);
     }
     VkResult result = DispatchGetMemoryWin32HandleNV(device, memory, handleType, pHandle);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetMemoryWin32HandleNV, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordGetMemoryWin32HandleNV(device, memory, handleType, pHandle, result);
     }
     return result;
@@ -7687,19 +8899,24 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginConditionalRenderingEXT(
     VkCommandBuffer                             commandBuffer,
     const VkConditionalRenderingBeginInfoEXT*   pConditionalRenderingBegin) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdBeginConditionalRenderingEXT);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdBeginConditionalRenderingEXT, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBeginConditionalRenderingEXT(commandBuffer, pConditionalRenderingBegin);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdBeginConditionalRenderingEXT, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdBeginConditionalRenderingEXT(commandBuffer, pConditionalRenderingBegin);
     }
     DispatchCmdBeginConditionalRenderingEXT(commandBuffer, pConditionalRenderingBegin);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdBeginConditionalRenderingEXT, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdBeginConditionalRenderingEXT(commandBuffer, pConditionalRenderingBegin);
     }
 }
@@ -7707,19 +8924,24 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginConditionalRenderingEXT(
 VKAPI_ATTR void VKAPI_CALL CmdEndConditionalRenderingEXT(
     VkCommandBuffer                             commandBuffer) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdEndConditionalRenderingEXT);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdEndConditionalRenderingEXT, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdEndConditionalRenderingEXT(commandBuffer);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdEndConditionalRenderingEXT, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdEndConditionalRenderingEXT(commandBuffer);
     }
     DispatchCmdEndConditionalRenderingEXT(commandBuffer);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdEndConditionalRenderingEXT, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdEndConditionalRenderingEXT(commandBuffer);
     }
 }
@@ -7729,19 +8951,24 @@ VKAPI_ATTR void VKAPI_CALL CmdProcessCommandsNVX(
     VkCommandBuffer                             commandBuffer,
     const VkCmdProcessCommandsInfoNVX*          pProcessCommandsInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdProcessCommandsNVX);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdProcessCommandsNVX, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdProcessCommandsNVX(commandBuffer, pProcessCommandsInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdProcessCommandsNVX, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdProcessCommandsNVX(commandBuffer, pProcessCommandsInfo);
     }
     DispatchCmdProcessCommandsNVX(commandBuffer, pProcessCommandsInfo);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdProcessCommandsNVX, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdProcessCommandsNVX(commandBuffer, pProcessCommandsInfo);
     }
 }
@@ -7750,19 +8977,24 @@ VKAPI_ATTR void VKAPI_CALL CmdReserveSpaceForCommandsNVX(
     VkCommandBuffer                             commandBuffer,
     const VkCmdReserveSpaceForCommandsInfoNVX*  pReserveSpaceInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdReserveSpaceForCommandsNVX);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdReserveSpaceForCommandsNVX, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdReserveSpaceForCommandsNVX(commandBuffer, pReserveSpaceInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdReserveSpaceForCommandsNVX, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdReserveSpaceForCommandsNVX(commandBuffer, pReserveSpaceInfo);
     }
     DispatchCmdReserveSpaceForCommandsNVX(commandBuffer, pReserveSpaceInfo);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdReserveSpaceForCommandsNVX, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdReserveSpaceForCommandsNVX(commandBuffer, pReserveSpaceInfo);
     }
 }
@@ -7773,19 +9005,24 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateIndirectCommandsLayoutNVX(
     const VkAllocationCallbacks*                pAllocator,
     VkIndirectCommandsLayoutNVX*                pIndirectCommandsLayout) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCreateIndirectCommandsLayoutNVX);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateIndirectCommandsLayoutNVX, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateIndirectCommandsLayoutNVX(device, pCreateInfo, pAllocator, pIndirectCommandsLayout);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateIndirectCommandsLayoutNVX, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCreateIndirectCommandsLayoutNVX(device, pCreateInfo, pAllocator, pIndirectCommandsLayout);
     }
     VkResult result = DispatchCreateIndirectCommandsLayoutNVX(device, pCreateInfo, pAllocator, pIndirectCommandsLayout);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateIndirectCommandsLayoutNVX, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCreateIndirectCommandsLayoutNVX(device, pCreateInfo, pAllocator, pIndirectCommandsLayout, result);
     }
     return result;
@@ -7796,19 +9033,24 @@ VKAPI_ATTR void VKAPI_CALL DestroyIndirectCommandsLayoutNVX(
     VkIndirectCommandsLayoutNVX                 indirectCommandsLayout,
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointDestroyIndirectCommandsLayoutNVX);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroyIndirectCommandsLayoutNVX, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyIndirectCommandsLayoutNVX(device, indirectCommandsLayout, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroyIndirectCommandsLayoutNVX, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordDestroyIndirectCommandsLayoutNVX(device, indirectCommandsLayout, pAllocator);
     }
     DispatchDestroyIndirectCommandsLayoutNVX(device, indirectCommandsLayout, pAllocator);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroyIndirectCommandsLayoutNVX, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordDestroyIndirectCommandsLayoutNVX(device, indirectCommandsLayout, pAllocator);
     }
 }
@@ -7819,19 +9061,24 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateObjectTableNVX(
     const VkAllocationCallbacks*                pAllocator,
     VkObjectTableNVX*                           pObjectTable) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCreateObjectTableNVX);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateObjectTableNVX, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateObjectTableNVX(device, pCreateInfo, pAllocator, pObjectTable);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateObjectTableNVX, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCreateObjectTableNVX(device, pCreateInfo, pAllocator, pObjectTable);
     }
     VkResult result = DispatchCreateObjectTableNVX(device, pCreateInfo, pAllocator, pObjectTable);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateObjectTableNVX, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCreateObjectTableNVX(device, pCreateInfo, pAllocator, pObjectTable, result);
     }
     return result;
@@ -7842,19 +9089,24 @@ VKAPI_ATTR void VKAPI_CALL DestroyObjectTableNVX(
     VkObjectTableNVX                            objectTable,
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointDestroyObjectTableNVX);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroyObjectTableNVX, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyObjectTableNVX(device, objectTable, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroyObjectTableNVX, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordDestroyObjectTableNVX(device, objectTable, pAllocator);
     }
     DispatchDestroyObjectTableNVX(device, objectTable, pAllocator);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroyObjectTableNVX, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordDestroyObjectTableNVX(device, objectTable, pAllocator);
     }
 }
@@ -7866,19 +9118,24 @@ VKAPI_ATTR VkResult VKAPI_CALL RegisterObjectsNVX(
     const VkObjectTableEntryNVX* const*         ppObjectTableEntries,
     const uint32_t*                             pObjectIndices) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointRegisterObjectsNVX);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointRegisterObjectsNVX, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateRegisterObjectsNVX(device, objectTable, objectCount, ppObjectTableEntries, pObjectIndices);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointRegisterObjectsNVX, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordRegisterObjectsNVX(device, objectTable, objectCount, ppObjectTableEntries, pObjectIndices);
     }
     VkResult result = DispatchRegisterObjectsNVX(device, objectTable, objectCount, ppObjectTableEntries, pObjectIndices);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointRegisterObjectsNVX, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordRegisterObjectsNVX(device, objectTable, objectCount, ppObjectTableEntries, pObjectIndices, result);
     }
     return result;
@@ -7891,19 +9148,24 @@ VKAPI_ATTR VkResult VKAPI_CALL UnregisterObjectsNVX(
     const VkObjectEntryTypeNVX*                 pObjectEntryTypes,
     const uint32_t*                             pObjectIndices) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointUnregisterObjectsNVX);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointUnregisterObjectsNVX, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateUnregisterObjectsNVX(device, objectTable, objectCount, pObjectEntryTypes, pObjectIndices);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointUnregisterObjectsNVX, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordUnregisterObjectsNVX(device, objectTable, objectCount, pObjectEntryTypes, pObjectIndices);
     }
     VkResult result = DispatchUnregisterObjectsNVX(device, objectTable, objectCount, pObjectEntryTypes, pObjectIndices);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointUnregisterObjectsNVX, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordUnregisterObjectsNVX(device, objectTable, objectCount, pObjectEntryTypes, pObjectIndices, result);
     }
     return result;
@@ -7938,19 +9200,24 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewportWScalingNV(
     uint32_t                                    viewportCount,
     const VkViewportWScalingNV*                 pViewportWScalings) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdSetViewportWScalingNV);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdSetViewportWScalingNV, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetViewportWScalingNV(commandBuffer, firstViewport, viewportCount, pViewportWScalings);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdSetViewportWScalingNV, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdSetViewportWScalingNV(commandBuffer, firstViewport, viewportCount, pViewportWScalings);
     }
     DispatchCmdSetViewportWScalingNV(commandBuffer, firstViewport, viewportCount, pViewportWScalings);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdSetViewportWScalingNV, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdSetViewportWScalingNV(commandBuffer, firstViewport, viewportCount, pViewportWScalings);
     }
 }
@@ -8058,19 +9325,24 @@ VKAPI_ATTR VkResult VKAPI_CALL DisplayPowerControlEXT(
     VkDisplayKHR                                display,
     const VkDisplayPowerInfoEXT*                pDisplayPowerInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointDisplayPowerControlEXT);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDisplayPowerControlEXT, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDisplayPowerControlEXT(device, display, pDisplayPowerInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDisplayPowerControlEXT, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordDisplayPowerControlEXT(device, display, pDisplayPowerInfo);
     }
     VkResult result = DispatchDisplayPowerControlEXT(device, display, pDisplayPowerInfo);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDisplayPowerControlEXT, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordDisplayPowerControlEXT(device, display, pDisplayPowerInfo, result);
     }
     return result;
@@ -8082,19 +9354,24 @@ VKAPI_ATTR VkResult VKAPI_CALL RegisterDeviceEventEXT(
     const VkAllocationCallbacks*                pAllocator,
     VkFence*                                    pFence) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointRegisterDeviceEventEXT);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointRegisterDeviceEventEXT, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateRegisterDeviceEventEXT(device, pDeviceEventInfo, pAllocator, pFence);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointRegisterDeviceEventEXT, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordRegisterDeviceEventEXT(device, pDeviceEventInfo, pAllocator, pFence);
     }
     VkResult result = DispatchRegisterDeviceEventEXT(device, pDeviceEventInfo, pAllocator, pFence);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointRegisterDeviceEventEXT, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordRegisterDeviceEventEXT(device, pDeviceEventInfo, pAllocator, pFence, result);
     }
     return result;
@@ -8107,19 +9384,24 @@ VKAPI_ATTR VkResult VKAPI_CALL RegisterDisplayEventEXT(
     const VkAllocationCallbacks*                pAllocator,
     VkFence*                                    pFence) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointRegisterDisplayEventEXT);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointRegisterDisplayEventEXT, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateRegisterDisplayEventEXT(device, display, pDisplayEventInfo, pAllocator, pFence);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointRegisterDisplayEventEXT, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordRegisterDisplayEventEXT(device, display, pDisplayEventInfo, pAllocator, pFence);
     }
     VkResult result = DispatchRegisterDisplayEventEXT(device, display, pDisplayEventInfo, pAllocator, pFence);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointRegisterDisplayEventEXT, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordRegisterDisplayEventEXT(device, display, pDisplayEventInfo, pAllocator, pFence, result);
     }
     return result;
@@ -8131,19 +9413,24 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSwapchainCounterEXT(
     VkSurfaceCounterFlagBitsEXT                 counter,
     uint64_t*                                   pCounterValue) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointGetSwapchainCounterEXT);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetSwapchainCounterEXT, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetSwapchainCounterEXT(device, swapchain, counter, pCounterValue);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetSwapchainCounterEXT, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordGetSwapchainCounterEXT(device, swapchain, counter, pCounterValue);
     }
     VkResult result = DispatchGetSwapchainCounterEXT(device, swapchain, counter, pCounterValue);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetSwapchainCounterEXT, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordGetSwapchainCounterEXT(device, swapchain, counter, pCounterValue, result);
     }
     return result;
@@ -8155,19 +9442,24 @@ VKAPI_ATTR VkResult VKAPI_CALL GetRefreshCycleDurationGOOGLE(
     VkSwapchainKHR                              swapchain,
     VkRefreshCycleDurationGOOGLE*               pDisplayTimingProperties) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointGetRefreshCycleDurationGOOGLE);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetRefreshCycleDurationGOOGLE, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetRefreshCycleDurationGOOGLE(device, swapchain, pDisplayTimingProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetRefreshCycleDurationGOOGLE, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordGetRefreshCycleDurationGOOGLE(device, swapchain, pDisplayTimingProperties);
     }
     VkResult result = DispatchGetRefreshCycleDurationGOOGLE(device, swapchain, pDisplayTimingProperties);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetRefreshCycleDurationGOOGLE, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordGetRefreshCycleDurationGOOGLE(device, swapchain, pDisplayTimingProperties, result);
     }
     return result;
@@ -8179,19 +9471,24 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPastPresentationTimingGOOGLE(
     uint32_t*                                   pPresentationTimingCount,
     VkPastPresentationTimingGOOGLE*             pPresentationTimings) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointGetPastPresentationTimingGOOGLE);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetPastPresentationTimingGOOGLE, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPastPresentationTimingGOOGLE(device, swapchain, pPresentationTimingCount, pPresentationTimings);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetPastPresentationTimingGOOGLE, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordGetPastPresentationTimingGOOGLE(device, swapchain, pPresentationTimingCount, pPresentationTimings);
     }
     VkResult result = DispatchGetPastPresentationTimingGOOGLE(device, swapchain, pPresentationTimingCount, pPresentationTimings);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetPastPresentationTimingGOOGLE, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordGetPastPresentationTimingGOOGLE(device, swapchain, pPresentationTimingCount, pPresentationTimings, result);
     }
     return result;
@@ -8209,19 +9506,24 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDiscardRectangleEXT(
     uint32_t                                    discardRectangleCount,
     const VkRect2D*                             pDiscardRectangles) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdSetDiscardRectangleEXT);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdSetDiscardRectangleEXT, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetDiscardRectangleEXT(commandBuffer, firstDiscardRectangle, discardRectangleCount, pDiscardRectangles);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdSetDiscardRectangleEXT, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdSetDiscardRectangleEXT(commandBuffer, firstDiscardRectangle, discardRectangleCount, pDiscardRectangles);
     }
     DispatchCmdSetDiscardRectangleEXT(commandBuffer, firstDiscardRectangle, discardRectangleCount, pDiscardRectangles);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdSetDiscardRectangleEXT, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdSetDiscardRectangleEXT(commandBuffer, firstDiscardRectangle, discardRectangleCount, pDiscardRectangles);
     }
 }
@@ -8236,19 +9538,24 @@ VKAPI_ATTR void VKAPI_CALL SetHdrMetadataEXT(
     const VkSwapchainKHR*                       pSwapchains,
     const VkHdrMetadataEXT*                     pMetadata) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointSetHdrMetadataEXT);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointSetHdrMetadataEXT, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateSetHdrMetadataEXT(device, swapchainCount, pSwapchains, pMetadata);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointSetHdrMetadataEXT, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordSetHdrMetadataEXT(device, swapchainCount, pSwapchains, pMetadata);
     }
     DispatchSetHdrMetadataEXT(device, swapchainCount, pSwapchains, pMetadata);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointSetHdrMetadataEXT, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordSetHdrMetadataEXT(device, swapchainCount, pSwapchains, pMetadata);
     }
 }
@@ -8314,20 +9621,25 @@ VKAPI_ATTR VkResult VKAPI_CALL SetDebugUtilsObjectNameEXT(
     VkDevice                                    device,
     const VkDebugUtilsObjectNameInfoEXT*        pNameInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointSetDebugUtilsObjectNameEXT);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointSetDebugUtilsObjectNameEXT, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateSetDebugUtilsObjectNameEXT(device, pNameInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointSetDebugUtilsObjectNameEXT, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordSetDebugUtilsObjectNameEXT(device, pNameInfo);
     }
     layer_data->report_data->DebugReportSetUtilsObjectName(pNameInfo);
     VkResult result = DispatchSetDebugUtilsObjectNameEXT(device, pNameInfo);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointSetDebugUtilsObjectNameEXT, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordSetDebugUtilsObjectNameEXT(device, pNameInfo, result);
     }
     return result;
@@ -8337,19 +9649,24 @@ VKAPI_ATTR VkResult VKAPI_CALL SetDebugUtilsObjectTagEXT(
     VkDevice                                    device,
     const VkDebugUtilsObjectTagInfoEXT*         pTagInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointSetDebugUtilsObjectTagEXT);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointSetDebugUtilsObjectTagEXT, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateSetDebugUtilsObjectTagEXT(device, pTagInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointSetDebugUtilsObjectTagEXT, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordSetDebugUtilsObjectTagEXT(device, pTagInfo);
     }
     VkResult result = DispatchSetDebugUtilsObjectTagEXT(device, pTagInfo);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointSetDebugUtilsObjectTagEXT, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordSetDebugUtilsObjectTagEXT(device, pTagInfo, result);
     }
     return result;
@@ -8359,20 +9676,25 @@ VKAPI_ATTR void VKAPI_CALL QueueBeginDebugUtilsLabelEXT(
     VkQueue                                     queue,
     const VkDebugUtilsLabelEXT*                 pLabelInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointQueueBeginDebugUtilsLabelEXT);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointQueueBeginDebugUtilsLabelEXT, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateQueueBeginDebugUtilsLabelEXT(queue, pLabelInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointQueueBeginDebugUtilsLabelEXT, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordQueueBeginDebugUtilsLabelEXT(queue, pLabelInfo);
     }
     BeginQueueDebugUtilsLabel(layer_data->report_data, queue, pLabelInfo);
     DispatchQueueBeginDebugUtilsLabelEXT(queue, pLabelInfo);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointQueueBeginDebugUtilsLabelEXT, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordQueueBeginDebugUtilsLabelEXT(queue, pLabelInfo);
     }
 }
@@ -8380,20 +9702,25 @@ VKAPI_ATTR void VKAPI_CALL QueueBeginDebugUtilsLabelEXT(
 VKAPI_ATTR void VKAPI_CALL QueueEndDebugUtilsLabelEXT(
     VkQueue                                     queue) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointQueueEndDebugUtilsLabelEXT);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointQueueEndDebugUtilsLabelEXT, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateQueueEndDebugUtilsLabelEXT(queue);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointQueueEndDebugUtilsLabelEXT, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordQueueEndDebugUtilsLabelEXT(queue);
     }
     DispatchQueueEndDebugUtilsLabelEXT(queue);
     EndQueueDebugUtilsLabel(layer_data->report_data, queue);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointQueueEndDebugUtilsLabelEXT, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordQueueEndDebugUtilsLabelEXT(queue);
     }
 }
@@ -8402,20 +9729,25 @@ VKAPI_ATTR void VKAPI_CALL QueueInsertDebugUtilsLabelEXT(
     VkQueue                                     queue,
     const VkDebugUtilsLabelEXT*                 pLabelInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointQueueInsertDebugUtilsLabelEXT);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointQueueInsertDebugUtilsLabelEXT, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateQueueInsertDebugUtilsLabelEXT(queue, pLabelInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointQueueInsertDebugUtilsLabelEXT, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordQueueInsertDebugUtilsLabelEXT(queue, pLabelInfo);
     }
     InsertQueueDebugUtilsLabel(layer_data->report_data, queue, pLabelInfo);
     DispatchQueueInsertDebugUtilsLabelEXT(queue, pLabelInfo);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointQueueInsertDebugUtilsLabelEXT, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordQueueInsertDebugUtilsLabelEXT(queue, pLabelInfo);
     }
 }
@@ -8424,19 +9756,24 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginDebugUtilsLabelEXT(
     VkCommandBuffer                             commandBuffer,
     const VkDebugUtilsLabelEXT*                 pLabelInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdBeginDebugUtilsLabelEXT);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdBeginDebugUtilsLabelEXT, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBeginDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdBeginDebugUtilsLabelEXT, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdBeginDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
     }
     DispatchCmdBeginDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdBeginDebugUtilsLabelEXT, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdBeginDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
     }
 }
@@ -8444,19 +9781,24 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginDebugUtilsLabelEXT(
 VKAPI_ATTR void VKAPI_CALL CmdEndDebugUtilsLabelEXT(
     VkCommandBuffer                             commandBuffer) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdEndDebugUtilsLabelEXT);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdEndDebugUtilsLabelEXT, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdEndDebugUtilsLabelEXT(commandBuffer);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdEndDebugUtilsLabelEXT, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdEndDebugUtilsLabelEXT(commandBuffer);
     }
     DispatchCmdEndDebugUtilsLabelEXT(commandBuffer);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdEndDebugUtilsLabelEXT, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdEndDebugUtilsLabelEXT(commandBuffer);
     }
 }
@@ -8465,19 +9807,24 @@ VKAPI_ATTR void VKAPI_CALL CmdInsertDebugUtilsLabelEXT(
     VkCommandBuffer                             commandBuffer,
     const VkDebugUtilsLabelEXT*                 pLabelInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdInsertDebugUtilsLabelEXT);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdInsertDebugUtilsLabelEXT, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdInsertDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdInsertDebugUtilsLabelEXT, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdInsertDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
     }
     DispatchCmdInsertDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdInsertDebugUtilsLabelEXT, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdInsertDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
     }
 }
@@ -8560,19 +9907,24 @@ VKAPI_ATTR VkResult VKAPI_CALL GetAndroidHardwareBufferPropertiesANDROID(
     const struct AHardwareBuffer*               buffer,
     VkAndroidHardwareBufferPropertiesANDROID*   pProperties) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointGetAndroidHardwareBufferPropertiesANDROID);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetAndroidHardwareBufferPropertiesANDROID, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetAndroidHardwareBufferPropertiesANDROID(device, buffer, pProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetAndroidHardwareBufferPropertiesANDROID, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordGetAndroidHardwareBufferPropertiesANDROID(device, buffer, pProperties);
     }
     VkResult result = DispatchGetAndroidHardwareBufferPropertiesANDROID(device, buffer, pProperties);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetAndroidHardwareBufferPropertiesANDROID, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordGetAndroidHardwareBufferPropertiesANDROID(device, buffer, pProperties, result);
     }
     return result;
@@ -8583,19 +9935,24 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryAndroidHardwareBufferANDROID(
     const VkMemoryGetAndroidHardwareBufferInfoANDROID* pInfo,
     struct AHardwareBuffer**                    pBuffer) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointGetMemoryAndroidHardwareBufferANDROID);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetMemoryAndroidHardwareBufferANDROID, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetMemoryAndroidHardwareBufferANDROID(device, pInfo, pBuffer);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetMemoryAndroidHardwareBufferANDROID, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordGetMemoryAndroidHardwareBufferANDROID(device, pInfo, pBuffer);
     }
     VkResult result = DispatchGetMemoryAndroidHardwareBufferANDROID(device, pInfo, pBuffer);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetMemoryAndroidHardwareBufferANDROID, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordGetMemoryAndroidHardwareBufferANDROID(device, pInfo, pBuffer, result);
     }
     return result;
@@ -8613,19 +9970,24 @@ VKAPI_ATTR void VKAPI_CALL CmdSetSampleLocationsEXT(
     VkCommandBuffer                             commandBuffer,
     const VkSampleLocationsInfoEXT*             pSampleLocationsInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdSetSampleLocationsEXT);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdSetSampleLocationsEXT, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetSampleLocationsEXT(commandBuffer, pSampleLocationsInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdSetSampleLocationsEXT, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdSetSampleLocationsEXT(commandBuffer, pSampleLocationsInfo);
     }
     DispatchCmdSetSampleLocationsEXT(commandBuffer, pSampleLocationsInfo);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdSetSampleLocationsEXT, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdSetSampleLocationsEXT(commandBuffer, pSampleLocationsInfo);
     }
 }
@@ -8664,19 +10026,24 @@ VKAPI_ATTR VkResult VKAPI_CALL GetImageDrmFormatModifierPropertiesEXT(
     VkImage                                     image,
     VkImageDrmFormatModifierPropertiesEXT*      pProperties) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointGetImageDrmFormatModifierPropertiesEXT);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetImageDrmFormatModifierPropertiesEXT, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetImageDrmFormatModifierPropertiesEXT(device, image, pProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetImageDrmFormatModifierPropertiesEXT, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordGetImageDrmFormatModifierPropertiesEXT(device, image, pProperties);
     }
     VkResult result = DispatchGetImageDrmFormatModifierPropertiesEXT(device, image, pProperties);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetImageDrmFormatModifierPropertiesEXT, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordGetImageDrmFormatModifierPropertiesEXT(device, image, pProperties, result);
     }
     return result;
@@ -8691,19 +10058,24 @@ VKAPI_ATTR void VKAPI_CALL CmdBindShadingRateImageNV(
     VkImageView                                 imageView,
     VkImageLayout                               imageLayout) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdBindShadingRateImageNV);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdBindShadingRateImageNV, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBindShadingRateImageNV(commandBuffer, imageView, imageLayout);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdBindShadingRateImageNV, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdBindShadingRateImageNV(commandBuffer, imageView, imageLayout);
     }
     DispatchCmdBindShadingRateImageNV(commandBuffer, imageView, imageLayout);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdBindShadingRateImageNV, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdBindShadingRateImageNV(commandBuffer, imageView, imageLayout);
     }
 }
@@ -8714,19 +10086,24 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewportShadingRatePaletteNV(
     uint32_t                                    viewportCount,
     const VkShadingRatePaletteNV*               pShadingRatePalettes) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdSetViewportShadingRatePaletteNV);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdSetViewportShadingRatePaletteNV, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetViewportShadingRatePaletteNV(commandBuffer, firstViewport, viewportCount, pShadingRatePalettes);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdSetViewportShadingRatePaletteNV, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdSetViewportShadingRatePaletteNV(commandBuffer, firstViewport, viewportCount, pShadingRatePalettes);
     }
     DispatchCmdSetViewportShadingRatePaletteNV(commandBuffer, firstViewport, viewportCount, pShadingRatePalettes);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdSetViewportShadingRatePaletteNV, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdSetViewportShadingRatePaletteNV(commandBuffer, firstViewport, viewportCount, pShadingRatePalettes);
     }
 }
@@ -8737,19 +10114,24 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCoarseSampleOrderNV(
     uint32_t                                    customSampleOrderCount,
     const VkCoarseSampleOrderCustomNV*          pCustomSampleOrders) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdSetCoarseSampleOrderNV);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdSetCoarseSampleOrderNV, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetCoarseSampleOrderNV(commandBuffer, sampleOrderType, customSampleOrderCount, pCustomSampleOrders);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdSetCoarseSampleOrderNV, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdSetCoarseSampleOrderNV(commandBuffer, sampleOrderType, customSampleOrderCount, pCustomSampleOrders);
     }
     DispatchCmdSetCoarseSampleOrderNV(commandBuffer, sampleOrderType, customSampleOrderCount, pCustomSampleOrders);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdSetCoarseSampleOrderNV, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdSetCoarseSampleOrderNV(commandBuffer, sampleOrderType, customSampleOrderCount, pCustomSampleOrders);
     }
 }
@@ -8761,19 +10143,24 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateAccelerationStructureNV(
     const VkAllocationCallbacks*                pAllocator,
     VkAccelerationStructureNV*                  pAccelerationStructure) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCreateAccelerationStructureNV);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateAccelerationStructureNV, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateAccelerationStructureNV(device, pCreateInfo, pAllocator, pAccelerationStructure);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateAccelerationStructureNV, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCreateAccelerationStructureNV(device, pCreateInfo, pAllocator, pAccelerationStructure);
     }
     VkResult result = DispatchCreateAccelerationStructureNV(device, pCreateInfo, pAllocator, pAccelerationStructure);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateAccelerationStructureNV, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCreateAccelerationStructureNV(device, pCreateInfo, pAllocator, pAccelerationStructure, result);
     }
     return result;
@@ -8784,19 +10171,24 @@ VKAPI_ATTR void VKAPI_CALL DestroyAccelerationStructureNV(
     VkAccelerationStructureNV                   accelerationStructure,
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointDestroyAccelerationStructureNV);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroyAccelerationStructureNV, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyAccelerationStructureNV(device, accelerationStructure, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroyAccelerationStructureNV, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordDestroyAccelerationStructureNV(device, accelerationStructure, pAllocator);
     }
     DispatchDestroyAccelerationStructureNV(device, accelerationStructure, pAllocator);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointDestroyAccelerationStructureNV, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordDestroyAccelerationStructureNV(device, accelerationStructure, pAllocator);
     }
 }
@@ -8806,19 +10198,24 @@ VKAPI_ATTR void VKAPI_CALL GetAccelerationStructureMemoryRequirementsNV(
     const VkAccelerationStructureMemoryRequirementsInfoNV* pInfo,
     VkMemoryRequirements2KHR*                   pMemoryRequirements) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointGetAccelerationStructureMemoryRequirementsNV);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetAccelerationStructureMemoryRequirementsNV, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetAccelerationStructureMemoryRequirementsNV(device, pInfo, pMemoryRequirements);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetAccelerationStructureMemoryRequirementsNV, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordGetAccelerationStructureMemoryRequirementsNV(device, pInfo, pMemoryRequirements);
     }
     DispatchGetAccelerationStructureMemoryRequirementsNV(device, pInfo, pMemoryRequirements);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetAccelerationStructureMemoryRequirementsNV, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordGetAccelerationStructureMemoryRequirementsNV(device, pInfo, pMemoryRequirements);
     }
 }
@@ -8828,19 +10225,24 @@ VKAPI_ATTR VkResult VKAPI_CALL BindAccelerationStructureMemoryNV(
     uint32_t                                    bindInfoCount,
     const VkBindAccelerationStructureMemoryInfoNV* pBindInfos) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointBindAccelerationStructureMemoryNV);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointBindAccelerationStructureMemoryNV, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateBindAccelerationStructureMemoryNV(device, bindInfoCount, pBindInfos);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointBindAccelerationStructureMemoryNV, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordBindAccelerationStructureMemoryNV(device, bindInfoCount, pBindInfos);
     }
     VkResult result = DispatchBindAccelerationStructureMemoryNV(device, bindInfoCount, pBindInfos);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointBindAccelerationStructureMemoryNV, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordBindAccelerationStructureMemoryNV(device, bindInfoCount, pBindInfos, result);
     }
     return result;
@@ -8857,19 +10259,24 @@ VKAPI_ATTR void VKAPI_CALL CmdBuildAccelerationStructureNV(
     VkBuffer                                    scratch,
     VkDeviceSize                                scratchOffset) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdBuildAccelerationStructureNV);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdBuildAccelerationStructureNV, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBuildAccelerationStructureNV(commandBuffer, pInfo, instanceData, instanceOffset, update, dst, src, scratch, scratchOffset);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdBuildAccelerationStructureNV, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdBuildAccelerationStructureNV(commandBuffer, pInfo, instanceData, instanceOffset, update, dst, src, scratch, scratchOffset);
     }
     DispatchCmdBuildAccelerationStructureNV(commandBuffer, pInfo, instanceData, instanceOffset, update, dst, src, scratch, scratchOffset);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdBuildAccelerationStructureNV, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdBuildAccelerationStructureNV(commandBuffer, pInfo, instanceData, instanceOffset, update, dst, src, scratch, scratchOffset);
     }
 }
@@ -8880,19 +10287,24 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyAccelerationStructureNV(
     VkAccelerationStructureNV                   src,
     VkCopyAccelerationStructureModeNV           mode) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdCopyAccelerationStructureNV);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdCopyAccelerationStructureNV, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyAccelerationStructureNV(commandBuffer, dst, src, mode);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdCopyAccelerationStructureNV, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdCopyAccelerationStructureNV(commandBuffer, dst, src, mode);
     }
     DispatchCmdCopyAccelerationStructureNV(commandBuffer, dst, src, mode);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdCopyAccelerationStructureNV, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdCopyAccelerationStructureNV(commandBuffer, dst, src, mode);
     }
 }
@@ -8914,19 +10326,24 @@ VKAPI_ATTR void VKAPI_CALL CmdTraceRaysNV(
     uint32_t                                    height,
     uint32_t                                    depth) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdTraceRaysNV);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdTraceRaysNV, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdTraceRaysNV(commandBuffer, raygenShaderBindingTableBuffer, raygenShaderBindingOffset, missShaderBindingTableBuffer, missShaderBindingOffset, missShaderBindingStride, hitShaderBindingTableBuffer, hitShaderBindingOffset, hitShaderBindingStride, callableShaderBindingTableBuffer, callableShaderBindingOffset, callableShaderBindingStride, width, height, depth);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdTraceRaysNV, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdTraceRaysNV(commandBuffer, raygenShaderBindingTableBuffer, raygenShaderBindingOffset, missShaderBindingTableBuffer, missShaderBindingOffset, missShaderBindingStride, hitShaderBindingTableBuffer, hitShaderBindingOffset, hitShaderBindingStride, callableShaderBindingTableBuffer, callableShaderBindingOffset, callableShaderBindingStride, width, height, depth);
     }
     DispatchCmdTraceRaysNV(commandBuffer, raygenShaderBindingTableBuffer, raygenShaderBindingOffset, missShaderBindingTableBuffer, missShaderBindingOffset, missShaderBindingStride, hitShaderBindingTableBuffer, hitShaderBindingOffset, hitShaderBindingStride, callableShaderBindingTableBuffer, callableShaderBindingOffset, callableShaderBindingStride, width, height, depth);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdTraceRaysNV, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdTraceRaysNV(commandBuffer, raygenShaderBindingTableBuffer, raygenShaderBindingOffset, missShaderBindingTableBuffer, missShaderBindingOffset, missShaderBindingStride, hitShaderBindingTableBuffer, hitShaderBindingOffset, hitShaderBindingStride, callableShaderBindingTableBuffer, callableShaderBindingOffset, callableShaderBindingStride, width, height, depth);
     }
 }
@@ -8939,19 +10356,24 @@ VKAPI_ATTR VkResult VKAPI_CALL GetRayTracingShaderGroupHandlesNV(
     size_t                                      dataSize,
     void*                                       pData) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointGetRayTracingShaderGroupHandlesNV);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetRayTracingShaderGroupHandlesNV, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetRayTracingShaderGroupHandlesNV(device, pipeline, firstGroup, groupCount, dataSize, pData);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetRayTracingShaderGroupHandlesNV, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordGetRayTracingShaderGroupHandlesNV(device, pipeline, firstGroup, groupCount, dataSize, pData);
     }
     VkResult result = DispatchGetRayTracingShaderGroupHandlesNV(device, pipeline, firstGroup, groupCount, dataSize, pData);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetRayTracingShaderGroupHandlesNV, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordGetRayTracingShaderGroupHandlesNV(device, pipeline, firstGroup, groupCount, dataSize, pData, result);
     }
     return result;
@@ -8963,19 +10385,24 @@ VKAPI_ATTR VkResult VKAPI_CALL GetAccelerationStructureHandleNV(
     size_t                                      dataSize,
     void*                                       pData) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointGetAccelerationStructureHandleNV);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetAccelerationStructureHandleNV, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetAccelerationStructureHandleNV(device, accelerationStructure, dataSize, pData);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetAccelerationStructureHandleNV, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordGetAccelerationStructureHandleNV(device, accelerationStructure, dataSize, pData);
     }
     VkResult result = DispatchGetAccelerationStructureHandleNV(device, accelerationStructure, dataSize, pData);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetAccelerationStructureHandleNV, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordGetAccelerationStructureHandleNV(device, accelerationStructure, dataSize, pData, result);
     }
     return result;
@@ -8989,19 +10416,24 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteAccelerationStructuresPropertiesNV(
     VkQueryPool                                 queryPool,
     uint32_t                                    firstQuery) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdWriteAccelerationStructuresPropertiesNV);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdWriteAccelerationStructuresPropertiesNV, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdWriteAccelerationStructuresPropertiesNV(commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdWriteAccelerationStructuresPropertiesNV, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdWriteAccelerationStructuresPropertiesNV(commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
     }
     DispatchCmdWriteAccelerationStructuresPropertiesNV(commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdWriteAccelerationStructuresPropertiesNV, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdWriteAccelerationStructuresPropertiesNV(commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
     }
 }
@@ -9011,19 +10443,24 @@ VKAPI_ATTR VkResult VKAPI_CALL CompileDeferredNV(
     VkPipeline                                  pipeline,
     uint32_t                                    shader) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCompileDeferredNV);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCompileDeferredNV, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCompileDeferredNV(device, pipeline, shader);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCompileDeferredNV, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCompileDeferredNV(device, pipeline, shader);
     }
     VkResult result = DispatchCompileDeferredNV(device, pipeline, shader);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCompileDeferredNV, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCompileDeferredNV(device, pipeline, shader, result);
     }
     return result;
@@ -9039,19 +10476,24 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryHostPointerPropertiesEXT(
     const void*                                 pHostPointer,
     VkMemoryHostPointerPropertiesEXT*           pMemoryHostPointerProperties) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointGetMemoryHostPointerPropertiesEXT);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetMemoryHostPointerPropertiesEXT, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetMemoryHostPointerPropertiesEXT(device, handleType, pHostPointer, pMemoryHostPointerProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetMemoryHostPointerPropertiesEXT, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordGetMemoryHostPointerPropertiesEXT(device, handleType, pHostPointer, pMemoryHostPointerProperties);
     }
     VkResult result = DispatchGetMemoryHostPointerPropertiesEXT(device, handleType, pHostPointer, pMemoryHostPointerProperties);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetMemoryHostPointerPropertiesEXT, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordGetMemoryHostPointerPropertiesEXT(device, handleType, pHostPointer, pMemoryHostPointerProperties, result);
     }
     return result;
@@ -9065,19 +10507,24 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteBufferMarkerAMD(
     VkDeviceSize                                dstOffset,
     uint32_t                                    marker) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdWriteBufferMarkerAMD);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdWriteBufferMarkerAMD, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdWriteBufferMarkerAMD(commandBuffer, pipelineStage, dstBuffer, dstOffset, marker);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdWriteBufferMarkerAMD, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdWriteBufferMarkerAMD(commandBuffer, pipelineStage, dstBuffer, dstOffset, marker);
     }
     DispatchCmdWriteBufferMarkerAMD(commandBuffer, pipelineStage, dstBuffer, dstOffset, marker);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdWriteBufferMarkerAMD, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdWriteBufferMarkerAMD(commandBuffer, pipelineStage, dstBuffer, dstOffset, marker);
     }
 }
@@ -9114,19 +10561,24 @@ VKAPI_ATTR VkResult VKAPI_CALL GetCalibratedTimestampsEXT(
     uint64_t*                                   pTimestamps,
     uint64_t*                                   pMaxDeviation) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointGetCalibratedTimestampsEXT);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetCalibratedTimestampsEXT, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetCalibratedTimestampsEXT(device, timestampCount, pTimestampInfos, pTimestamps, pMaxDeviation);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetCalibratedTimestampsEXT, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordGetCalibratedTimestampsEXT(device, timestampCount, pTimestampInfos, pTimestamps, pMaxDeviation);
     }
     VkResult result = DispatchGetCalibratedTimestampsEXT(device, timestampCount, pTimestampInfos, pTimestamps, pMaxDeviation);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetCalibratedTimestampsEXT, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordGetCalibratedTimestampsEXT(device, timestampCount, pTimestampInfos, pTimestamps, pMaxDeviation, result);
     }
     return result;
@@ -9147,19 +10599,24 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMeshTasksNV(
     uint32_t                                    taskCount,
     uint32_t                                    firstTask) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdDrawMeshTasksNV);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdDrawMeshTasksNV, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawMeshTasksNV(commandBuffer, taskCount, firstTask);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdDrawMeshTasksNV, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdDrawMeshTasksNV(commandBuffer, taskCount, firstTask);
     }
     DispatchCmdDrawMeshTasksNV(commandBuffer, taskCount, firstTask);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdDrawMeshTasksNV, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdDrawMeshTasksNV(commandBuffer, taskCount, firstTask);
     }
 }
@@ -9171,19 +10628,24 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMeshTasksIndirectNV(
     uint32_t                                    drawCount,
     uint32_t                                    stride) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdDrawMeshTasksIndirectNV);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdDrawMeshTasksIndirectNV, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawMeshTasksIndirectNV(commandBuffer, buffer, offset, drawCount, stride);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdDrawMeshTasksIndirectNV, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdDrawMeshTasksIndirectNV(commandBuffer, buffer, offset, drawCount, stride);
     }
     DispatchCmdDrawMeshTasksIndirectNV(commandBuffer, buffer, offset, drawCount, stride);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdDrawMeshTasksIndirectNV, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdDrawMeshTasksIndirectNV(commandBuffer, buffer, offset, drawCount, stride);
     }
 }
@@ -9197,19 +10659,24 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMeshTasksIndirectCountNV(
     uint32_t                                    maxDrawCount,
     uint32_t                                    stride) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdDrawMeshTasksIndirectCountNV);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdDrawMeshTasksIndirectCountNV, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawMeshTasksIndirectCountNV(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdDrawMeshTasksIndirectCountNV, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdDrawMeshTasksIndirectCountNV(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
     DispatchCmdDrawMeshTasksIndirectCountNV(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdDrawMeshTasksIndirectCountNV, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdDrawMeshTasksIndirectCountNV(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
 }
@@ -9223,19 +10690,24 @@ VKAPI_ATTR void VKAPI_CALL CmdSetExclusiveScissorNV(
     uint32_t                                    exclusiveScissorCount,
     const VkRect2D*                             pExclusiveScissors) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdSetExclusiveScissorNV);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdSetExclusiveScissorNV, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetExclusiveScissorNV(commandBuffer, firstExclusiveScissor, exclusiveScissorCount, pExclusiveScissors);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdSetExclusiveScissorNV, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdSetExclusiveScissorNV(commandBuffer, firstExclusiveScissor, exclusiveScissorCount, pExclusiveScissors);
     }
     DispatchCmdSetExclusiveScissorNV(commandBuffer, firstExclusiveScissor, exclusiveScissorCount, pExclusiveScissors);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdSetExclusiveScissorNV, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdSetExclusiveScissorNV(commandBuffer, firstExclusiveScissor, exclusiveScissorCount, pExclusiveScissors);
     }
 }
@@ -9245,19 +10717,24 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCheckpointNV(
     VkCommandBuffer                             commandBuffer,
     const void*                                 pCheckpointMarker) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdSetCheckpointNV);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdSetCheckpointNV, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetCheckpointNV(commandBuffer, pCheckpointMarker);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdSetCheckpointNV, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdSetCheckpointNV(commandBuffer, pCheckpointMarker);
     }
     DispatchCmdSetCheckpointNV(commandBuffer, pCheckpointMarker);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdSetCheckpointNV, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdSetCheckpointNV(commandBuffer, pCheckpointMarker);
     }
 }
@@ -9267,19 +10744,24 @@ VKAPI_ATTR void VKAPI_CALL GetQueueCheckpointDataNV(
     uint32_t*                                   pCheckpointDataCount,
     VkCheckpointDataNV*                         pCheckpointData) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointGetQueueCheckpointDataNV);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetQueueCheckpointDataNV, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetQueueCheckpointDataNV(queue, pCheckpointDataCount, pCheckpointData);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetQueueCheckpointDataNV, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordGetQueueCheckpointDataNV(queue, pCheckpointDataCount, pCheckpointData);
     }
     DispatchGetQueueCheckpointDataNV(queue, pCheckpointDataCount, pCheckpointData);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetQueueCheckpointDataNV, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordGetQueueCheckpointDataNV(queue, pCheckpointDataCount, pCheckpointData);
     }
 }
@@ -9290,19 +10772,24 @@ VKAPI_ATTR VkResult VKAPI_CALL InitializePerformanceApiINTEL(
     VkDevice                                    device,
     const VkInitializePerformanceApiInfoINTEL*  pInitializeInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointInitializePerformanceApiINTEL);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointInitializePerformanceApiINTEL, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateInitializePerformanceApiINTEL(device, pInitializeInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointInitializePerformanceApiINTEL, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordInitializePerformanceApiINTEL(device, pInitializeInfo);
     }
     VkResult result = DispatchInitializePerformanceApiINTEL(device, pInitializeInfo);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointInitializePerformanceApiINTEL, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordInitializePerformanceApiINTEL(device, pInitializeInfo, result);
     }
     return result;
@@ -9311,19 +10798,24 @@ VKAPI_ATTR VkResult VKAPI_CALL InitializePerformanceApiINTEL(
 VKAPI_ATTR void VKAPI_CALL UninitializePerformanceApiINTEL(
     VkDevice                                    device) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointUninitializePerformanceApiINTEL);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointUninitializePerformanceApiINTEL, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateUninitializePerformanceApiINTEL(device);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointUninitializePerformanceApiINTEL, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordUninitializePerformanceApiINTEL(device);
     }
     DispatchUninitializePerformanceApiINTEL(device);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointUninitializePerformanceApiINTEL, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordUninitializePerformanceApiINTEL(device);
     }
 }
@@ -9332,19 +10824,24 @@ VKAPI_ATTR VkResult VKAPI_CALL CmdSetPerformanceMarkerINTEL(
     VkCommandBuffer                             commandBuffer,
     const VkPerformanceMarkerInfoINTEL*         pMarkerInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdSetPerformanceMarkerINTEL);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdSetPerformanceMarkerINTEL, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetPerformanceMarkerINTEL(commandBuffer, pMarkerInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdSetPerformanceMarkerINTEL, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdSetPerformanceMarkerINTEL(commandBuffer, pMarkerInfo);
     }
     VkResult result = DispatchCmdSetPerformanceMarkerINTEL(commandBuffer, pMarkerInfo);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdSetPerformanceMarkerINTEL, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdSetPerformanceMarkerINTEL(commandBuffer, pMarkerInfo, result);
     }
     return result;
@@ -9354,19 +10851,24 @@ VKAPI_ATTR VkResult VKAPI_CALL CmdSetPerformanceStreamMarkerINTEL(
     VkCommandBuffer                             commandBuffer,
     const VkPerformanceStreamMarkerInfoINTEL*   pMarkerInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdSetPerformanceStreamMarkerINTEL);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdSetPerformanceStreamMarkerINTEL, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetPerformanceStreamMarkerINTEL(commandBuffer, pMarkerInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdSetPerformanceStreamMarkerINTEL, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdSetPerformanceStreamMarkerINTEL(commandBuffer, pMarkerInfo);
     }
     VkResult result = DispatchCmdSetPerformanceStreamMarkerINTEL(commandBuffer, pMarkerInfo);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdSetPerformanceStreamMarkerINTEL, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdSetPerformanceStreamMarkerINTEL(commandBuffer, pMarkerInfo, result);
     }
     return result;
@@ -9376,19 +10878,24 @@ VKAPI_ATTR VkResult VKAPI_CALL CmdSetPerformanceOverrideINTEL(
     VkCommandBuffer                             commandBuffer,
     const VkPerformanceOverrideInfoINTEL*       pOverrideInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdSetPerformanceOverrideINTEL);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdSetPerformanceOverrideINTEL, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetPerformanceOverrideINTEL(commandBuffer, pOverrideInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdSetPerformanceOverrideINTEL, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdSetPerformanceOverrideINTEL(commandBuffer, pOverrideInfo);
     }
     VkResult result = DispatchCmdSetPerformanceOverrideINTEL(commandBuffer, pOverrideInfo);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdSetPerformanceOverrideINTEL, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdSetPerformanceOverrideINTEL(commandBuffer, pOverrideInfo, result);
     }
     return result;
@@ -9399,19 +10906,24 @@ VKAPI_ATTR VkResult VKAPI_CALL AcquirePerformanceConfigurationINTEL(
     const VkPerformanceConfigurationAcquireInfoINTEL* pAcquireInfo,
     VkPerformanceConfigurationINTEL*            pConfiguration) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointAcquirePerformanceConfigurationINTEL);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointAcquirePerformanceConfigurationINTEL, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateAcquirePerformanceConfigurationINTEL(device, pAcquireInfo, pConfiguration);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointAcquirePerformanceConfigurationINTEL, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordAcquirePerformanceConfigurationINTEL(device, pAcquireInfo, pConfiguration);
     }
     VkResult result = DispatchAcquirePerformanceConfigurationINTEL(device, pAcquireInfo, pConfiguration);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointAcquirePerformanceConfigurationINTEL, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordAcquirePerformanceConfigurationINTEL(device, pAcquireInfo, pConfiguration, result);
     }
     return result;
@@ -9421,19 +10933,24 @@ VKAPI_ATTR VkResult VKAPI_CALL ReleasePerformanceConfigurationINTEL(
     VkDevice                                    device,
     VkPerformanceConfigurationINTEL             configuration) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointReleasePerformanceConfigurationINTEL);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointReleasePerformanceConfigurationINTEL, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateReleasePerformanceConfigurationINTEL(device, configuration);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointReleasePerformanceConfigurationINTEL, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordReleasePerformanceConfigurationINTEL(device, configuration);
     }
     VkResult result = DispatchReleasePerformanceConfigurationINTEL(device, configuration);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointReleasePerformanceConfigurationINTEL, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordReleasePerformanceConfigurationINTEL(device, configuration, result);
     }
     return result;
@@ -9443,19 +10960,24 @@ VKAPI_ATTR VkResult VKAPI_CALL QueueSetPerformanceConfigurationINTEL(
     VkQueue                                     queue,
     VkPerformanceConfigurationINTEL             configuration) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointQueueSetPerformanceConfigurationINTEL);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointQueueSetPerformanceConfigurationINTEL, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateQueueSetPerformanceConfigurationINTEL(queue, configuration);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointQueueSetPerformanceConfigurationINTEL, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordQueueSetPerformanceConfigurationINTEL(queue, configuration);
     }
     VkResult result = DispatchQueueSetPerformanceConfigurationINTEL(queue, configuration);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointQueueSetPerformanceConfigurationINTEL, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordQueueSetPerformanceConfigurationINTEL(queue, configuration, result);
     }
     return result;
@@ -9466,19 +10988,24 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPerformanceParameterINTEL(
     VkPerformanceParameterTypeINTEL             parameter,
     VkPerformanceValueINTEL*                    pValue) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointGetPerformanceParameterINTEL);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetPerformanceParameterINTEL, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPerformanceParameterINTEL(device, parameter, pValue);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetPerformanceParameterINTEL, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordGetPerformanceParameterINTEL(device, parameter, pValue);
     }
     VkResult result = DispatchGetPerformanceParameterINTEL(device, parameter, pValue);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetPerformanceParameterINTEL, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordGetPerformanceParameterINTEL(device, parameter, pValue, result);
     }
     return result;
@@ -9491,19 +11018,24 @@ VKAPI_ATTR void VKAPI_CALL SetLocalDimmingAMD(
     VkSwapchainKHR                              swapChain,
     VkBool32                                    localDimmingEnable) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointSetLocalDimmingAMD);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointSetLocalDimmingAMD, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateSetLocalDimmingAMD(device, swapChain, localDimmingEnable);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointSetLocalDimmingAMD, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordSetLocalDimmingAMD(device, swapChain, localDimmingEnable);
     }
     DispatchSetLocalDimmingAMD(device, swapChain, localDimmingEnable);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointSetLocalDimmingAMD, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordSetLocalDimmingAMD(device, swapChain, localDimmingEnable);
     }
 }
@@ -9577,19 +11109,24 @@ VKAPI_ATTR VkDeviceAddress VKAPI_CALL GetBufferDeviceAddressEXT(
     VkDevice                                    device,
     const VkBufferDeviceAddressInfo*            pInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointGetBufferDeviceAddressEXT);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetBufferDeviceAddressEXT, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetBufferDeviceAddressEXT(device, pInfo);
         if (skip) return 0;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetBufferDeviceAddressEXT, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordGetBufferDeviceAddressEXT(device, pInfo);
     }
     VkDeviceAddress result = DispatchGetBufferDeviceAddressEXT(device, pInfo);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetBufferDeviceAddressEXT, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordGetBufferDeviceAddressEXT(device, pInfo, result);
     }
     return result;
@@ -9678,19 +11215,24 @@ VKAPI_ATTR VkResult VKAPI_CALL AcquireFullScreenExclusiveModeEXT(
     VkDevice                                    device,
     VkSwapchainKHR                              swapchain) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointAcquireFullScreenExclusiveModeEXT);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointAcquireFullScreenExclusiveModeEXT, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateAcquireFullScreenExclusiveModeEXT(device, swapchain);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointAcquireFullScreenExclusiveModeEXT, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordAcquireFullScreenExclusiveModeEXT(device, swapchain);
     }
     VkResult result = DispatchAcquireFullScreenExclusiveModeEXT(device, swapchain);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointAcquireFullScreenExclusiveModeEXT, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordAcquireFullScreenExclusiveModeEXT(device, swapchain, result);
     }
     return result;
@@ -9700,19 +11242,24 @@ VKAPI_ATTR VkResult VKAPI_CALL ReleaseFullScreenExclusiveModeEXT(
     VkDevice                                    device,
     VkSwapchainKHR                              swapchain) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointReleaseFullScreenExclusiveModeEXT);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointReleaseFullScreenExclusiveModeEXT, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateReleaseFullScreenExclusiveModeEXT(device, swapchain);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointReleaseFullScreenExclusiveModeEXT, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordReleaseFullScreenExclusiveModeEXT(device, swapchain);
     }
     VkResult result = DispatchReleaseFullScreenExclusiveModeEXT(device, swapchain);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointReleaseFullScreenExclusiveModeEXT, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordReleaseFullScreenExclusiveModeEXT(device, swapchain, result);
     }
     return result;
@@ -9723,19 +11270,24 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDeviceGroupSurfacePresentModes2EXT(
     const VkPhysicalDeviceSurfaceInfo2KHR*      pSurfaceInfo,
     VkDeviceGroupPresentModeFlagsKHR*           pModes) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointGetDeviceGroupSurfacePresentModes2EXT);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetDeviceGroupSurfacePresentModes2EXT, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceGroupSurfacePresentModes2EXT(device, pSurfaceInfo, pModes);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetDeviceGroupSurfacePresentModes2EXT, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordGetDeviceGroupSurfacePresentModes2EXT(device, pSurfaceInfo, pModes);
     }
     VkResult result = DispatchGetDeviceGroupSurfacePresentModes2EXT(device, pSurfaceInfo, pModes);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointGetDeviceGroupSurfacePresentModes2EXT, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordGetDeviceGroupSurfacePresentModes2EXT(device, pSurfaceInfo, pModes, result);
     }
     return result;
@@ -9773,19 +11325,24 @@ VKAPI_ATTR void VKAPI_CALL CmdSetLineStippleEXT(
     uint32_t                                    lineStippleFactor,
     uint16_t                                    lineStipplePattern) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCmdSetLineStippleEXT);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdSetLineStippleEXT, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetLineStippleEXT(commandBuffer, lineStippleFactor, lineStipplePattern);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdSetLineStippleEXT, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCmdSetLineStippleEXT(commandBuffer, lineStippleFactor, lineStipplePattern);
     }
     DispatchCmdSetLineStippleEXT(commandBuffer, lineStippleFactor, lineStipplePattern);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCmdSetLineStippleEXT, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCmdSetLineStippleEXT(commandBuffer, lineStippleFactor, lineStipplePattern);
     }
 }
@@ -9797,19 +11354,24 @@ VKAPI_ATTR void VKAPI_CALL ResetQueryPoolEXT(
     uint32_t                                    firstQuery,
     uint32_t                                    queryCount) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointResetQueryPoolEXT);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointResetQueryPoolEXT, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateResetQueryPoolEXT(device, queryPool, firstQuery, queryCount);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointResetQueryPoolEXT, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordResetQueryPoolEXT(device, queryPool, firstQuery, queryCount);
     }
     DispatchResetQueryPoolEXT(device, queryPool, firstQuery, queryCount);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointResetQueryPoolEXT, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordResetQueryPoolEXT(device, queryPool, firstQuery, queryCount);
     }
 }
@@ -9818,6 +11380,301 @@ VKAPI_ATTR void VKAPI_CALL ResetQueryPoolEXT(
 
 
 
+// Names of the entry points, indexed by EntryPointId
+const char *const kEntryPointNames[kEntryPointCount] = {
+    "vkGetDeviceQueue",
+    "vkQueueSubmit",
+    "vkQueueWaitIdle",
+    "vkDeviceWaitIdle",
+    "vkAllocateMemory",
+    "vkFreeMemory",
+    "vkMapMemory",
+    "vkUnmapMemory",
+    "vkFlushMappedMemoryRanges",
+    "vkInvalidateMappedMemoryRanges",
+    "vkGetDeviceMemoryCommitment",
+    "vkBindBufferMemory",
+    "vkBindImageMemory",
+    "vkGetBufferMemoryRequirements",
+    "vkGetImageMemoryRequirements",
+    "vkGetImageSparseMemoryRequirements",
+    "vkQueueBindSparse",
+    "vkCreateFence",
+    "vkDestroyFence",
+    "vkResetFences",
+    "vkGetFenceStatus",
+    "vkWaitForFences",
+    "vkCreateSemaphore",
+    "vkDestroySemaphore",
+    "vkCreateEvent",
+    "vkDestroyEvent",
+    "vkGetEventStatus",
+    "vkSetEvent",
+    "vkResetEvent",
+    "vkCreateQueryPool",
+    "vkDestroyQueryPool",
+    "vkGetQueryPoolResults",
+    "vkCreateBuffer",
+    "vkDestroyBuffer",
+    "vkCreateBufferView",
+    "vkDestroyBufferView",
+    "vkCreateImage",
+    "vkDestroyImage",
+    "vkGetImageSubresourceLayout",
+    "vkCreateImageView",
+    "vkDestroyImageView",
+    "vkCreateShaderModule",
+    "vkDestroyShaderModule",
+    "vkCreatePipelineCache",
+    "vkDestroyPipelineCache",
+    "vkGetPipelineCacheData",
+    "vkMergePipelineCaches",
+    "vkCreateGraphicsPipelines",
+    "vkCreateComputePipelines",
+    "vkDestroyPipeline",
+    "vkCreatePipelineLayout",
+    "vkDestroyPipelineLayout",
+    "vkCreateSampler",
+    "vkDestroySampler",
+    "vkCreateDescriptorSetLayout",
+    "vkDestroyDescriptorSetLayout",
+    "vkCreateDescriptorPool",
+    "vkDestroyDescriptorPool",
+    "vkResetDescriptorPool",
+    "vkAllocateDescriptorSets",
+    "vkFreeDescriptorSets",
+    "vkUpdateDescriptorSets",
+    "vkCreateFramebuffer",
+    "vkDestroyFramebuffer",
+    "vkCreateRenderPass",
+    "vkDestroyRenderPass",
+    "vkGetRenderAreaGranularity",
+    "vkCreateCommandPool",
+    "vkDestroyCommandPool",
+    "vkResetCommandPool",
+    "vkAllocateCommandBuffers",
+    "vkFreeCommandBuffers",
+    "vkBeginCommandBuffer",
+    "vkEndCommandBuffer",
+    "vkResetCommandBuffer",
+    "vkCmdBindPipeline",
+    "vkCmdSetViewport",
+    "vkCmdSetScissor",
+    "vkCmdSetLineWidth",
+    "vkCmdSetDepthBias",
+    "vkCmdSetBlendConstants",
+    "vkCmdSetDepthBounds",
+    "vkCmdSetStencilCompareMask",
+    "vkCmdSetStencilWriteMask",
+    "vkCmdSetStencilReference",
+    "vkCmdBindDescriptorSets",
+    "vkCmdBindIndexBuffer",
+    "vkCmdBindVertexBuffers",
+    "vkCmdDraw",
+    "vkCmdDrawIndexed",
+    "vkCmdDrawIndirect",
+    "vkCmdDrawIndexedIndirect",
+    "vkCmdDispatch",
+    "vkCmdDispatchIndirect",
+    "vkCmdCopyBuffer",
+    "vkCmdCopyImage",
+    "vkCmdBlitImage",
+    "vkCmdCopyBufferToImage",
+    "vkCmdCopyImageToBuffer",
+    "vkCmdUpdateBuffer",
+    "vkCmdFillBuffer",
+    "vkCmdClearColorImage",
+    "vkCmdClearDepthStencilImage",
+    "vkCmdClearAttachments",
+    "vkCmdResolveImage",
+    "vkCmdSetEvent",
+    "vkCmdResetEvent",
+    "vkCmdWaitEvents",
+    "vkCmdPipelineBarrier",
+    "vkCmdBeginQuery",
+    "vkCmdEndQuery",
+    "vkCmdResetQueryPool",
+    "vkCmdWriteTimestamp",
+    "vkCmdCopyQueryPoolResults",
+    "vkCmdPushConstants",
+    "vkCmdBeginRenderPass",
+    "vkCmdNextSubpass",
+    "vkCmdEndRenderPass",
+    "vkCmdExecuteCommands",
+    "vkBindBufferMemory2",
+    "vkBindImageMemory2",
+    "vkGetDeviceGroupPeerMemoryFeatures",
+    "vkCmdSetDeviceMask",
+    "vkCmdDispatchBase",
+    "vkGetImageMemoryRequirements2",
+    "vkGetBufferMemoryRequirements2",
+    "vkGetImageSparseMemoryRequirements2",
+    "vkTrimCommandPool",
+    "vkGetDeviceQueue2",
+    "vkCreateSamplerYcbcrConversion",
+    "vkDestroySamplerYcbcrConversion",
+    "vkCreateDescriptorUpdateTemplate",
+    "vkDestroyDescriptorUpdateTemplate",
+    "vkUpdateDescriptorSetWithTemplate",
+    "vkGetDescriptorSetLayoutSupport",
+    "vkCmdDrawIndirectCount",
+    "vkCmdDrawIndexedIndirectCount",
+    "vkCreateRenderPass2",
+    "vkCmdBeginRenderPass2",
+    "vkCmdNextSubpass2",
+    "vkCmdEndRenderPass2",
+    "vkResetQueryPool",
+    "vkGetSemaphoreCounterValue",
+    "vkWaitSemaphores",
+    "vkSignalSemaphore",
+    "vkGetBufferDeviceAddress",
+    "vkGetBufferOpaqueCaptureAddress",
+    "vkGetDeviceMemoryOpaqueCaptureAddress",
+    "vkCreateSwapchainKHR",
+    "vkDestroySwapchainKHR",
+    "vkGetSwapchainImagesKHR",
+    "vkAcquireNextImageKHR",
+    "vkQueuePresentKHR",
+    "vkGetDeviceGroupPresentCapabilitiesKHR",
+    "vkGetDeviceGroupSurfacePresentModesKHR",
+    "vkAcquireNextImage2KHR",
+    "vkCreateSharedSwapchainsKHR",
+    "vkGetDeviceGroupPeerMemoryFeaturesKHR",
+    "vkCmdSetDeviceMaskKHR",
+    "vkCmdDispatchBaseKHR",
+    "vkTrimCommandPoolKHR",
+    "vkGetMemoryWin32HandleKHR",
+    "vkGetMemoryWin32HandlePropertiesKHR",
+    "vkGetMemoryFdKHR",
+    "vkGetMemoryFdPropertiesKHR",
+    "vkImportSemaphoreWin32HandleKHR",
+    "vkGetSemaphoreWin32HandleKHR",
+    "vkImportSemaphoreFdKHR",
+    "vkGetSemaphoreFdKHR",
+    "vkCmdPushDescriptorSetKHR",
+    "vkCmdPushDescriptorSetWithTemplateKHR",
+    "vkCreateDescriptorUpdateTemplateKHR",
+    "vkDestroyDescriptorUpdateTemplateKHR",
+    "vkUpdateDescriptorSetWithTemplateKHR",
+    "vkCreateRenderPass2KHR",
+    "vkCmdBeginRenderPass2KHR",
+    "vkCmdNextSubpass2KHR",
+    "vkCmdEndRenderPass2KHR",
+    "vkGetSwapchainStatusKHR",
+    "vkImportFenceWin32HandleKHR",
+    "vkGetFenceWin32HandleKHR",
+    "vkImportFenceFdKHR",
+    "vkGetFenceFdKHR",
+    "vkAcquireProfilingLockKHR",
+    "vkReleaseProfilingLockKHR",
+    "vkGetImageMemoryRequirements2KHR",
+    "vkGetBufferMemoryRequirements2KHR",
+    "vkGetImageSparseMemoryRequirements2KHR",
+    "vkCreateSamplerYcbcrConversionKHR",
+    "vkDestroySamplerYcbcrConversionKHR",
+    "vkBindBufferMemory2KHR",
+    "vkBindImageMemory2KHR",
+    "vkGetDescriptorSetLayoutSupportKHR",
+    "vkCmdDrawIndirectCountKHR",
+    "vkCmdDrawIndexedIndirectCountKHR",
+    "vkGetSemaphoreCounterValueKHR",
+    "vkWaitSemaphoresKHR",
+    "vkSignalSemaphoreKHR",
+    "vkGetBufferDeviceAddressKHR",
+    "vkGetBufferOpaqueCaptureAddressKHR",
+    "vkGetDeviceMemoryOpaqueCaptureAddressKHR",
+    "vkGetPipelineExecutablePropertiesKHR",
+    "vkGetPipelineExecutableStatisticsKHR",
+    "vkGetPipelineExecutableInternalRepresentationsKHR",
+    "vkDebugMarkerSetObjectTagEXT",
+    "vkDebugMarkerSetObjectNameEXT",
+    "vkCmdDebugMarkerBeginEXT",
+    "vkCmdDebugMarkerEndEXT",
+    "vkCmdDebugMarkerInsertEXT",
+    "vkCmdBindTransformFeedbackBuffersEXT",
+    "vkCmdBeginTransformFeedbackEXT",
+    "vkCmdEndTransformFeedbackEXT",
+    "vkCmdBeginQueryIndexedEXT",
+    "vkCmdEndQueryIndexedEXT",
+    "vkCmdDrawIndirectByteCountEXT",
+    "vkGetImageViewHandleNVX",
+    "vkCmdDrawIndirectCountAMD",
+    "vkCmdDrawIndexedIndirectCountAMD",
+    "vkGetShaderInfoAMD",
+    "vkGetMemoryWin32HandleNV",
+    "vkCmdBeginConditionalRenderingEXT",
+    "vkCmdEndConditionalRenderingEXT",
+    "vkCmdProcessCommandsNVX",
+    "vkCmdReserveSpaceForCommandsNVX",
+    "vkCreateIndirectCommandsLayoutNVX",
+    "vkDestroyIndirectCommandsLayoutNVX",
+    "vkCreateObjectTableNVX",
+    "vkDestroyObjectTableNVX",
+    "vkRegisterObjectsNVX",
+    "vkUnregisterObjectsNVX",
+    "vkCmdSetViewportWScalingNV",
+    "vkDisplayPowerControlEXT",
+    "vkRegisterDeviceEventEXT",
+    "vkRegisterDisplayEventEXT",
+    "vkGetSwapchainCounterEXT",
+    "vkGetRefreshCycleDurationGOOGLE",
+    "vkGetPastPresentationTimingGOOGLE",
+    "vkCmdSetDiscardRectangleEXT",
+    "vkSetHdrMetadataEXT",
+    "vkSetDebugUtilsObjectNameEXT",
+    "vkSetDebugUtilsObjectTagEXT",
+    "vkQueueBeginDebugUtilsLabelEXT",
+    "vkQueueEndDebugUtilsLabelEXT",
+    "vkQueueInsertDebugUtilsLabelEXT",
+    "vkCmdBeginDebugUtilsLabelEXT",
+    "vkCmdEndDebugUtilsLabelEXT",
+    "vkCmdInsertDebugUtilsLabelEXT",
+    "vkGetAndroidHardwareBufferPropertiesANDROID",
+    "vkGetMemoryAndroidHardwareBufferANDROID",
+    "vkCmdSetSampleLocationsEXT",
+    "vkGetImageDrmFormatModifierPropertiesEXT",
+    "vkCmdBindShadingRateImageNV",
+    "vkCmdSetViewportShadingRatePaletteNV",
+    "vkCmdSetCoarseSampleOrderNV",
+    "vkCreateAccelerationStructureNV",
+    "vkDestroyAccelerationStructureNV",
+    "vkGetAccelerationStructureMemoryRequirementsNV",
+    "vkBindAccelerationStructureMemoryNV",
+    "vkCmdBuildAccelerationStructureNV",
+    "vkCmdCopyAccelerationStructureNV",
+    "vkCmdTraceRaysNV",
+    "vkCreateRayTracingPipelinesNV",
+    "vkGetRayTracingShaderGroupHandlesNV",
+    "vkGetAccelerationStructureHandleNV",
+    "vkCmdWriteAccelerationStructuresPropertiesNV",
+    "vkCompileDeferredNV",
+    "vkGetMemoryHostPointerPropertiesEXT",
+    "vkCmdWriteBufferMarkerAMD",
+    "vkGetCalibratedTimestampsEXT",
+    "vkCmdDrawMeshTasksNV",
+    "vkCmdDrawMeshTasksIndirectNV",
+    "vkCmdDrawMeshTasksIndirectCountNV",
+    "vkCmdSetExclusiveScissorNV",
+    "vkCmdSetCheckpointNV",
+    "vkGetQueueCheckpointDataNV",
+    "vkInitializePerformanceApiINTEL",
+    "vkUninitializePerformanceApiINTEL",
+    "vkCmdSetPerformanceMarkerINTEL",
+    "vkCmdSetPerformanceStreamMarkerINTEL",
+    "vkCmdSetPerformanceOverrideINTEL",
+    "vkAcquirePerformanceConfigurationINTEL",
+    "vkReleasePerformanceConfigurationINTEL",
+    "vkQueueSetPerformanceConfigurationINTEL",
+    "vkGetPerformanceParameterINTEL",
+    "vkSetLocalDimmingAMD",
+    "vkGetBufferDeviceAddressEXT",
+    "vkAcquireFullScreenExclusiveModeEXT",
+    "vkReleaseFullScreenExclusiveModeEXT",
+    "vkGetDeviceGroupSurfacePresentModes2EXT",
+    "vkCmdSetLineStippleEXT",
+    "vkResetQueryPoolEXT",
+};
+
 // Map of intercepted ApiName to its associated function data
 #ifdef _MSC_VER
 #pragma warning( suppress: 6262 ) // VS analysis: this uses more than 16 kiB, which is fine here at global scope
@@ -10273,6 +12130,7 @@ const std::unordered_map<std::string, function_data> name_to_funcptr_map = {
     {"vkCreateHeadlessSurfaceEXT", {kFuncTypeInst, (void*)CreateHeadlessSurfaceEXT}},
     {"vkCmdSetLineStippleEXT", {kFuncTypeDev, (void*)CmdSetLineStippleEXT}},
     {"vkResetQueryPoolEXT", {kFuncTypeDev, (void*)ResetQueryPoolEXT}},
+    {"vkGetEntryPointCostsLAYER", {kFuncTypeDev, (void*)GetEntryPointCostsLAYER}},
 };
 
 
@@ -50,6 +50,8 @@
 #include "vk_extension_helper.h"
 #include "vk_safe_struct.h"
 #include "vk_typemap_helper.h"
+#include "handle_registry.h"
+#include "entry_point_costs.h"
 
 
 extern std::atomic<uint64_t> global_unique_id;
@@ -2502,6 +2504,301 @@ VKAPI_ATTR void VKAPI_CALL ResetQueryPoolEXT(
 
 
 
+// Ids of the entry points an EntryPointCosts keeps counters for
+enum EntryPointId {
+    kEntryPointGetDeviceQueue,
+    kEntryPointQueueSubmit,
+    kEntryPointQueueWaitIdle,
+    kEntryPointDeviceWaitIdle,
+    kEntryPointAllocateMemory,
+    kEntryPointFreeMemory,
+    kEntryPointMapMemory,
+    kEntryPointUnmapMemory,
+    kEntryPointFlushMappedMemoryRanges,
+    kEntryPointInvalidateMappedMemoryRanges,
+    kEntryPointGetDeviceMemoryCommitment,
+    kEntryPointBindBufferMemory,
+    kEntryPointBindImageMemory,
+    kEntryPointGetBufferMemoryRequirements,
+    kEntryPointGetImageMemoryRequirements,
+    kEntryPointGetImageSparseMemoryRequirements,
+    kEntryPointQueueBindSparse,
+    kEntryPointCreateFence,
+    kEntryPointDestroyFence,
+    kEntryPointResetFences,
+    kEntryPointGetFenceStatus,
+    kEntryPointWaitForFences,
+    kEntryPointCreateSemaphore,
+    kEntryPointDestroySemaphore,
+    kEntryPointCreateEvent,
+    kEntryPointDestroyEvent,
+    kEntryPointGetEventStatus,
+    kEntryPointSetEvent,
+    kEntryPointResetEvent,
+    kEntryPointCreateQueryPool,
+    kEntryPointDestroyQueryPool,
+    kEntryPointGetQueryPoolResults,
+    kEntryPointCreateBuffer,
+    kEntryPointDestroyBuffer,
+    kEntryPointCreateBufferView,
+    kEntryPointDestroyBufferView,
+    kEntryPointCreateImage,
+    kEntryPointDestroyImage,
+    kEntryPointGetImageSubresourceLayout,
+    kEntryPointCreateImageView,
+    kEntryPointDestroyImageView,
+    kEntryPointCreateShaderModule,
+    kEntryPointDestroyShaderModule,
+    kEntryPointCreatePipelineCache,
+    kEntryPointDestroyPipelineCache,
+    kEntryPointGetPipelineCacheData,
+    kEntryPointMergePipelineCaches,
+    kEntryPointCreateGraphicsPipelines,
+    kEntryPointCreateComputePipelines,
+    kEntryPointDestroyPipeline,
+    kEntryPointCreatePipelineLayout,
+    kEntryPointDestroyPipelineLayout,
+    kEntryPointCreateSampler,
+    kEntryPointDestroySampler,
+    kEntryPointCreateDescriptorSetLayout,
+    kEntryPointDestroyDescriptorSetLayout,
+    kEntryPointCreateDescriptorPool,
+    kEntryPointDestroyDescriptorPool,
+    kEntryPointResetDescriptorPool,
+    kEntryPointAllocateDescriptorSets,
+    kEntryPointFreeDescriptorSets,
+    kEntryPointUpdateDescriptorSets,
+    kEntryPointCreateFramebuffer,
+    kEntryPointDestroyFramebuffer,
+    kEntryPointCreateRenderPass,
+    kEntryPointDestroyRenderPass,
+    kEntryPointGetRenderAreaGranularity,
+    kEntryPointCreateCommandPool,
+    kEntryPointDestroyCommandPool,
+    kEntryPointResetCommandPool,
+    kEntryPointAllocateCommandBuffers,
+    kEntryPointFreeCommandBuffers,
+    kEntryPointBeginCommandBuffer,
+    kEntryPointEndCommandBuffer,
+    kEntryPointResetCommandBuffer,
+    kEntryPointCmdBindPipeline,
+    kEntryPointCmdSetViewport,
+    kEntryPointCmdSetScissor,
+    kEntryPointCmdSetLineWidth,
+    kEntryPointCmdSetDepthBias,
+    kEntryPointCmdSetBlendConstants,
+    kEntryPointCmdSetDepthBounds,
+    kEntryPointCmdSetStencilCompareMask,
+    kEntryPointCmdSetStencilWriteMask,
+    kEntryPointCmdSetStencilReference,
+    kEntryPointCmdBindDescriptorSets,
+    kEntryPointCmdBindIndexBuffer,
+    kEntryPointCmdBindVertexBuffers,
+    kEntryPointCmdDraw,
+    kEntryPointCmdDrawIndexed,
+    kEntryPointCmdDrawIndirect,
+    kEntryPointCmdDrawIndexedIndirect,
+    kEntryPointCmdDispatch,
+    kEntryPointCmdDispatchIndirect,
+    kEntryPointCmdCopyBuffer,
+    kEntryPointCmdCopyImage,
+    kEntryPointCmdBlitImage,
+    kEntryPointCmdCopyBufferToImage,
+    kEntryPointCmdCopyImageToBuffer,
+    kEntryPointCmdUpdateBuffer,
+    kEntryPointCmdFillBuffer,
+    kEntryPointCmdClearColorImage,
+    kEntryPointCmdClearDepthStencilImage,
+    kEntryPointCmdClearAttachments,
+    kEntryPointCmdResolveImage,
+    kEntryPointCmdSetEvent,
+    kEntryPointCmdResetEvent,
+    kEntryPointCmdWaitEvents,
+    kEntryPointCmdPipelineBarrier,
+    kEntryPointCmdBeginQuery,
+    kEntryPointCmdEndQuery,
+    kEntryPointCmdResetQueryPool,
+    kEntryPointCmdWriteTimestamp,
+    kEntryPointCmdCopyQueryPoolResults,
+    kEntryPointCmdPushConstants,
+    kEntryPointCmdBeginRenderPass,
+    kEntryPointCmdNextSubpass,
+    kEntryPointCmdEndRenderPass,
+    kEntryPointCmdExecuteCommands,
+    kEntryPointBindBufferMemory2,
+    kEntryPointBindImageMemory2,
+    kEntryPointGetDeviceGroupPeerMemoryFeatures,
+    kEntryPointCmdSetDeviceMask,
+    kEntryPointCmdDispatchBase,
+    kEntryPointGetImageMemoryRequirements2,
+    kEntryPointGetBufferMemoryRequirements2,
+    kEntryPointGetImageSparseMemoryRequirements2,
+    kEntryPointTrimCommandPool,
+    kEntryPointGetDeviceQueue2,
+    kEntryPointCreateSamplerYcbcrConversion,
+    kEntryPointDestroySamplerYcbcrConversion,
+    kEntryPointCreateDescriptorUpdateTemplate,
+    kEntryPointDestroyDescriptorUpdateTemplate,
+    kEntryPointUpdateDescriptorSetWithTemplate,
+    kEntryPointGetDescriptorSetLayoutSupport,
+    kEntryPointCmdDrawIndirectCount,
+    kEntryPointCmdDrawIndexedIndirectCount,
+    kEntryPointCreateRenderPass2,
+    kEntryPointCmdBeginRenderPass2,
+    kEntryPointCmdNextSubpass2,
+    kEntryPointCmdEndRenderPass2,
+    kEntryPointResetQueryPool,
+    kEntryPointGetSemaphoreCounterValue,
+    kEntryPointWaitSemaphores,
+    kEntryPointSignalSemaphore,
+    kEntryPointGetBufferDeviceAddress,
+    kEntryPointGetBufferOpaqueCaptureAddress,
+    kEntryPointGetDeviceMemoryOpaqueCaptureAddress,
+    kEntryPointCreateSwapchainKHR,
+    kEntryPointDestroySwapchainKHR,
+    kEntryPointGetSwapchainImagesKHR,
+    kEntryPointAcquireNextImageKHR,
+    kEntryPointQueuePresentKHR,
+    kEntryPointGetDeviceGroupPresentCapabilitiesKHR,
+    kEntryPointGetDeviceGroupSurfacePresentModesKHR,
+    kEntryPointAcquireNextImage2KHR,
+    kEntryPointCreateSharedSwapchainsKHR,
+    kEntryPointGetDeviceGroupPeerMemoryFeaturesKHR,
+    kEntryPointCmdSetDeviceMaskKHR,
+    kEntryPointCmdDispatchBaseKHR,
+    kEntryPointTrimCommandPoolKHR,
+    kEntryPointGetMemoryWin32HandleKHR,
+    kEntryPointGetMemoryWin32HandlePropertiesKHR,
+    kEntryPointGetMemoryFdKHR,
+    kEntryPointGetMemoryFdPropertiesKHR,
+    kEntryPointImportSemaphoreWin32HandleKHR,
+    kEntryPointGetSemaphoreWin32HandleKHR,
+    kEntryPointImportSemaphoreFdKHR,
+    kEntryPointGetSemaphoreFdKHR,
+    kEntryPointCmdPushDescriptorSetKHR,
+    kEntryPointCmdPushDescriptorSetWithTemplateKHR,
+    kEntryPointCreateDescriptorUpdateTemplateKHR,
+    kEntryPointDestroyDescriptorUpdateTemplateKHR,
+    kEntryPointUpdateDescriptorSetWithTemplateKHR,
+    kEntryPointCreateRenderPass2KHR,
+    kEntryPointCmdBeginRenderPass2KHR,
+    kEntryPointCmdNextSubpass2KHR,
+    kEntryPointCmdEndRenderPass2KHR,
+    kEntryPointGetSwapchainStatusKHR,
+    kEntryPointImportFenceWin32HandleKHR,
+    kEntryPointGetFenceWin32HandleKHR,
+    kEntryPointImportFenceFdKHR,
+    kEntryPointGetFenceFdKHR,
+    kEntryPointAcquireProfilingLockKHR,
+    kEntryPointReleaseProfilingLockKHR,
+    kEntryPointGetImageMemoryRequirements2KHR,
+    kEntryPointGetBufferMemoryRequirements2KHR,
+    kEntryPointGetImageSparseMemoryRequirements2KHR,
+    kEntryPointCreateSamplerYcbcrConversionKHR,
+    kEntryPointDestroySamplerYcbcrConversionKHR,
+    kEntryPointBindBufferMemory2KHR,
+    kEntryPointBindImageMemory2KHR,
+    kEntryPointGetDescriptorSetLayoutSupportKHR,
+    kEntryPointCmdDrawIndirectCountKHR,
+    kEntryPointCmdDrawIndexedIndirectCountKHR,
+    kEntryPointGetSemaphoreCounterValueKHR,
+    kEntryPointWaitSemaphoresKHR,
+    kEntryPointSignalSemaphoreKHR,
+    kEntryPointGetBufferDeviceAddressKHR,
+    kEntryPointGetBufferOpaqueCaptureAddressKHR,
+    kEntryPointGetDeviceMemoryOpaqueCaptureAddressKHR,
+    kEntryPointGetPipelineExecutablePropertiesKHR,
+    kEntryPointGetPipelineExecutableStatisticsKHR,
+    kEntryPointGetPipelineExecutableInternalRepresentationsKHR,
+    kEntryPointDebugMarkerSetObjectTagEXT,
+    kEntryPointDebugMarkerSetObjectNameEXT,
+    kEntryPointCmdDebugMarkerBeginEXT,
+    kEntryPointCmdDebugMarkerEndEXT,
+    kEntryPointCmdDebugMarkerInsertEXT,
+    kEntryPointCmdBindTransformFeedbackBuffersEXT,
+    kEntryPointCmdBeginTransformFeedbackEXT,
+    kEntryPointCmdEndTransformFeedbackEXT,
+    kEntryPointCmdBeginQueryIndexedEXT,
+    kEntryPointCmdEndQueryIndexedEXT,
+    kEntryPointCmdDrawIndirectByteCountEXT,
+    kEntryPointGetImageViewHandleNVX,
+    kEntryPointCmdDrawIndirectCountAMD,
+    kEntryPointCmdDrawIndexedIndirectCountAMD,
+    kEntryPointGetShaderInfoAMD,
+    kEntryPointGetMemoryWin32HandleNV,
+    kEntryPointCmdBeginConditionalRenderingEXT,
+    kEntryPointCmdEndConditionalRenderingEXT,
+    kEntryPointCmdProcessCommandsNVX,
+    kEntryPointCmdReserveSpaceForCommandsNVX,
+    kEntryPointCreateIndirectCommandsLayoutNVX,
+    kEntryPointDestroyIndirectCommandsLayoutNVX,
+    kEntryPointCreateObjectTableNVX,
+    kEntryPointDestroyObjectTableNVX,
+    kEntryPointRegisterObjectsNVX,
+    kEntryPointUnregisterObjectsNVX,
+    kEntryPointCmdSetViewportWScalingNV,
+    kEntryPointDisplayPowerControlEXT,
+    kEntryPointRegisterDeviceEventEXT,
+    kEntryPointRegisterDisplayEventEXT,
+    kEntryPointGetSwapchainCounterEXT,
+    kEntryPointGetRefreshCycleDurationGOOGLE,
+    kEntryPointGetPastPresentationTimingGOOGLE,
+    kEntryPointCmdSetDiscardRectangleEXT,
+    kEntryPointSetHdrMetadataEXT,
+    kEntryPointSetDebugUtilsObjectNameEXT,
+    kEntryPointSetDebugUtilsObjectTagEXT,
+    kEntryPointQueueBeginDebugUtilsLabelEXT,
+    kEntryPointQueueEndDebugUtilsLabelEXT,
+    kEntryPointQueueInsertDebugUtilsLabelEXT,
+    kEntryPointCmdBeginDebugUtilsLabelEXT,
+    kEntryPointCmdEndDebugUtilsLabelEXT,
+    kEntryPointCmdInsertDebugUtilsLabelEXT,
+    kEntryPointGetAndroidHardwareBufferPropertiesANDROID,
+    kEntryPointGetMemoryAndroidHardwareBufferANDROID,
+    kEntryPointCmdSetSampleLocationsEXT,
+    kEntryPointGetImageDrmFormatModifierPropertiesEXT,
+    kEntryPointCmdBindShadingRateImageNV,
+    kEntryPointCmdSetViewportShadingRatePaletteNV,
+    kEntryPointCmdSetCoarseSampleOrderNV,
+    kEntryPointCreateAccelerationStructureNV,
+    kEntryPointDestroyAccelerationStructureNV,
+    kEntryPointGetAccelerationStructureMemoryRequirementsNV,
+    kEntryPointBindAccelerationStructureMemoryNV,
+    kEntryPointCmdBuildAccelerationStructureNV,
+    kEntryPointCmdCopyAccelerationStructureNV,
+    kEntryPointCmdTraceRaysNV,
+    kEntryPointCreateRayTracingPipelinesNV,
+    kEntryPointGetRayTracingShaderGroupHandlesNV,
+    kEntryPointGetAccelerationStructureHandleNV,
+    kEntryPointCmdWriteAccelerationStructuresPropertiesNV,
+    kEntryPointCompileDeferredNV,
+    kEntryPointGetMemoryHostPointerPropertiesEXT,
+    kEntryPointCmdWriteBufferMarkerAMD,
+    kEntryPointGetCalibratedTimestampsEXT,
+    kEntryPointCmdDrawMeshTasksNV,
+    kEntryPointCmdDrawMeshTasksIndirectNV,
+    kEntryPointCmdDrawMeshTasksIndirectCountNV,
+    kEntryPointCmdSetExclusiveScissorNV,
+    kEntryPointCmdSetCheckpointNV,
+    kEntryPointGetQueueCheckpointDataNV,
+    kEntryPointInitializePerformanceApiINTEL,
+    kEntryPointUninitializePerformanceApiINTEL,
+    kEntryPointCmdSetPerformanceMarkerINTEL,
+    kEntryPointCmdSetPerformanceStreamMarkerINTEL,
+    kEntryPointCmdSetPerformanceOverrideINTEL,
+    kEntryPointAcquirePerformanceConfigurationINTEL,
+    kEntryPointReleasePerformanceConfigurationINTEL,
+    kEntryPointQueueSetPerformanceConfigurationINTEL,
+    kEntryPointGetPerformanceParameterINTEL,
+    kEntryPointSetLocalDimmingAMD,
+    kEntryPointGetBufferDeviceAddressEXT,
+    kEntryPointAcquireFullScreenExclusiveModeEXT,
+    kEntryPointReleaseFullScreenExclusiveModeEXT,
+    kEntryPointGetDeviceGroupSurfacePresentModes2EXT,
+    kEntryPointCmdSetLineStippleEXT,
+    kEntryPointResetQueryPoolEXT,
+    kEntryPointCount,
+};
 
 // Layer object type identifiers
 enum LayerObjectTypeId {
@@ -2543,6 +2840,8 @@ typedef enum ValidationCheckDisables {
 typedef enum ValidationCheckEnables {
     VALIDATION_CHECK_ENABLE_VENDOR_SPECIFIC_ARM,
     VALIDATION_CHECK_ENABLE_VENDOR_SPECIFIC_ALL,
+    VALIDATION_CHECK_ENABLE_UNIFIED_HANDLE_REGISTRY,
+    VALIDATION_CHECK_ENABLE_ENTRY_POINT_COSTS,
 } ValidationCheckEnables;
 
 // CHECK_DISABLED struct is a container for bools that can block validation checks from being performed.
@@ -2570,6 +2869,8 @@ struct CHECK_ENABLED {
     bool gpu_validation;
     bool gpu_validation_reserve_binding_slot;
     bool best_practices;
+    bool unified_handle_registry;                   // Share one per-handle table between the device's validation objects
+    bool entry_point_costs;                         // Count calls and time spent per entry point and validation object
     bool vendor_specific_arm;                       // Vendor-specific validation for Arm platforms
 
     void SetAllVendorSpecific(bool value) { std::fill(&vendor_specific_arm, &vendor_specific_arm + 1, value); }
@@ -2599,6 +2900,14 @@ class ValidationObject {
 
         std::string layer_name = "CHASSIS";
 
+        // The device's shared per-handle table, owned by the device's chassis object
+        std::unique_ptr<HandleRegistry> handle_registry;
+        // Called at CreateDevice time, before any handle of the device exists, for validation objects that keep their
+        // per-handle data in the registry
+        virtual void AttachHandleRegistry(HandleRegistry *registry) {};
+        // The device's entry point call counts and timings, owned by the device's chassis object
+        std::unique_ptr<EntryPointCosts> entry_point_costs;
+
         // Constructor
         ValidationObject(){};
         // Destructor
@@ -2627,8 +2936,7 @@ class ValidationObject {
 
             std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
             // Avoid logging cost if msg is to be ignored
-            if (!(report_data->active_severities & VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT) ||
-                !(report_data->active_types & VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT)) {
+            if (!LogMsgEnabled(report_data, vuid_text, VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT, VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT)) {
                 return false;
             }
             va_list argptr;
@@ -2647,8 +2955,7 @@ class ValidationObject {
         bool LogWarning(HANDLE_T src_object, const std::string &vuid_text, const char *format, ...) const {
             std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
             // Avoid logging cost if msg is to be ignored
-            if (!(report_data->active_severities & VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT) ||
-                !(report_data->active_types & VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT)) {
+            if (!LogMsgEnabled(report_data, vuid_text, VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT, VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT)) {
                 return false;
             }
             va_list argptr;
@@ -2667,8 +2974,7 @@ class ValidationObject {
         bool LogPerformanceWarning(HANDLE_T src_object, const std::string &vuid_text, const char *format, ...) const {
             std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
             // Avoid logging cost if msg is to be ignored
-            if (!(report_data->active_severities & VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT) ||
-                !(report_data->active_types & VK_DEBUG_UTILS_MESSAGE_TYPE_PERFORMANCE_BIT_EXT)) {
+            if (!LogMsgEnabled(report_data, vuid_text, VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT, VK_DEBUG_UTILS_MESSAGE_TYPE_PERFORMANCE_BIT_EXT)) {
                 return false;
             }
             va_list argptr;
@@ -2687,8 +2993,7 @@ class ValidationObject {
         bool LogInfo(HANDLE_T src_object, const std::string &vuid_text, const char *format, ...) const {
             std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
             // Avoid logging cost if msg is to be ignored
-            if (!(report_data->active_severities & VK_DEBUG_UTILS_MESSAGE_SEVERITY_INFO_BIT_EXT) ||
-                !(report_data->active_types & VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT)) {
+            if (!LogMsgEnabled(report_data, vuid_text, VK_DEBUG_UTILS_MESSAGE_SEVERITY_INFO_BIT_EXT, VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT)) {
                 return false;
             }
             va_list argptr;
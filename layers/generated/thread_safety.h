@@ -26,6 +26,7 @@
 
 #include <atomic>
 #include <chrono>
+#include <condition_variable>
 #include <mutex>
 #include <string>
 #include <thread>
@@ -77,7 +78,7 @@ public:
         int64_t count;
     };
 
-    ObjectUseData() : thread(0), writer_reader_count(0) {
+    ObjectUseData() : thread(0), writer_reader_count(0), waiters(0) {
         // silence -Wunused-private-field warning
         padding[0] = 0;
     }
@@ -92,10 +93,13 @@ public:
     }
     WriteReadCount RemoveWriter() {
         int64_t prev = writer_reader_count.fetch_add(-(1LL << 32));
+        // Waiting readers only need the writers gone
+        if (WriteReadCount(prev - (1LL << 32)).GetWriteCount() == 0) WakeWaiters();
         return WriteReadCount(prev);
     }
     WriteReadCount RemoveReader() {
         int64_t prev = writer_reader_count.fetch_add(-1LL);
+        if (prev == 1LL) WakeWaiters();
         return WriteReadCount(prev);
     }
     WriteReadCount GetCount() {
@@ -104,20 +108,74 @@ public:
 
     void WaitForObjectIdle(bool is_writer)  {
         // Wait for thread-safe access to object instead of skipping call.
-        while (GetCount().GetReadCount() > (int)(!is_writer) || GetCount().GetWriteCount() > (int)is_writer) {
-            std::this_thread::sleep_for(std::chrono::microseconds(1));
+        // The caller's own use is dropped while it waits, so that two colliding threads never wait on each other, and taken
+        // again once the object is idle.
+        for (;;) {
+            if (is_writer) {
+                RemoveWriter();
+            } else {
+                RemoveReader();
+            }
+            WaitForOtherUsers(is_writer);
+            if (IsIdle(is_writer ? AddWriter() : AddReader(), is_writer)) return;
         }
     }
 
     std::atomic<loader_platform_thread_id> thread;
 
 private:
+    static const int kWaitSpinCount = 64;
+    static const int kParkingSlots = 64;
+
+    // Parked waiters share a fixed set of slots hashed by object, so that objects don't each carry a mutex
+    struct ParkingSlot {
+        std::mutex mutex;
+        std::condition_variable idle;
+    };
+    static ParkingSlot &GetParkingSlot(const ObjectUseData *use_data) {
+        static ParkingSlot slots[kParkingSlots];
+        return slots[(reinterpret_cast<uintptr_t>(use_data) / sizeof(ObjectUseData)) % kParkingSlots];
+    }
+
+    // count excludes the caller's own use
+    static bool IsIdle(const WriteReadCount &count, bool is_writer) {
+        return count.GetWriteCount() == 0 && (!is_writer || count.GetReadCount() == 0);
+    }
+
+    // Most collisions clear quickly, so spin briefly before parking the thread until the other users are done
+    void WaitForOtherUsers(bool is_writer) {
+        for (int spin = 0; spin < kWaitSpinCount; ++spin) {
+            if (IsIdle(GetCount(), is_writer)) return;
+            std::this_thread::yield();
+        }
+        waiters.fetch_add(1);
+        ParkingSlot &slot = GetParkingSlot(this);
+        {
+            std::unique_lock<std::mutex> lock(slot.mutex);
+            slot.idle.wait(lock, [this, is_writer]() { return IsIdle(GetCount(), is_writer); });
+        }
+        waiters.fetch_sub(1);
+    }
+
+    void WakeWaiters() {
+        if (waiters.load() == 0) return;
+        ParkingSlot &slot = GetParkingSlot(this);
+        {
+            // Taking the lock orders this wake up after a waiter that has checked IsIdle() but not yet gone to sleep
+            std::lock_guard<std::mutex> lock(slot.mutex);
+        }
+        slot.idle.notify_all();
+    }
+
     // need to update write and read counts atomically. Writer in high
     // 32 bits, reader in low 32 bits.
     std::atomic<int64_t> writer_reader_count;
+    // Number of threads parked in WaitForObjectIdle()
+    std::atomic<int32_t> waiters;
 
     // Put each lock on its own cache line to avoid false cache line sharing.
-    char padding[(-int(sizeof(std::atomic<loader_platform_thread_id>) + sizeof(std::atomic<int64_t>))) & 63];
+    char padding[(-int(sizeof(std::atomic<loader_platform_thread_id>) + sizeof(std::atomic<int64_t>) +
+                       sizeof(std::atomic<int32_t>))) & 63];
 };
 
 
@@ -128,7 +186,11 @@ public:
     VulkanObjectType object_type;
     ValidationObject *object_data;
 
-    vl_concurrent_unordered_map<T, std::shared_ptr<ObjectUseData>, 6> object_table;
+    HandleRegistryMap<T, ObjectUseData, 6> object_table;
+
+    void AttachHandleRegistry(HandleRegistry *registry) {
+        object_table.Attach(registry, object_type, &HandleRegistrySlot::thread_safety);
+    }
 
     void CreateObject(T object) {
         object_table.insert_or_assign(object, std::make_shared<ObjectUseData>());
@@ -415,6 +477,44 @@ public:
 #endif  // DISTINCT_NONDISPATCHABLE_HANDLES
               {};
 
+    // Command pool contents stay in their own table, their counts would share a slot with the command pool's
+    void AttachHandleRegistry(HandleRegistry *registry) override {
+        c_VkCommandBuffer.AttachHandleRegistry(registry);
+        c_VkQueue.AttachHandleRegistry(registry);
+#ifdef DISTINCT_NONDISPATCHABLE_HANDLES
+        c_VkAccelerationStructureNV.AttachHandleRegistry(registry);
+        c_VkBuffer.AttachHandleRegistry(registry);
+        c_VkBufferView.AttachHandleRegistry(registry);
+        c_VkCommandPool.AttachHandleRegistry(registry);
+        c_VkDescriptorPool.AttachHandleRegistry(registry);
+        c_VkDescriptorSet.AttachHandleRegistry(registry);
+        c_VkDescriptorSetLayout.AttachHandleRegistry(registry);
+        c_VkDescriptorUpdateTemplate.AttachHandleRegistry(registry);
+        c_VkDeviceMemory.AttachHandleRegistry(registry);
+        c_VkDisplayKHR.AttachHandleRegistry(registry);
+        c_VkDisplayModeKHR.AttachHandleRegistry(registry);
+        c_VkEvent.AttachHandleRegistry(registry);
+        c_VkFence.AttachHandleRegistry(registry);
+        c_VkFramebuffer.AttachHandleRegistry(registry);
+        c_VkImage.AttachHandleRegistry(registry);
+        c_VkImageView.AttachHandleRegistry(registry);
+        c_VkIndirectCommandsLayoutNVX.AttachHandleRegistry(registry);
+        c_VkObjectTableNVX.AttachHandleRegistry(registry);
+        c_VkPerformanceConfigurationINTEL.AttachHandleRegistry(registry);
+        c_VkPipeline.AttachHandleRegistry(registry);
+        c_VkPipelineCache.AttachHandleRegistry(registry);
+        c_VkPipelineLayout.AttachHandleRegistry(registry);
+        c_VkQueryPool.AttachHandleRegistry(registry);
+        c_VkRenderPass.AttachHandleRegistry(registry);
+        c_VkSampler.AttachHandleRegistry(registry);
+        c_VkSamplerYcbcrConversion.AttachHandleRegistry(registry);
+        c_VkSemaphore.AttachHandleRegistry(registry);
+        c_VkShaderModule.AttachHandleRegistry(registry);
+        c_VkSwapchainKHR.AttachHandleRegistry(registry);
+        c_VkValidationCacheEXT.AttachHandleRegistry(registry);
+#endif  // DISTINCT_NONDISPATCHABLE_HANDLES
+    }
+
 #define WRAPPER(type)                                                \
     void StartWriteObject(type object, const char *api_name) {       \
         c_##type.StartWrite(object, api_name);                       \
@@ -219,9 +219,24 @@ VkResult GpuAssistedDescriptorSetManager::GetDescriptorSets(uint32_t count, VkDe
     desc_sets->clear();
     desc_sets->resize(count);
 
-    for (auto &pool : desc_pool_map_) {
-        if (pool.second.used + count < pool.second.size) {
-            pool_to_use = pool.first;
+    // Prefer recycled sets, which need neither an allocation nor, usually, a descriptor write
+    for (auto &pool_entry : desc_pool_map_) {
+        auto &free_sets = pool_entry.second.free_sets;
+        if (free_sets.size() >= count) {
+            std::copy(free_sets.end() - count, free_sets.end(), desc_sets->begin());
+            free_sets.resize(free_sets.size() - count);
+            pool_entry.second.used += count;
+            stats_.set_hits += count;
+            *pool = pool_entry.first;
+            return result;
+        }
+    }
+
+    // Sets on a free list still occupy their pool, so only never-allocated slots count as available here
+    for (auto &pool_entry : desc_pool_map_) {
+        const auto &tracker = pool_entry.second;
+        if (tracker.used + static_cast<uint32_t>(tracker.free_sets.size()) + count < tracker.size) {
+            pool_to_use = pool_entry.first;
             break;
         }
     }
@@ -237,7 +252,7 @@ VkResult GpuAssistedDescriptorSetManager::GetDescriptorSets(uint32_t count, VkDe
         VkDescriptorPoolCreateInfo desc_pool_info = {};
         desc_pool_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
         desc_pool_info.pNext = NULL;
-        desc_pool_info.flags = VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT;
+        desc_pool_info.flags = 0;
         desc_pool_info.maxSets = pool_count;
         desc_pool_info.poolSizeCount = 1;
         desc_pool_info.pPoolSizes = &size_counts;
@@ -248,6 +263,7 @@ VkResult GpuAssistedDescriptorSetManager::GetDescriptorSets(uint32_t count, VkDe
         }
         desc_pool_map_[pool_to_use].size = desc_pool_info.maxSets;
         desc_pool_map_[pool_to_use].used = 0;
+        stats_.pools_created++;
     }
     std::vector<VkDescriptorSetLayout> desc_layouts(count, dev_data_->debug_desc_layout);
 
@@ -261,24 +277,149 @@ VkResult GpuAssistedDescriptorSetManager::GetDescriptorSets(uint32_t count, VkDe
     }
     *pool = pool_to_use;
     desc_pool_map_[pool_to_use].used += count;
+    stats_.set_misses += count;
     return result;
 }
 
 void GpuAssistedDescriptorSetManager::PutBackDescriptorSet(VkDescriptorPool desc_pool, VkDescriptorSet desc_set) {
     auto iter = desc_pool_map_.find(desc_pool);
     if (iter != desc_pool_map_.end()) {
-        VkResult result = DispatchFreeDescriptorSets(dev_data_->device, desc_pool, 1, &desc_set);
-        assert(result == VK_SUCCESS);
-        if (result != VK_SUCCESS) {
-            return;
+        iter->second.used--;
+        iter->second.free_sets.push_back(desc_set);
+    }
+    return;
+}
+
+void GpuAssistedDescriptorSetManager::UpdateBufferDescriptors(uint32_t write_count, const VkWriteDescriptorSet *writes) {
+    std::vector<VkWriteDescriptorSet> needed_writes;
+    needed_writes.reserve(write_count);
+    for (uint32_t i = 0; i < write_count; ++i) {
+        const auto &write = writes[i];
+        assert(write.descriptorCount == 1 && write.dstArrayElement == 0 && write.pBufferInfo);
+        auto &written = written_buffers_[write.dstSet];
+        if (written.size() <= write.dstBinding) {
+            written.resize(write.dstBinding + 1, VkDescriptorBufferInfo{VK_NULL_HANDLE, 0, 0});
         }
-        desc_pool_map_[desc_pool].used--;
-        if (0 == desc_pool_map_[desc_pool].used) {
-            DispatchDestroyDescriptorPool(dev_data_->device, desc_pool, NULL);
-            desc_pool_map_.erase(desc_pool);
+        auto &current = written[write.dstBinding];
+        const auto &requested = *write.pBufferInfo;
+        if (current.buffer == requested.buffer && current.offset == requested.offset && current.range == requested.range) {
+            stats_.writes_skipped++;
+            continue;
         }
+        current = requested;
+        needed_writes.push_back(write);
     }
-    return;
+    if (!needed_writes.empty()) {
+        stats_.writes_issued += needed_writes.size();
+        DispatchUpdateDescriptorSets(dev_data_->device, static_cast<uint32_t>(needed_writes.size()), needed_writes.data(), 0,
+                                     nullptr);
+    }
+}
+
+// Implementation for Memory Block Allocator class
+GpuAssistedMemoryBlockAllocator::GpuAssistedMemoryBlockAllocator(VmaAllocator allocator, VmaMemoryUsage usage,
+                                                                 VkDeviceSize alignment)
+    : allocator_(allocator), usage_(usage), alignment_(alignment ? alignment : 1) {}
+
+GpuAssistedMemoryBlockAllocator::~GpuAssistedMemoryBlockAllocator() {
+    for (auto &entry : chunks_in_use_) {
+        for (auto &chunk : entry.second) {
+            DestroyChunk(chunk);
+        }
+    }
+    chunks_in_use_.clear();
+    for (auto &chunk : free_chunks_) {
+        DestroyChunk(chunk);
+    }
+    free_chunks_.clear();
+}
+
+VkResult GpuAssistedMemoryBlockAllocator::CreateChunk(VkDeviceSize size, Chunk *chunk) {
+    VkBufferCreateInfo buffer_info = {VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO};
+    buffer_info.size = size;
+    buffer_info.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+    VmaAllocationCreateInfo alloc_create_info = {};
+    alloc_create_info.flags = VMA_ALLOCATION_CREATE_MAPPED_BIT;
+    alloc_create_info.usage = usage_;
+    VmaAllocationInfo alloc_info = {};
+    VkResult result =
+        vmaCreateBuffer(allocator_, &buffer_info, &alloc_create_info, &chunk->buffer, &chunk->allocation, &alloc_info);
+    if (result != VK_SUCCESS) {
+        return result;
+    }
+    if (!alloc_info.pMappedData) {
+        vmaDestroyBuffer(allocator_, chunk->buffer, chunk->allocation);
+        return VK_ERROR_MEMORY_MAP_FAILED;
+    }
+    chunk->data = static_cast<uint8_t *>(alloc_info.pMappedData);
+    chunk->size = size;
+    chunk->used = 0;
+    // Fresh memory has undefined contents; every block must start out zeroed
+    memset(chunk->data, 0, static_cast<size_t>(size));
+    vmaFlushAllocation(allocator_, chunk->allocation, 0, size);
+    return VK_SUCCESS;
+}
+
+void GpuAssistedMemoryBlockAllocator::DestroyChunk(const Chunk &chunk) {
+    vmaDestroyBuffer(allocator_, chunk.buffer, chunk.allocation);
+}
+
+VkResult GpuAssistedMemoryBlockAllocator::GetBlock(VkCommandBuffer command_buffer, VkDeviceSize size,
+                                                   GpuAssistedDeviceMemoryBlock *block) {
+    auto &chunks = chunks_in_use_[command_buffer];
+    VkDeviceSize offset = 0;
+    if (!chunks.empty()) {
+        offset = ((chunks.back().used + alignment_ - 1) / alignment_) * alignment_;
+    }
+    if (chunks.empty() || offset + size > chunks.back().size) {
+        // Oversized requests get a chunk of their own, which is recycled like any other once the command buffer is reset
+        VkDeviceSize chunk_size = kChunkSize;
+        if (size > chunk_size) chunk_size = size;
+        auto free_chunk = free_chunks_.end();
+        for (auto it = free_chunks_.begin(); it != free_chunks_.end(); ++it) {
+            if (it->size >= chunk_size) {
+                free_chunk = it;
+                break;
+            }
+        }
+        Chunk chunk = {};
+        if (free_chunk != free_chunks_.end()) {
+            chunk = *free_chunk;
+            *free_chunk = free_chunks_.back();
+            free_chunks_.pop_back();
+        } else {
+            VkResult result = CreateChunk(chunk_size, &chunk);
+            if (result != VK_SUCCESS) {
+                return result;
+            }
+        }
+        chunks.push_back(chunk);
+        offset = 0;
+    }
+
+    auto &chunk = chunks.back();
+    chunk.used = offset + size;
+    block->buffer = chunk.buffer;
+    block->allocation = chunk.allocation;
+    block->offset = offset;
+    block->size = size;
+    block->data = chunk.data + offset;
+    return VK_SUCCESS;
+}
+
+void GpuAssistedMemoryBlockAllocator::PutBackBlocks(VkCommandBuffer command_buffer) {
+    auto iter = chunks_in_use_.find(command_buffer);
+    if (iter == chunks_in_use_.end()) {
+        return;
+    }
+    // The command buffer is no longer pending, so the GPU is done with these chunks.  Only the used prefix can be dirty.
+    for (auto &chunk : iter->second) {
+        memset(chunk.data, 0, static_cast<size_t>(chunk.used));
+        vmaFlushAllocation(allocator_, chunk.allocation, 0, chunk.used);
+        chunk.used = 0;
+        free_chunks_.push_back(chunk);
+    }
+    chunks_in_use_.erase(iter);
 }
 
 // Trampolines to make VMA call Dispatch for Vulkan calls
@@ -479,6 +620,13 @@ void GpuAssisted::PostCallRecordCreateDevice(VkPhysicalDevice physicalDevice, co
     VkResult result1 = InitializeVma(physicalDevice, *pDevice, &device_gpu_assisted->vmaAllocator);
     assert(result1 == VK_SUCCESS);
     std::unique_ptr<GpuAssistedDescriptorSetManager> desc_set_manager(new GpuAssistedDescriptorSetManager(device_gpu_assisted));
+    // Blocks are bound as storage buffers at their offset, and are flushed and invalidated individually
+    const auto &limits = device_gpu_assisted->phys_dev_props.limits;
+    const VkDeviceSize block_alignment = std::max(limits.minStorageBufferOffsetAlignment, limits.nonCoherentAtomSize);
+    device_gpu_assisted->output_block_allocator.reset(
+        new GpuAssistedMemoryBlockAllocator(device_gpu_assisted->vmaAllocator, VMA_MEMORY_USAGE_GPU_TO_CPU, block_alignment));
+    device_gpu_assisted->input_block_allocator.reset(
+        new GpuAssistedMemoryBlockAllocator(device_gpu_assisted->vmaAllocator, VMA_MEMORY_USAGE_CPU_TO_GPU, block_alignment));
 
     // The descriptor indexing checks require only the first "output" binding.
     const VkDescriptorSetLayoutBinding debug_desc_layout_bindings[kNumBindingsInSet] = {
@@ -583,7 +731,16 @@ void GpuAssisted::PreCallRecordDestroyDevice(VkDevice device, const VkAllocation
         DispatchDestroyDescriptorSetLayout(device, dummy_desc_layout, NULL);
         dummy_desc_layout = VK_NULL_HANDLE;
     }
+    if (desc_set_manager) {
+        const auto &stats = desc_set_manager->GetStats();
+        LogInfo(device, "UNASSIGNED-GPU-Assisted Validation. ",
+                "Descriptor sets: %" PRIu64 " reused, %" PRIu64 " allocated in %" PRIu64
+                " pools.  Buffer descriptor writes: %" PRIu64 " issued, %" PRIu64 " skipped.",
+                stats.set_hits, stats.set_misses, stats.pools_created, stats.writes_issued, stats.writes_skipped);
+    }
     desc_set_manager.reset();
+    output_block_allocator.reset();
+    input_block_allocator.reset();
 
     DestroyAccelerationStructureBuildValidationState();
 
@@ -989,7 +1146,7 @@ struct GPUAV_RESTORABLE_PIPELINE_STATE {
     void Create(CMD_BUFFER_STATE *cb_state, VkPipelineBindPoint bind_point) {
         pipeline_bind_point = bind_point;
 
-        LAST_BOUND_STATE &last_bound = cb_state->lastBound[bind_point];
+        LAST_BOUND_STATE &last_bound = cb_state->lastBound[ConvertToLvlBindPoint(bind_point)];
         if (last_bound.pipeline_state) {
             pipeline = last_bound.pipeline_state->pipeline;
             pipeline_layout = last_bound.pipeline_layout;
@@ -1168,7 +1325,7 @@ void GpuAssisted::PreCallRecordCmdBuildAccelerationStructureNV(VkCommandBuffer c
     descriptor_set_writes[1].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
     descriptor_set_writes[1].pBufferInfo = &descriptor_buffer_infos[1];
 
-    DispatchUpdateDescriptorSets(device, 2, descriptor_set_writes, 0, nullptr);
+    desc_set_manager->UpdateBufferDescriptors(2, descriptor_set_writes);
 
     // Issue a memory barrier to make sure anything writing to the instance buffer has finished.
     VkMemoryBarrier memory_barrier = {};
@@ -1296,25 +1453,21 @@ void GpuAssisted::PostCallRecordCreatePipelineLayout(VkDevice device, const VkPi
     }
 }
 
-// Free the device memory and descriptor set associated with a command buffer.
+// Recycle the device memory and free the descriptor sets associated with a command buffer.
 void GpuAssisted::ResetCommandBuffer(VkCommandBuffer commandBuffer) {
     if (aborted) {
         return;
     }
-    auto gpuav_buffer_list = GetGpuAssistedBufferInfo(commandBuffer);
-    for (auto buffer_info : gpuav_buffer_list) {
-        vmaDestroyBuffer(vmaAllocator, buffer_info.output_mem_block.buffer, buffer_info.output_mem_block.allocation);
-        if (buffer_info.di_input_mem_block.buffer) {
-            vmaDestroyBuffer(vmaAllocator, buffer_info.di_input_mem_block.buffer, buffer_info.di_input_mem_block.allocation);
-        }
-        if (buffer_info.bda_input_mem_block.buffer) {
-            vmaDestroyBuffer(vmaAllocator, buffer_info.bda_input_mem_block.buffer, buffer_info.bda_input_mem_block.allocation);
-        }
+    auto &gpuav_buffer_list = GetGpuAssistedBufferInfo(commandBuffer);
+    for (auto &buffer_info : gpuav_buffer_list) {
         if (buffer_info.desc_set != VK_NULL_HANDLE) {
             desc_set_manager->PutBackDescriptorSet(buffer_info.desc_pool, buffer_info.desc_set);
         }
     }
     command_buffer_map.erase(commandBuffer);
+    di_pending_updates.erase(commandBuffer);
+    output_block_allocator->PutBackBlocks(commandBuffer);
+    input_block_allocator->PutBackBlocks(commandBuffer);
 
     auto &as_validation_info = acceleration_structure_validation_state;
     auto &as_validation_buffer_infos = as_validation_info.validation_buffers[commandBuffer];
@@ -2066,34 +2219,34 @@ void GpuAssisted::AnalyzeAndReportError(CMD_BUFFER_STATE *cb_node, VkQueue queue
     memset(debug_output_buffer, 0, sizeof(uint32_t) * words_to_clear);
 }
 
-// For the given command buffer, map its debug data buffers and read their contents for analysis.
+// For the given command buffer, read the contents of its debug data buffers for analysis.
 void GpuAssisted::ProcessInstrumentationBuffer(VkQueue queue, CMD_BUFFER_STATE *cb_node) {
     if (cb_node && (cb_node->hasDrawCmd || cb_node->hasTraceRaysCmd || cb_node->hasDispatchCmd)) {
-        auto gpu_buffer_list = GetGpuAssistedBufferInfo(cb_node->commandBuffer);
+        auto &gpu_buffer_list = GetGpuAssistedBufferInfo(cb_node->commandBuffer);
         uint32_t draw_index = 0;
         uint32_t compute_index = 0;
         uint32_t ray_trace_index = 0;
 
         for (auto &buffer_info : gpu_buffer_list) {
-            char *pData;
-            VkResult result = vmaMapMemory(vmaAllocator, buffer_info.output_mem_block.allocation, (void **)&pData);
+            const auto &output_block = buffer_info.output_mem_block;
             // Analyze debug output buffer
-            if (result == VK_SUCCESS) {
-                uint32_t operation_index = 0;
-                if (buffer_info.pipeline_bind_point == VK_PIPELINE_BIND_POINT_GRAPHICS) {
-                    operation_index = draw_index;
-                } else if (buffer_info.pipeline_bind_point == VK_PIPELINE_BIND_POINT_COMPUTE) {
-                    operation_index = compute_index;
-                } else if (buffer_info.pipeline_bind_point == VK_PIPELINE_BIND_POINT_RAY_TRACING_NV) {
-                    operation_index = ray_trace_index;
-                } else {
-                    assert(false);
-                }
-
-                AnalyzeAndReportError(cb_node, queue, buffer_info.pipeline_bind_point, operation_index, (uint32_t *)pData);
-                vmaUnmapMemory(vmaAllocator, buffer_info.output_mem_block.allocation);
+            vmaInvalidateAllocation(vmaAllocator, output_block.allocation, output_block.offset, output_block.size);
+            uint32_t operation_index = 0;
+            if (buffer_info.pipeline_bind_point == VK_PIPELINE_BIND_POINT_GRAPHICS) {
+                operation_index = draw_index;
+            } else if (buffer_info.pipeline_bind_point == VK_PIPELINE_BIND_POINT_COMPUTE) {
+                operation_index = compute_index;
+            } else if (buffer_info.pipeline_bind_point == VK_PIPELINE_BIND_POINT_RAY_TRACING_NV) {
+                operation_index = ray_trace_index;
+            } else {
+                assert(false);
             }
 
+            AnalyzeAndReportError(cb_node, queue, buffer_info.pipeline_bind_point, operation_index,
+                                  reinterpret_cast<uint32_t *>(output_block.data));
+            // Make the cleared record visible to the GPU in case the command buffer is submitted again
+            vmaFlushAllocation(vmaAllocator, output_block.allocation, output_block.offset, output_block.size);
+
             if (buffer_info.pipeline_bind_point == VK_PIPELINE_BIND_POINT_GRAPHICS) {
                 draw_index++;
             } else if (buffer_info.pipeline_bind_point == VK_PIPELINE_BIND_POINT_COMPUTE) {
@@ -2107,20 +2260,46 @@ void GpuAssisted::ProcessInstrumentationBuffer(VkQueue queue, CMD_BUFFER_STATE *
     }
 }
 
-// For the given command buffer, map its debug data buffers and update the status of any update after bind descriptors
+// For the given command buffer, mark the update after bind descriptors that have been written since the last submit in its
+// input buffers.  A written descriptor cannot become unwritten without invalidating the command buffer, so marked words are
+// dropped from the pending lists and a command buffer that is resubmitted unchanged has nothing left to do here.
 void GpuAssisted::UpdateInstrumentationBuffer(CMD_BUFFER_STATE *cb_node) {
-    auto gpu_buffer_list = GetGpuAssistedBufferInfo(cb_node->commandBuffer);
-    uint32_t *pData;
-    for (auto &buffer_info : gpu_buffer_list) {
-        if (buffer_info.di_input_mem_block.update_at_submit.size() > 0) {
-            VkResult result = vmaMapMemory(vmaAllocator, buffer_info.di_input_mem_block.allocation, (void **)&pData);
-            if (result == VK_SUCCESS) {
-                for (auto update : buffer_info.di_input_mem_block.update_at_submit) {
-                    if (update.second->updated) pData[update.first] = 1;
-                }
-                vmaUnmapMemory(vmaAllocator, buffer_info.di_input_mem_block.allocation);
+    auto pending = di_pending_updates.find(cb_node->commandBuffer);
+    if (pending == di_pending_updates.end()) {
+        return;
+    }
+    auto &gpu_buffer_list = GetGpuAssistedBufferInfo(cb_node->commandBuffer);
+    auto &pending_indices = pending->second;
+    size_t pending_count = 0;
+    for (size_t buffer_index : pending_indices) {
+        auto &di_input_block = gpu_buffer_list[buffer_index].di_input_mem_block;
+        auto &updates = di_input_block.update_at_submit;
+        uint32_t *pData = reinterpret_cast<uint32_t *>(di_input_block.data);
+        uint32_t first_dirty = UINT32_MAX;
+        uint32_t last_dirty = 0;
+        size_t remaining = 0;
+        for (size_t i = 0; i < updates.size(); ++i) {
+            const uint32_t word = updates[i].word;
+            if (updates[i].set->GetDescriptorFromGlobalIndex(updates[i].global_index)->updated) {
+                pData[word] = 1;
+                first_dirty = std::min(first_dirty, word);
+                last_dirty = std::max(last_dirty, word);
+            } else {
+                updates[remaining++] = updates[i];
             }
         }
+        updates.resize(remaining);
+        if (first_dirty <= last_dirty) {
+            vmaFlushAllocation(vmaAllocator, di_input_block.allocation, di_input_block.offset + first_dirty * sizeof(uint32_t),
+                               (last_dirty - first_dirty + 1) * sizeof(uint32_t));
+        }
+        if (remaining) {
+            pending_indices[pending_count++] = buffer_index;
+        }
+    }
+    pending_indices.resize(pending_count);
+    if (pending_indices.empty()) {
+        di_pending_updates.erase(pending);
     }
 }
 
@@ -2326,34 +2505,22 @@ void GpuAssisted::AllocateValidationResources(const VkCommandBuffer cmd_buffer,
         return;
     }
 
-    // Allocate memory for the output block that the gpu will use to return any error information
+    // Allocate memory for the output block that the gpu will use to return any error information.  Blocks come back
+    // zeroed, so only error information from the gpu will be present.
     GpuAssistedDeviceMemoryBlock output_block = {};
-    VkBufferCreateInfo bufferInfo = {VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO};
-    bufferInfo.size = output_buffer_size;
-    bufferInfo.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
-    VmaAllocationCreateInfo allocInfo = {};
-    allocInfo.usage = VMA_MEMORY_USAGE_GPU_TO_CPU;
-    result = vmaCreateBuffer(vmaAllocator, &bufferInfo, &allocInfo, &output_block.buffer, &output_block.allocation, nullptr);
+    result = output_block_allocator->GetBlock(cmd_buffer, output_buffer_size, &output_block);
     if (result != VK_SUCCESS) {
         ReportSetupProblem(device, "Unable to allocate device memory.  Device could become unstable.");
         aborted = true;
         return;
     }
 
-    // Clear the output block to zeros so that only error information from the gpu will be present
-    uint32_t *pData;
-    result = vmaMapMemory(vmaAllocator, output_block.allocation, (void **)&pData);
-    if (result == VK_SUCCESS) {
-        memset(pData, 0, output_buffer_size);
-        vmaUnmapMemory(vmaAllocator, output_block.allocation);
-    }
-
     GpuAssistedDeviceMemoryBlock di_input_block = {}, bda_input_block = {};
     VkDescriptorBufferInfo di_input_desc_buffer_info = {};
     VkDescriptorBufferInfo bda_input_desc_buffer_info = {};
     VkWriteDescriptorSet desc_writes[3] = {};
     uint32_t desc_count = 1;
-    auto const &state = cb_node->lastBound[bind_point];
+    auto const &state = cb_node->lastBound[ConvertToLvlBindPoint(bind_point)];
     uint32_t number_of_sets = (uint32_t)state.per_set.size();
 
     // Figure out how much memory we need for the input block based on how many sets and bindings there are
@@ -2389,10 +2556,7 @@ void GpuAssisted::AllocateValidationResources(const VkCommandBuffer cmd_buffer,
         // see if descriptors have been written. In gpu_validation.md, we note this and advise
         // using densely packed bindings as a best practice when using gpu-av with descriptor indexing
         uint32_t words_needed = 1 + (number_of_sets * 2) + (binding_count * 2) + descriptor_count;
-        allocInfo.usage = VMA_MEMORY_USAGE_CPU_TO_GPU;
-        bufferInfo.size = words_needed * 4;
-        result =
-            vmaCreateBuffer(vmaAllocator, &bufferInfo, &allocInfo, &di_input_block.buffer, &di_input_block.allocation, nullptr);
+        result = input_block_allocator->GetBlock(cmd_buffer, words_needed * 4, &di_input_block);
         if (result != VK_SUCCESS) {
             ReportSetupProblem(device, "Unable to allocate device memory.  Device could become unstable.");
             aborted = true;
@@ -2402,8 +2566,7 @@ void GpuAssisted::AllocateValidationResources(const VkCommandBuffer cmd_buffer,
         // Populate input buffer first with the sizes of every descriptor in every set, then with whether
         // each element of each descriptor has been written or not.  See gpu_validation.md for a more thourough
         // outline of the input buffer format
-        result = vmaMapMemory(vmaAllocator, di_input_block.allocation, (void **)&pData);
-        memset(pData, 0, static_cast<size_t>(bufferInfo.size));
+        uint32_t *pData = reinterpret_cast<uint32_t *>(di_input_block.data);
         // Pointer to a sets array that points into the sizes array
         uint32_t *sets_to_sizes = pData + 1;
         // Pointer to the sizes array that contains the array size of the descriptor at each binding
@@ -2456,7 +2619,7 @@ void GpuAssisted::AllocateValidationResources(const VkCommandBuffer cmd_buffer,
                             pData[written_index] = 1;
                         } else if (desc->IsUpdateAfterBind(binding)) {
                             // If it hasn't been written now and it's update after bind, put it in a list to check at QueueSubmit
-                            di_input_block.update_at_submit[written_index] = descriptor;
+                            di_input_block.update_at_submit.push_back({written_index, desc, i});
                         }
                         written_index++;
                     }
@@ -2470,11 +2633,11 @@ void GpuAssisted::AllocateValidationResources(const VkCommandBuffer cmd_buffer,
                 *sets_to_bindings++ = 0;
             }
         }
-        vmaUnmapMemory(vmaAllocator, di_input_block.allocation);
+        vmaFlushAllocation(vmaAllocator, di_input_block.allocation, di_input_block.offset, di_input_block.size);
 
         di_input_desc_buffer_info.range = (words_needed * 4);
         di_input_desc_buffer_info.buffer = di_input_block.buffer;
-        di_input_desc_buffer_info.offset = 0;
+        di_input_desc_buffer_info.offset = di_input_block.offset;
 
         desc_writes[1].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
         desc_writes[1].dstBinding = 1;
@@ -2501,20 +2664,15 @@ void GpuAssisted::AllocateValidationResources(const VkCommandBuffer cmd_buffer,
 
         uint32_t num_buffers = static_cast<uint32_t>(buffer_map.size());
         uint32_t words_needed = (num_buffers + 3) + (num_buffers + 2);
-        allocInfo.usage = VMA_MEMORY_USAGE_CPU_TO_GPU;
-        bufferInfo.size = words_needed * 8;  // 64 bit words
-        result =
-            vmaCreateBuffer(vmaAllocator, &bufferInfo, &allocInfo, &bda_input_block.buffer, &bda_input_block.allocation, nullptr);
+        result = input_block_allocator->GetBlock(cmd_buffer, words_needed * 8, &bda_input_block);  // 64 bit words
         if (result != VK_SUCCESS) {
             ReportSetupProblem(device, "Unable to allocate device memory.  Device could become unstable.");
             aborted = true;
             return;
         }
-        uint64_t *bda_data;
-        result = vmaMapMemory(vmaAllocator, bda_input_block.allocation, (void **)&bda_data);
+        uint64_t *bda_data = reinterpret_cast<uint64_t *>(bda_input_block.data);
         uint32_t address_index = 1;
         uint32_t size_index = 3 + num_buffers;
-        memset(bda_data, 0, static_cast<size_t>(bufferInfo.size));
         bda_data[0] = size_index;       // Start of buffer sizes
         bda_data[address_index++] = 0;  // NULL address
         bda_data[size_index++] = 0;
@@ -2525,11 +2683,11 @@ void GpuAssisted::AllocateValidationResources(const VkCommandBuffer cmd_buffer,
         }
         bda_data[address_index] = UINTPTR_MAX;
         bda_data[size_index] = 0;
-        vmaUnmapMemory(vmaAllocator, bda_input_block.allocation);
+        vmaFlushAllocation(vmaAllocator, bda_input_block.allocation, bda_input_block.offset, bda_input_block.size);
 
         bda_input_desc_buffer_info.range = (words_needed * 8);
         bda_input_desc_buffer_info.buffer = bda_input_block.buffer;
-        bda_input_desc_buffer_info.offset = 0;
+        bda_input_desc_buffer_info.offset = bda_input_block.offset;
 
         desc_writes[desc_count].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
         desc_writes[desc_count].dstBinding = 2;
@@ -2542,31 +2700,24 @@ void GpuAssisted::AllocateValidationResources(const VkCommandBuffer cmd_buffer,
 
     // Write the descriptor
     output_desc_buffer_info.buffer = output_block.buffer;
-    output_desc_buffer_info.offset = 0;
+    output_desc_buffer_info.offset = output_block.offset;
 
     desc_writes[0].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
     desc_writes[0].descriptorCount = 1;
     desc_writes[0].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
     desc_writes[0].pBufferInfo = &output_desc_buffer_info;
     desc_writes[0].dstSet = desc_sets[0];
-    DispatchUpdateDescriptorSets(device, desc_count, desc_writes, 0, NULL);
-
-    auto iter = cb_node->lastBound.find(bind_point);  // find() allows read-only access to cb_state
-    if (iter != cb_node->lastBound.end()) {
-        auto pipeline_state = iter->second.pipeline_state;
-        if (pipeline_state && (pipeline_state->pipeline_layout->set_layouts.size() <= desc_set_bind_index)) {
-            DispatchCmdBindDescriptorSets(cmd_buffer, bind_point, pipeline_state->pipeline_layout->layout, desc_set_bind_index, 1,
-                                          desc_sets.data(), 0, nullptr);
-        }
-        // Record buffer and memory info in CB state tracking
-        GetGpuAssistedBufferInfo(cmd_buffer)
-            .emplace_back(output_block, di_input_block, bda_input_block, desc_sets[0], desc_pool, bind_point);
-    } else {
-        ReportSetupProblem(device, "Unable to find pipeline state");
-        vmaDestroyBuffer(vmaAllocator, di_input_block.buffer, di_input_block.allocation);
-        vmaDestroyBuffer(vmaAllocator, bda_input_block.buffer, bda_input_block.allocation);
-        vmaDestroyBuffer(vmaAllocator, output_block.buffer, output_block.allocation);
-        aborted = true;
-        return;
+    desc_set_manager->UpdateBufferDescriptors(desc_count, desc_writes);
+
+    auto pipeline_state = cb_node->lastBound[ConvertToLvlBindPoint(bind_point)].pipeline_state;
+    if (pipeline_state && (pipeline_state->pipeline_layout->set_layouts.size() <= desc_set_bind_index)) {
+        DispatchCmdBindDescriptorSets(cmd_buffer, bind_point, pipeline_state->pipeline_layout->layout, desc_set_bind_index, 1,
+                                      desc_sets.data(), 0, nullptr);
+    }
+    // Record buffer and memory info in CB state tracking
+    auto &gpu_buffer_list = GetGpuAssistedBufferInfo(cmd_buffer);
+    gpu_buffer_list.emplace_back(output_block, di_input_block, bda_input_block, desc_sets[0], desc_pool, bind_point);
+    if (!di_input_block.update_at_submit.empty()) {
+        di_pending_updates[cmd_buffer].push_back(gpu_buffer_list.size() - 1);
     }
 }
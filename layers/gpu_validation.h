@@ -25,10 +25,22 @@
 #include "vk_mem_alloc.h"
 class GpuAssisted;
 
+// A slice of one of the persistently mapped chunks handed out by GpuAssistedMemoryBlockAllocator.  buffer and allocation
+// belong to the chunk and are shared with the other blocks carved from it.
 struct GpuAssistedDeviceMemoryBlock {
     VkBuffer buffer;
     VmaAllocation allocation;
-    std::unordered_map<uint32_t, const cvdescriptorset::Descriptor*> update_at_submit;
+    VkDeviceSize offset;
+    VkDeviceSize size;
+    uint8_t* data;  // Host pointer to the start of the block, not of the chunk
+    // Words of an input block, in ascending order, whose update after bind descriptor had not been written yet.  The
+    // descriptor is looked up again at submit since unwritten descriptors of large bindings are shared placeholders.
+    struct PendingUpdate {
+        uint32_t word;
+        const cvdescriptorset::DescriptorSet* set;
+        uint32_t global_index;
+    };
+    std::vector<PendingUpdate> update_at_submit;
 };
 
 struct GpuAssistedBufferInfo {
@@ -54,26 +66,73 @@ struct GpuAssistedQueueBarrierCommandInfo {
     VkCommandBuffer barrier_command_buffer = VK_NULL_HANDLE;
 };
 
-// Class to encapsulate Descriptor Set allocation.  This manager creates and destroys Descriptor Pools
-// as needed to satisfy requests for descriptor sets.
+// Class to encapsulate Descriptor Set allocation.  This manager creates Descriptor Pools as needed to satisfy requests
+// for descriptor sets.  Sets that are put back go on a free list and are handed out again rather than freed, and pools
+// live until the manager is destroyed.  Every set uses the debug descriptor set layout, so one free list per pool suffices.
 class GpuAssistedDescriptorSetManager {
   public:
+    struct Stats {
+        uint64_t set_hits = 0;        // Sets handed out from a free list
+        uint64_t set_misses = 0;      // Sets that had to be allocated
+        uint64_t writes_issued = 0;   // Buffer descriptors written
+        uint64_t writes_skipped = 0;  // Buffer descriptors that already pointed at the requested range
+        uint64_t pools_created = 0;
+    };
+
     GpuAssistedDescriptorSetManager(GpuAssisted* dev_data);
     ~GpuAssistedDescriptorSetManager();
 
     VkResult GetDescriptorSet(VkDescriptorPool* desc_pool, VkDescriptorSet* desc_sets);
     VkResult GetDescriptorSets(uint32_t count, VkDescriptorPool* pool, std::vector<VkDescriptorSet>* desc_sets);
     void PutBackDescriptorSet(VkDescriptorPool desc_pool, VkDescriptorSet desc_set);
+    // Update single buffer descriptors in sets from this manager, leaving out those that already hold the same range
+    void UpdateBufferDescriptors(uint32_t write_count, const VkWriteDescriptorSet* writes);
+    const Stats& GetStats() const { return stats_; }
 
   private:
     static const uint32_t kItemsPerChunk = 512;
     struct PoolTracker {
         uint32_t size;
         uint32_t used;
+        std::vector<VkDescriptorSet> free_sets;
     };
 
     GpuAssisted* dev_data_;
     std::unordered_map<VkDescriptorPool, struct PoolTracker> desc_pool_map_;
+    // Last buffer range written to each binding of each set, indexed by binding
+    std::unordered_map<VkDescriptorSet, std::vector<VkDescriptorBufferInfo>> written_buffers_;
+    Stats stats_;
+};
+
+// Class to encapsulate the device memory behind the per-draw output and input blocks.  Blocks are aligned slices of
+// large, persistently mapped chunks.  A command buffer keeps its chunks until it is reset or freed, at which point they are
+// zeroed in bulk and returned to a free list, so blocks are always handed out cleared.
+class GpuAssistedMemoryBlockAllocator {
+  public:
+    GpuAssistedMemoryBlockAllocator(VmaAllocator allocator, VmaMemoryUsage usage, VkDeviceSize alignment);
+    ~GpuAssistedMemoryBlockAllocator();
+
+    VkResult GetBlock(VkCommandBuffer command_buffer, VkDeviceSize size, GpuAssistedDeviceMemoryBlock* block);
+    void PutBackBlocks(VkCommandBuffer command_buffer);
+
+  private:
+    static const VkDeviceSize kChunkSize = 64 * 1024;
+    struct Chunk {
+        VkBuffer buffer;
+        VmaAllocation allocation;
+        uint8_t* data;
+        VkDeviceSize size;
+        VkDeviceSize used;
+    };
+
+    VkResult CreateChunk(VkDeviceSize size, Chunk* chunk);
+    void DestroyChunk(const Chunk& chunk);
+
+    VmaAllocator allocator_;
+    VmaMemoryUsage usage_;
+    VkDeviceSize alignment_;
+    std::unordered_map<VkCommandBuffer, std::vector<Chunk>> chunks_in_use_;
+    std::vector<Chunk> free_chunks_;
 };
 
 struct GpuAssistedShaderTracker {
@@ -117,8 +176,12 @@ class GpuAssisted : public ValidationStateTracker {
     uint32_t unique_shader_module_id = 0;
     std::unordered_map<uint32_t, GpuAssistedShaderTracker> shader_map;
     std::unique_ptr<GpuAssistedDescriptorSetManager> desc_set_manager;
+    std::unique_ptr<GpuAssistedMemoryBlockAllocator> output_block_allocator;  // GPU_TO_CPU
+    std::unique_ptr<GpuAssistedMemoryBlockAllocator> input_block_allocator;   // CPU_TO_GPU
     std::map<VkQueue, GpuAssistedQueueBarrierCommandInfo> queue_barrier_command_infos;
     std::unordered_map<VkCommandBuffer, std::vector<GpuAssistedBufferInfo>> command_buffer_map;  // gpu_buffer_list;
+    // Indices into a command buffer's gpu_buffer_list of the entries whose update_at_submit list is not empty
+    std::unordered_map<VkCommandBuffer, std::vector<size_t>> di_pending_updates;
     uint32_t output_buffer_size;
     VmaAllocator vmaAllocator = {};
     PFN_vkSetDeviceLoaderData vkSetDeviceLoaderData;
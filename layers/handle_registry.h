@@ -0,0 +1,213 @@
+/* Copyright (c) 2020 The Khronos Group Inc.
+ * Copyright (c) 2020 Valve Corporation
+ * Copyright (c) 2020 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#pragma once
+#ifndef HANDLE_REGISTRY_H_
+#define HANDLE_REGISTRY_H_
+
+#include <cassert>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "cast_utils.h"
+#include "vk_layer_utils.h"
+#include "vk_object_types.h"
+
+// Forward declarations of the per-handle payloads...
+class ObjectUseData;
+struct ObjTrackState;
+
+// The per-handle payloads of every validation object sharing a HandleRegistry, side by side. A null payload means the
+// validation object has no entry for the handle.
+struct HandleRegistrySlot {
+    std::shared_ptr<ObjectUseData> thread_safety;
+    std::shared_ptr<ObjTrackState> object_lifetimes;
+
+    bool Empty() const { return !thread_safety && !object_lifetimes; }
+};
+
+// One table of per-handle slots for a whole VkDevice, enabled with VALIDATION_CHECK_ENABLE_UNIFIED_HANDLE_REGISTRY. The
+// validation objects keep their payloads in it instead of in tables of their own, so creating or destroying a handle touches a
+// single table. Each object type has its own buckets, as the per-type tables it replaces did, since non-dispatchable handles of
+// different types may share a value. Slots are dropped once their last payload is released.
+class HandleRegistry {
+  public:
+    template <typename Payload>
+    using Field = std::shared_ptr<Payload> HandleRegistrySlot::*;
+
+    // Indexed by VulkanObjectType, including kVulkanObjectTypeMax, to match the per-type tables of the validation objects
+    HandleRegistry() : types_(new TypeTable[kVulkanObjectTypeMax + 1]) {}
+
+    // Returns false, leaving the slot untouched, if the payload is already set
+    template <typename Payload>
+    bool Insert(uint64_t handle, VulkanObjectType object_type, Field<Payload> field, const std::shared_ptr<Payload> &value) {
+        assert(value);
+        Bucket &bucket = types_[object_type].GetBucket(handle);
+        write_lock_guard_t lock(bucket.lock);
+        auto &payload = bucket.slots[handle].*field;
+        if (payload) return false;
+        payload = value;
+        return true;
+    }
+
+    template <typename Payload>
+    void InsertOrAssign(uint64_t handle, VulkanObjectType object_type, Field<Payload> field,
+                        const std::shared_ptr<Payload> &value) {
+        assert(value);
+        Bucket &bucket = types_[object_type].GetBucket(handle);
+        write_lock_guard_t lock(bucket.lock);
+        bucket.slots[handle].*field = value;
+    }
+
+    template <typename Payload>
+    std::shared_ptr<Payload> Find(uint64_t handle, VulkanObjectType object_type, Field<Payload> field) const {
+        const Bucket &bucket = types_[object_type].GetBucket(handle);
+        read_lock_guard_t lock(bucket.lock);
+        auto it = bucket.slots.find(handle);
+        if (it == bucket.slots.end()) return nullptr;
+        return it->second.*field;
+    }
+
+    // Clears the payload and returns what it held
+    template <typename Payload>
+    std::shared_ptr<Payload> Pop(uint64_t handle, VulkanObjectType object_type, Field<Payload> field) {
+        Bucket &bucket = types_[object_type].GetBucket(handle);
+        write_lock_guard_t lock(bucket.lock);
+        auto it = bucket.slots.find(handle);
+        if (it == bucket.slots.end()) return nullptr;
+        std::shared_ptr<Payload> payload = std::move(it->second.*field);
+        if (it->second.Empty()) bucket.slots.erase(it);
+        return payload;
+    }
+
+    template <typename Payload>
+    std::vector<std::pair<uint64_t, std::shared_ptr<Payload>>> Snapshot(VulkanObjectType object_type, Field<Payload> field) const {
+        std::vector<std::pair<uint64_t, std::shared_ptr<Payload>>> ret;
+        for (const auto &bucket : types_[object_type].buckets) {
+            read_lock_guard_t lock(bucket.lock);
+            for (const auto &slot : bucket.slots) {
+                if (slot.second.*field) {
+                    ret.emplace_back(slot.first, slot.second.*field);
+                }
+            }
+        }
+        return ret;
+    }
+
+  private:
+    static const int kBucketsLog2 = 6;
+    static const int kBuckets = 1 << kBucketsLog2;
+
+    struct Bucket {
+        std::unordered_map<uint64_t, HandleRegistrySlot> slots;
+        mutable ReadWriteLock lock;
+    };
+    struct TypeTable {
+        Bucket buckets[kBuckets];
+
+        Bucket &GetBucket(uint64_t handle) { return buckets[BucketIndex(handle)]; }
+        const Bucket &GetBucket(uint64_t handle) const { return buckets[BucketIndex(handle)]; }
+    };
+
+    static uint32_t BucketIndex(uint64_t handle) {
+        uint32_t hash = (uint32_t)(handle >> 32) + (uint32_t)handle;
+        hash ^= (hash >> kBucketsLog2) ^ (hash >> (2 * kBucketsLog2));
+        return hash & (kBuckets - 1);
+    }
+
+    std::unique_ptr<TypeTable[]> types_;
+};
+
+// Drop-in replacement for vl_concurrent_unordered_map<Key, std::shared_ptr<Payload>> that keeps its entries in a shared
+// HandleRegistry once one is attached. Attach() has to happen while the map is still empty.
+template <typename Key, typename Payload, int BUCKETSLOG2 = 2>
+class HandleRegistryMap {
+  public:
+    typedef vl_concurrent_unordered_map<Key, std::shared_ptr<Payload>, BUCKETSLOG2> local_map_type;
+    typedef typename local_map_type::FindResult FindResult;
+
+    void Attach(HandleRegistry *registry, VulkanObjectType object_type, HandleRegistry::Field<Payload> field) {
+        registry_ = registry;
+        object_type_ = object_type;
+        field_ = field;
+    }
+
+    void insert_or_assign(const Key &key, const std::shared_ptr<Payload> &value) {
+        if (registry_) {
+            registry_->InsertOrAssign(CastToUint64(key), object_type_, field_, value);
+        } else {
+            local_map_.insert_or_assign(key, value);
+        }
+    }
+
+    bool insert(const Key &key, const std::shared_ptr<Payload> &value) {
+        if (registry_) return registry_->Insert(CastToUint64(key), object_type_, field_, value);
+        return local_map_.insert(key, value);
+    }
+
+    // returns size_type
+    size_t erase(const Key &key) {
+        if (registry_) return registry_->Pop(CastToUint64(key), object_type_, field_) ? 1 : 0;
+        return local_map_.erase(key);
+    }
+
+    bool contains(const Key &key) const {
+        if (registry_) return registry_->Find(CastToUint64(key), object_type_, field_) != nullptr;
+        return local_map_.contains(key);
+    }
+
+    FindResult end() const { return local_map_.end(); }
+
+    FindResult find(const Key &key) const {
+        if (registry_) {
+            auto payload = registry_->Find(CastToUint64(key), object_type_, field_);
+            return payload ? FindResult(true, std::move(payload)) : end();
+        }
+        return local_map_.find(key);
+    }
+
+    FindResult pop(const Key &key) {
+        if (registry_) {
+            auto payload = registry_->Pop(CastToUint64(key), object_type_, field_);
+            return payload ? FindResult(true, std::move(payload)) : end();
+        }
+        return local_map_.pop(key);
+    }
+
+    std::vector<std::pair<const Key, std::shared_ptr<Payload>>> snapshot(
+        std::function<bool(std::shared_ptr<Payload>)> f = nullptr) const {
+        if (!registry_) return local_map_.snapshot(f);
+        std::vector<std::pair<const Key, std::shared_ptr<Payload>>> ret;
+        for (auto &entry : registry_->Snapshot(object_type_, field_)) {
+            if (!f || f(entry.second)) {
+                ret.emplace_back(CastFromUint64<Key>(entry.first), std::move(entry.second));
+            }
+        }
+        return ret;
+    }
+
+  private:
+    local_map_type local_map_;
+    HandleRegistry *registry_ = nullptr;
+    VulkanObjectType object_type_ = kVulkanObjectTypeUnknown;
+    HandleRegistry::Field<Payload> field_ = nullptr;
+};
+
+#endif  // HANDLE_REGISTRY_H_
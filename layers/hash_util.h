@@ -26,9 +26,11 @@
 #include <memory>
 #include <mutex>
 #include <type_traits>
-#include <unordered_set>
+#include <unordered_map>
 #include <vector>
 
+#include "vk_layer_utils.h"  // For ReadWriteLock
+
 // Hash and equality utilities for supporting hashing containers (e.g. unordered_set, unordered_map)
 namespace hash_util {
 
@@ -122,41 +124,74 @@ struct IsOrderedContainer {
 //       execution.
 //
 // The entries of the dictionary are shared_pointers (the contents of
-// which are invariant with resize/insert), with the hash and equality
-// template arguments wrapped in a shared pointer dereferencing
-// function object
-template <typename T, typename Hasher = std::hash<T>, typename KeyEqual = std::equal_to<T>>
+// which are invariant with resize/insert), bucketed by the full hash
+// of the referenced value.
+//
+// The dictionary is split into 2^BUCKETSLOG2 independently locked shards,
+// selected by the hash of the value. Lookups hash the value once, probe
+// the shard under a read lock, and only allocate the shared_pointer (and
+// take the write lock) on a miss. The dictionaries are process-wide, so
+// this keeps concurrent layout creation from serializing on a single lock.
+template <typename T, typename Hasher = std::hash<T>, typename KeyEqual = std::equal_to<T>, int BUCKETSLOG2 = 4>
 class Dictionary {
   public:
     using Def = T;
     using Id = std::shared_ptr<const Def>;
 
     // Find the unique entry match the provided value, adding if needed
-    // TODO: segregate lookup from insert, using reader/write locks to reduce contention -- if needed
     template <typename U = T>
     Id look_up(U &&value) {
-        // We create an Id from the value, which will either be retained by dict (if new) or deleted on return (if extant)
-        Id from_input = std::make_shared<T>(std::forward<U>(value));
+        const size_t hash = Hasher()(value);
+        Shard &shard = shards_[ShardIndex(hash)];
+        {
+            read_lock_guard_t lock(shard.lock);
+            const Id *found = shard.find(hash, value);
+            if (found) return *found;
+        }
 
-        // Insert takes care of the "unique" id part by rejecting the insert if a key matching by_value exists, but returning us
-        // the Id of the extant shared_pointer(id->def) instead.
-        // return the value of the Iterator from the <Iterator, bool> pair returned by insert
-        Guard g(lock);  // Dict isn't thread safe, and use is presumed to be multi-threaded
-        return *dict.insert(from_input).first;
+        // We create an Id from the value only on a miss, which will either be retained by dict (if still new) or deleted on
+        // return (if another thread inserted a matching value between the read and write locks)
+        Id from_input = std::make_shared<T>(std::forward<U>(value));
+        write_lock_guard_t lock(shard.lock);
+        const Id *found = shard.find(hash, *from_input);
+        if (found) return *found;
+        shard.dict.emplace(hash, from_input);
+        return from_input;
     }
 
   private:
-    struct HashKeyValue {
-        size_t operator()(const Id &value) const { return Hasher()(*value); }
+    // The full hash is computed once per look_up, and used as the key directly
+    struct IdentityHash {
+        size_t operator()(size_t hash) const { return hash; }
     };
-    struct KeyValueEqual {
-        bool operator()(const Id &lhs, const Id &rhs) const { return KeyEqual()(*lhs, *rhs); }
+    using Dict = std::unordered_multimap<size_t, Id, IdentityHash>;
+
+    struct Shard {
+        mutable ReadWriteLock lock;
+        Dict dict;
+        // Keep each shard's lock on its own cache line to avoid false cache line sharing.
+        char padding[(-int(sizeof(ReadWriteLock) + sizeof(Dict))) & 63];
+
+        const Id *find(size_t hash, const T &value) const {
+            const auto range = dict.equal_range(hash);
+            for (auto it = range.first; it != range.second; ++it) {
+                if (KeyEqual()(*it->second, value)) return &it->second;
+            }
+            return nullptr;
+        }
     };
-    using Dict = std::unordered_set<Id, HashKeyValue, KeyValueEqual>;
-    using Lock = std::mutex;
-    using Guard = std::lock_guard<Lock>;
-    Lock lock;
-    Dict dict;
+
+    static const int SHARDS = (1 << BUCKETSLOG2);
+
+    // The low bits of the hash select the bucket within the shard's unordered_multimap, so fold the high bits in
+    static uint32_t ShardIndex(size_t hash) {
+        uint64_t u64 = static_cast<uint64_t>(hash);
+        uint32_t index = static_cast<uint32_t>(u64 >> 32) ^ static_cast<uint32_t>(u64);
+        index ^= (index >> 16) ^ (index >> 24);
+        return index & (SHARDS - 1);
+    }
+
+    Shard shards_[SHARDS];
 };
 }  // namespace hash_util
 
@@ -91,7 +91,11 @@ class ImageSubresourceLayoutMap {
         bool operator!=(const SubresourceRangeLayout& rhs) const { return !(*this == rhs); }
     };
 
-    using RangeMap = subresource_adapter::BothRangeMap<VkImageLayout, 16>;
+    // Images of up to kDenseLimit subresources (e.g. 10 mips x 6 layers) keep their layouts in a dense array sized to the image.
+    // Each dense entry holds the full range key beside the layout, so larger images (including 12 mips x 6 layers) use the
+    // range_map, where an image in a single layout is one node.
+    static const size_t kDenseLimit = 64;
+    using RangeMap = subresource_adapter::BothRangeMap<VkImageLayout, 16, kDenseLimit>;
     template <typename MapA, typename MapB>
     using ParallelIterator = sparse_container::parallel_iterator<MapA, MapB>;
     using LayoutMap = RangeMap;
@@ -202,7 +206,7 @@ class ImageSubresourceLayoutMap {
     }
 
     // This map *also* needs "write once" semantics
-    using InitialLayoutStateMap = subresource_adapter::BothRangeMap<InitialLayoutState*, 16>;
+    using InitialLayoutStateMap = subresource_adapter::BothRangeMap<InitialLayoutState*, 16, kDenseLimit>;
 
   private:
     const IMAGE_STATE& image_state_;
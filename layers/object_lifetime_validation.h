@@ -53,9 +53,19 @@ struct ObjTrackState {
     ObjectStatusFlags status;                                      // Object state
     uint64_t parent_object;                                        // Parent object
     std::unique_ptr<std::unordered_set<uint64_t> > child_objects;  // Child objects (used for VkDescriptorPool only)
+
+    // Resetting a VkDescriptorPool only bumps its generation; a VkDescriptorSet whose generation no longer matches its pool's
+    // was implicitly freed and is stale.  Stale sets stay in the object map until they are reclaimed in bulk.
+    std::atomic<uint64_t> generation{0};
+    std::shared_ptr<const ObjTrackState> parent_pool;  // VkDescriptorSet only
+    // VkDescriptorPool only: children of earlier generations that may still be in the object map
+    std::vector<std::unique_ptr<std::unordered_set<uint64_t> > > stale_child_objects;
+    size_t stale_child_count = 0;
+
+    bool IsStale() const { return parent_pool && generation.load() != parent_pool->generation.load(); }
 };
 
-typedef vl_concurrent_unordered_map<uint64_t, std::shared_ptr<ObjTrackState>, 6> object_map_type;
+typedef HandleRegistryMap<uint64_t, ObjTrackState, 6> object_map_type;
 
 class ObjectLifetimes : public ValidationObject {
   public:
@@ -79,6 +89,14 @@ class ObjectLifetimes : public ValidationObject {
     // Constructor for object lifetime tracking
     ObjectLifetimes() : num_objects{}, num_total_objects(0) {}
 
+    // Only the per-type maps move into the registry, swapchainImageMap keeps its own table
+    void AttachHandleRegistry(HandleRegistry *registry) override {
+        for (uint32_t object_type = 0; object_type <= kVulkanObjectTypeMax; ++object_type) {
+            object_map[object_type].Attach(registry, static_cast<VulkanObjectType>(object_type),
+                                           &HandleRegistrySlot::object_lifetimes);
+        }
+    }
+
     template <typename T1>
     void InsertObject(object_map_type &map, T1 object, VulkanObjectType object_type, std::shared_ptr<ObjTrackState> pNode) {
         uint64_t object_handle = HandleToUint64(object);
@@ -101,6 +119,17 @@ class ObjectLifetimes : public ValidationObject {
     bool ReportLeakedInstanceObjects(VkInstance instance, VulkanObjectType object_type, const std::string &error_code) const;
 
     void DestroyUndestroyedObjects(VulkanObjectType object_type);
+    // A pool reset reclaims the stale sets of earlier resets once more than this many have piled up
+    static const size_t kMaxStaleDescriptorSets = 16384;
+    void ReclaimStaleDescriptorSets(ObjTrackState *pool_node);
+    // Stale descriptor sets count as destroyed
+    bool ContainsLiveObject(const object_map_type &map, uint64_t object_handle, VulkanObjectType object_type) const {
+        if (object_type != kVulkanObjectTypeDescriptorSet) {
+            return map.contains(object_handle);
+        }
+        auto item = map.find(object_handle);
+        return item != map.end() && !item->second->IsStale();
+    }
 
     void CreateQueue(VkQueue vkObj);
     void AllocateCommandBuffer(const VkCommandPool command_pool, const VkCommandBuffer command_buffer, VkCommandBufferLevel level);
@@ -130,7 +159,7 @@ class ObjectLifetimes : public ValidationObject {
     bool CheckObjectValidity(uint64_t object_handle, VulkanObjectType object_type, bool null_allowed,
                              const char *invalid_handle_code, const char *wrong_device_code) const {
         // Look for object in object map
-        if (!object_map[object_type].contains(object_handle)) {
+        if (!ContainsLiveObject(object_map[object_type], object_handle, object_type)) {
             // If object is an image, also look for it in the swapchain image map
             if ((object_type != kVulkanObjectTypeImage) || (swapchainImageMap.find(object_handle) == swapchainImageMap.end())) {
                 // Object not found, look for it in other device object maps
@@ -139,8 +168,8 @@ class ObjectLifetimes : public ValidationObject {
                         if (layer_object_data->container_type == LayerObjectTypeObjectTracker) {
                             auto object_lifetime_data = reinterpret_cast<ObjectLifetimes *>(layer_object_data);
                             if (object_lifetime_data && (object_lifetime_data != this)) {
-                                if (object_lifetime_data->object_map[object_type].find(object_handle) !=
-                                        object_lifetime_data->object_map[object_type].end() ||
+                                if (object_lifetime_data->ContainsLiveObject(object_lifetime_data->object_map[object_type],
+                                                                             object_handle, object_type) ||
                                     (object_type == kVulkanObjectTypeImage &&
                                      object_lifetime_data->swapchainImageMap.find(object_handle) !=
                                          object_lifetime_data->swapchainImageMap.end())) {
@@ -217,6 +246,10 @@ class ObjectLifetimes : public ValidationObject {
 
             return;
         }
+        // Stale descriptor sets were already taken out of the counts when their pool was reset
+        if (item->second->IsStale()) {
+            return;
+        }
         assert(num_total_objects > 0);
 
         num_total_objects--;
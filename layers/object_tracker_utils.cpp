@@ -126,21 +126,46 @@ void ObjectLifetimes::AllocateDescriptorSet(VkDescriptorPool descriptor_pool, Vk
     pNewObjNode->status = OBJSTATUS_NONE;
     pNewObjNode->handle = HandleToUint64(descriptor_set);
     pNewObjNode->parent_object = HandleToUint64(descriptor_pool);
-    InsertObject(object_map[kVulkanObjectTypeDescriptorSet], descriptor_set, kVulkanObjectTypeDescriptorSet, pNewObjNode);
-    num_objects[kVulkanObjectTypeDescriptorSet]++;
-    num_total_objects++;
 
     auto itr = object_map[kVulkanObjectTypeDescriptorPool].find(HandleToUint64(descriptor_pool));
     if (itr != object_map[kVulkanObjectTypeDescriptorPool].end()) {
+        pNewObjNode->generation = itr->second->generation.load();
+        pNewObjNode->parent_pool = itr->second;
         itr->second->child_objects->insert(HandleToUint64(descriptor_set));
     }
+
+    // Handles of sets freed by a pool reset are commonly handed out again before the stale entry has been reclaimed
+    auto existing = object_map[kVulkanObjectTypeDescriptorSet].find(HandleToUint64(descriptor_set));
+    if (existing != object_map[kVulkanObjectTypeDescriptorSet].end() && existing->second->IsStale()) {
+        object_map[kVulkanObjectTypeDescriptorSet].insert_or_assign(HandleToUint64(descriptor_set), pNewObjNode);
+    } else {
+        InsertObject(object_map[kVulkanObjectTypeDescriptorSet], descriptor_set, kVulkanObjectTypeDescriptorSet, pNewObjNode);
+    }
+    num_objects[kVulkanObjectTypeDescriptorSet]++;
+    num_total_objects++;
+}
+
+// Remove the descriptor sets that earlier resets of a pool left in the object map.  Handles that have since been allocated
+// again are live and stay.
+void ObjectLifetimes::ReclaimStaleDescriptorSets(ObjTrackState *pool_node) {
+    auto &set_map = object_map[kVulkanObjectTypeDescriptorSet];
+    for (const auto &stale_sets : pool_node->stale_child_objects) {
+        for (auto set : *stale_sets) {
+            auto item = set_map.find(set);
+            if (item != set_map.end() && item->second->IsStale()) {
+                set_map.erase(set);
+            }
+        }
+    }
+    pool_node->stale_child_objects.clear();
+    pool_node->stale_child_count = 0;
 }
 
 bool ObjectLifetimes::ValidateDescriptorSet(VkDescriptorPool descriptor_pool, VkDescriptorSet descriptor_set) const {
     bool skip = false;
     uint64_t object_handle = HandleToUint64(descriptor_set);
     auto dsItem = object_map[kVulkanObjectTypeDescriptorSet].find(object_handle);
-    if (dsItem != object_map[kVulkanObjectTypeDescriptorSet].end()) {
+    if (dsItem != object_map[kVulkanObjectTypeDescriptorSet].end() && !dsItem->second->IsStale()) {
         if (dsItem->second->parent_object != HandleToUint64(descriptor_pool)) {
             // We know that the parent *must* be a descriptor pool
             const auto parent_pool = CastFromUint64<VkDescriptorPool>(dsItem->second->parent_object);
@@ -261,6 +286,7 @@ bool ObjectLifetimes::ReportLeakedDeviceObjects(VkDevice device, VulkanObjectTyp
     auto snapshot = object_map[object_type].snapshot();
     for (const auto &item : snapshot) {
         const auto object_info = item.second;
+        if (object_info->IsStale()) continue;
         skip |= LogError(device, error_code, "OBJ ERROR : For %s, %s has not been destroyed.",
                          report_data->FormatHandle(device).c_str(),
                          report_data->FormatHandle(ObjTrackStateTypedHandle(*object_info)).c_str());
@@ -426,30 +452,32 @@ bool ObjectLifetimes::PreCallValidateResetDescriptorPool(VkDevice device, VkDesc
     skip |=
         ValidateObject(descriptorPool, kVulkanObjectTypeDescriptorPool, false,
                        "VUID-vkResetDescriptorPool-descriptorPool-parameter", "VUID-vkResetDescriptorPool-descriptorPool-parent");
-
-    auto itr = object_map[kVulkanObjectTypeDescriptorPool].find(HandleToUint64(descriptorPool));
-    if (itr != object_map[kVulkanObjectTypeDescriptorPool].end()) {
-        auto pPoolNode = itr->second;
-        for (auto set : *pPoolNode->child_objects) {
-            skip |= ValidateDestroyObject((VkDescriptorSet)set, kVulkanObjectTypeDescriptorSet, nullptr, kVUIDUndefined,
-                                          kVUIDUndefined);
-        }
-    }
+    // Descriptor sets carry no allocation callbacks, so there is nothing to check for the sets the reset frees
     return skip;
 }
 
 void ObjectLifetimes::PreCallRecordResetDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool,
                                                        VkDescriptorPoolResetFlags flags) {
     auto lock = write_shared_lock();
-    // A DescriptorPool's descriptor sets are implicitly deleted when the pool is reset. Remove this pool's descriptor sets from
-    // our descriptorSet map.
+    // A DescriptorPool's descriptor sets are implicitly deleted when the pool is reset. Bumping the pool's generation makes
+    // all of them stale at once; they are removed from our descriptorSet map in bulk later on.
     auto itr = object_map[kVulkanObjectTypeDescriptorPool].find(HandleToUint64(descriptorPool));
     if (itr != object_map[kVulkanObjectTypeDescriptorPool].end()) {
         auto pPoolNode = itr->second;
-        for (auto set : *pPoolNode->child_objects) {
-            RecordDestroyObject((VkDescriptorSet)set, kVulkanObjectTypeDescriptorSet);
+        const auto freed_count = pPoolNode->child_objects->size();
+        if (freed_count == 0) {
+            return;
+        }
+        pPoolNode->generation++;
+        num_objects[kVulkanObjectTypeDescriptorSet] -= freed_count;
+        num_total_objects -= freed_count;
+        pPoolNode->stale_child_count += freed_count;
+        pPoolNode->stale_child_objects.emplace_back(std::move(pPoolNode->child_objects));
+        pPoolNode->child_objects.reset(new std::unordered_set<uint64_t>);
+        // Bound the map growth for drivers that do not hand the same handles out again after a reset
+        if (pPoolNode->stale_child_count > kMaxStaleDescriptorSets) {
+            ReclaimStaleDescriptorSets(pPoolNode.get());
         }
-        pPoolNode->child_objects->clear();
     }
 }
 
@@ -726,6 +754,7 @@ void ObjectLifetimes::PreCallRecordDestroyDescriptorPool(VkDevice device, VkDesc
     auto itr = object_map[kVulkanObjectTypeDescriptorPool].find(HandleToUint64(descriptorPool));
     if (itr != object_map[kVulkanObjectTypeDescriptorPool].end()) {
         auto pPoolNode = itr->second;
+        ReclaimStaleDescriptorSets(pPoolNode.get());
         for (auto set : *pPoolNode->child_objects) {
             RecordDestroyObject((VkDescriptorSet)set, kVulkanObjectTypeDescriptorSet);
         }
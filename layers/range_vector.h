@@ -24,9 +24,11 @@
 #define RANGE_VECTOR_H_
 
 #include <algorithm>
+#include <array>
 #include <cassert>
 #include <limits>
 #include <map>
+#include <memory>
 #include <utility>
 
 #define RANGE_ASSERT(b) assert(b)
@@ -1021,16 +1023,46 @@ class small_range_map {
     iterator upper_bound(const key_type &key) { return iterator(this, upper_bound_impl(this, key)); }
     const_iterator upper_bound(const key_type &key) const { return const_iterator(this, upper_bound_impl(this, key)); }
 
+    // Limits above N use the same index addressed layout, but in a single heap allocation sized to the limit
     small_range_map(index_type limit = N) : size_(0), limit_(static_cast<SmallIndex>(limit)) {
         RANGE_ASSERT(limit <= std::numeric_limits<SmallIndex>::max());
+        init_storage();
         init_range();
     }
 
+    small_range_map(const small_range_map &other) : size_(other.size_), limit_(other.limit_) {
+        init_storage();
+        copy_storage(other);
+    }
+
+    small_range_map &operator=(const small_range_map &other) {
+        if (this != &other) {
+            size_ = other.size_;
+            limit_ = other.limit_;
+            init_storage();
+            copy_storage(other);
+        }
+        return *this;
+    }
+
+    // Dense storage is handed over, inline storage is copied
+    small_range_map(small_range_map &&other) : size_(other.size_), limit_(other.limit_) { move_storage(other); }
+
+    small_range_map &operator=(small_range_map &&other) {
+        if (this != &other) {
+            size_ = other.size_;
+            limit_ = other.limit_;
+            move_storage(other);
+        }
+        return *this;
+    }
+
     // Only valid for empty maps
     void set_limit(size_t limit) {
         RANGE_ASSERT(size_ == 0);
         RANGE_ASSERT(limit <= std::numeric_limits<SmallIndex>::max());
         limit_ = static_cast<SmallIndex>(limit);
+        init_storage();
         init_range();
     }
     inline index_type get_limit() const { return static_cast<index_type>(limit_); }
@@ -1169,6 +1201,9 @@ class small_range_map {
                     RANGE_ASSERT(first_range.end < clear_range.end);  // we handled the "includes" case above
                     resize_value(first_range.begin, clear_range.begin);
                     rerange_end(first_range.begin, clear_range.begin, clear_range.begin);
+                } else {
+                    // The whole first range is cleared, so the empty space may extend to the left of it
+                    empty_left.begin = find_inuse_left(clear_range);
                 }
             } else {
                 empty_left.begin = find_inuse_left(clear_range);
@@ -1214,12 +1249,54 @@ class small_range_map {
         return empty;
     }
 
-    void init_range() {
-        const SmallRange init_val(limit_, 0);
-        for (SmallIndex i = 0; i < limit_; ++i) {
-            ranges_[i] = init_val;
-            in_use_[i] = false;
+    // The dense layout is limit_ values, followed by limit_ ranges and limit_ in use flags, in one allocation
+    void init_storage() {
+        if (limit_ > N) {
+            const size_t tail_bytes = limit_ * (sizeof(SmallRange) + sizeof(bool));
+            const size_t tail_count = (tail_bytes + sizeof(BackingStore) - 1) / sizeof(BackingStore);
+            dense_storage_.reset(new BackingStore[limit_ + tail_count]);
+            backing_store_ = dense_storage_.get();
+            ranges_ = reinterpret_cast<SmallRange *>(backing_store_ + limit_);
+            in_use_ = reinterpret_cast<bool *>(ranges_ + limit_);
+        } else {
+            dense_storage_.reset();
+            point_at_inline_storage();
+        }
+    }
+
+    void point_at_inline_storage() {
+        ranges_ = inline_ranges_.data();
+        backing_store_ = inline_backing_store_.data();
+        in_use_ = inline_in_use_.data();
+    }
+
+    void move_storage(small_range_map &other) {
+        if (limit_ > N) {
+            dense_storage_ = std::move(other.dense_storage_);
+            ranges_ = other.ranges_;
+            backing_store_ = other.backing_store_;
+            in_use_ = other.in_use_;
+        } else {
+            dense_storage_.reset();
+            point_at_inline_storage();
+            copy_storage(other);
         }
+        // Leave other as a valid empty map
+        other.size_ = 0;
+        other.limit_ = 0;
+        other.dense_storage_.reset();
+        other.point_at_inline_storage();
+    }
+
+    void copy_storage(const small_range_map &other) {
+        std::copy(other.ranges_, other.ranges_ + limit_, ranges_);
+        std::copy(other.backing_store_, other.backing_store_ + limit_, backing_store_);
+        std::copy(other.in_use_, other.in_use_ + limit_, in_use_);
+    }
+
+    void init_range() {
+        std::fill(ranges_, ranges_ + limit_, SmallRange(limit_, 0));
+        std::fill(in_use_, in_use_ + limit_, false);
     }
     value_type *get_value(SmallIndex index) {
         RANGE_ASSERT(index < limit_);  // Must be inbounds
@@ -1338,9 +1415,13 @@ class small_range_map {
 
     SmallIndex size_;
     SmallIndex limit_;
-    std::array<SmallRange, N> ranges_;
-    std::array<BackingStore, N> backing_store_;
-    std::array<bool, N> in_use_;
+    SmallRange *ranges_;
+    BackingStore *backing_store_;
+    bool *in_use_;
+    std::array<SmallRange, N> inline_ranges_;
+    std::array<BackingStore, N> inline_backing_store_;
+    std::array<bool, N> inline_in_use_;
+    std::unique_ptr<BackingStore[]> dense_storage_;
 };
 
 // Forward index iterator, tracking an index value and the appropos lower bound
@@ -1690,7 +1771,8 @@ bool update_range_value(Map &map, const Range &range, MapValue &&value, value_pr
     while (range.includes(pos->index)) {
         if (!pos->valid) {
             if (precedence == value_precedence::prefer_source) {
-                // We can convert this into and overwrite...
+                // We can convert this into and overwrite... but earlier matching entries may have moved pos past range.begin
+                pos.seek(range.begin);
                 map.overwrite_range(pos->lower_bound, std::make_pair(range, std::forward<MapValue>(value)));
                 return true;
             }
@@ -20,6 +20,7 @@
  * Shannon McPherson <shannon@lunarg.com>
  */
 
+#include <algorithm>
 #include <cmath>
 #include <set>
 #include <sstream>
@@ -641,7 +642,7 @@ bool ValidationStateTracker::SetSparseMemBinding(const VkDeviceMemory mem, const
 }
 
 void ValidationStateTracker::UpdateDrawState(CMD_BUFFER_STATE *cb_state, const VkPipelineBindPoint bind_point) {
-    auto &state = cb_state->lastBound[bind_point];
+    auto &state = cb_state->lastBound[ConvertToLvlBindPoint(bind_point)];
     PIPELINE_STATE *pPipe = state.pipeline_state;
     if (VK_NULL_HANDLE != state.pipeline_layout) {
         for (const auto &set_binding_pair : pPipe->active_slots) {
@@ -684,7 +685,7 @@ void ValidationStateTracker::UpdateDrawState(CMD_BUFFER_STATE *cb_state, const V
                         std::set_difference(binding_req_map.begin(), binding_req_map.end(),
                                             state.per_set[setIndex].validated_set_binding_req_map.begin(),
                                             state.per_set[setIndex].validated_set_binding_req_map.end(),
-                                            std::inserter(delta_reqs, delta_reqs.begin()));
+                                            std::back_inserter(delta_reqs));
                         descriptor_set->UpdateDrawState(this, cb_state, pPipe, delta_reqs);
                     } else {
                         descriptor_set->UpdateDrawState(this, cb_state, pPipe, binding_req_map);
@@ -700,7 +701,7 @@ void ValidationStateTracker::UpdateDrawState(CMD_BUFFER_STATE *cb_state, const V
                             state.per_set[setIndex].validated_set_binding_req_map = set_binding_pair.second;
                         }
                     } else {
-                        state.per_set[setIndex].validated_set_binding_req_map = BindingReqMap();
+                        state.per_set[setIndex].validated_set_binding_req_map.clear();
                     }
                 }
             }
@@ -868,7 +869,7 @@ void ValidationStateTracker::ResetCommandBufferState(const VkCommandBuffer cb) {
         pCB->scissorMask = 0;
 
         for (auto &item : pCB->lastBound) {
-            item.second.reset();
+            item.reset();
         }
 
         memset(&pCB->activeRenderPassBeginInfo, 0, sizeof(pCB->activeRenderPassBeginInfo));
@@ -1421,23 +1422,12 @@ void ValidationStateTracker::PreCallRecordDestroyDevice(VkDevice device, const V
     queueMap.clear();
 }
 
-// Loop through bound objects and increment their in_use counts.
-void ValidationStateTracker::IncrementBoundObjects(CMD_BUFFER_STATE const *cb_node) {
-    for (auto obj : cb_node->object_bindings) {
-        auto base_obj = GetStateStructPtrFromObject(obj);
-        if (base_obj) {
-            base_obj->in_use.fetch_add(1);
-        }
-    }
-}
-
 // Track which resources are in-flight by atomically incrementing their "in_use" count
 void ValidationStateTracker::IncrementResources(CMD_BUFFER_STATE *cb_node) {
     cb_node->submitCount++;
+    // Objects bound to this command buffer report in use through their cb_bindings, see BASE_NODE::InUse()
     cb_node->in_use.fetch_add(1);
 
-    // First Increment for all "generic" objects bound to cmd buffer, followed by special-case objects below
-    IncrementBoundObjects(cb_node);
     // TODO : We should be able to remove the NULL look-up checks from the code below as long as
     //  all the corresponding cases are verified to cause CB_INVALID state and the CB_INVALID state
     //  should then be flagged prior to calling this function
@@ -1447,17 +1437,6 @@ void ValidationStateTracker::IncrementResources(CMD_BUFFER_STATE *cb_node) {
     }
 }
 
-// Decrement in-use count for objects bound to command buffer
-void ValidationStateTracker::DecrementBoundResources(CMD_BUFFER_STATE const *cb_node) {
-    BASE_NODE *base_obj = nullptr;
-    for (auto obj : cb_node->object_bindings) {
-        base_obj = GetStateStructPtrFromObject(obj);
-        if (base_obj) {
-            base_obj->in_use.fetch_sub(1);
-        }
-    }
-}
-
 void ValidationStateTracker::RetireWorkOnQueue(QUEUE_STATE *pQueue, uint64_t seq) {
     std::unordered_map<VkQueue, uint64_t> otherQueueSeqs;
 
@@ -1493,8 +1472,6 @@ void ValidationStateTracker::RetireWorkOnQueue(QUEUE_STATE *pQueue, uint64_t seq
             if (!cb_node) {
                 continue;
             }
-            // First perform decrement on general case bound objects
-            DecrementBoundResources(cb_node);
             for (auto event : cb_node->writeEventsBeforeWait) {
                 auto eventNode = eventMap.find(event);
                 if (eventNode != eventMap.end()) {
@@ -2870,9 +2847,9 @@ void ValidationStateTracker::PreCallRecordCmdBindPipeline(VkCommandBuffer comman
         cb_state->status |= cb_state->static_status;
     }
     ResetCommandBufferPushConstantDataIfIncompatible(cb_state, pipe_state->pipeline_layout->layout);
-    cb_state->lastBound[pipelineBindPoint].pipeline_state = pipe_state;
+    cb_state->lastBound[ConvertToLvlBindPoint(pipelineBindPoint)].pipeline_state = pipe_state;
     SetPipelineState(pipe_state);
-    AddCommandBufferBinding(pipe_state->cb_bindings, VulkanTypedHandle(pipeline, kVulkanObjectTypePipeline), cb_state);
+    AddCommandBufferBinding(pipe_state->cb_bindings, VulkanTypedHandle(pipeline, kVulkanObjectTypePipeline, pipe_state), cb_state);
 }
 
 void ValidationStateTracker::PreCallRecordCmdSetViewport(VkCommandBuffer commandBuffer, uint32_t firstViewport,
@@ -3118,7 +3095,7 @@ void ValidationStateTracker::UpdateLastBoundDescriptorSets(CMD_BUFFER_STATE *cb_
     assert(last_binding_index < pipeline_layout->compat_for_set.size());
 
     // Some useful shorthand
-    auto &last_bound = cb_state->lastBound[pipeline_bind_point];
+    auto &last_bound = cb_state->lastBound[ConvertToLvlBindPoint(pipeline_bind_point)];
     auto &pipe_compat_ids = pipeline_layout->compat_for_set;
     const uint32_t current_size = static_cast<uint32_t>(last_bound.per_set.size());
 
@@ -3180,7 +3157,7 @@ void ValidationStateTracker::UpdateLastBoundDescriptorSets(CMD_BUFFER_STATE *cb_
             // TODO: Add logic for tracking push_descriptor offsets (here or in caller)
             if (set_dynamic_descriptor_count && input_dynamic_offsets) {
                 const uint32_t *end_offset = input_dynamic_offsets + set_dynamic_descriptor_count;
-                last_bound.per_set[set_idx].dynamicOffsets = std::vector<uint32_t>(input_dynamic_offsets, end_offset);
+                last_bound.per_set[set_idx].dynamicOffsets.assign(input_dynamic_offsets, end_offset);
                 input_dynamic_offsets = end_offset;
                 assert(input_dynamic_offsets <= (p_dynamic_offsets + dynamic_offset_count));
             } else {
@@ -3203,15 +3180,17 @@ void ValidationStateTracker::PreCallRecordCmdBindDescriptorSets(VkCommandBuffer
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     auto pipeline_layout = GetPipelineLayout(layout);
 
+    auto &last_bound = cb_state->lastBound[ConvertToLvlBindPoint(pipelineBindPoint)];
+
     // Resize binding arrays
     uint32_t last_set_index = firstSet + setCount - 1;
-    if (last_set_index >= cb_state->lastBound[pipelineBindPoint].per_set.size()) {
-        cb_state->lastBound[pipelineBindPoint].per_set.resize(last_set_index + 1);
+    if (last_set_index >= last_bound.per_set.size()) {
+        last_bound.per_set.resize(last_set_index + 1);
     }
 
     UpdateLastBoundDescriptorSets(cb_state, pipelineBindPoint, pipeline_layout, firstSet, setCount, pDescriptorSets, nullptr,
                                   dynamicOffsetCount, pDynamicOffsets);
-    cb_state->lastBound[pipelineBindPoint].pipeline_layout = layout;
+    last_bound.pipeline_layout = layout;
     ResetCommandBufferPushConstantDataIfIncompatible(cb_state, layout);
 }
 
@@ -3226,7 +3205,7 @@ void ValidationStateTracker::RecordCmdPushDescriptorSetState(CMD_BUFFER_STATE *c
 
     // We need a descriptor set to update the bindings with, compatible with the passed layout
     const auto dsl = pipeline_layout->set_layouts[set];
-    auto &last_bound = cb_state->lastBound[pipelineBindPoint];
+    auto &last_bound = cb_state->lastBound[ConvertToLvlBindPoint(pipelineBindPoint)];
     auto &push_descriptor_set = last_bound.push_descriptor_set;
     // If we are disturbing the current push_desriptor_set clear it
     if (!push_descriptor_set || !CompatForSet(set, last_bound, pipeline_layout->compat_for_set)) {
@@ -3483,15 +3462,101 @@ void ValidationStateTracker::PostCallRecordCreateFramebuffer(VkDevice device, co
     auto fb_state = std::make_shared<FRAMEBUFFER_STATE>(*pFramebuffer, pCreateInfo, GetRenderPassShared(pCreateInfo->renderPass));
 
     if ((pCreateInfo->flags & VK_FRAMEBUFFER_CREATE_IMAGELESS_BIT_KHR) == 0) {
-        for (uint32_t i = 0; i < pCreateInfo->attachmentCount; ++i) {
-            VkImageView view = pCreateInfo->pAttachments[i];
-            auto view_state = GetImageViewState(view);
-            if (!view_state) {
-                continue;
+        RecordFramebufferAttachmentOverlaps(fb_state.get(), pCreateInfo);
+    }
+    frameBufferMap[*pFramebuffer] = std::move(fb_state);
+}
+
+template <class T>
+static bool IsRangeOverlapping(T offset1, T size1, T offset2, T size2) {
+    return (((offset1 + size1) > offset2) && ((offset1 + size1) < (offset2 + size2))) ||
+           ((offset1 > offset2) && (offset1 < (offset2 + size2)));
+}
+
+static bool IsRegionOverlapping(VkImageSubresourceRange range1, VkImageSubresourceRange range2) {
+    return (IsRangeOverlapping(range1.baseMipLevel, range1.levelCount, range2.baseMipLevel, range2.levelCount) &&
+            IsRangeOverlapping(range1.baseArrayLayer, range1.layerCount, range2.baseArrayLayer, range2.layerCount));
+}
+
+// Attachments alias if they use the same view, overlapping subresources of the same image, or overlapping ranges of the
+// same memory object. Only attachments sharing an image or a memory object can alias, so bucket them first and only
+// compare within a bucket. The result depends only on the framebuffer, so it is computed once here instead of at every
+// vkCmdBeginRenderPass.
+void ValidationStateTracker::RecordFramebufferAttachmentOverlaps(FRAMEBUFFER_STATE *fb_state,
+                                                                 const VkFramebufferCreateInfo *pCreateInfo) {
+    auto &overlaps = fb_state->attachment_overlaps;
+    overlaps.resize(pCreateInfo->attachmentCount);
+
+    auto add_overlap = [&overlaps](uint32_t i, uint32_t j) {
+        overlaps[i].emplace_back(j);
+        overlaps[j].emplace_back(i);
+    };
+
+    std::unordered_map<VkImage, std::vector<uint32_t>> image_buckets;
+    std::unordered_map<const DEVICE_MEMORY_STATE *, std::vector<VkImage>> memory_buckets;
+    std::vector<const IMAGE_VIEW_STATE *> view_states(pCreateInfo->attachmentCount, nullptr);
+    for (uint32_t i = 0; i < pCreateInfo->attachmentCount; ++i) {
+        VkImageView view = pCreateInfo->pAttachments[i];
+        // The same view used twice always aliases, whether or not it is still known to the tracker.
+        for (uint32_t j = 0; j < i; ++j) {
+            if (pCreateInfo->pAttachments[j] == view) {
+                add_overlap(j, i);
+            }
+        }
+        view_states[i] = GetImageViewState(view);
+        if (!view_states[i]) continue;
+        const VkImage image = view_states[i]->create_info.image;
+        auto &image_bucket = image_buckets[image];
+        if (image_bucket.empty()) {
+            const auto image_state = GetImageState(image);
+            if (image_state) {
+                memory_buckets[image_state->binding.mem_state.get()].emplace_back(image);
             }
         }
+        image_bucket.emplace_back(i);
+    }
+
+    // Distinct views of the same image alias when their subresource ranges overlap
+    for (const auto &image_bucket : image_buckets) {
+        const auto &indices = image_bucket.second;
+        for (size_t a = 0; a < indices.size(); ++a) {
+            for (size_t b = a + 1; b < indices.size(); ++b) {
+                const uint32_t i = indices[a];
+                const uint32_t j = indices[b];
+                if (pCreateInfo->pAttachments[i] == pCreateInfo->pAttachments[j]) continue;
+                if (IsRegionOverlapping(view_states[i]->create_info.subresourceRange,
+                                        view_states[j]->create_info.subresourceRange)) {
+                    add_overlap(i, j);
+                }
+            }
+        }
+    }
+
+    // Views of distinct images alias when the images are bound to overlapping ranges of the same memory
+    for (const auto &memory_bucket : memory_buckets) {
+        const auto &images = memory_bucket.second;
+        for (size_t a = 0; a < images.size(); ++a) {
+            const auto &binding_a = GetImageState(images[a])->binding;
+            for (size_t b = a + 1; b < images.size(); ++b) {
+                const auto &binding_b = GetImageState(images[b])->binding;
+                // IsRangeOverlapping is not symmetric; evaluate it with the lower attachment index first, as the pairwise
+                // scan did.
+                const bool a_first = IsRangeOverlapping(binding_a.offset, binding_a.size, binding_b.offset, binding_b.size);
+                const bool b_first = IsRangeOverlapping(binding_b.offset, binding_b.size, binding_a.offset, binding_a.size);
+                if (!a_first && !b_first) continue;
+                for (const auto i : image_buckets[images[a]]) {
+                    for (const auto j : image_buckets[images[b]]) {
+                        if (i < j ? a_first : b_first) add_overlap(i, j);
+                    }
+                }
+            }
+        }
+    }
+
+    // Keep the ascending order the pairwise scan used to produce, so reported errors stay stable.
+    for (auto &overlap : overlaps) {
+        std::sort(overlap.begin(), overlap.end());
     }
-    frameBufferMap[*pFramebuffer] = std::move(fb_state);
 }
 
 void ValidationStateTracker::RecordRenderPassDAG(RenderPassCreateVersion rp_version, const VkRenderPassCreateInfo2KHR *pCreateInfo,
@@ -4854,7 +4919,7 @@ void ValidationStateTracker::RecordPipelineShaderStage(VkPipelineShaderStageCrea
     for (auto use : stage_state->descriptor_uses) {
         // While validating shaders capture which slots are used by the pipeline
         const uint32_t slot = use.first.first;
-        auto &reqs = pipeline->active_slots[slot][use.first.second];
+        auto &reqs = FindOrInsertBindingReq(&pipeline->active_slots[slot], use.first.second);
         reqs = descriptor_req(reqs | DescriptorTypeToReqs(module, use.second.type_id));
         pipeline->max_active_slot = std::max(pipeline->max_active_slot, slot);
     }
@@ -21,7 +21,12 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <iterator>
+
 #include "parameter_name.h"
+#include "vk_layer_data.h"
 #include "vk_typemap_helper.h"
 
 // Suppress unused warning on Linux
@@ -79,6 +84,19 @@ const uint32_t ExtEnumBaseValue = 1000000000;
 // The value of all VK_xxx_MAX_ENUM tokens
 const uint32_t MaxEnumValue = 0x7FFFFFFF;
 
+// Number of pNext pointers and sTypes validate_struct_pnext tracks without allocating
+const int kPNextChainInlineCount = 16;
+
+// Returns the given list of sTypes sorted by value, as required for the allowed_types table of validate_struct_pnext.
+// The tables are declared as function local statics, so the sort happens once per call site.
+template <size_t N>
+std::array<VkStructureType, N> SortedStructTypes(const VkStructureType (&types)[N]) {
+    std::array<VkStructureType, N> sorted;
+    std::copy(std::begin(types), std::end(types), sorted.begin());
+    std::sort(sorted.begin(), sorted.end());
+    return sorted;
+}
+
 class StatelessValidation : public ValidationObject {
   public:
     VkPhysicalDeviceLimits device_limits = {};
@@ -487,8 +505,10 @@ class StatelessValidation : public ValidationObject {
         // TODO: The valid pNext structure types are not recursive. Each structure has its own list of valid sTypes for pNext.
         // Codegen a map of vectors containing the allowable pNext types for each struct and use that here -- also simplifies parms.
         if (next != NULL) {
-            std::unordered_set<const void *> cycle_check;
-            std::unordered_set<VkStructureType, std::hash<int>> unique_stype_check;
+            // Chains are almost always short, so the cycle and duplicate checks stay in inline storage, only spilling to the
+            // heap for unusually long chains.
+            small_unordered_set<const void *, kPNextChainInlineCount> cycle_check;
+            small_unordered_set<uint32_t, kPNextChainInlineCount> unique_stype_check;
 
             const char *disclaimer =
                 "This warning is based on the Valid Usage documentation for version %d of the Vulkan header.  It is possible that "
@@ -505,37 +525,36 @@ class StatelessValidation : public ValidationObject {
                 skip_call |= LogWarning(device, pnext_vuid, message.c_str(), api_name, parameter_name.get_name().c_str(),
                                         header_version, parameter_name.get_name().c_str());
             } else {
+                // allowed_types must be sorted by value (see SortedStructTypes)
                 const VkStructureType *start = allowed_types;
                 const VkStructureType *end = allowed_types + allowed_type_count;
+                assert(std::is_sorted(start, end));
                 const VkBaseOutStructure *current = reinterpret_cast<const VkBaseOutStructure *>(next);
 
+                const bool is_create_instance = (strncmp(api_name, "vkCreateInstance", strlen(api_name)) == 0);
+                const bool is_create_device = (strncmp(api_name, "vkCreateDevice", strlen(api_name)) == 0);
+
                 cycle_check.insert(next);
 
                 while (current != NULL) {
-                    if (((strncmp(api_name, "vkCreateInstance", strlen(api_name)) != 0) ||
-                         (current->sType != VK_STRUCTURE_TYPE_LOADER_INSTANCE_CREATE_INFO)) &&
-                        ((strncmp(api_name, "vkCreateDevice", strlen(api_name)) != 0) ||
-                         (current->sType != VK_STRUCTURE_TYPE_LOADER_DEVICE_CREATE_INFO))) {
-                        if (cycle_check.find(current->pNext) != cycle_check.end()) {
+                    if ((!is_create_instance || (current->sType != VK_STRUCTURE_TYPE_LOADER_INSTANCE_CREATE_INFO)) &&
+                        (!is_create_device || (current->sType != VK_STRUCTURE_TYPE_LOADER_DEVICE_CREATE_INFO))) {
+                        if (!cycle_check.insert(current->pNext).second) {
                             std::string message = "%s: %s chain contains a cycle -- pNext pointer " PRIx64 " is repeated.";
                             skip_call |= LogError(device, kVUID_PVError_InvalidStructPNext, message.c_str(), api_name,
                                                   parameter_name.get_name().c_str(), reinterpret_cast<uint64_t>(next));
                             break;
-                        } else {
-                            cycle_check.insert(current->pNext);
                         }
 
-                        std::string type_name = string_VkStructureType(current->sType);
-                        if (unique_stype_check.find(current->sType) != unique_stype_check.end()) {
+                        if (!unique_stype_check.insert(static_cast<uint32_t>(current->sType)).second) {
                             // stype_vuid will only be null if there are no listed pNext and will hit disclaimer check
                             std::string message = "%s: %s chain contains duplicate structure types: %s appears multiple times.";
                             skip_call |= LogError(device, stype_vuid, message.c_str(), api_name, parameter_name.get_name().c_str(),
-                                                  type_name.c_str());
-                        } else {
-                            unique_stype_check.insert(current->sType);
+                                                  string_VkStructureType(current->sType));
                         }
 
-                        if (std::find(start, end, current->sType) == end) {
+                        if (!std::binary_search(start, end, current->sType)) {
+                            const char *type_name = string_VkStructureType(current->sType);
                             if (type_name == UnsupportedStructureTypeString) {
                                 std::string message =
                                     "%s: %s chain includes a structure with unknown VkStructureType (%d); Allowed structures are "
@@ -550,7 +569,7 @@ class StatelessValidation : public ValidationObject {
                                     "[%s]. ";
                                 message += disclaimer;
                                 skip_call |= LogWarning(device, pnext_vuid, message.c_str(), api_name,
-                                                        parameter_name.get_name().c_str(), type_name.c_str(), allowed_struct_names,
+                                                        parameter_name.get_name().c_str(), type_name, allowed_struct_names,
                                                         header_version, parameter_name.get_name().c_str());
                             }
                         }
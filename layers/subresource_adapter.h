@@ -328,7 +328,9 @@ class RangeGenerator {
 // use in performance sensitive places that are *already* templatized (for example update_range_value).
 // In STL style.  Note that N must be < uint8_t max
 enum BothRangeMapMode { kTristate, kSmall, kBig };
-template <typename T, size_t N>
+// Small mode keeps an index addressed array of up to DenseLimit entries, inline for limits up to N and heap allocated above
+// that. Larger limits use the std::map based range_map.
+template <typename T, size_t N, size_t DenseLimit = N>
 class BothRangeMap {
     using BigMap = sparse_container::range_map<IndexType, T>;
     using RangeType = sparse_container::range<IndexType>;
@@ -337,6 +339,7 @@ class BothRangeMap {
     using SmallMapConstIterator = typename SmallMap::const_iterator;
     using BigMapIterator = typename BigMap::iterator;
     using BigMapConstIterator = typename BigMap::const_iterator;
+    static_assert(N <= DenseLimit && DenseLimit <= std::numeric_limits<uint8_t>::max(), "DenseLimit must fit the small map index");
 
   public:
     using value_type = typename SmallMap::value_type;
@@ -571,10 +574,10 @@ class BothRangeMap {
     BothRangeMap() : const_big_map_(big_map_), const_small_map_(small_map_), mode_(BothRangeMapMode::kBig) {}
     BothRangeMap(index_type limit)
         : big_map_(),
-          small_map_(limit <= N ? limit : 0),
+          small_map_(limit <= DenseLimit ? limit : 0),
           const_big_map_(big_map_),
           const_small_map_(small_map_),
-          mode_(limit <= N ? BothRangeMapMode::kSmall : BothRangeMapMode::kBig) {}
+          mode_(limit <= DenseLimit ? BothRangeMapMode::kSmall : BothRangeMapMode::kBig) {}
 
     inline bool empty() const {
         if (SmallMode()) {
@@ -20,10 +20,9 @@
  */
 
 #include <string.h>
+#include <array>
 #include <string>
 #include <vector>
-#include <map>
-#include <set>
 #include "vulkan/vulkan.h"
 #include "vk_format_utils.h"
 
@@ -33,12 +32,17 @@ struct VULKAN_FORMAT_INFO {
     VkFormatCompatibilityClass format_class;
 };
 
+struct VULKAN_FORMAT_TABLE_ENTRY {
+    VkFormat format;
+    VULKAN_FORMAT_INFO info;
+};
+
 // Disable auto-formatting for this large table
 // clang-format off
 
 // Set up data structure with size(bytes) and number of channels for each Vulkan format
 // For compressed and multi-plane formats, size is bytes per compressed or shared block
-const std::map<VkFormat, VULKAN_FORMAT_INFO> vk_format_table = {
+static const VULKAN_FORMAT_TABLE_ENTRY vk_format_table[] = {
     {VK_FORMAT_UNDEFINED,                   {0, 0, VK_FORMAT_COMPATIBILITY_CLASS_NONE_BIT }},
     {VK_FORMAT_R4G4_UNORM_PACK8,            {1, 2, VK_FORMAT_COMPATIBILITY_CLASS_8_BIT}},
     {VK_FORMAT_R4G4B4A4_UNORM_PACK16,       {2, 4, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT}},
@@ -279,8 +283,124 @@ const std::map<VkFormat, VULKAN_FORMAT_INFO> vk_format_table = {
 // Renable formatting
 // clang-format on
 
+struct VULKAN_PER_PLANE_COMPATIBILITY {
+    uint32_t width_divisor;
+    uint32_t height_divisor;
+    VkFormat compatible_format;
+};
+
+struct VULKAN_MULTIPLANE_COMPATIBILITY {
+    VULKAN_PER_PLANE_COMPATIBILITY per_plane[VK_MULTIPLANE_FORMAT_MAX_PLANES];
+};
+
+struct VULKAN_MULTIPLANE_TABLE_ENTRY {
+    VkFormat format;
+    VULKAN_MULTIPLANE_COMPATIBILITY compatibility;
+};
+
+// Source: Vulkan spec Table 47. Plane Format Compatibility Table
+// clang-format off
+static const VULKAN_MULTIPLANE_TABLE_ENTRY vk_multiplane_compatibility_table[] = {
+    { VK_FORMAT_G8_B8_R8_3PLANE_420_UNORM,                  { { { 1, 1, VK_FORMAT_R8_UNORM },
+                                                                { 2, 2, VK_FORMAT_R8_UNORM },
+                                                                { 2, 2, VK_FORMAT_R8_UNORM } } } },
+    { VK_FORMAT_G8_B8R8_2PLANE_420_UNORM,                   { { { 1, 1, VK_FORMAT_R8_UNORM },
+                                                                { 2, 2, VK_FORMAT_R8G8_UNORM },
+                                                                { 1, 1, VK_FORMAT_UNDEFINED } } } },
+    { VK_FORMAT_G8_B8_R8_3PLANE_422_UNORM,                  { { { 1, 1, VK_FORMAT_R8_UNORM },
+                                                                { 2, 1, VK_FORMAT_R8_UNORM },
+                                                                { 2, 1, VK_FORMAT_R8_UNORM } } } },
+    { VK_FORMAT_G8_B8R8_2PLANE_422_UNORM,                   { { { 1, 1, VK_FORMAT_R8_UNORM },
+                                                                { 2, 1, VK_FORMAT_R8G8_UNORM },
+                                                                { 1, 1, VK_FORMAT_UNDEFINED } } } },
+    { VK_FORMAT_G8_B8_R8_3PLANE_444_UNORM,                  { { { 1, 1, VK_FORMAT_R8_UNORM },
+                                                                { 1, 1, VK_FORMAT_R8_UNORM },
+                                                                { 1, 1, VK_FORMAT_R8_UNORM } } } },
+    { VK_FORMAT_G10X6_B10X6_R10X6_3PLANE_420_UNORM_3PACK16, { { { 1, 1, VK_FORMAT_R10X6_UNORM_PACK16 },
+                                                                { 2, 2, VK_FORMAT_R10X6_UNORM_PACK16 },
+                                                                { 2, 2, VK_FORMAT_R10X6_UNORM_PACK16 } } } },
+    { VK_FORMAT_G10X6_B10X6R10X6_2PLANE_420_UNORM_3PACK16,  { { { 1, 1, VK_FORMAT_R10X6_UNORM_PACK16 },
+                                                                { 2, 2, VK_FORMAT_R10X6G10X6_UNORM_2PACK16 },
+                                                                { 1, 1, VK_FORMAT_UNDEFINED } } } },
+    { VK_FORMAT_G10X6_B10X6_R10X6_3PLANE_422_UNORM_3PACK16, { { { 1, 1, VK_FORMAT_R10X6_UNORM_PACK16 },
+                                                                { 2, 1, VK_FORMAT_R10X6_UNORM_PACK16 },
+                                                                { 2, 1, VK_FORMAT_R10X6_UNORM_PACK16 } } } },
+    { VK_FORMAT_G10X6_B10X6R10X6_2PLANE_422_UNORM_3PACK16,  { { { 1, 1, VK_FORMAT_R10X6_UNORM_PACK16 },
+                                                                { 2, 1, VK_FORMAT_R10X6G10X6_UNORM_2PACK16 },
+                                                                { 1, 1, VK_FORMAT_UNDEFINED } } } },
+    { VK_FORMAT_G10X6_B10X6_R10X6_3PLANE_444_UNORM_3PACK16, { { { 1, 1, VK_FORMAT_R10X6_UNORM_PACK16 },
+                                                                { 1, 1, VK_FORMAT_R10X6_UNORM_PACK16 },
+                                                                { 1, 1, VK_FORMAT_R10X6_UNORM_PACK16 } } } },
+    { VK_FORMAT_G12X4_B12X4_R12X4_3PLANE_420_UNORM_3PACK16, { { { 1, 1, VK_FORMAT_R12X4_UNORM_PACK16 },
+                                                                { 2, 2, VK_FORMAT_R12X4_UNORM_PACK16 },
+                                                                { 2, 2, VK_FORMAT_R12X4_UNORM_PACK16 } } } },
+    { VK_FORMAT_G12X4_B12X4R12X4_2PLANE_420_UNORM_3PACK16,  { { { 1, 1, VK_FORMAT_R12X4_UNORM_PACK16 },
+                                                                { 2, 2, VK_FORMAT_R12X4G12X4_UNORM_2PACK16 },
+                                                                { 1, 1, VK_FORMAT_UNDEFINED } } } },
+    { VK_FORMAT_G12X4_B12X4_R12X4_3PLANE_422_UNORM_3PACK16, { { { 1, 1, VK_FORMAT_R12X4_UNORM_PACK16 },
+                                                                { 2, 1, VK_FORMAT_R12X4_UNORM_PACK16 },
+                                                                { 2, 1, VK_FORMAT_R12X4_UNORM_PACK16 } } } },
+    { VK_FORMAT_G12X4_B12X4R12X4_2PLANE_422_UNORM_3PACK16,  { { { 1, 1, VK_FORMAT_R12X4_UNORM_PACK16 },
+                                                                { 2, 1, VK_FORMAT_R12X4G12X4_UNORM_2PACK16 },
+                                                                { 1, 1, VK_FORMAT_UNDEFINED } } } },
+    { VK_FORMAT_G12X4_B12X4_R12X4_3PLANE_444_UNORM_3PACK16, { { { 1, 1, VK_FORMAT_R12X4_UNORM_PACK16 },
+                                                                { 1, 1, VK_FORMAT_R12X4_UNORM_PACK16 },
+                                                                { 1, 1, VK_FORMAT_R12X4_UNORM_PACK16 } } } },
+    { VK_FORMAT_G16_B16_R16_3PLANE_420_UNORM,               { { { 1, 1, VK_FORMAT_R16_UNORM },
+                                                                { 2, 2, VK_FORMAT_R16_UNORM },
+                                                                { 2, 2, VK_FORMAT_R16_UNORM } } } },
+    { VK_FORMAT_G16_B16R16_2PLANE_420_UNORM,                { { { 1, 1, VK_FORMAT_R16_UNORM },
+                                                                { 2, 2, VK_FORMAT_R16G16_UNORM },
+                                                                { 1, 1, VK_FORMAT_UNDEFINED } } } },
+    { VK_FORMAT_G16_B16_R16_3PLANE_422_UNORM,               { { { 1, 1, VK_FORMAT_R16_UNORM },
+                                                                { 2, 1, VK_FORMAT_R16_UNORM },
+                                                                { 2, 1, VK_FORMAT_R16_UNORM } } } },
+    { VK_FORMAT_G16_B16R16_2PLANE_422_UNORM,                { { { 1, 1, VK_FORMAT_R16_UNORM },
+                                                                { 2, 1, VK_FORMAT_R16G16_UNORM },
+                                                                { 1, 1, VK_FORMAT_UNDEFINED } } } },
+    { VK_FORMAT_G16_B16_R16_3PLANE_444_UNORM,               { { { 1, 1, VK_FORMAT_R16_UNORM },
+                                                                { 1, 1, VK_FORMAT_R16_UNORM },
+                                                                { 1, 1, VK_FORMAT_R16_UNORM } } } }
+};
+// clang-format on
+
+// Source: Vulkan spec Table 69. Formats requiring sampler YCBCR conversion for VK_IMAGE_ASPECT_COLOR_BIT image views
+static const VkFormat vk_formats_requiring_ycbcr_conversion[] = {VK_FORMAT_G8B8G8R8_422_UNORM,
+                                                                  VK_FORMAT_B8G8R8G8_422_UNORM,
+                                                                  VK_FORMAT_G8_B8_R8_3PLANE_420_UNORM,
+                                                                  VK_FORMAT_G8_B8R8_2PLANE_420_UNORM,
+                                                                  VK_FORMAT_G8_B8_R8_3PLANE_422_UNORM,
+                                                                  VK_FORMAT_G8_B8R8_2PLANE_422_UNORM,
+                                                                  VK_FORMAT_G8_B8_R8_3PLANE_444_UNORM,
+                                                                  VK_FORMAT_R10X6G10X6B10X6A10X6_UNORM_4PACK16,
+                                                                  VK_FORMAT_G10X6B10X6G10X6R10X6_422_UNORM_4PACK16,
+                                                                  VK_FORMAT_B10X6G10X6R10X6G10X6_422_UNORM_4PACK16,
+                                                                  VK_FORMAT_G10X6_B10X6_R10X6_3PLANE_420_UNORM_3PACK16,
+                                                                  VK_FORMAT_G10X6_B10X6R10X6_2PLANE_420_UNORM_3PACK16,
+                                                                  VK_FORMAT_G10X6_B10X6_R10X6_3PLANE_422_UNORM_3PACK16,
+                                                                  VK_FORMAT_G10X6_B10X6R10X6_2PLANE_422_UNORM_3PACK16,
+                                                                  VK_FORMAT_G10X6_B10X6_R10X6_3PLANE_444_UNORM_3PACK16,
+                                                                  VK_FORMAT_R12X4G12X4B12X4A12X4_UNORM_4PACK16,
+                                                                  VK_FORMAT_G12X4B12X4G12X4R12X4_422_UNORM_4PACK16,
+                                                                  VK_FORMAT_B12X4G12X4R12X4G12X4_422_UNORM_4PACK16,
+                                                                  VK_FORMAT_G12X4_B12X4_R12X4_3PLANE_420_UNORM_3PACK16,
+                                                                  VK_FORMAT_G12X4_B12X4R12X4_2PLANE_420_UNORM_3PACK16,
+                                                                  VK_FORMAT_G12X4_B12X4_R12X4_3PLANE_422_UNORM_3PACK16,
+                                                                  VK_FORMAT_G12X4_B12X4R12X4_2PLANE_422_UNORM_3PACK16,
+                                                                  VK_FORMAT_G12X4_B12X4_R12X4_3PLANE_444_UNORM_3PACK16,
+                                                                  VK_FORMAT_G16B16G16R16_422_UNORM,
+                                                                  VK_FORMAT_B16G16R16G16_422_UNORM,
+                                                                  VK_FORMAT_G16_B16_R16_3PLANE_420_UNORM,
+                                                                  VK_FORMAT_G16_B16R16_2PLANE_420_UNORM,
+                                                                  VK_FORMAT_G16_B16_R16_3PLANE_422_UNORM,
+                                                                  VK_FORMAT_G16_B16R16_2PLANE_422_UNORM,
+                                                                  VK_FORMAT_G16_B16_R16_3PLANE_444_UNORM};
+
+// Per-format classification, used only to populate the dense format property table below. The public format queries
+// read the table rather than re-running these switches.
+
 // Return true if format is an ETC2 or EAC compressed texture format
-VK_LAYER_EXPORT bool FormatIsCompressed_ETC2_EAC(VkFormat format) {
+static bool ClassifyIsCompressed_ETC2_EAC(VkFormat format) {
     bool found = false;
 
     switch (format) {
@@ -303,7 +423,7 @@ VK_LAYER_EXPORT bool FormatIsCompressed_ETC2_EAC(VkFormat format) {
 }
 
 // Return true if format is an ASTC compressed texture format
-VK_LAYER_EXPORT bool FormatIsCompressed_ASTC_LDR(VkFormat format) {
+static bool ClassifyIsCompressed_ASTC_LDR(VkFormat format) {
     bool found = false;
 
     switch (format) {
@@ -344,7 +464,7 @@ VK_LAYER_EXPORT bool FormatIsCompressed_ASTC_LDR(VkFormat format) {
 }
 
 // Return true if format is a BC compressed texture format
-VK_LAYER_EXPORT bool FormatIsCompressed_BC(VkFormat format) {
+static bool ClassifyIsCompressed_BC(VkFormat format) {
     bool found = false;
 
     switch (format) {
@@ -373,7 +493,7 @@ VK_LAYER_EXPORT bool FormatIsCompressed_BC(VkFormat format) {
 }
 
 // Return true if format is a PVRTC compressed texture format
-VK_LAYER_EXPORT bool FormatIsCompressed_PVRTC(VkFormat format) {
+static bool ClassifyIsCompressed_PVRTC(VkFormat format) {
     bool found = false;
 
     switch (format) {
@@ -394,7 +514,7 @@ VK_LAYER_EXPORT bool FormatIsCompressed_PVRTC(VkFormat format) {
 }
 
 // Single-plane "_422" formats are treated as 2x1 compressed (for copies)
-VK_LAYER_EXPORT bool FormatIsSinglePlane_422(VkFormat format) {
+static bool ClassifyIsSinglePlane_422(VkFormat format) {
     bool found = false;
 
     switch (format) {
@@ -414,13 +534,8 @@ VK_LAYER_EXPORT bool FormatIsSinglePlane_422(VkFormat format) {
     return found;
 }
 
-// Return true if format is compressed
-VK_LAYER_EXPORT bool FormatIsCompressed(VkFormat format) {
-    return (FormatIsCompressed_ASTC_LDR(format) || FormatIsCompressed_BC(format) || FormatIsCompressed_ETC2_EAC(format) ||
-            FormatIsCompressed_PVRTC(format));
-}
 // Return true if format is packed
-VK_LAYER_EXPORT bool FormatIsPacked(VkFormat format) {
+static bool ClassifyIsPacked(VkFormat format) {
     bool found = false;
 
     switch (format) {
@@ -482,22 +597,8 @@ VK_LAYER_EXPORT bool FormatIsPacked(VkFormat format) {
     return found;
 }
 
-// Return true if format is 'normal', with one texel per format element
-VK_LAYER_EXPORT bool FormatElementIsTexel(VkFormat format) {
-    if (FormatIsPacked(format) || FormatIsCompressed(format) || FormatIsSinglePlane_422(format) || FormatIsMultiplane(format)) {
-        return false;
-    } else {
-        return true;
-    }
-}
-
-// Return true if format is a depth or stencil format
-VK_LAYER_EXPORT bool FormatIsDepthOrStencil(VkFormat format) {
-    return (FormatIsDepthAndStencil(format) || FormatIsDepthOnly(format) || FormatIsStencilOnly(format));
-}
-
 // Return true if format contains depth and stencil information
-VK_LAYER_EXPORT bool FormatIsDepthAndStencil(VkFormat format) {
+static bool ClassifyIsDepthAndStencil(VkFormat format) {
     bool is_ds = false;
 
     switch (format) {
@@ -512,11 +613,8 @@ VK_LAYER_EXPORT bool FormatIsDepthAndStencil(VkFormat format) {
     return is_ds;
 }
 
-// Return true if format is a stencil-only format
-VK_LAYER_EXPORT bool FormatIsStencilOnly(VkFormat format) { return (format == VK_FORMAT_S8_UINT); }
-
 // Return true if format is a depth-only format
-VK_LAYER_EXPORT bool FormatIsDepthOnly(VkFormat format) {
+static bool ClassifyIsDepthOnly(VkFormat format) {
     bool is_depth = false;
 
     switch (format) {
@@ -533,7 +631,7 @@ VK_LAYER_EXPORT bool FormatIsDepthOnly(VkFormat format) {
 }
 
 // Return true if format is of type NORM
-VK_LAYER_EXPORT bool FormatIsNorm(VkFormat format) {
+static bool ClassifyIsNorm(VkFormat format) {
     bool is_norm = false;
 
     switch (format) {
@@ -608,7 +706,7 @@ VK_LAYER_EXPORT bool FormatIsNorm(VkFormat format) {
 }
 
 // Return true if format is of type UNORM
-VK_LAYER_EXPORT bool FormatIsUNorm(VkFormat format) {
+static bool ClassifyIsUNorm(VkFormat format) {
     bool is_unorm = false;
 
     switch (format) {
@@ -666,7 +764,7 @@ VK_LAYER_EXPORT bool FormatIsUNorm(VkFormat format) {
 }
 
 // Return true if format is of type SNORM
-VK_LAYER_EXPORT bool FormatIsSNorm(VkFormat format) {
+static bool ClassifyIsSNorm(VkFormat format) {
     bool is_snorm = false;
 
     switch (format) {
@@ -696,11 +794,8 @@ VK_LAYER_EXPORT bool FormatIsSNorm(VkFormat format) {
     return is_snorm;
 }
 
-// Return true if format is an integer format
-VK_LAYER_EXPORT bool FormatIsInt(VkFormat format) { return (FormatIsSInt(format) || FormatIsUInt(format)); }
-
 // Return true if format is an unsigned integer format
-VK_LAYER_EXPORT bool FormatIsUInt(VkFormat format) {
+static bool ClassifyIsUInt(VkFormat format) {
     bool is_uint = false;
 
     switch (format) {
@@ -736,7 +831,7 @@ VK_LAYER_EXPORT bool FormatIsUInt(VkFormat format) {
 }
 
 // Return true if format is a signed integer format
-VK_LAYER_EXPORT bool FormatIsSInt(VkFormat format) {
+static bool ClassifyIsSInt(VkFormat format) {
     bool is_sint = false;
 
     switch (format) {
@@ -771,7 +866,7 @@ VK_LAYER_EXPORT bool FormatIsSInt(VkFormat format) {
 }
 
 // Return true if format is a floating-point format
-VK_LAYER_EXPORT bool FormatIsFloat(VkFormat format) {
+static bool ClassifyIsFloat(VkFormat format) {
     bool is_float = false;
 
     switch (format) {
@@ -801,7 +896,7 @@ VK_LAYER_EXPORT bool FormatIsFloat(VkFormat format) {
 }
 
 // Return true if format is in the SRGB colorspace
-VK_LAYER_EXPORT bool FormatIsSRGB(VkFormat format) {
+static bool ClassifyIsSRGB(VkFormat format) {
     bool is_srgb = false;
 
     switch (format) {
@@ -843,7 +938,7 @@ VK_LAYER_EXPORT bool FormatIsSRGB(VkFormat format) {
 }
 
 // Return true if format is a USCALED format
-VK_LAYER_EXPORT bool FormatIsUScaled(VkFormat format) {
+static bool ClassifyIsUScaled(VkFormat format) {
     bool is_uscaled = false;
 
     switch (format) {
@@ -870,7 +965,7 @@ VK_LAYER_EXPORT bool FormatIsUScaled(VkFormat format) {
 }
 
 // Return true if format is a SSCALED format
-VK_LAYER_EXPORT bool FormatIsSScaled(VkFormat format) {
+static bool ClassifyIsSScaled(VkFormat format) {
     bool is_sscaled = false;
 
     switch (format) {
@@ -900,7 +995,7 @@ VK_LAYER_EXPORT bool FormatIsSScaled(VkFormat format) {
 // Uncompressed formats return {1, 1, 1}
 // Compressed formats return the compression block extents
 // Multiplane formats return the 'shared' extent of their low-res channel(s)
-VK_LAYER_EXPORT VkExtent3D FormatTexelBlockExtent(VkFormat format) {
+static VkExtent3D ClassifyTexelBlockExtent(VkFormat format) {
     VkExtent3D block_size = {1, 1, 1};
     switch (format) {
         case VK_FORMAT_BC1_RGB_UNORM_BLOCK:
@@ -1041,7 +1136,7 @@ VK_LAYER_EXPORT VkExtent3D FormatTexelBlockExtent(VkFormat format) {
     return block_size;
 }
 
-VK_LAYER_EXPORT uint32_t FormatDepthSize(VkFormat format) {
+static uint32_t ClassifyDepthSize(VkFormat format) {
     uint32_t depth_size = 0;
     switch (format) {
         case VK_FORMAT_D16_UNORM:
@@ -1063,7 +1158,7 @@ VK_LAYER_EXPORT uint32_t FormatDepthSize(VkFormat format) {
     return depth_size;
 }
 
-VK_LAYER_EXPORT VkFormatNumericalType FormatDepthNumericalType(VkFormat format) {
+static VkFormatNumericalType ClassifyDepthNumericalType(VkFormat format) {
     VkFormatNumericalType numerical_type = VK_FORMAT_NUMERICAL_TYPE_NONE;
     switch (format) {
         case VK_FORMAT_D16_UNORM:
@@ -1083,7 +1178,7 @@ VK_LAYER_EXPORT VkFormatNumericalType FormatDepthNumericalType(VkFormat format)
     return numerical_type;
 }
 
-VK_LAYER_EXPORT uint32_t FormatStencilSize(VkFormat format) {
+static uint32_t ClassifyStencilSize(VkFormat format) {
     uint32_t stencil_size = 0;
     switch (format) {
         case VK_FORMAT_S8_UINT:
@@ -1099,7 +1194,7 @@ VK_LAYER_EXPORT uint32_t FormatStencilSize(VkFormat format) {
     return stencil_size;
 }
 
-VK_LAYER_EXPORT VkFormatNumericalType FormatStencilNumericalType(VkFormat format) {
+static VkFormatNumericalType ClassifyStencilNumericalType(VkFormat format) {
     VkFormatNumericalType numerical_type = VK_FORMAT_NUMERICAL_TYPE_NONE;
     switch (format) {
         case VK_FORMAT_S8_UINT:
@@ -1115,7 +1210,7 @@ VK_LAYER_EXPORT VkFormatNumericalType FormatStencilNumericalType(VkFormat format
     return numerical_type;
 }
 
-VK_LAYER_EXPORT uint32_t FormatPlaneCount(VkFormat format) {
+static uint32_t ClassifyPlaneCount(VkFormat format) {
     switch (format) {
         case VK_FORMAT_G8_B8_R8_3PLANE_420_UNORM:
         case VK_FORMAT_G8_B8_R8_3PLANE_422_UNORM:
@@ -1147,13 +1242,257 @@ VK_LAYER_EXPORT uint32_t FormatPlaneCount(VkFormat format) {
     }
 }
 
+
+// Predicate bits of VULKAN_FORMAT_PROPERTIES::flags
+enum VULKAN_FORMAT_PROPERTY_FLAG_BITS : uint32_t {
+    FORMAT_PROPERTY_COMPRESSED_ETC2_EAC = 0x00000001,
+    FORMAT_PROPERTY_COMPRESSED_ASTC_LDR = 0x00000002,
+    FORMAT_PROPERTY_COMPRESSED_BC = 0x00000004,
+    FORMAT_PROPERTY_COMPRESSED_PVRTC = 0x00000008,
+    FORMAT_PROPERTY_SINGLE_PLANE_422 = 0x00000010,
+    FORMAT_PROPERTY_PACKED = 0x00000020,
+    FORMAT_PROPERTY_DEPTH_AND_STENCIL = 0x00000040,
+    FORMAT_PROPERTY_DEPTH_ONLY = 0x00000080,
+    FORMAT_PROPERTY_STENCIL_ONLY = 0x00000100,
+    FORMAT_PROPERTY_NORM = 0x00000200,
+    FORMAT_PROPERTY_UNORM = 0x00000400,
+    FORMAT_PROPERTY_SNORM = 0x00000800,
+    FORMAT_PROPERTY_UINT = 0x00001000,
+    FORMAT_PROPERTY_SINT = 0x00002000,
+    FORMAT_PROPERTY_FLOAT = 0x00004000,
+    FORMAT_PROPERTY_SRGB = 0x00008000,
+    FORMAT_PROPERTY_USCALED = 0x00010000,
+    FORMAT_PROPERTY_SSCALED = 0x00020000,
+    FORMAT_PROPERTY_REQUIRES_YCBCR_CONVERSION = 0x00040000,
+    FORMAT_PROPERTY_ELEMENT_IS_TEXEL = 0x00080000,
+
+    FORMAT_PROPERTY_COMPRESSED = FORMAT_PROPERTY_COMPRESSED_ETC2_EAC | FORMAT_PROPERTY_COMPRESSED_ASTC_LDR |
+                                 FORMAT_PROPERTY_COMPRESSED_BC | FORMAT_PROPERTY_COMPRESSED_PVRTC,
+    FORMAT_PROPERTY_DEPTH_OR_STENCIL = FORMAT_PROPERTY_DEPTH_AND_STENCIL | FORMAT_PROPERTY_DEPTH_ONLY | FORMAT_PROPERTY_STENCIL_ONLY,
+    FORMAT_PROPERTY_INT = FORMAT_PROPERTY_UINT | FORMAT_PROPERTY_SINT,
+};
+
+// Everything the format queries below report for a single format
+struct VULKAN_FORMAT_PROPERTIES {
+    VULKAN_FORMAT_INFO info;
+    VkExtent3D block_extent;
+    uint32_t plane_count;
+    uint32_t depth_size;
+    uint32_t stencil_size;
+    VkFormatNumericalType depth_numerical_type;
+    VkFormatNumericalType stencil_numerical_type;
+    uint32_t flags;
+    VULKAN_MULTIPLANE_COMPATIBILITY multiplane;
+};
+
+// Inclusive ranges of format values given dense storage in the format property table. Core formats are indexed directly, and
+// each extension block follows in order. Any format outside these ranges maps to a single trailing entry with default
+// properties.
+struct VULKAN_FORMAT_RANGE {
+    uint32_t begin;
+    uint32_t end;
+    uint32_t count() const { return end - begin + 1; }
+};
+
+static const VULKAN_FORMAT_RANGE vk_format_table_ranges[] = {
+    {VK_FORMAT_UNDEFINED, VK_FORMAT_ASTC_12x12_SRGB_BLOCK},
+    {VK_FORMAT_PVRTC1_2BPP_UNORM_BLOCK_IMG, VK_FORMAT_PVRTC2_4BPP_SRGB_BLOCK_IMG},
+    {VK_FORMAT_G8B8G8R8_422_UNORM, VK_FORMAT_G16_B16_R16_3PLANE_444_UNORM},
+};
+
+// Map a format to its index in the format property table -- a bounds check per dense range
+static inline uint32_t FormatTableIndex(VkFormat format) {
+    const uint32_t value = static_cast<uint32_t>(format);
+    uint32_t base = 0;
+    for (const auto &range : vk_format_table_ranges) {
+        // Values below range.begin wrap around to large offsets, so a single compare covers both bounds
+        const uint32_t offset = value - range.begin;
+        if (offset < range.count()) {
+            return base + offset;
+        }
+        base += range.count();
+    }
+    return base;
+}
+
+class VULKAN_FORMAT_PROPERTY_TABLE {
+  public:
+    VULKAN_FORMAT_PROPERTY_TABLE() {
+        uint32_t index = 0;
+        for (const auto &range : vk_format_table_ranges) {
+            for (uint32_t value = range.begin; value <= range.end; ++value, ++index) {
+                properties_[index] = Classify(static_cast<VkFormat>(value));
+            }
+        }
+        // The trailing entry for unknown formats
+        properties_[index] = Classify(VK_FORMAT_MAX_ENUM);
+
+        for (const auto &entry : vk_format_table) {
+            properties_[FormatTableIndex(entry.format)].info = entry.info;
+        }
+        for (const auto &entry : vk_multiplane_compatibility_table) {
+            properties_[FormatTableIndex(entry.format)].multiplane = entry.compatibility;
+        }
+        for (const auto format : vk_formats_requiring_ycbcr_conversion) {
+            properties_[FormatTableIndex(format)].flags |= FORMAT_PROPERTY_REQUIRES_YCBCR_CONVERSION;
+        }
+    }
+
+    const VULKAN_FORMAT_PROPERTIES &operator[](VkFormat format) const { return properties_[FormatTableIndex(format)]; }
+
+  private:
+    static VULKAN_FORMAT_PROPERTIES Classify(VkFormat format) {
+        VULKAN_FORMAT_PROPERTIES props = {};
+        props.info = {0, 0, VK_FORMAT_COMPATIBILITY_CLASS_NONE_BIT};
+        props.block_extent = ClassifyTexelBlockExtent(format);
+        props.plane_count = ClassifyPlaneCount(format);
+        props.depth_size = ClassifyDepthSize(format);
+        props.stencil_size = ClassifyStencilSize(format);
+        props.depth_numerical_type = ClassifyDepthNumericalType(format);
+        props.stencil_numerical_type = ClassifyStencilNumericalType(format);
+        for (uint32_t plane = 0; plane < VK_MULTIPLANE_FORMAT_MAX_PLANES; ++plane) {
+            props.multiplane.per_plane[plane] = {1, 1, VK_FORMAT_UNDEFINED};
+        }
+
+        uint32_t flags = 0;
+        if (ClassifyIsCompressed_ETC2_EAC(format)) flags |= FORMAT_PROPERTY_COMPRESSED_ETC2_EAC;
+        if (ClassifyIsCompressed_ASTC_LDR(format)) flags |= FORMAT_PROPERTY_COMPRESSED_ASTC_LDR;
+        if (ClassifyIsCompressed_BC(format)) flags |= FORMAT_PROPERTY_COMPRESSED_BC;
+        if (ClassifyIsCompressed_PVRTC(format)) flags |= FORMAT_PROPERTY_COMPRESSED_PVRTC;
+        if (ClassifyIsSinglePlane_422(format)) flags |= FORMAT_PROPERTY_SINGLE_PLANE_422;
+        if (ClassifyIsPacked(format)) flags |= FORMAT_PROPERTY_PACKED;
+        if (ClassifyIsDepthAndStencil(format)) flags |= FORMAT_PROPERTY_DEPTH_AND_STENCIL;
+        if (ClassifyIsDepthOnly(format)) flags |= FORMAT_PROPERTY_DEPTH_ONLY;
+        if (format == VK_FORMAT_S8_UINT) flags |= FORMAT_PROPERTY_STENCIL_ONLY;
+        if (ClassifyIsNorm(format)) flags |= FORMAT_PROPERTY_NORM;
+        if (ClassifyIsUNorm(format)) flags |= FORMAT_PROPERTY_UNORM;
+        if (ClassifyIsSNorm(format)) flags |= FORMAT_PROPERTY_SNORM;
+        if (ClassifyIsUInt(format)) flags |= FORMAT_PROPERTY_UINT;
+        if (ClassifyIsSInt(format)) flags |= FORMAT_PROPERTY_SINT;
+        if (ClassifyIsFloat(format)) flags |= FORMAT_PROPERTY_FLOAT;
+        if (ClassifyIsSRGB(format)) flags |= FORMAT_PROPERTY_SRGB;
+        if (ClassifyIsUScaled(format)) flags |= FORMAT_PROPERTY_USCALED;
+        if (ClassifyIsSScaled(format)) flags |= FORMAT_PROPERTY_SSCALED;
+        // 'normal', with one texel per format element
+        if (!(flags & (FORMAT_PROPERTY_PACKED | FORMAT_PROPERTY_COMPRESSED | FORMAT_PROPERTY_SINGLE_PLANE_422)) &&
+            (props.plane_count <= 1)) {
+            flags |= FORMAT_PROPERTY_ELEMENT_IS_TEXEL;
+        }
+        props.flags = flags;
+        return props;
+    }
+
+    static const uint32_t kTableSize = (VK_FORMAT_ASTC_12x12_SRGB_BLOCK - VK_FORMAT_UNDEFINED + 1) +
+                                       (VK_FORMAT_PVRTC2_4BPP_SRGB_BLOCK_IMG - VK_FORMAT_PVRTC1_2BPP_UNORM_BLOCK_IMG + 1) +
+                                       (VK_FORMAT_G16_B16_R16_3PLANE_444_UNORM - VK_FORMAT_G8B8G8R8_422_UNORM + 1) + 1;
+    std::array<VULKAN_FORMAT_PROPERTIES, kTableSize> properties_;
+};
+
+static const VULKAN_FORMAT_PROPERTY_TABLE vk_format_properties;
+
+static inline bool FormatHasProperty(VkFormat format, uint32_t property) {
+    return (vk_format_properties[format].flags & property) != 0;
+}
+
+// Return true if format is an ETC2 or EAC compressed texture format
+VK_LAYER_EXPORT bool FormatIsCompressed_ETC2_EAC(VkFormat format) {
+    return FormatHasProperty(format, FORMAT_PROPERTY_COMPRESSED_ETC2_EAC);
+}
+
+// Return true if format is an ASTC compressed texture format
+VK_LAYER_EXPORT bool FormatIsCompressed_ASTC_LDR(VkFormat format) {
+    return FormatHasProperty(format, FORMAT_PROPERTY_COMPRESSED_ASTC_LDR);
+}
+
+// Return true if format is a BC compressed texture format
+VK_LAYER_EXPORT bool FormatIsCompressed_BC(VkFormat format) { return FormatHasProperty(format, FORMAT_PROPERTY_COMPRESSED_BC); }
+
+// Return true if format is a PVRTC compressed texture format
+VK_LAYER_EXPORT bool FormatIsCompressed_PVRTC(VkFormat format) {
+    return FormatHasProperty(format, FORMAT_PROPERTY_COMPRESSED_PVRTC);
+}
+
+// Single-plane "_422" formats are treated as 2x1 compressed (for copies)
+VK_LAYER_EXPORT bool FormatIsSinglePlane_422(VkFormat format) {
+    return FormatHasProperty(format, FORMAT_PROPERTY_SINGLE_PLANE_422);
+}
+
+// Return true if format is compressed
+VK_LAYER_EXPORT bool FormatIsCompressed(VkFormat format) { return FormatHasProperty(format, FORMAT_PROPERTY_COMPRESSED); }
+
+// Return true if format is packed
+VK_LAYER_EXPORT bool FormatIsPacked(VkFormat format) { return FormatHasProperty(format, FORMAT_PROPERTY_PACKED); }
+
+// Return true if format is 'normal', with one texel per format element
+VK_LAYER_EXPORT bool FormatElementIsTexel(VkFormat format) { return FormatHasProperty(format, FORMAT_PROPERTY_ELEMENT_IS_TEXEL); }
+
+// Return true if format is a depth or stencil format
+VK_LAYER_EXPORT bool FormatIsDepthOrStencil(VkFormat format) { return FormatHasProperty(format, FORMAT_PROPERTY_DEPTH_OR_STENCIL); }
+
+// Return true if format contains depth and stencil information
+VK_LAYER_EXPORT bool FormatIsDepthAndStencil(VkFormat format) {
+    return FormatHasProperty(format, FORMAT_PROPERTY_DEPTH_AND_STENCIL);
+}
+
+// Return true if format is a stencil-only format
+VK_LAYER_EXPORT bool FormatIsStencilOnly(VkFormat format) { return (format == VK_FORMAT_S8_UINT); }
+
+// Return true if format is a depth-only format
+VK_LAYER_EXPORT bool FormatIsDepthOnly(VkFormat format) { return FormatHasProperty(format, FORMAT_PROPERTY_DEPTH_ONLY); }
+
+// Return true if format is of type NORM
+VK_LAYER_EXPORT bool FormatIsNorm(VkFormat format) { return FormatHasProperty(format, FORMAT_PROPERTY_NORM); }
+
+// Return true if format is of type UNORM
+VK_LAYER_EXPORT bool FormatIsUNorm(VkFormat format) { return FormatHasProperty(format, FORMAT_PROPERTY_UNORM); }
+
+// Return true if format is of type SNORM
+VK_LAYER_EXPORT bool FormatIsSNorm(VkFormat format) { return FormatHasProperty(format, FORMAT_PROPERTY_SNORM); }
+
+// Return true if format is an integer format
+VK_LAYER_EXPORT bool FormatIsInt(VkFormat format) { return FormatHasProperty(format, FORMAT_PROPERTY_INT); }
+
+// Return true if format is an unsigned integer format
+VK_LAYER_EXPORT bool FormatIsUInt(VkFormat format) { return FormatHasProperty(format, FORMAT_PROPERTY_UINT); }
+
+// Return true if format is a signed integer format
+VK_LAYER_EXPORT bool FormatIsSInt(VkFormat format) { return FormatHasProperty(format, FORMAT_PROPERTY_SINT); }
+
+// Return true if format is a floating-point format
+VK_LAYER_EXPORT bool FormatIsFloat(VkFormat format) { return FormatHasProperty(format, FORMAT_PROPERTY_FLOAT); }
+
+// Return true if format is in the SRGB colorspace
+VK_LAYER_EXPORT bool FormatIsSRGB(VkFormat format) { return FormatHasProperty(format, FORMAT_PROPERTY_SRGB); }
+
+// Return true if format is a USCALED format
+VK_LAYER_EXPORT bool FormatIsUScaled(VkFormat format) { return FormatHasProperty(format, FORMAT_PROPERTY_USCALED); }
+
+// Return true if format is a SSCALED format
+VK_LAYER_EXPORT bool FormatIsSScaled(VkFormat format) { return FormatHasProperty(format, FORMAT_PROPERTY_SSCALED); }
+
+// Return texel block sizes for all formats
+// Uncompressed formats return {1, 1, 1}
+// Compressed formats return the compression block extents
+// Multiplane formats return the 'shared' extent of their low-res channel(s)
+VK_LAYER_EXPORT VkExtent3D FormatTexelBlockExtent(VkFormat format) { return vk_format_properties[format].block_extent; }
+
+VK_LAYER_EXPORT uint32_t FormatDepthSize(VkFormat format) { return vk_format_properties[format].depth_size; }
+
+VK_LAYER_EXPORT VkFormatNumericalType FormatDepthNumericalType(VkFormat format) {
+    return vk_format_properties[format].depth_numerical_type;
+}
+
+VK_LAYER_EXPORT uint32_t FormatStencilSize(VkFormat format) { return vk_format_properties[format].stencil_size; }
+
+VK_LAYER_EXPORT VkFormatNumericalType FormatStencilNumericalType(VkFormat format) {
+    return vk_format_properties[format].stencil_numerical_type;
+}
+
+VK_LAYER_EXPORT uint32_t FormatPlaneCount(VkFormat format) { return vk_format_properties[format].plane_count; }
+
 // Return format class of the specified format
 VK_LAYER_EXPORT VkFormatCompatibilityClass FormatCompatibilityClass(VkFormat format) {
-    auto item = vk_format_table.find(format);
-    if (item != vk_format_table.end()) {
-        return item->second.format_class;
-    }
-    return VK_FORMAT_COMPATIBILITY_CLASS_NONE_BIT;
+    return vk_format_properties[format].info.format_class;
 }
 
 // Return size, in bytes, of one element of the specified format
@@ -1177,11 +1516,7 @@ VK_LAYER_EXPORT uint32_t FormatElementSize(VkFormat format, VkImageAspectFlags a
         format = FindMultiplaneCompatibleFormat(format, aspectMask);
     }
 
-    auto item = vk_format_table.find(format);
-    if (item != vk_format_table.end()) {
-        return item->second.size;
-    }
-    return 0;
+    return vk_format_properties[format].info.size;
 }
 
 // Return the size in bytes of one texel of given foramt
@@ -1197,13 +1532,7 @@ VK_LAYER_EXPORT double FormatTexelSize(VkFormat format) {
 }
 
 // Return the number of channels for a given format
-uint32_t FormatChannelCount(VkFormat format) {
-    auto item = vk_format_table.find(format);
-    if (item != vk_format_table.end()) {
-        return item->second.channel_count;
-    }
-    return 0;
-}
+uint32_t FormatChannelCount(VkFormat format) { return vk_format_properties[format].info.channel_count; }
 
 // Perform a zero-tolerant modulo operation
 VK_LAYER_EXPORT VkDeviceSize SafeModulo(VkDeviceSize dividend, VkDeviceSize divisor) {
@@ -1222,82 +1551,6 @@ VK_LAYER_EXPORT VkDeviceSize SafeDivision(VkDeviceSize dividend, VkDeviceSize di
     return result;
 }
 
-struct VULKAN_PER_PLANE_COMPATIBILITY {
-    uint32_t width_divisor;
-    uint32_t height_divisor;
-    VkFormat compatible_format;
-};
-
-struct VULKAN_MULTIPLANE_COMPATIBILITY {
-    VULKAN_PER_PLANE_COMPATIBILITY per_plane[VK_MULTIPLANE_FORMAT_MAX_PLANES];
-};
-
-// Source: Vulkan spec Table 47. Plane Format Compatibility Table
-// clang-format off
-static const std::map<VkFormat, VULKAN_MULTIPLANE_COMPATIBILITY>vk_multiplane_compatibility_map {
-    { VK_FORMAT_G8_B8_R8_3PLANE_420_UNORM,                  { { { 1, 1, VK_FORMAT_R8_UNORM },
-                                                                { 2, 2, VK_FORMAT_R8_UNORM },
-                                                                { 2, 2, VK_FORMAT_R8_UNORM } } } },
-    { VK_FORMAT_G8_B8R8_2PLANE_420_UNORM,                   { { { 1, 1, VK_FORMAT_R8_UNORM },
-                                                                { 2, 2, VK_FORMAT_R8G8_UNORM },
-                                                                { 1, 1, VK_FORMAT_UNDEFINED } } } },
-    { VK_FORMAT_G8_B8_R8_3PLANE_422_UNORM,                  { { { 1, 1, VK_FORMAT_R8_UNORM },
-                                                                { 2, 1, VK_FORMAT_R8_UNORM },
-                                                                { 2, 1, VK_FORMAT_R8_UNORM } } } },
-    { VK_FORMAT_G8_B8R8_2PLANE_422_UNORM,                   { { { 1, 1, VK_FORMAT_R8_UNORM },
-                                                                { 2, 1, VK_FORMAT_R8G8_UNORM },
-                                                                { 1, 1, VK_FORMAT_UNDEFINED } } } },
-    { VK_FORMAT_G8_B8_R8_3PLANE_444_UNORM,                  { { { 1, 1, VK_FORMAT_R8_UNORM },
-                                                                { 1, 1, VK_FORMAT_R8_UNORM },
-                                                                { 1, 1, VK_FORMAT_R8_UNORM } } } },
-    { VK_FORMAT_G10X6_B10X6_R10X6_3PLANE_420_UNORM_3PACK16, { { { 1, 1, VK_FORMAT_R10X6_UNORM_PACK16 },
-                                                                { 2, 2, VK_FORMAT_R10X6_UNORM_PACK16 },
-                                                                { 2, 2, VK_FORMAT_R10X6_UNORM_PACK16 } } } },
-    { VK_FORMAT_G10X6_B10X6R10X6_2PLANE_420_UNORM_3PACK16,  { { { 1, 1, VK_FORMAT_R10X6_UNORM_PACK16 },
-                                                                { 2, 2, VK_FORMAT_R10X6G10X6_UNORM_2PACK16 },
-                                                                { 1, 1, VK_FORMAT_UNDEFINED } } } },
-    { VK_FORMAT_G10X6_B10X6_R10X6_3PLANE_422_UNORM_3PACK16, { { { 1, 1, VK_FORMAT_R10X6_UNORM_PACK16 },
-                                                                { 2, 1, VK_FORMAT_R10X6_UNORM_PACK16 },
-                                                                { 2, 1, VK_FORMAT_R10X6_UNORM_PACK16 } } } },
-    { VK_FORMAT_G10X6_B10X6R10X6_2PLANE_422_UNORM_3PACK16,  { { { 1, 1, VK_FORMAT_R10X6_UNORM_PACK16 },
-                                                                { 2, 1, VK_FORMAT_R10X6G10X6_UNORM_2PACK16 },
-                                                                { 1, 1, VK_FORMAT_UNDEFINED } } } },
-    { VK_FORMAT_G10X6_B10X6_R10X6_3PLANE_444_UNORM_3PACK16, { { { 1, 1, VK_FORMAT_R10X6_UNORM_PACK16 },
-                                                                { 1, 1, VK_FORMAT_R10X6_UNORM_PACK16 },
-                                                                { 1, 1, VK_FORMAT_R10X6_UNORM_PACK16 } } } },
-    { VK_FORMAT_G12X4_B12X4_R12X4_3PLANE_420_UNORM_3PACK16, { { { 1, 1, VK_FORMAT_R12X4_UNORM_PACK16 },
-                                                                { 2, 2, VK_FORMAT_R12X4_UNORM_PACK16 },
-                                                                { 2, 2, VK_FORMAT_R12X4_UNORM_PACK16 } } } },
-    { VK_FORMAT_G12X4_B12X4R12X4_2PLANE_420_UNORM_3PACK16,  { { { 1, 1, VK_FORMAT_R12X4_UNORM_PACK16 },
-                                                                { 2, 2, VK_FORMAT_R12X4G12X4_UNORM_2PACK16 },
-                                                                { 1, 1, VK_FORMAT_UNDEFINED } } } },
-    { VK_FORMAT_G12X4_B12X4_R12X4_3PLANE_422_UNORM_3PACK16, { { { 1, 1, VK_FORMAT_R12X4_UNORM_PACK16 },
-                                                                { 2, 1, VK_FORMAT_R12X4_UNORM_PACK16 },
-                                                                { 2, 1, VK_FORMAT_R12X4_UNORM_PACK16 } } } },
-    { VK_FORMAT_G12X4_B12X4R12X4_2PLANE_422_UNORM_3PACK16,  { { { 1, 1, VK_FORMAT_R12X4_UNORM_PACK16 },
-                                                                { 2, 1, VK_FORMAT_R12X4G12X4_UNORM_2PACK16 },
-                                                                { 1, 1, VK_FORMAT_UNDEFINED } } } },
-    { VK_FORMAT_G12X4_B12X4_R12X4_3PLANE_444_UNORM_3PACK16, { { { 1, 1, VK_FORMAT_R12X4_UNORM_PACK16 },
-                                                                { 1, 1, VK_FORMAT_R12X4_UNORM_PACK16 },
-                                                                { 1, 1, VK_FORMAT_R12X4_UNORM_PACK16 } } } },
-    { VK_FORMAT_G16_B16_R16_3PLANE_420_UNORM,               { { { 1, 1, VK_FORMAT_R16_UNORM },
-                                                                { 2, 2, VK_FORMAT_R16_UNORM },
-                                                                { 2, 2, VK_FORMAT_R16_UNORM } } } },
-    { VK_FORMAT_G16_B16R16_2PLANE_420_UNORM,                { { { 1, 1, VK_FORMAT_R16_UNORM },
-                                                                { 2, 2, VK_FORMAT_R16G16_UNORM },
-                                                                { 1, 1, VK_FORMAT_UNDEFINED } } } },
-    { VK_FORMAT_G16_B16_R16_3PLANE_422_UNORM,               { { { 1, 1, VK_FORMAT_R16_UNORM },
-                                                                { 2, 1, VK_FORMAT_R16_UNORM },
-                                                                { 2, 1, VK_FORMAT_R16_UNORM } } } },
-    { VK_FORMAT_G16_B16R16_2PLANE_422_UNORM,                { { { 1, 1, VK_FORMAT_R16_UNORM },
-                                                                { 2, 1, VK_FORMAT_R16G16_UNORM },
-                                                                { 1, 1, VK_FORMAT_UNDEFINED } } } },
-    { VK_FORMAT_G16_B16_R16_3PLANE_444_UNORM,               { { { 1, 1, VK_FORMAT_R16_UNORM },
-                                                                { 1, 1, VK_FORMAT_R16_UNORM },
-                                                                { 1, 1, VK_FORMAT_R16_UNORM } } } }
-};
-// clang-format on
-
 uint32_t GetPlaneIndex(VkImageAspectFlags aspect) {
     // Returns an out of bounds index on error
     switch (aspect) {
@@ -1319,24 +1572,24 @@ uint32_t GetPlaneIndex(VkImageAspectFlags aspect) {
 
 VK_LAYER_EXPORT VkFormat FindMultiplaneCompatibleFormat(VkFormat mp_fmt, VkImageAspectFlags plane_aspect) {
     uint32_t plane_idx = GetPlaneIndex(plane_aspect);
-    auto it = vk_multiplane_compatibility_map.find(mp_fmt);
-    if ((it == vk_multiplane_compatibility_map.end()) || (plane_idx >= VK_MULTIPLANE_FORMAT_MAX_PLANES)) {
+    if (plane_idx >= VK_MULTIPLANE_FORMAT_MAX_PLANES) {
         return VK_FORMAT_UNDEFINED;
     }
 
-    return it->second.per_plane[plane_idx].compatible_format;
+    // Formats without planes have VK_FORMAT_UNDEFINED for every plane
+    return vk_format_properties[mp_fmt].multiplane.per_plane[plane_idx].compatible_format;
 }
 
 VK_LAYER_EXPORT VkExtent2D FindMultiplaneExtentDivisors(VkFormat mp_fmt, VkImageAspectFlags plane_aspect) {
     VkExtent2D divisors = {1, 1};
     uint32_t plane_idx = GetPlaneIndex(plane_aspect);
-    auto it = vk_multiplane_compatibility_map.find(mp_fmt);
-    if ((it == vk_multiplane_compatibility_map.end()) || (plane_idx >= VK_MULTIPLANE_FORMAT_MAX_PLANES)) {
+    if (plane_idx >= VK_MULTIPLANE_FORMAT_MAX_PLANES) {
         return divisors;
     }
 
-    divisors.width = it->second.per_plane[plane_idx].width_divisor;
-    divisors.height = it->second.per_plane[plane_idx].height_divisor;
+    const auto &per_plane = vk_format_properties[mp_fmt].multiplane.per_plane[plane_idx];
+    divisors.width = per_plane.width_divisor;
+    divisors.height = per_plane.height_divisor;
     return divisors;
 }
 
@@ -1368,39 +1621,6 @@ VK_LAYER_EXPORT bool FormatSizesAreEqual(VkFormat srcFormat, VkFormat dstFormat,
     }
 }
 
-// Source: Vulkan spec Table 69. Formats requiring sampler YCBCR conversion for VK_IMAGE_ASPECT_COLOR_BIT image views
-const std::set<VkFormat> vk_formats_requiring_ycbcr_conversion{VK_FORMAT_G8B8G8R8_422_UNORM,
-                                                               VK_FORMAT_B8G8R8G8_422_UNORM,
-                                                               VK_FORMAT_G8_B8_R8_3PLANE_420_UNORM,
-                                                               VK_FORMAT_G8_B8R8_2PLANE_420_UNORM,
-                                                               VK_FORMAT_G8_B8_R8_3PLANE_422_UNORM,
-                                                               VK_FORMAT_G8_B8R8_2PLANE_422_UNORM,
-                                                               VK_FORMAT_G8_B8_R8_3PLANE_444_UNORM,
-                                                               VK_FORMAT_R10X6G10X6B10X6A10X6_UNORM_4PACK16,
-                                                               VK_FORMAT_G10X6B10X6G10X6R10X6_422_UNORM_4PACK16,
-                                                               VK_FORMAT_B10X6G10X6R10X6G10X6_422_UNORM_4PACK16,
-                                                               VK_FORMAT_G10X6_B10X6_R10X6_3PLANE_420_UNORM_3PACK16,
-                                                               VK_FORMAT_G10X6_B10X6R10X6_2PLANE_420_UNORM_3PACK16,
-                                                               VK_FORMAT_G10X6_B10X6_R10X6_3PLANE_422_UNORM_3PACK16,
-                                                               VK_FORMAT_G10X6_B10X6R10X6_2PLANE_422_UNORM_3PACK16,
-                                                               VK_FORMAT_G10X6_B10X6_R10X6_3PLANE_444_UNORM_3PACK16,
-                                                               VK_FORMAT_R12X4G12X4B12X4A12X4_UNORM_4PACK16,
-                                                               VK_FORMAT_G12X4B12X4G12X4R12X4_422_UNORM_4PACK16,
-                                                               VK_FORMAT_B12X4G12X4R12X4G12X4_422_UNORM_4PACK16,
-                                                               VK_FORMAT_G12X4_B12X4_R12X4_3PLANE_420_UNORM_3PACK16,
-                                                               VK_FORMAT_G12X4_B12X4R12X4_2PLANE_420_UNORM_3PACK16,
-                                                               VK_FORMAT_G12X4_B12X4_R12X4_3PLANE_422_UNORM_3PACK16,
-                                                               VK_FORMAT_G12X4_B12X4R12X4_2PLANE_422_UNORM_3PACK16,
-                                                               VK_FORMAT_G12X4_B12X4_R12X4_3PLANE_444_UNORM_3PACK16,
-                                                               VK_FORMAT_G16B16G16R16_422_UNORM,
-                                                               VK_FORMAT_B16G16R16G16_422_UNORM,
-                                                               VK_FORMAT_G16_B16_R16_3PLANE_420_UNORM,
-                                                               VK_FORMAT_G16_B16R16_2PLANE_420_UNORM,
-                                                               VK_FORMAT_G16_B16_R16_3PLANE_422_UNORM,
-                                                               VK_FORMAT_G16_B16R16_2PLANE_422_UNORM,
-                                                               VK_FORMAT_G16_B16_R16_3PLANE_444_UNORM};
-
 VK_LAYER_EXPORT bool FormatRequiresYcbcrConversion(VkFormat format) {
-    auto it = vk_formats_requiring_ycbcr_conversion.find(format);
-    return (it != vk_formats_requiring_ycbcr_conversion.end());
+    return FormatHasProperty(format, FORMAT_PROPERTY_REQUIRES_YCBCR_CONVERSION);
 }
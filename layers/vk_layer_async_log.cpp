@@ -0,0 +1,221 @@
+/* Copyright (c) 2020 The Khronos Group Inc.
+ * Copyright (c) 2020 Valve Corporation
+ * Copyright (c) 2020 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "vk_layer_async_log.h"
+
+#include <chrono>
+#include <sstream>
+
+#include "vk_layer_logging.h"
+
+const uint64_t AsyncLogWriter::kRingSize;
+
+AsyncLogWriter::AsyncLogWriter(FILE *output, Format format)
+    : ring_(new Slot[kRingSize]),
+      enqueue_pos_(0),
+      dequeue_pos_(0),
+      stop_(false),
+      output_(output),
+      format_(format),
+      written_count_(0) {
+    for (uint64_t i = 0; i < kRingSize; ++i) {
+        ring_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    if (format_ == Format::kJsonl) {
+        std::string run_record;
+        AppendJsonlRunRecord(&run_record);
+        fwrite(run_record.data(), 1, run_record.size(), output_);
+    }
+    writer_thread_ = std::thread(&AsyncLogWriter::WriterLoop, this);
+}
+
+AsyncLogWriter::~AsyncLogWriter() {
+    stop_.store(true, std::memory_order_release);
+    work_available_.notify_one();
+    writer_thread_.join();
+}
+
+void AsyncLogWriter::Push(const LogMessageFields &fields) {
+    uint64_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+    Slot *slot = nullptr;
+    for (;;) {
+        slot = &ring_[pos & (kRingSize - 1)];
+        const uint64_t sequence = slot->sequence.load(std::memory_order_acquire);
+        const int64_t diff = static_cast<int64_t>(sequence - pos);
+        if (diff == 0) {
+            if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+        } else if (diff < 0) {
+            // Ring is full, let the writer catch up
+            work_available_.notify_one();
+            std::this_thread::yield();
+            pos = enqueue_pos_.load(std::memory_order_relaxed);
+        } else {
+            pos = enqueue_pos_.load(std::memory_order_relaxed);
+        }
+    }
+
+    const VkDebugUtilsMessengerCallbackDataEXT *callback_data = fields.callback_data;
+    Record &record = slot->record;
+    record.severity = fields.severity;
+    record.type = fields.types;
+    record.message_id_number = callback_data->messageIdNumber;
+    record.has_message_id = (fields.message_id != nullptr);
+    record.message_id = fields.message_id ? fields.message_id : "";
+    record.message = fields.message;
+    record.objects.resize(callback_data->objectCount);
+    for (uint32_t obj = 0; obj < callback_data->objectCount; ++obj) {
+        const auto &object = callback_data->pObjects[obj];
+        record.objects[obj].handle = object.objectHandle;
+        record.objects[obj].type = object.objectType;
+        record.objects[obj].has_name = (object.pObjectName != nullptr);
+        if (object.pObjectName) record.objects[obj].name = object.pObjectName;
+    }
+    if (format_ == Format::kJsonl) {
+        record.time_ns = JsonlTimestamp();
+        record.thread_id = JsonlThreadId();
+        record.queue_labels.resize(callback_data->queueLabelCount);
+        for (uint32_t label = 0; label < callback_data->queueLabelCount; ++label) {
+            record.queue_labels[label] = callback_data->pQueueLabels[label].pLabelName;
+        }
+        record.cmd_buf_labels.resize(callback_data->cmdBufLabelCount);
+        for (uint32_t label = 0; label < callback_data->cmdBufLabelCount; ++label) {
+            record.cmd_buf_labels[label] = callback_data->pCmdBufLabels[label].pLabelName;
+        }
+    }
+
+    slot->sequence.store(pos + 1, std::memory_order_release);
+    work_available_.notify_one();
+}
+
+void AsyncLogWriter::Flush() {
+    const uint64_t target = enqueue_pos_.load(std::memory_order_acquire);
+    std::unique_lock<std::mutex> lock(writer_mutex_);
+    work_available_.notify_one();
+    records_written_.wait(lock, [this, target] { return written_count_ >= target; });
+}
+
+// Matches the output of messenger_log_callback for the pMessage debug_log_msg would have composed
+void AsyncLogWriter::FormatRecord(const Record &record, std::string *out) {
+    std::ostringstream msg_buffer;
+    char msg_severity[30];
+    char msg_type[30];
+
+    PrintMessageSeverity(record.severity, msg_severity);
+    PrintMessageType(record.type, msg_type);
+
+    // debug_log_msg always reports exactly one object, the one the composed text describes
+    std::string composed;
+    const char *message_id = record.has_message_id ? record.message_id.c_str() : nullptr;
+    if (record.objects.empty()) {
+        composed = record.message;
+    } else {
+        const ObjectRecord &object = record.objects[0];
+        AppendComposedMessage(&composed, message_id, object.type, object.handle, object.has_name ? object.name.c_str() : nullptr,
+                              record.message.c_str());
+    }
+
+    msg_buffer << record.message_id << "(" << msg_severity << " / " << msg_type << "): msgNum: " << record.message_id_number
+               << " - " << composed << "\n";
+    msg_buffer << "    Objects: " << record.objects.size() << "\n";
+    for (uint32_t obj = 0; obj < record.objects.size(); ++obj) {
+        const ObjectRecord &object = record.objects[obj];
+        msg_buffer << "        [" << obj << "] " << std::hex << std::showbase << object.handle << ", type: " << std::dec
+                   << std::noshowbase << object.type << ", name: " << (object.has_name ? object.name.c_str() : "NULL") << "\n";
+    }
+    const std::string formatted = msg_buffer.str();
+    out->append(formatted);
+
+#if defined __ANDROID__
+    LOGCONSOLE("%s", formatted.c_str());
+#endif
+}
+
+// Rebuilds the message fields from the record, so that the output matches JsonlLogSink
+void AsyncLogWriter::FormatJsonlRecord(const Record &record, std::string *out) {
+    std::vector<VkDebugUtilsObjectNameInfoEXT> objects(record.objects.size());
+    for (size_t obj = 0; obj < record.objects.size(); ++obj) {
+        objects[obj].sType = VK_STRUCTURE_TYPE_DEBUG_UTILS_OBJECT_NAME_INFO_EXT;
+        objects[obj].pNext = nullptr;
+        objects[obj].objectType = record.objects[obj].type;
+        objects[obj].objectHandle = record.objects[obj].handle;
+        objects[obj].pObjectName = record.objects[obj].has_name ? record.objects[obj].name.c_str() : nullptr;
+    }
+    auto make_labels = [](const std::vector<std::string> &names) {
+        std::vector<VkDebugUtilsLabelEXT> labels(names.size());
+        for (size_t label = 0; label < names.size(); ++label) {
+            labels[label] = {VK_STRUCTURE_TYPE_DEBUG_UTILS_LABEL_EXT, nullptr, names[label].c_str(), {0.0f, 0.0f, 0.0f, 0.0f}};
+        }
+        return labels;
+    };
+    const std::vector<VkDebugUtilsLabelEXT> queue_labels = make_labels(record.queue_labels);
+    const std::vector<VkDebugUtilsLabelEXT> cmd_buf_labels = make_labels(record.cmd_buf_labels);
+
+    VkDebugUtilsMessengerCallbackDataEXT callback_data = {};
+    callback_data.sType = VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CALLBACK_DATA_EXT;
+    callback_data.pMessageIdName = record.has_message_id ? record.message_id.c_str() : nullptr;
+    callback_data.messageIdNumber = record.message_id_number;
+    callback_data.queueLabelCount = static_cast<uint32_t>(queue_labels.size());
+    callback_data.pQueueLabels = queue_labels.data();
+    callback_data.cmdBufLabelCount = static_cast<uint32_t>(cmd_buf_labels.size());
+    callback_data.pCmdBufLabels = cmd_buf_labels.data();
+    callback_data.objectCount = static_cast<uint32_t>(objects.size());
+    callback_data.pObjects = objects.data();
+
+    const LogMessageFields fields = {record.severity, record.type, callback_data.pMessageIdName, record.message.c_str(),
+                                     &callback_data};
+    AppendJsonlMessageRecord(out, &interned_vuids_, fields, record.time_ns, record.thread_id);
+}
+
+void AsyncLogWriter::WriterLoop() {
+    std::string batch;
+    for (;;) {
+        const bool stopping = stop_.load(std::memory_order_acquire);
+
+        // Drain every record that is ready into a single batch
+        uint64_t drained = 0;
+        for (;;) {
+            Slot &slot = ring_[dequeue_pos_ & (kRingSize - 1)];
+            if (slot.sequence.load(std::memory_order_acquire) != dequeue_pos_ + 1) break;
+            if (format_ == Format::kJsonl) {
+                FormatJsonlRecord(slot.record, &batch);
+            } else {
+                FormatRecord(slot.record, &batch);
+            }
+            slot.sequence.store(dequeue_pos_ + kRingSize, std::memory_order_release);
+            ++dequeue_pos_;
+            ++drained;
+        }
+
+        if (drained) {
+            fwrite(batch.data(), 1, batch.size(), output_);
+            fflush(output_);
+            batch.clear();
+            {
+                std::lock_guard<std::mutex> lock(writer_mutex_);
+                written_count_ = dequeue_pos_;
+            }
+            records_written_.notify_all();
+            continue;
+        }
+        if (stopping) break;
+
+        // Producers notify without taking the lock, so bound the wait rather than rely on every wakeup arriving
+        std::unique_lock<std::mutex> lock(writer_mutex_);
+        work_available_.wait_for(lock, std::chrono::milliseconds(10));
+    }
+}
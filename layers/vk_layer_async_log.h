@@ -0,0 +1,108 @@
+/* Copyright (c) 2020 The Khronos Group Inc.
+ * Copyright (c) 2020 Valve Corporation
+ * Copyright (c) 2020 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+#include "vulkan/vulkan.h"
+
+struct LogMessageFields;
+
+// Writes debug messenger output to a log file from a dedicated thread.
+//
+// Validation threads only copy the unformatted message fields into a record in a bounded, lock-free multi-producer ring. The
+// writer thread composes and formats the records and writes everything available as one batch with a single fflush, so message
+// producers neither format text nor block on file I/O unless the ring is full.
+class AsyncLogWriter {
+  public:
+    // Text matches messenger_log_callback, JSONL matches JsonlLogSink
+    enum class Format { kText, kJsonl };
+
+    explicit AsyncLogWriter(FILE *output, Format format = Format::kText);
+    // Writes any queued messages before returning
+    ~AsyncLogWriter();
+
+    AsyncLogWriter(const AsyncLogWriter &) = delete;
+    AsyncLogWriter &operator=(const AsyncLogWriter &) = delete;
+
+    void Push(const LogMessageFields &fields);
+    // Blocks until every message pushed before the call has been written
+    void Flush();
+
+  private:
+    static const uint64_t kRingSize = 1024;  // Must be a power of two
+
+    struct ObjectRecord {
+        uint64_t handle;
+        VkObjectType type;
+        bool has_name;
+        std::string name;
+    };
+
+    // Slots are reused, so once the ring has warmed up, copying into a record's strings and objects reuses their storage
+    struct Record {
+        VkDebugUtilsMessageSeverityFlagBitsEXT severity;
+        VkDebugUtilsMessageTypeFlagsEXT type;
+        int32_t message_id_number;
+        bool has_message_id;
+        std::string message_id;
+        std::string message;
+        std::vector<ObjectRecord> objects;
+        // Only captured for JSONL
+        int64_t time_ns;
+        uint64_t thread_id;
+        std::vector<std::string> queue_labels;
+        std::vector<std::string> cmd_buf_labels;
+    };
+
+    // A slot is free for the producer claiming position p when sequence == p, and ready for the writer when
+    // sequence == p + 1.
+    struct Slot {
+        std::atomic<uint64_t> sequence;
+        Record record;
+    };
+
+    void WriterLoop();
+    static void FormatRecord(const Record &record, std::string *out);
+    void FormatJsonlRecord(const Record &record, std::string *out);
+
+    std::unique_ptr<Slot[]> ring_;
+    std::atomic<uint64_t> enqueue_pos_;
+    uint64_t dequeue_pos_;  // Only touched by the writer thread
+    std::atomic<bool> stop_;
+    FILE *output_;
+    const Format format_;
+    std::unordered_set<std::string> interned_vuids_;  // Only touched by the writer thread
+
+    std::mutex writer_mutex_;
+    std::condition_variable work_available_;
+    std::condition_variable records_written_;
+    uint64_t written_count_;  // Guarded by writer_mutex_
+
+    std::thread writer_thread_;
+};
@@ -20,9 +20,11 @@
 #ifndef LAYER_DATA_H
 #define LAYER_DATA_H
 
+#include <algorithm>
 #include <cassert>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 // This is a wrapper around unordered_map that optimizes for the common case
 // of only containing a small number of elements. The first N elements are stored
@@ -341,6 +343,62 @@ class small_unordered_map
 template <typename Key, int N = 1>
 class small_unordered_set : public small_container<Key, Key, std::unordered_set<Key>, value_type_helper_set<Key>, N> {};
 
+// This is a sorted set of unique values that optimizes for the common case of
+// only containing a small number of elements. The first N elements are stored
+// inline in the object, larger sets move to a vector. Iterators are pointers
+// into the sorted values and are invalidated by insert().
+template <typename T, int N>
+class small_flat_set {
+  public:
+    typedef const T *const_iterator;
+
+    small_flat_set() : small_data_(), size_(0) {}
+
+    const_iterator begin() const { return data(); }
+    const_iterator end() const { return data() + size_; }
+
+    const_iterator find(const T &value) const {
+        const_iterator it = std::lower_bound(begin(), end(), value);
+        return (it != end() && !(value < *it)) ? it : end();
+    }
+
+    size_t count(const T &value) const { return find(value) != end() ? 1 : 0; }
+
+    bool insert(const T &value) {
+        const size_t pos = std::lower_bound(begin(), end(), value) - begin();
+        if (pos < size_ && !(value < data()[pos])) {
+            return false;
+        }
+        if (size_ < N) {
+            std::copy_backward(small_data_ + pos, small_data_ + size_, small_data_ + size_ + 1);
+            small_data_[pos] = value;
+        } else {
+            if (size_ == N) {
+                large_data_.assign(small_data_, small_data_ + N);
+            }
+            large_data_.insert(large_data_.begin() + pos, value);
+        }
+        size_++;
+        return true;
+    }
+
+    size_t size() const { return size_; }
+
+    bool empty() const { return size_ == 0; }
+
+    void clear() {
+        large_data_.clear();
+        size_ = 0;
+    }
+
+  private:
+    const T *data() const { return size_ <= N ? small_data_ : large_data_.data(); }
+
+    T small_data_[N];
+    std::vector<T> large_data_;
+    size_t size_;
+};
+
 // For the given data key, look up the layer_data instance from given layer_data_map
 template <typename DATA_T>
 DATA_T *GetLayerDataPtr(void *data_key, small_unordered_map<void *, DATA_T *, 2> &layer_data_map) {
@@ -32,15 +32,19 @@
 
 #include <algorithm>
 #include <array>
+#include <chrono>
 #include <memory>
 #include <mutex>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 
 #include "vk_typemap_helper.h"
+#include "vk_layer_async_log.h"
 #include "vk_layer_config.h"
 #include "vk_layer_data.h"
 #include "vk_loader_platform.h"
@@ -80,6 +84,17 @@ typedef enum DebugCallbackStatusBits {
 } DebugCallbackStatusBits;
 typedef VkFlags DebugCallbackStatusFlags;
 
+// A message as debug_log_msg has it before joining the message id, object and text into pMessage. Layer-internal log sinks
+// receive this instead of the composed text, so they can format the message themselves, off the calling thread if they like.
+struct LogMessageFields {
+    VkDebugUtilsMessageSeverityFlagBitsEXT severity;
+    VkDebugUtilsMessageTypeFlagsEXT types;
+    const char *message_id;  // May be null
+    const char *message;     // The text given to LogError and friends
+    const VkDebugUtilsMessengerCallbackDataEXT *callback_data;  // pMessage is null
+};
+typedef void (*PFN_LayerLogSink)(const LogMessageFields &fields, void *user_data);
+
 typedef struct {
     DebugCallbackStatusFlags callback_status;
 
@@ -93,6 +108,8 @@ typedef struct {
     VkDebugUtilsMessageSeverityFlagsEXT debug_utils_msg_flags;
     VkDebugUtilsMessageTypeFlagsEXT debug_utils_msg_type;
     PFN_vkDebugUtilsMessengerCallbackEXT debug_utils_callback_function_ptr;
+    // Set instead of debug_utils_callback_function_ptr for layer-internal log sinks
+    PFN_LayerLogSink log_sink_function_ptr;
 
     void *pUserData;
 
@@ -167,6 +184,29 @@ struct LoggingLabelState {
 
 static inline int string_sprintf(std::string *output, const char *fmt, ...);
 
+// 32-bit FNV-1a hash of a message id (VUID) string, used to key message filtering and duplicate counting
+static inline uint32_t HashMessageId(const std::string &vuid_text) {
+    uint32_t hash = 2166136261u;
+    for (const char c : vuid_text) {
+        hash = (hash ^ static_cast<uint8_t>(c)) * 16777619u;
+    }
+    return hash;
+}
+
+// Number of times a message id has been reported. The id text is kept so that ids with the same hash are counted apart.
+struct MessageIdCount {
+    std::string vuid_text;
+    uint32_t count;
+};
+
+// State for the synchronous JSONL log sink: the output file, and the message ids whose spec text has already been written
+struct JsonlLogState {
+    FILE *output;
+    std::unordered_set<std::string> interned_vuids;
+
+    ~JsonlLogState() { fflush(output); }
+};
+
 typedef struct _debug_report_data {
     std::vector<VkLayerDbgFunctionState> debug_callback_list;
     VkDebugUtilsMessageSeverityFlagsEXT active_severities{0};
@@ -181,6 +221,17 @@ typedef struct _debug_report_data {
     // the layers to continue this pattern, but also allows them to use/change this specific member for synchronization purposes.
     mutable std::mutex debug_output_mutex;
     const void *instance_pnext_chain{};
+    // Message ids muted through the message_id_filter setting, keyed by HashMessageId. The id text is only compared when the
+    // hash matches.
+    std::unordered_multimap<uint32_t, std::string> filter_message_ids{};
+    // Maximum number of times any one message id is reported, 0 for no limit
+    uint32_t duplicate_message_limit{0};
+    // Times each message id has been reported, keyed by HashMessageId and guarded by debug_output_mutex
+    mutable std::unordered_multimap<uint32_t, MessageIdCount> duplicate_message_count_map{};
+    // Log file writer used by the default log messenger when the log_async setting is enabled
+    std::unique_ptr<AsyncLogWriter> async_log_writer{};
+    // Sink state used by the default log messenger when the log_format setting is jsonl and log_async is off
+    std::unique_ptr<JsonlLogState> jsonl_log_state{};
 
     void DebugReportSetUtilsObjectName(const VkDebugUtilsObjectNameInfoEXT *pNameInfo) {
         std::unique_lock<std::mutex> lock(debug_output_mutex);
@@ -314,6 +365,34 @@ static inline void RemoveAllMessageCallbacks(debug_report_data *debug_data, std:
     callbacks.clear();
 }
 
+// Appends the pMessage text for a message: "[ <vuid> ] Object: 0x<handle> (Name = <name> : Type = <type>) | <message>"
+static inline void AppendComposedMessage(std::string *out, const char *text_vuid, VkObjectType object_type, uint64_t src_object,
+                                         const char *object_name, const char *message) {
+    if (text_vuid != nullptr) {
+        out->append("[ ");
+        out->append(text_vuid);
+        out->append(" ] ");
+    }
+    if (0 != src_object) {
+        char handle[24];
+        snprintf(handle, sizeof(handle), "0x%" PRIx64, src_object);
+        out->append("Object: ");
+        out->append(handle);
+        if (object_name) {
+            out->append(" (Name = ");
+            out->append(object_name);
+            out->append(" : Type = ");
+        } else {
+            out->append(" (Type = ");
+        }
+    } else {
+        out->append("Object: VK_NULL_HANDLE (Type = ");
+    }
+    out->append(std::to_string(object_type));
+    out->append(") | ");
+    out->append(message);
+}
+
 static inline bool debug_log_msg(const debug_report_data *debug_data, VkFlags msg_flags, VkObjectType object_type,
                                  uint64_t src_object, size_t location, const char *layer_prefix, const char *message,
                                  const char *text_vuid) {
@@ -348,11 +427,8 @@ static inline bool debug_log_msg(const debug_report_data *debug_data, VkFlags ms
 
     std::vector<VkDebugUtilsLabelEXT> queue_labels;
     std::vector<VkDebugUtilsLabelEXT> cmd_buf_labels;
-    std::string composite_message = "";
-    std::ostringstream oss;
 
     if (0 != src_object) {
-        oss << "Object: 0x" << std::hex << src_object;
         // If this is a queue, add any queue labels to the callback data.
         if (VK_OBJECT_TYPE_QUEUE == object_name_info.objectType) {
             auto label_iter = debug_data->debugUtilsQueueLabels.find(reinterpret_cast<VkQueue>(src_object));
@@ -378,23 +454,17 @@ static inline bool debug_log_msg(const debug_report_data *debug_data, VkFlags ms
         }
         if (!object_label.empty()) {
             object_name_info.pObjectName = object_label.c_str();
-            oss << " (Name = " << object_label << " : Type = ";
-        } else {
-            oss << " (Type = ";
         }
-        oss << std::to_string(object_type) << ")";
-    } else {
-        oss << "Object: VK_NULL_HANDLE (Type = " << std::to_string(object_type) << ")";
     }
 
-    composite_message += oss.str();
-    composite_message += " | ";
-    composite_message += message;
-    if (text_vuid != nullptr) {
-        composite_message.insert(0, " ] ");
-        composite_message.insert(0, text_vuid);
-        composite_message.insert(0, "[ ");
-    }
+    // Log sinks format the message themselves, so the composed text is only built once a callback needs it
+    std::string composite_message;
+    auto get_composite_message = [&]() -> const char * {
+        if (composite_message.empty()) {
+            AppendComposedMessage(&composite_message, text_vuid, object_type, src_object, object_name_info.pObjectName, message);
+        }
+        return composite_message.c_str();
+    };
     const auto callback_list = &debug_data->debug_callback_list;
 
     // We only output to default callbacks if there are no non-default callbacks
@@ -410,14 +480,20 @@ static inline bool debug_log_msg(const debug_report_data *debug_data, VkFlags ms
         // VK_EXT_debug_report callback (deprecated)
         if (!current_callback.IsUtils() && (current_callback.debug_report_msg_flags & msg_flags)) {
             if (current_callback.debug_report_callback_function_ptr(msg_flags, convertCoreObjectToDebugReportObject(object_type),
-                                                                    src_object, location, 0, layer_prefix,
-                                                                    composite_message.c_str(), current_callback.pUserData)) {
+                                                                    src_object, location, 0, layer_prefix, get_composite_message(),
+                                                                    current_callback.pUserData)) {
                 bail = true;
             }
             // VK_EXT_debug_utils callback
         } else if (current_callback.IsUtils() && (current_callback.debug_utils_msg_flags & severity) &&
                    (current_callback.debug_utils_msg_type & types)) {
-            callback_data.pMessage = composite_message.c_str();
+            if (current_callback.log_sink_function_ptr) {
+                const LogMessageFields fields = {static_cast<VkDebugUtilsMessageSeverityFlagBitsEXT>(severity), types, text_vuid,
+                                                 message, &callback_data};
+                current_callback.log_sink_function_ptr(fields, current_callback.pUserData);
+                continue;
+            }
+            callback_data.pMessage = get_composite_message();
             if (current_callback.debug_utils_callback_function_ptr(static_cast<VkDebugUtilsMessageSeverityFlagBitsEXT>(severity),
                                                                    types, &callback_data, current_callback.pUserData)) {
                 bail = true;
@@ -526,6 +602,19 @@ static inline VkResult layer_create_messenger_callback(debug_report_data *debug_
     return VK_SUCCESS;
 }
 
+// Adds a default messenger whose messages go to the given log sink rather than to a VkDebugUtilsMessengerEXT callback
+static inline void layer_create_log_sink(debug_report_data *debug_data, const VkDebugUtilsMessengerCreateInfoEXT *create_info,
+                                         PFN_LayerLogSink log_sink) {
+    VkDebugUtilsMessengerEXT messenger = VK_NULL_HANDLE;
+    layer_create_messenger_callback(debug_data, true, create_info, nullptr, &messenger);
+    std::unique_lock<std::mutex> lock(debug_data->debug_output_mutex);
+    for (auto &callback_state : debug_data->debug_callback_list) {
+        if (callback_state.IsUtils() && callback_state.debug_utils_callback_object == messenger) {
+            callback_state.log_sink_function_ptr = log_sink;
+        }
+    }
+}
+
 static inline VkResult layer_create_report_callback(debug_report_data *debug_data, bool default_callback,
                                                     const VkDebugReportCallbackCreateInfoEXT *create_info,
                                                     const VkAllocationCallbacks *allocator, VkDebugReportCallbackEXT *callback) {
@@ -608,9 +697,71 @@ static inline int vasprintf(char **strp, char const *fmt, va_list ap) {
 }
 #endif
 
+// Returns the duplicate count entry of a message id, or nullptr if it has not been reported yet
+// This must be called with the debug_output_mutex already held
+static inline MessageIdCount *FindMessageIdCount(const debug_report_data *debug_data, const std::string &vuid_text,
+                                                 uint32_t message_hash) {
+    const auto range = debug_data->duplicate_message_count_map.equal_range(message_hash);
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second.vuid_text == vuid_text) return &it->second;
+    }
+    return nullptr;
+}
+
+// Returns true if the message id is filtered out, or was already reported duplicate_message_limit times
+// This must be called with the debug_output_mutex already held
+static inline bool LogMsgIdMuted(const debug_report_data *debug_data, const std::string &vuid_text, uint32_t message_hash) {
+    const auto range = debug_data->filter_message_ids.equal_range(message_hash);
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second == vuid_text) return true;
+    }
+    if (debug_data->duplicate_message_limit > 0) {
+        const MessageIdCount *count = FindMessageIdCount(debug_data, vuid_text, message_hash);
+        if (count && (count->count >= debug_data->duplicate_message_limit)) return true;
+    }
+    return false;
+}
+
+// Returns true if a message with the given id, severity and type would be reported. Callers check this before formatting
+// the message, so a muted message costs one hash of its id and a probe of each map.
+// This must be called with the debug_output_mutex already held
+static inline bool LogMsgEnabled(const debug_report_data *debug_data, const std::string &vuid_text,
+                                 VkDebugUtilsMessageSeverityFlagsEXT severity, VkDebugUtilsMessageTypeFlagsEXT type) {
+    if (!(debug_data->active_severities & severity) || !(debug_data->active_types & type)) {
+        return false;
+    }
+    if (debug_data->filter_message_ids.empty() && (debug_data->duplicate_message_limit == 0)) {
+        return true;
+    }
+    return !LogMsgIdMuted(debug_data, vuid_text, HashMessageId(vuid_text));
+}
+
+// Applies the message filter and counts the message against the duplicate message limit, so every message goes through
+// them whether or not the caller checked LogMsgEnabled first. Takes ownership of err_msg.
 // This must be called with the debug_output_mutex already held
 static inline bool LogMsgLocked(const debug_report_data *debug_data, VkFlags msg_flags, VkObjectType object_type,
                                 uint64_t src_object, const std::string &vuid_text, char *err_msg) {
+    VkDebugUtilsMessageSeverityFlagsEXT severity;
+    VkDebugUtilsMessageTypeFlagsEXT type;
+    DebugReportFlagsToAnnotFlags(msg_flags, true, &severity, &type);
+    bool enabled = (debug_data->active_severities & severity) && (debug_data->active_types & type);
+    if (enabled && (!debug_data->filter_message_ids.empty() || (debug_data->duplicate_message_limit > 0))) {
+        const uint32_t message_hash = HashMessageId(vuid_text);
+        enabled = !LogMsgIdMuted(debug_data, vuid_text, message_hash);
+        if (enabled && (debug_data->duplicate_message_limit > 0)) {
+            MessageIdCount *count = FindMessageIdCount(debug_data, vuid_text, message_hash);
+            if (count) {
+                ++count->count;
+            } else {
+                debug_data->duplicate_message_count_map.emplace(message_hash, MessageIdCount{vuid_text, 1});
+            }
+        }
+    }
+    if (!enabled) {
+        free(err_msg);
+        return false;
+    }
+
     std::string str_plus_spec_text(err_msg ? err_msg : "Allocation failure");
 
     // Append the spec error text to the error message, unless it's an UNASSIGNED or UNDEFINED vuid
@@ -697,6 +848,10 @@ static inline VKAPI_ATTR VkBool32 VKAPI_CALL MessengerBreakCallback(VkDebugUtils
                                                                     VkDebugUtilsMessageTypeFlagsEXT message_type,
                                                                     const VkDebugUtilsMessengerCallbackDataEXT *callback_data,
                                                                     void *user_data) {
+    // When logging asynchronously, make sure the message that triggered the break has reached the log first
+    if (user_data) {
+        static_cast<AsyncLogWriter *>(user_data)->Flush();
+    }
 #ifdef WIN32
     DebugBreak();
 #else
@@ -739,6 +894,144 @@ static inline VKAPI_ATTR VkBool32 VKAPI_CALL messenger_log_callback(VkDebugUtils
     return false;
 }
 
+// Queues the message for the AsyncLogWriter passed as user_data, which formats it like messenger_log_callback
+static inline void AsyncLogSink(const LogMessageFields &fields, void *user_data) {
+    static_cast<AsyncLogWriter *>(user_data)->Push(fields);
+}
+
+// Appends text to out as the contents of a JSON string, escaping as needed
+static inline void AppendJsonString(std::string *out, const char *text) {
+    static const char hex_digits[] = "0123456789abcdef";
+    for (const char *c = text; c && *c; ++c) {
+        switch (*c) {
+            case '"':
+                out->append("\\\"");
+                break;
+            case '\\':
+                out->append("\\\\");
+                break;
+            case '\n':
+                out->append("\\n");
+                break;
+            case '\r':
+                out->append("\\r");
+                break;
+            case '\t':
+                out->append("\\t");
+                break;
+            default:
+                if (static_cast<unsigned char>(*c) < 0x20) {
+                    out->append("\\u00");
+                    out->push_back(hex_digits[(*c >> 4) & 0xf]);
+                    out->push_back(hex_digits[*c & 0xf]);
+                } else {
+                    out->push_back(*c);
+                }
+                break;
+        }
+    }
+}
+
+static inline void AppendJsonLabels(std::string *out, const char *key, uint32_t label_count, const VkDebugUtilsLabelEXT *labels) {
+    out->append(",\"");
+    out->append(key);
+    out->append("\":[");
+    for (uint32_t i = 0; i < label_count; ++i) {
+        if (i) out->push_back(',');
+        out->push_back('"');
+        AppendJsonString(out, labels[i].pLabelName);
+        out->push_back('"');
+    }
+    out->push_back(']');
+}
+
+// JSONL log records are one JSON object per line, for offline aggregation with scripts/vk_validation_log_stats.py.
+//
+// A "run" record starts the output of each log sink, so that handles from different runs logged to the same file, or
+// concatenated logs, are not mistaken for one another. Each message becomes a "message" record, with the message id, text and
+// objects taken from the message fields rather than from the composed pMessage. The spec text appended to a message is written
+// once per message id as a separate "spec" record instead of being repeated in every message record.
+static inline int64_t JsonlTimestamp() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static inline uint64_t JsonlThreadId() { return std::hash<std::thread::id>()(std::this_thread::get_id()); }
+
+static inline void AppendJsonlRunRecord(std::string *out) {
+    out->append("{\"record\":\"run\",\"time_ns\":");
+    out->append(std::to_string(JsonlTimestamp()));
+    out->append("}\n");
+}
+
+static inline void AppendJsonlMessageRecord(std::string *out, std::unordered_set<std::string> *interned_vuids,
+                                            const LogMessageFields &fields, int64_t time_ns, uint64_t thread_id) {
+    static const char kSpecTextPrefix[] = " The Vulkan spec states: ";
+    const auto *callback_data = fields.callback_data;
+    const char *vuid = fields.message_id ? fields.message_id : "";
+    std::string message = fields.message;
+
+    const size_t spec_pos = message.find(kSpecTextPrefix);
+    if (spec_pos != std::string::npos) {
+        if (interned_vuids->insert(vuid).second) {
+            out->append("{\"record\":\"spec\",\"vuid\":\"");
+            AppendJsonString(out, vuid);
+            out->append("\",\"text\":\"");
+            AppendJsonString(out, message.c_str() + spec_pos + sizeof(kSpecTextPrefix) - 1);
+            out->append("\"}\n");
+        }
+        message.erase(spec_pos);
+    }
+
+    char msg_severity[30];
+    char msg_type[30];
+    PrintMessageSeverity(fields.severity, msg_severity);
+    PrintMessageType(fields.types, msg_type);
+
+    out->append("{\"record\":\"message\",\"time_ns\":");
+    out->append(std::to_string(time_ns));
+    out->append(",\"thread\":");
+    out->append(std::to_string(thread_id));
+    out->append(",\"vuid\":\"");
+    AppendJsonString(out, vuid);
+    out->append("\",\"severity\":\"");
+    out->append(msg_severity);
+    out->append("\",\"type\":\"");
+    out->append(msg_type);
+    out->append("\",\"message\":\"");
+    AppendJsonString(out, message.c_str());
+    out->append("\",\"objects\":[");
+    for (uint32_t obj = 0; obj < callback_data->objectCount; ++obj) {
+        const auto &object = callback_data->pObjects[obj];
+        char handle[32];
+        snprintf(handle, sizeof(handle), "0x%" PRIx64, object.objectHandle);
+        if (obj) out->push_back(',');
+        out->append("{\"handle\":\"");
+        out->append(handle);
+        out->append("\",\"type\":\"");
+        out->append(object_string[ConvertCoreObjectToVulkanObject(object.objectType)]);
+        out->append("\"");
+        if (object.pObjectName) {
+            out->append(",\"name\":\"");
+            AppendJsonString(out, object.pObjectName);
+            out->append("\"");
+        }
+        out->push_back('}');
+    }
+    out->push_back(']');
+    AppendJsonLabels(out, "queue_labels", callback_data->queueLabelCount, callback_data->pQueueLabels);
+    AppendJsonLabels(out, "cmd_buf_labels", callback_data->cmdBufLabelCount, callback_data->pCmdBufLabels);
+    out->append("}\n");
+}
+
+// Synchronous JSONL log sink. The output is left to stdio buffering rather than flushed per message; with log_async the
+// background writer formats the records instead and flushes once per batch.
+static inline void JsonlLogSink(const LogMessageFields &fields, void *user_data) {
+    auto state = static_cast<JsonlLogState *>(user_data);
+    std::string record;
+    AppendJsonlMessageRecord(&record, &state->interned_vuids, fields, JsonlTimestamp(), JsonlThreadId());
+    fwrite(record.data(), 1, record.size(), state->output);
+}
+
 static inline VKAPI_ATTR VkBool32 VKAPI_CALL messenger_win32_debug_output_msg(
     VkDebugUtilsMessageSeverityFlagBitsEXT message_severity, VkDebugUtilsMessageTypeFlagsEXT message_type,
     const VkDebugUtilsMessengerCallbackDataEXT *callback_data, void *user_data) {
@@ -22,6 +22,8 @@
 #include "vk_layer_utils.h"
 
 #include <string.h>
+#include <algorithm>
+#include <cctype>
 #include <string>
 #include <map>
 #include <vector>
@@ -99,9 +101,13 @@ VK_LAYER_EXPORT void layer_debug_messenger_actions(debug_report_data *report_dat
     std::string report_flags_key = layer_identifier;
     std::string debug_action_key = layer_identifier;
     std::string log_filename_key = layer_identifier;
+    std::string log_async_key = layer_identifier;
+    std::string log_format_key = layer_identifier;
     report_flags_key.append(".report_flags");
     debug_action_key.append(".debug_action");
     log_filename_key.append(".log_filename");
+    log_async_key.append(".log_async");
+    log_format_key.append(".log_format");
 
     // Initialize layer options
     LogMessageTypeFlags report_flags = GetLayerOptionFlags(report_flags_key, log_msg_type_option_definitions, 0);
@@ -131,9 +137,30 @@ VK_LAYER_EXPORT void layer_debug_messenger_actions(debug_report_data *report_dat
     if (debug_action & VK_DBG_LAYER_ACTION_LOG_MSG) {
         const char *log_filename = getLayerOption(log_filename_key.c_str());
         FILE *log_output = getLayerLogOutput(log_filename, layer_identifier);
-        dbgCreateInfo.pfnUserCallback = messenger_log_callback;
-        dbgCreateInfo.pUserData = (void *)log_output;
-        layer_create_messenger_callback(report_data, true, &dbgCreateInfo, pAllocator, &messenger);
+        std::string log_async = getLayerOption(log_async_key.c_str());
+        std::string log_format = getLayerOption(log_format_key.c_str());
+        std::transform(log_async.begin(), log_async.end(), log_async.begin(), ::tolower);
+        std::transform(log_format.begin(), log_format.end(), log_format.begin(), ::tolower);
+        const bool jsonl = (log_format == "jsonl");
+        if (log_async == "true") {
+            report_data->async_log_writer.reset(
+                new AsyncLogWriter(log_output, jsonl ? AsyncLogWriter::Format::kJsonl : AsyncLogWriter::Format::kText));
+            dbgCreateInfo.pfnUserCallback = nullptr;
+            dbgCreateInfo.pUserData = report_data->async_log_writer.get();
+            layer_create_log_sink(report_data, &dbgCreateInfo, AsyncLogSink);
+        } else if (jsonl) {
+            report_data->jsonl_log_state.reset(new JsonlLogState{log_output, {}});
+            std::string run_record;
+            AppendJsonlRunRecord(&run_record);
+            fwrite(run_record.data(), 1, run_record.size(), log_output);
+            dbgCreateInfo.pfnUserCallback = nullptr;
+            dbgCreateInfo.pUserData = report_data->jsonl_log_state.get();
+            layer_create_log_sink(report_data, &dbgCreateInfo, JsonlLogSink);
+        } else {
+            dbgCreateInfo.pfnUserCallback = messenger_log_callback;
+            dbgCreateInfo.pUserData = (void *)log_output;
+            layer_create_messenger_callback(report_data, true, &dbgCreateInfo, pAllocator, &messenger);
+        }
     }
 
     messenger = VK_NULL_HANDLE;
@@ -148,7 +175,7 @@ VK_LAYER_EXPORT void layer_debug_messenger_actions(debug_report_data *report_dat
 
     if (debug_action & VK_DBG_LAYER_ACTION_BREAK) {
         dbgCreateInfo.pfnUserCallback = MessengerBreakCallback;
-        dbgCreateInfo.pUserData = NULL;
+        dbgCreateInfo.pUserData = report_data->async_log_writer.get();
         layer_create_messenger_callback(report_data, true, &dbgCreateInfo, pAllocator, &messenger);
     }
 }
@@ -92,6 +92,7 @@ class BestPracticesOutputGenerator(OutputGenerator):
             ]
 
         self.extension_info = dict()
+        self.result_codes = {}
     #
     # Separate content for validation source and header files
     def otwrite(self, dest, formatstring):
@@ -166,6 +167,7 @@ class BestPracticesOutputGenerator(OutputGenerator):
                 ext_deprecation_data += '    {"%s", {kExt%s, "%s"}},\n' % (ext, ext_data[0], ext_data[1])
             ext_deprecation_data += '};\n'
             self.otwrite('hdr', ext_deprecation_data)
+            self.otwrite('hdr', self.GenerateResultBit())
         OutputGenerator.endFile(self)
     #
     # Processing point at beginning of each extension definition
@@ -189,6 +191,101 @@ class BestPracticesOutputGenerator(OutputGenerator):
             return
         self.extension_info[ext_name] = [reason, target]
     #
+    # Collect the VkResult codes, which give the bit layout of the return code masks
+    def genGroup(self, groupinfo, groupName, alias):
+        OutputGenerator.genGroup(self, groupinfo, groupName, alias)
+        if groupName == 'VkResult':
+            for elem in groupinfo.elem.findall('enum'):
+                if elem.get('supported') != 'disabled' and elem.get('alias') is None:
+                    if elem.get('name') != 'VK_SUCCESS':
+                        self.result_codes[elem.get('name')] = self.enumToValue(elem, True)[0]
+            if len(self.result_codes) > 64:
+                print("Error: VkResult codes no longer fit in a 64-bit return code mask, update generator source.\n")
+                sys.exit(1)
+    #
+    # Map every VkResult code but VK_SUCCESS to its own bit, so that the return codes of a command fold into constant masks.
+    # Codes are either small core values or +/-(1000000000 + extension_number * 1000 + offset), so each kind is mapped through
+    # its own dense table rather than compared one by one. Table entries are the bit index plus one, with 0 for no code.
+    def GenerateResultBit(self):
+        ext_base = 1000000000
+        bits = {}
+        core_codes = {}
+        ext_codes = {}
+        for index, code in enumerate(sorted(self.result_codes)):
+            value = self.result_codes[code]
+            bits[code] = index + 1
+            if abs(value) < ext_base:
+                core_codes[value] = code
+            else:
+                ext_number, ext_offset = divmod(abs(value) - ext_base, 1000)
+                ext_codes[(ext_number, ext_offset, value < 0)] = code
+        core_min = min(core_codes)
+        core_max = max(core_codes)
+        ext_count = max(key[0] for key in ext_codes) + 1
+        ext_offsets = max(key[1] for key in ext_codes) + 1
+        ext_numbers = sorted(set(key[0] for key in ext_codes))
+
+        result_bit = '\n// VkResult core codes lie in [kResultCoreMin, kResultCoreMax] and extension codes are\n'
+        result_bit += '// +/-(kResultExtBase + extension_number * 1000 + offset). Each kind maps to its return code mask bit through a dense\n'
+        result_bit += '// table of bit index plus one, with 0 for VK_SUCCESS and unknown codes.\n'
+        result_bit += 'static constexpr int32_t kResultCoreMin = %d;\n' % core_min
+        result_bit += 'static constexpr int32_t kResultCoreMax = %d;\n' % core_max
+        result_bit += 'static constexpr uint8_t kResultCoreBits[] = {\n'
+        for value in range(core_min, core_max + 1):
+            if value in core_codes:
+                result_bit += '    %d,  // %s\n' % (bits[core_codes[value]], core_codes[value])
+            else:
+                result_bit += '    0,\n'
+        result_bit += '};\n'
+        result_bit += 'static constexpr int32_t kResultExtBase = %d;\n' % ext_base
+        result_bit += 'static constexpr uint32_t kResultExtCount = %d;\n' % ext_count
+        result_bit += 'static constexpr uint32_t kResultExtOffsets = %d;\n' % ext_offsets
+        result_bit += '// Row of kResultExtBits plus one for each extension number, 0 for extensions without result codes\n'
+        result_bit += 'static constexpr uint8_t kResultExtRows[kResultExtCount] = {'
+        rows = [str(ext_numbers.index(number) + 1) if number in ext_numbers else '0' for number in range(ext_count)]
+        for index in range(0, len(rows), 32):
+            result_bit += '\n    ' + ', '.join(rows[index:index + 32]) + ','
+        result_bit += '\n};\n'
+        result_bit += '// Indexed by offset * 2, plus one for error codes\n'
+        result_bit += 'static constexpr uint8_t kResultExtBits[][kResultExtOffsets * 2] = {\n'
+        for number in ext_numbers:
+            row = []
+            names = []
+            for offset in range(ext_offsets):
+                for error in [False, True]:
+                    code = ext_codes.get((number, offset, error))
+                    row.append(str(bits[code]) if code else '0')
+                    if code:
+                        names.append(code)
+            result_bit += '    {%s},  // %s\n' % (', '.join(row), ', '.join(names))
+        result_bit += '};\n'
+        result_bit += '\n'
+        result_bit += 'static constexpr uint64_t ResultBitFromEntry(uint32_t entry) { return entry ? 1ULL << (entry - 1) : 0; }\n'
+        result_bit += '\n'
+        result_bit += '// code is the absolute value of the result less kResultExtBase\n'
+        result_bit += 'static constexpr uint64_t ResultExtBit(uint32_t code, bool error) {\n'
+        result_bit += '    return (code / 1000 < kResultExtCount && code % 1000 < kResultExtOffsets && kResultExtRows[code / 1000])\n'
+        result_bit += '               ? ResultBitFromEntry(kResultExtBits[kResultExtRows[code / 1000] - 1][(code % 1000) * 2 + error])\n'
+        result_bit += '               : 0;\n'
+        result_bit += '}\n'
+        result_bit += '\n'
+        result_bit += '// Bit of a VkResult code in the return code masks passed to ValidateReturnCodes, 0 for VK_SUCCESS and unknown codes\n'
+        result_bit += 'static constexpr uint64_t VkResultBit(VkResult result) {\n'
+        result_bit += '    return (result >= kResultCoreMin && result <= kResultCoreMax)\n'
+        result_bit += '               ? ResultBitFromEntry(kResultCoreBits[result - kResultCoreMin])\n'
+        result_bit += '               : (result >= kResultExtBase)\n'
+        result_bit += '                     ? ResultExtBit(static_cast<uint32_t>(result - kResultExtBase), false)\n'
+        result_bit += '                     : (result <= -kResultExtBase) ? ResultExtBit(static_cast<uint32_t>(-(result + kResultExtBase)), true) : 0;\n'
+        result_bit += '}\n'
+        return result_bit
+    #
+    # OR the bits of a comma separated list of VkResult codes into a constant mask expression
+    def ResultMask(self, codes):
+        codes = [code for code in (codes or '').split(',') if code != '']
+        if not codes:
+            return '0'
+        return ' | '.join('VkResultBit(%s)' % code for code in codes)
+    #
     # Retrieve the type and name for a parameter
     def getTypeNameTuple(self, param):
         type = ''
@@ -244,14 +341,8 @@ class BestPracticesOutputGenerator(OutputGenerator):
             params_text = params_text[:-2] + ');\n'
             intercept += '    ValidationStateTracker::PostCallRecord'+cmdname[2:] + '(' + params_text
             intercept += '    if (result != VK_SUCCESS) {\n'
-            if error_codes is not None:
-                intercept += '        static const std::vector<VkResult> error_codes = {%s};\n' % error_codes
-            else:
-                intercept += '        static const std::vector<VkResult> error_codes = {};\n'
-            if success_codes is not None:
-                intercept += '        static const std::vector<VkResult> success_codes = {%s};\n' % success_codes
-            else:
-                intercept += '        static const std::vector<VkResult> success_codes = {};\n'
+            intercept += '        static constexpr uint64_t error_codes = %s;\n' % self.ResultMask(error_codes)
+            intercept += '        static constexpr uint64_t success_codes = %s;\n' % self.ResultMask(success_codes)
             intercept += '        ValidateReturnCodes("%s", result, error_codes, success_codes);\n' % cmdname
             intercept += '    }\n'
             intercept += '}\n'
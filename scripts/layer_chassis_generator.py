@@ -124,6 +124,17 @@ class LayerChassisOutputGenerator(OutputGenerator):
                      'group', 'bitmask', 'funcpointer', 'struct']
     ALL_SECTIONS = TYPE_SECTIONS + ['command']
 
+    # Manually implemented device functions that still charge their costs to EntryPointCosts
+    costed_manual_functions = [
+        'vkCreateGraphicsPipelines',
+        'vkCreateComputePipelines',
+        'vkCreateRayTracingPipelinesNV',
+        'vkCreatePipelineLayout',
+        'vkCreateShaderModule',
+        'vkAllocateDescriptorSets',
+        'vkCreateBuffer',
+        ]
+
     manual_functions = [
         # Include functions here to be interecpted w/ manually implemented function bodies
         'vkGetDeviceProcAddr',
@@ -224,6 +235,8 @@ class LayerChassisOutputGenerator(OutputGenerator):
 #include "vk_extension_helper.h"
 #include "vk_safe_struct.h"
 #include "vk_typemap_helper.h"
+#include "handle_registry.h"
+#include "entry_point_costs.h"
 
 
 extern std::atomic<uint64_t> global_unique_id;
@@ -291,6 +304,8 @@ typedef enum ValidationCheckDisables {
 typedef enum ValidationCheckEnables {
     VALIDATION_CHECK_ENABLE_VENDOR_SPECIFIC_ARM,
     VALIDATION_CHECK_ENABLE_VENDOR_SPECIFIC_ALL,
+    VALIDATION_CHECK_ENABLE_UNIFIED_HANDLE_REGISTRY,
+    VALIDATION_CHECK_ENABLE_ENTRY_POINT_COSTS,
 } ValidationCheckEnables;
 
 // CHECK_DISABLED struct is a container for bools that can block validation checks from being performed.
@@ -318,6 +333,8 @@ struct CHECK_ENABLED {
     bool gpu_validation;
     bool gpu_validation_reserve_binding_slot;
     bool best_practices;
+    bool unified_handle_registry;                   // Share one per-handle table between the device's validation objects
+    bool entry_point_costs;                         // Count calls and time spent per entry point and validation object
     bool vendor_specific_arm;                       // Vendor-specific validation for Arm platforms
 
     void SetAllVendorSpecific(bool value) { std::fill(&vendor_specific_arm, &vendor_specific_arm + 1, value); }
@@ -347,6 +364,14 @@ class ValidationObject {
 
         std::string layer_name = "CHASSIS";
 
+        // The device's shared per-handle table, owned by the device's chassis object
+        std::unique_ptr<HandleRegistry> handle_registry;
+        // Called at CreateDevice time, before any handle of the device exists, for validation objects that keep their
+        // per-handle data in the registry
+        virtual void AttachHandleRegistry(HandleRegistry *registry) {};
+        // The device's entry point call counts and timings, owned by the device's chassis object
+        std::unique_ptr<EntryPointCosts> entry_point_costs;
+
         // Constructor
         ValidationObject(){};
         // Destructor
@@ -375,8 +400,7 @@ class ValidationObject {
 
             std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
             // Avoid logging cost if msg is to be ignored
-            if (!(report_data->active_severities & VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT) ||
-                !(report_data->active_types & VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT)) {
+            if (!LogMsgEnabled(report_data, vuid_text, VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT, VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT)) {
                 return false;
             }
             va_list argptr;
@@ -395,8 +419,7 @@ class ValidationObject {
         bool LogWarning(HANDLE_T src_object, const std::string &vuid_text, const char *format, ...) const {
             std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
             // Avoid logging cost if msg is to be ignored
-            if (!(report_data->active_severities & VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT) ||
-                !(report_data->active_types & VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT)) {
+            if (!LogMsgEnabled(report_data, vuid_text, VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT, VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT)) {
                 return false;
             }
             va_list argptr;
@@ -415,8 +438,7 @@ class ValidationObject {
         bool LogPerformanceWarning(HANDLE_T src_object, const std::string &vuid_text, const char *format, ...) const {
             std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
             // Avoid logging cost if msg is to be ignored
-            if (!(report_data->active_severities & VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT) ||
-                !(report_data->active_types & VK_DEBUG_UTILS_MESSAGE_TYPE_PERFORMANCE_BIT_EXT)) {
+            if (!LogMsgEnabled(report_data, vuid_text, VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT, VK_DEBUG_UTILS_MESSAGE_TYPE_PERFORMANCE_BIT_EXT)) {
                 return false;
             }
             va_list argptr;
@@ -435,8 +457,7 @@ class ValidationObject {
         bool LogInfo(HANDLE_T src_object, const std::string &vuid_text, const char *format, ...) const {
             std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
             // Avoid logging cost if msg is to be ignored
-            if (!(report_data->active_severities & VK_DEBUG_UTILS_MESSAGE_SEVERITY_INFO_BIT_EXT) ||
-                !(report_data->active_types & VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT)) {
+            if (!LogMsgEnabled(report_data, vuid_text, VK_DEBUG_UTILS_MESSAGE_SEVERITY_INFO_BIT_EXT, VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT)) {
                 return false;
             }
             va_list argptr;
@@ -535,6 +556,7 @@ class ValidationObject {
 
     inline_custom_source_preamble = """
 
+#include <stdlib.h>
 #include <string.h>
 #include <mutex>
 
@@ -593,6 +615,7 @@ typedef struct {
 } function_data;
 
 extern const std::unordered_map<std::string, function_data> name_to_funcptr_map;
+extern const char *const kEntryPointNames[kEntryPointCount];
 
 // Manually written functions
 
@@ -653,6 +676,8 @@ static const std::unordered_map<std::string, ValidationCheckDisables> Validation
 static const std::unordered_map<std::string, ValidationCheckEnables> ValidationEnableLookup = {
     {"VALIDATION_CHECK_ENABLE_VENDOR_SPECIFIC_ARM", VALIDATION_CHECK_ENABLE_VENDOR_SPECIFIC_ARM},
     {"VALIDATION_CHECK_ENABLE_VENDOR_SPECIFIC_ALL", VALIDATION_CHECK_ENABLE_VENDOR_SPECIFIC_ALL},
+    {"VALIDATION_CHECK_ENABLE_UNIFIED_HANDLE_REGISTRY", VALIDATION_CHECK_ENABLE_UNIFIED_HANDLE_REGISTRY},
+    {"VALIDATION_CHECK_ENABLE_ENTRY_POINT_COSTS", VALIDATION_CHECK_ENABLE_ENTRY_POINT_COSTS},
 };
 
 // Set the local disable flag for the appropriate VALIDATION_CHECK_DISABLE enum
@@ -720,6 +745,12 @@ void SetValidationEnable(CHECK_ENABLED* enable_data, const ValidationCheckEnable
         case VALIDATION_CHECK_ENABLE_VENDOR_SPECIFIC_ALL:
             enable_data->SetAllVendorSpecific(true);
             break;
+        case VALIDATION_CHECK_ENABLE_UNIFIED_HANDLE_REGISTRY:
+            enable_data->unified_handle_registry = true;
+            break;
+        case VALIDATION_CHECK_ENABLE_ENTRY_POINT_COSTS:
+            enable_data->entry_point_costs = true;
+            break;
         default:
             assert(true);
     }
@@ -825,16 +856,44 @@ void SetLocalDisableSetting(std::string list_of_disables, std::string delimiter,
     }
 }
 
+// Given a string representation of a list of message ids, add them to the set of muted messages
+void SetLocalMessageIdFilter(std::string list_of_ids, std::string delimiter, debug_report_data* debug_data) {
+    size_t pos = 0;
+    std::string token;
+    while (list_of_ids.length() != 0) {
+        pos = list_of_ids.find(delimiter);
+        if (pos != std::string::npos) {
+            token = list_of_ids.substr(0, pos);
+        } else {
+            pos = list_of_ids.length() - delimiter.length();
+            token = list_of_ids;
+        }
+        if (!token.empty()) {
+            debug_data->filter_message_ids.emplace(HashMessageId(token), token);
+        }
+        list_of_ids.erase(0, pos + delimiter.length());
+    }
+}
+
 // Process enables and disables set though the vk_layer_settings.txt config file or through an environment variable
-void ProcessConfigAndEnvSettings(const char* layer_description, CHECK_ENABLED* enables, CHECK_DISABLED* disables) {
+void ProcessConfigAndEnvSettings(const char* layer_description, CHECK_ENABLED* enables, CHECK_DISABLED* disables,
+                                 debug_report_data* debug_data) {
     std::string enable_key = layer_description;
     std::string disable_key = layer_description;
+    std::string message_id_filter_key = layer_description;
+    std::string duplicate_message_limit_key = layer_description;
     enable_key.append(".enables");
     disable_key.append(".disables");
+    message_id_filter_key.append(".message_id_filter");
+    duplicate_message_limit_key.append(".duplicate_message_limit");
     std::string list_of_config_enables = getLayerOption(enable_key.c_str());
     std::string list_of_env_enables = GetLayerEnvVar("VK_LAYER_ENABLES");
     std::string list_of_config_disables = getLayerOption(disable_key.c_str());
     std::string list_of_env_disables = GetLayerEnvVar("VK_LAYER_DISABLES");
+    std::string list_of_config_filter_ids = getLayerOption(message_id_filter_key.c_str());
+    std::string list_of_env_filter_ids = GetLayerEnvVar("VK_LAYER_MESSAGE_ID_FILTER");
+    std::string config_duplicate_message_limit = getLayerOption(duplicate_message_limit_key.c_str());
+    std::string env_duplicate_message_limit = GetLayerEnvVar("VK_LAYER_DUPLICATE_MESSAGE_LIMIT");
 #if defined(_WIN32)
     std::string env_delimiter = ";";
 #else
@@ -844,6 +903,43 @@ void ProcessConfigAndEnvSettings(const char* layer_description, CHECK_ENABLED* e
     SetLocalEnableSetting(list_of_env_enables, env_delimiter, enables);
     SetLocalDisableSetting(list_of_config_disables, ",", disables);
     SetLocalDisableSetting(list_of_env_disables, env_delimiter, disables);
+    SetLocalMessageIdFilter(list_of_config_filter_ids, ",", debug_data);
+    SetLocalMessageIdFilter(list_of_env_filter_ids, env_delimiter, debug_data);
+    // The environment variable overrides the config file limit
+    const std::string &duplicate_message_limit =
+        env_duplicate_message_limit.empty() ? config_duplicate_message_limit : env_duplicate_message_limit;
+    if (!duplicate_message_limit.empty()) {
+        debug_data->duplicate_message_limit = static_cast<uint32_t>(strtoul(duplicate_message_limit.c_str(), nullptr, 10));
+    }
+}
+
+// Names of the validation objects entry point costs are reported for, indexed by LayerObjectTypeId. The command counter is
+// the only object dispatched to as LayerObjectTypeDevice.
+static const char *const kLayerObjectTypeNames[LayerObjectTypeMaxEnum] = {
+    "Instance", "CommandCounter", "Threading", "ParameterValidation",
+    "ObjectTracker", "CoreValidation", "BestPractices", "GpuAssisted",
+};
+
+// The validation objects a device dispatches to, as a mask of LayerObjectTypeId bits
+static uint32_t DispatchedObjectTypeMask(const ValidationObject *layer_data) {
+    uint32_t mask = 0;
+    for (auto intercept : layer_data->object_dispatch) {
+        mask |= 1u << intercept->container_type;
+    }
+    return mask;
+}
+
+// Appends the entry point costs of a device to the file named by the entry_point_costs_file setting, if there is one
+static void DumpEntryPointCosts(const ValidationObject *layer_data) {
+    std::string costs_file_key = OBJECT_LAYER_DESCRIPTION;
+    costs_file_key.append(".entry_point_costs_file");
+    const std::string costs_file = getLayerOption(costs_file_key.c_str());
+    if (costs_file.empty()) return;
+    FILE *out = (costs_file == "stdout") ? stdout : fopen(costs_file.c_str(), "a");
+    if (!out) return;
+    fprintf(out, "Entry point costs of %s:\n", layer_data->report_data->FormatHandle(layer_data->device).c_str());
+    layer_data->entry_point_costs->Dump(out, DispatchedObjectTypeMask(layer_data));
+    if (out != stdout) fclose(out);
 }
 
 
@@ -949,7 +1045,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo *pCreat
     if (validation_flags_ext) {
         SetValidationFlags(&local_disables, validation_flags_ext);
     }
-    ProcessConfigAndEnvSettings(OBJECT_LAYER_DESCRIPTION, &local_enables, &local_disables);
+    ProcessConfigAndEnvSettings(OBJECT_LAYER_DESCRIPTION, &local_enables, &local_disables, report_data);
 
     // Create temporary dispatch vector for pre-calls until instance is created
     std::vector<ValidationObject*> local_object_dispatch;
@@ -1210,6 +1306,18 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice gpu, const VkDevice
         dev_intercept->device_extensions = device_interceptor->device_extensions;
     }
 
+    if (instance_interceptor->enabled.unified_handle_registry) {
+        device_interceptor->handle_registry.reset(new HandleRegistry);
+        for (auto dev_intercept : device_interceptor->object_dispatch) {
+            dev_intercept->AttachHandleRegistry(device_interceptor->handle_registry.get());
+        }
+    }
+
+    if (instance_interceptor->enabled.entry_point_costs) {
+        device_interceptor->entry_point_costs.reset(
+            new EntryPointCosts(kEntryPointCount, kEntryPointNames, LayerObjectTypeMaxEnum, kLayerObjectTypeNames));
+    }
+
     for (auto intercept : instance_interceptor->object_dispatch) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateDevice(gpu, pCreateInfo, pAllocator, pDevice, result);
@@ -1239,6 +1347,10 @@ VKAPI_ATTR void VKAPI_CALL DestroyDevice(VkDevice device, const VkAllocationCall
         intercept->PostCallRecordDestroyDevice(device, pAllocator);
     }
 
+    if (layer_data->entry_point_costs) {
+        DumpEntryPointCosts(layer_data);
+    }
+
     for (auto item = layer_data->object_dispatch.begin(); item != layer_data->object_dispatch.end(); item++) {
         delete *item;
     }
@@ -1256,6 +1368,8 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateGraphicsPipelines(
     const VkAllocationCallbacks*                pAllocator,
     VkPipeline*                                 pPipelines) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCreateGraphicsPipelines);
     bool skip = false;
 
     create_graphics_pipeline_api_state cgpl_state[LayerObjectTypeMaxEnum]{};
@@ -1263,11 +1377,13 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateGraphicsPipelines(
     for (auto intercept : layer_data->object_dispatch) {
         cgpl_state[intercept->container_type].pCreateInfos = pCreateInfos;
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateGraphicsPipelines, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, &(cgpl_state[intercept->container_type]));
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateGraphicsPipelines, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, &(cgpl_state[intercept->container_type]));
     }
 
@@ -1277,6 +1393,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateGraphicsPipelines(
 
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateGraphicsPipelines, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, result, &(cgpl_state[intercept->container_type]));
     }
     return result;
@@ -1291,6 +1408,8 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateComputePipelines(
     const VkAllocationCallbacks*                pAllocator,
     VkPipeline*                                 pPipelines) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCreateComputePipelines);
     bool skip = false;
 
     create_compute_pipeline_api_state ccpl_state[LayerObjectTypeMaxEnum]{};
@@ -1298,11 +1417,13 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateComputePipelines(
     for (auto intercept : layer_data->object_dispatch) {
         ccpl_state[intercept->container_type].pCreateInfos = pCreateInfos;
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateComputePipelines, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, &(ccpl_state[intercept->container_type]));
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateComputePipelines, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, &(ccpl_state[intercept->container_type]));
     }
 
@@ -1312,6 +1433,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateComputePipelines(
 
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateComputePipelines, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, result, &(ccpl_state[intercept->container_type]));
     }
     return result;
@@ -1325,6 +1447,8 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRayTracingPipelinesNV(
     const VkAllocationCallbacks*                pAllocator,
     VkPipeline*                                 pPipelines) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCreateRayTracingPipelinesNV);
     bool skip = false;
 
     create_ray_tracing_pipeline_api_state crtpl_state[LayerObjectTypeMaxEnum]{};
@@ -1332,12 +1456,14 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRayTracingPipelinesNV(
     for (auto intercept : layer_data->object_dispatch) {
         crtpl_state[intercept->container_type].pCreateInfos = pCreateInfos;
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateRayTracingPipelinesNV, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateRayTracingPipelinesNV(device, pipelineCache, createInfoCount, pCreateInfos,
                                                                       pAllocator, pPipelines, &(crtpl_state[intercept->container_type]));
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateRayTracingPipelinesNV, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCreateRayTracingPipelinesNV(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                             pPipelines, &(crtpl_state[intercept->container_type]));
     }
@@ -1346,6 +1472,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRayTracingPipelinesNV(
 
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateRayTracingPipelinesNV, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCreateRayTracingPipelinesNV(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                              pPipelines, result, &(crtpl_state[intercept->container_type]));
     }
@@ -1359,6 +1486,8 @@ VKAPI_ATTR VkResult VKAPI_CALL CreatePipelineLayout(
     const VkAllocationCallbacks*                pAllocator,
     VkPipelineLayout*                           pPipelineLayout) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCreatePipelineLayout);
     bool skip = false;
 
     create_pipeline_layout_api_state cpl_state{};
@@ -1366,16 +1495,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreatePipelineLayout(
 
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreatePipelineLayout, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreatePipelineLayout, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout, &cpl_state);
     }
     VkResult result = DispatchCreatePipelineLayout(device, &cpl_state.modified_create_info, pAllocator, pPipelineLayout);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreatePipelineLayout, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout, result);
     }
     return result;
@@ -1388,6 +1520,8 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateShaderModule(
     const VkAllocationCallbacks*                pAllocator,
     VkShaderModule*                             pShaderModule) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCreateShaderModule);
     bool skip = false;
 
     create_shader_module_api_state csm_state{};
@@ -1395,16 +1529,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateShaderModule(
 
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateShaderModule, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule, &csm_state);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateShaderModule, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule, &csm_state);
     }
     VkResult result = DispatchCreateShaderModule(device, &csm_state.instrumented_create_info, pAllocator, pShaderModule);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateShaderModule, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule, result, &csm_state);
     }
     return result;
@@ -1415,22 +1552,27 @@ VKAPI_ATTR VkResult VKAPI_CALL AllocateDescriptorSets(
     const VkDescriptorSetAllocateInfo*          pAllocateInfo,
     VkDescriptorSet*                            pDescriptorSets) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointAllocateDescriptorSets);
     bool skip = false;
 
     cvdescriptorset::AllocateDescriptorSetsData ads_state(pAllocateInfo->descriptorSetCount);
 
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointAllocateDescriptorSets, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateAllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets, &ads_state);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointAllocateDescriptorSets, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordAllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets);
     }
     VkResult result = DispatchAllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointAllocateDescriptorSets, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordAllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets, result, &ads_state);
     }
     return result;
@@ -1443,6 +1585,8 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateBuffer(
     const VkAllocationCallbacks*                pAllocator,
     VkBuffer*                                   pBuffer) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    auto entry_point_costs = layer_data->entry_point_costs.get();
+    if (entry_point_costs) entry_point_costs->AddCall(kEntryPointCreateBuffer);
     bool skip = false;
 
     create_buffer_api_state cb_state{};
@@ -1450,16 +1594,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateBuffer(
 
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->read_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateBuffer, kEntryPointPreCallValidate, intercept->container_type);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateBuffer(device, pCreateInfo, pAllocator, pBuffer);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateBuffer, kEntryPointPreCallRecord, intercept->container_type);
         intercept->PreCallRecordCreateBuffer(device, pCreateInfo, pAllocator, pBuffer, &cb_state);
     }
     VkResult result = DispatchCreateBuffer(device, &cb_state.modified_create_info, pAllocator, pBuffer);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
+        EntryPointTimer timer(entry_point_costs, kEntryPointCreateBuffer, kEntryPointPostCallRecord, intercept->container_type);
         intercept->PostCallRecordCreateBuffer(device, pCreateInfo, pAllocator, pBuffer, result);
     }
     return result;
@@ -1582,6 +1729,22 @@ VKAPI_ATTR VkResult VKAPI_CALL GetValidationCacheDataEXT(
     }
     return result;
 
+}
+
+// Layer-specific query of a device's entry point costs, see entry_point_costs.h
+VKAPI_ATTR VkResult VKAPI_CALL GetEntryPointCostsLAYER(VkDevice device, uint32_t *pCostCount, LayerEntryPointCost *pCosts) {
+    auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    if (!layer_data->entry_point_costs) return VK_ERROR_FEATURE_NOT_PRESENT;
+
+    const auto costs = layer_data->entry_point_costs->Collect(DispatchedObjectTypeMask(layer_data));
+    if (!pCosts) {
+        *pCostCount = static_cast<uint32_t>(costs.size());
+        return VK_SUCCESS;
+    }
+    const uint32_t count = std::min(*pCostCount, static_cast<uint32_t>(costs.size()));
+    std::copy(costs.begin(), costs.begin() + count, pCosts);
+    *pCostCount = count;
+    return (count < costs.size()) ? VK_INCOMPLETE : VK_SUCCESS;
 }"""
 
     inline_custom_validation_class_definitions = """
@@ -1722,6 +1885,7 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVe
         # Internal state - accumulators for different inner block text
         self.sections = dict([(section, []) for section in self.ALL_SECTIONS])
         self.intercepts = []
+        self.entry_points = []                      # Commands with an EntryPointId, in declaration order
         self.layer_factory = ''                     # String containing base layer factory class definition
 
     # Check if the parameter passed in is a pointer to an array
@@ -1760,6 +1924,12 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVe
         self.newline()
         if not self.header:
             # Record intercepted procedures
+            write('// Names of the entry points, indexed by EntryPointId', file=self.outFile)
+            write('const char *const kEntryPointNames[kEntryPointCount] = {', file=self.outFile)
+            write('\n'.join(['    "%s",' % name for name in self.entry_points]), file=self.outFile)
+            write('};\n', file=self.outFile)
+            # Layer-specific functions
+            self.intercepts += [ '    {"vkGetEntryPointCostsLAYER", {kFuncTypeDev, (void*)GetEntryPointCostsLAYER}},' ]
             write('// Map of intercepted ApiName to its associated function data', file=self.outFile)
             write('#ifdef _MSC_VER', file=self.outFile)
             write('#pragma warning( suppress: 6262 ) // VS analysis: this uses more than 16 kiB, which is fine here at global scope', file=self.outFile)
@@ -1775,6 +1945,13 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVe
             self.layer_factory += self.inline_custom_validation_class_definitions
             self.layer_factory += '};\n\n'
             self.layer_factory += 'extern small_unordered_map<void*, ValidationObject*, 2> layer_data_map;'
+            # Ids of the entry points whose costs are counted
+            entry_point_ids = '// Ids of the entry points an EntryPointCosts keeps counters for\n'
+            entry_point_ids += 'enum EntryPointId {\n'
+            entry_point_ids += ''.join(['    kEntryPoint%s,\n' % name[2:] for name in self.entry_points])
+            entry_point_ids += '    kEntryPointCount,\n'
+            entry_point_ids += '};'
+            write(entry_point_ids, file=self.outFile)
             write(self.layer_factory, file=self.outFile)
         else:
             write(self.inline_custom_source_postamble, file=self.outFile)
@@ -1871,18 +2048,6 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVe
         if name in ignore_functions:
             return
 
-        if self.header: # In the header declare all intercepts
-            self.appendSection('command', '')
-            self.appendSection('command', self.makeCDecls(cmdinfo.elem)[0])
-            if (self.featureExtraProtect != None):
-                self.layer_factory += '#ifdef %s\n' % self.featureExtraProtect
-            # Update base class with virtual function declarations
-            if 'ValidationCache' not in name:
-                self.layer_factory += self.BaseClassCdecl(cmdinfo.elem, name)
-            if (self.featureExtraProtect != None):
-                self.layer_factory += '#endif\n'
-            return
-
         dispatchable_type = cmdinfo.elem.find('param/type').text
         special_case_instance_APIs = [
             'vkCreateInstance',
@@ -1897,6 +2062,23 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVe
         else:
             function_type = 'kFuncTypeDev'
 
+        # Device functions going through the chassis intercepts get an EntryPointId to charge their costs to
+        costed = function_type == 'kFuncTypeDev' and (name not in self.manual_functions or name in self.costed_manual_functions)
+        if costed:
+            self.entry_points.append(name)
+
+        if self.header: # In the header declare all intercepts
+            self.appendSection('command', '')
+            self.appendSection('command', self.makeCDecls(cmdinfo.elem)[0])
+            if (self.featureExtraProtect != None):
+                self.layer_factory += '#ifdef %s\n' % self.featureExtraProtect
+            # Update base class with virtual function declarations
+            if 'ValidationCache' not in name:
+                self.layer_factory += self.BaseClassCdecl(cmdinfo.elem, name)
+            if (self.featureExtraProtect != None):
+                self.layer_factory += '#endif\n'
+            return
+
         if name in self.manual_functions:
             self.intercepts += [ '    {"%s", {%s, (void*)%s}},' % (name, function_type, name[2:]) ]
             return
@@ -1914,6 +2096,10 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVe
         # Setup common to call wrappers. First parameter is always dispatchable
         dispatchable_name = cmdinfo.elem.find('param/name').text
         self.appendSection('command', '    auto layer_data = GetLayerDataPtr(get_dispatch_key(%s), layer_data_map);' % (dispatchable_name))
+        entry_point_id = 'kEntryPoint' + name[2:]
+        if costed:
+            self.appendSection('command', '    auto entry_point_costs = layer_data->entry_point_costs.get();')
+            self.appendSection('command', '    if (entry_point_costs) entry_point_costs->AddCall(%s);' % entry_point_id)
         api_function_name = cmdinfo.elem.attrib.get('name')
         params = cmdinfo.elem.findall('param/name')
         paramstext = ', '.join([str(param.text) for param in params])
@@ -1940,6 +2126,8 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVe
         # Generate pre-call validation source code
         self.appendSection('command', '    %s' % self.precallvalidate_loop)
         self.appendSection('command', '        auto lock = intercept->read_lock();')
+        if costed:
+            self.appendSection('command', '        EntryPointTimer timer(entry_point_costs, %s, kEntryPointPreCallValidate, intercept->container_type);' % entry_point_id)
         self.appendSection('command', '        skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidate%s(%s);' % (api_function_name[2:], paramstext))
         self.appendSection('command', '        if (skip) %s' % return_map[resulttype.text])
         self.appendSection('command', '    }')
@@ -1947,6 +2135,8 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVe
         # Generate pre-call state recording source code
         self.appendSection('command', '    %s' % self.precallrecord_loop)
         self.appendSection('command', '        auto lock = intercept->write_lock();')
+        if costed:
+            self.appendSection('command', '        EntryPointTimer timer(entry_point_costs, %s, kEntryPointPreCallRecord, intercept->container_type);' % entry_point_id)
         self.appendSection('command', '        intercept->PreCallRecord%s(%s);' % (api_function_name[2:], paramstext))
         self.appendSection('command', '    }')
 
@@ -1967,6 +2157,8 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVe
         if (resulttype.text == 'VkResult' or resulttype.text == 'VkDeviceAddress'):
             returnparam = ', result'
         self.appendSection('command', '        auto lock = intercept->write_lock();')
+        if costed:
+            self.appendSection('command', '        EntryPointTimer timer(entry_point_costs, %s, kEntryPointPostCallRecord, intercept->container_type);' % entry_point_id)
         self.appendSection('command', '        intercept->PostCallRecord%s(%s%s);' % (api_function_name[2:], paramstext, returnparam))
         self.appendSection('command', '    }')
         # Return result variable, if any.
@@ -0,0 +1,161 @@
+#!/usr/bin/env python3
+# Copyright (c) 2020 The Khronos Group Inc.
+# Copyright (c) 2020 Valve Corporation
+# Copyright (c) 2020 LunarG, Inc.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# Aggregates validation layer logs written with the 'khronos_validation.log_format = jsonl' setting.
+#
+# Files are streamed one record at a time, so memory use is bounded by the number of distinct message ids and objects
+# rather than the number of messages. Gzip-compressed logs (*.gz) are read directly. Handles are only meaningful within
+# the run that logged them, so objects are counted per file and per run record.
+
+import argparse
+import gzip
+import json
+import sys
+from collections import Counter, defaultdict
+
+def OpenLog(filename):
+    if filename == '-':
+        return sys.stdin
+    if filename.endswith('.gz'):
+        return gzip.open(filename, 'rt', encoding='utf-8', errors='replace')
+    return open(filename, 'r', encoding='utf-8', errors='replace')
+
+class LogStats:
+    def __init__(self, severities):
+        self.severities = severities
+        self.total = 0
+        self.malformed = 0
+        self.vuid_counts = Counter()
+        self.vuid_severity = {}
+        self.vuid_files = defaultdict(set)
+        self.object_counts = Counter()
+        self.object_names = {}
+        self.run = 0
+        self.spec_text = {}
+        self.first_time_ns = None
+        self.last_time_ns = None
+
+    def AddRecord(self, record, filename):
+        kind = record.get('record')
+        if kind == 'run':
+            self.run += 1
+            return
+        if kind == 'spec':
+            self.spec_text.setdefault(record.get('vuid', ''), record.get('text', ''))
+            return
+        if kind != 'message':
+            return
+        severity = record.get('severity', '')
+        if self.severities and not any(s in self.severities for s in severity.split(',')):
+            return
+        vuid = record.get('vuid', '')
+        self.total += 1
+        self.vuid_counts[vuid] += 1
+        self.vuid_severity.setdefault(vuid, severity)
+        self.vuid_files[vuid].add(filename)
+        for obj in record.get('objects', []):
+            key = (filename, self.run, obj.get('type', ''), obj.get('handle', ''))
+            self.object_counts[key] += 1
+            if 'name' in obj:
+                self.object_names[key] = obj['name']
+        time_ns = record.get('time_ns')
+        if time_ns is not None:
+            self.first_time_ns = time_ns if self.first_time_ns is None else min(self.first_time_ns, time_ns)
+            self.last_time_ns = time_ns if self.last_time_ns is None else max(self.last_time_ns, time_ns)
+
+    def AddFile(self, filename):
+        # Records before the first run record (older logs) count as run 0
+        self.run = 0
+        with OpenLog(filename) as log:
+            for line in log:
+                line = line.strip()
+                if not line:
+                    continue
+                try:
+                    record = json.loads(line)
+                except ValueError:
+                    # A run that crashed may leave a truncated final line
+                    self.malformed += 1
+                    continue
+                self.AddRecord(record, filename)
+
+    def Summary(self, top):
+        summary = {
+            'total_messages': self.total,
+            'unique_vuids': len(self.vuid_counts),
+            'malformed_lines': self.malformed,
+            'vuids': [],
+            'top_objects': [],
+        }
+        for vuid, count in self.vuid_counts.most_common(top):
+            summary['vuids'].append({
+                'vuid': vuid,
+                'count': count,
+                'severity': self.vuid_severity.get(vuid, ''),
+                'files': len(self.vuid_files[vuid]),
+                'spec_text': self.spec_text.get(vuid, ''),
+            })
+        for key, count in self.object_counts.most_common(top):
+            filename, run, obj_type, handle = key
+            summary['top_objects'].append({
+                'file': filename,
+                'run': run,
+                'type': obj_type,
+                'handle': handle,
+                'name': self.object_names.get(key, ''),
+                'count': count,
+            })
+        return summary
+
+def PrintSummary(summary, show_spec):
+    print('Messages: %d  Unique VUIDs: %d  Malformed lines: %d' %
+          (summary['total_messages'], summary['unique_vuids'], summary['malformed_lines']))
+    print('')
+    print('%10s  %-8s %6s  %s' % ('Count', 'Severity', 'Files', 'VUID'))
+    for entry in summary['vuids']:
+        print('%10d  %-8s %6d  %s' % (entry['count'], entry['severity'], entry['files'], entry['vuid']))
+        if show_spec and entry['spec_text']:
+            print('%28s%s' % ('', entry['spec_text']))
+    print('')
+    print('%10s  %-32s %-20s %4s  %-24s %s' % ('Count', 'Object Type', 'Handle', 'Run', 'File', 'Name'))
+    for entry in summary['top_objects']:
+        print('%10d  %-32s %-20s %4d  %-24s %s' %
+              (entry['count'], entry['type'], entry['handle'], entry['run'], entry['file'], entry['name']))
+
+def main(argv):
+    parser = argparse.ArgumentParser(description='Aggregate JSONL validation layer logs into per-VUID counts and top offenders.')
+    parser.add_argument('logs', nargs='+', help='JSONL log files to read (optionally .gz compressed), or - for stdin')
+    parser.add_argument('-top', type=int, default=20, help='Number of VUIDs and objects to report (default 20)')
+    parser.add_argument('-severity', action='append', default=[], choices=['ERROR', 'WARN', 'INFO', 'VERBOSE'],
+                        help='Only count messages of this severity; may be given more than once')
+    parser.add_argument('-spec', action='store_true', help='Show the spec text for each reported VUID')
+    parser.add_argument('-json', action='store_true', help='Write the summary as JSON instead of a table')
+    args = parser.parse_args(argv)
+
+    stats = LogStats(args.severity)
+    for filename in args.logs:
+        stats.AddFile(filename)
+
+    summary = stats.Summary(args.top)
+    if args.json:
+        json.dump(summary, sys.stdout, indent=2)
+        print('')
+    else:
+        PrintSummary(summary, args.spec)
+
+if __name__ == '__main__':
+    main(sys.argv[1:])
@@ -0,0 +1,976 @@
+/*
+ * Copyright (c) 2020 The Khronos Group Inc.
+ * Copyright (c) 2020 Valve Corporation
+ * Copyright (c) 2020 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <thread>
+
+#include "vk_layer_benchmarks.h"
+#include "vk_format_utils.h"
+#include "entry_point_costs.h"
+
+static const VkFormat kColorFormat = VK_FORMAT_R8G8B8A8_UNORM;
+static const uint32_t kTargetSize = 256;
+static const VkImageSubresourceRange kColorRange = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1};
+
+static const char kVertexShader[] = R"(
+               OpCapability Shader
+               OpMemoryModel Logical GLSL450
+               OpEntryPoint Vertex %main "main" %position
+               OpDecorate %position BuiltIn Position
+       %void = OpTypeVoid
+    %void_fn = OpTypeFunction %void
+      %float = OpTypeFloat 32
+       %vec4 = OpTypeVector %float 4
+%ptr_out_vec4 = OpTypePointer Output %vec4
+   %position = OpVariable %ptr_out_vec4 Output
+    %float_0 = OpConstant %float 0
+     %origin = OpConstantComposite %vec4 %float_0 %float_0 %float_0 %float_0
+       %main = OpFunction %void None %void_fn
+      %entry = OpLabel
+               OpStore %position %origin
+               OpReturn
+               OpFunctionEnd
+)";
+
+// Reads a uniform buffer at binding 0 and a combined image sampler at binding 1
+static const char kFragmentShader[] = R"(
+               OpCapability Shader
+               OpMemoryModel Logical GLSL450
+               OpEntryPoint Fragment %main "main" %color
+               OpExecutionMode %main OriginUpperLeft
+               OpDecorate %color Location 0
+               OpDecorate %ubo_type Block
+               OpMemberDecorate %ubo_type 0 Offset 0
+               OpDecorate %ubo DescriptorSet 0
+               OpDecorate %ubo Binding 0
+               OpDecorate %tex DescriptorSet 0
+               OpDecorate %tex Binding 1
+       %void = OpTypeVoid
+    %void_fn = OpTypeFunction %void
+      %float = OpTypeFloat 32
+       %vec2 = OpTypeVector %float 2
+       %vec4 = OpTypeVector %float 4
+        %int = OpTypeInt 32 1
+      %int_0 = OpConstant %int 0
+    %float_0 = OpConstant %float 0
+      %coord = OpConstantComposite %vec2 %float_0 %float_0
+   %ubo_type = OpTypeStruct %vec4
+%ptr_ubo_type = OpTypePointer Uniform %ubo_type
+%ptr_ubo_vec4 = OpTypePointer Uniform %vec4
+        %ubo = OpVariable %ptr_ubo_type Uniform
+      %image = OpTypeImage %float 2D 0 0 0 1 Unknown
+    %sampled = OpTypeSampledImage %image
+%ptr_sampled = OpTypePointer UniformConstant %sampled
+        %tex = OpVariable %ptr_sampled UniformConstant
+%ptr_out_vec4 = OpTypePointer Output %vec4
+      %color = OpVariable %ptr_out_vec4 Output
+       %main = OpFunction %void None %void_fn
+      %entry = OpLabel
+  %ubo_value = OpAccessChain %ptr_ubo_vec4 %ubo %int_0
+       %tint = OpLoad %vec4 %ubo_value
+    %sampler = OpLoad %sampled %tex
+     %texel = OpImageSampleImplicitLod %vec4 %sampler %coord
+     %result = OpFAdd %vec4 %tint %texel
+               OpStore %color %result
+               OpReturn
+               OpFunctionEnd
+)";
+
+// Indexes an array of combined image samplers at binding 0 with a push constant, the usual "bindless" material lookup
+static std::string BindlessFragmentShader(uint32_t array_size) {
+    return R"(
+               OpCapability Shader
+               OpCapability SampledImageArrayDynamicIndexing
+               OpMemoryModel Logical GLSL450
+               OpEntryPoint Fragment %main "main" %color
+               OpExecutionMode %main OriginUpperLeft
+               OpDecorate %color Location 0
+               OpDecorate %textures DescriptorSet 0
+               OpDecorate %textures Binding 0
+               OpDecorate %push_type Block
+               OpMemberDecorate %push_type 0 Offset 0
+       %void = OpTypeVoid
+    %void_fn = OpTypeFunction %void
+      %float = OpTypeFloat 32
+       %vec2 = OpTypeVector %float 2
+       %vec4 = OpTypeVector %float 4
+        %int = OpTypeInt 32 1
+       %uint = OpTypeInt 32 0
+      %int_0 = OpConstant %int 0
+ %array_size = OpConstant %uint )" +
+           std::to_string(array_size) + R"(
+    %float_0 = OpConstant %float 0
+      %coord = OpConstantComposite %vec2 %float_0 %float_0
+      %image = OpTypeImage %float 2D 0 0 0 1 Unknown
+    %sampled = OpTypeSampledImage %image
+%sampled_array = OpTypeArray %sampled %array_size
+%ptr_sampled = OpTypePointer UniformConstant %sampled
+%ptr_sampled_array = OpTypePointer UniformConstant %sampled_array
+   %textures = OpVariable %ptr_sampled_array UniformConstant
+  %push_type = OpTypeStruct %uint
+%ptr_push_type = OpTypePointer PushConstant %push_type
+%ptr_push_uint = OpTypePointer PushConstant %uint
+       %push = OpVariable %ptr_push_type PushConstant
+%ptr_out_vec4 = OpTypePointer Output %vec4
+      %color = OpVariable %ptr_out_vec4 Output
+       %main = OpFunction %void None %void_fn
+      %entry = OpLabel
+ %index_ptr = OpAccessChain %ptr_push_uint %push %int_0
+      %index = OpLoad %uint %index_ptr
+%sampler_ptr = OpAccessChain %ptr_sampled %textures %index
+    %sampler = OpLoad %sampled %sampler_ptr
+     %texel = OpImageSampleImplicitLod %vec4 %sampler %coord
+               OpStore %color %texel
+               OpReturn
+               OpFunctionEnd
+)";
+}
+
+static const char kComputeShader[] = R"(
+               OpCapability Shader
+               OpMemoryModel Logical GLSL450
+               OpEntryPoint GLCompute %main "main"
+               OpExecutionMode %main LocalSize 64 1 1
+       %void = OpTypeVoid
+    %void_fn = OpTypeFunction %void
+       %main = OpFunction %void None %void_fn
+      %entry = OpLabel
+               OpReturn
+               OpFunctionEnd
+)";
+
+static uint32_t Scaled(uint32_t count, const BenchmarkOptions &options) { return count * options.iterations; }
+
+static void BeginCommandBuffer(VkCommandBuffer command_buffer) {
+    VkCommandBufferBeginInfo begin_info = {};
+    begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    vk::BeginCommandBuffer(command_buffer, &begin_info);
+}
+
+static VkDescriptorSet AllocateDescriptorSet(VkDevice device, VkDescriptorPool pool, VkDescriptorSetLayout layout) {
+    VkDescriptorSetAllocateInfo alloc_info = {};
+    alloc_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+    alloc_info.descriptorPool = pool;
+    alloc_info.descriptorSetCount = 1;
+    alloc_info.pSetLayouts = &layout;
+    VkDescriptorSet set = VK_NULL_HANDLE;
+    vk::AllocateDescriptorSets(device, &alloc_info, &set);
+    return set;
+}
+
+static VkImageMemoryBarrier LayoutBarrier(VkImage image, const VkImageSubresourceRange &range, VkImageLayout old_layout,
+                                          VkImageLayout new_layout) {
+    VkImageMemoryBarrier barrier = {};
+    barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+    barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.oldLayout = old_layout;
+    barrier.newLayout = new_layout;
+    barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.image = image;
+    barrier.subresourceRange = range;
+    return barrier;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+// Draw recording
+
+// Everything needed to record a render pass full of draws
+struct DrawSetup {
+    VkRenderPass render_pass = VK_NULL_HANDLE;
+    VkFramebuffer framebuffer = VK_NULL_HANDLE;
+    VkPipelineLayout pipeline_layout = VK_NULL_HANDLE;
+    VkPipeline pipeline = VK_NULL_HANDLE;
+    VkBuffer vertex_buffer = VK_NULL_HANDLE;
+    std::vector<VkDescriptorSet> descriptor_sets;
+    uint32_t push_constant_indices = 0;  // Non-zero for the bindless pipeline, which selects a texture per draw
+};
+
+static void CreateRenderTarget(BenchmarkDevice *device, DrawSetup *setup) {
+    VkImage color = device->CreateImage(kColorFormat, {kTargetSize, kTargetSize, 1}, 1, 1, VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT);
+    VkImageView view = device->CreateImageView(color, kColorFormat, VK_IMAGE_VIEW_TYPE_2D, kColorRange);
+    setup->render_pass = device->CreateRenderPass(kColorFormat);
+    setup->framebuffer = device->CreateFramebuffer(setup->render_pass, view, kTargetSize, kTargetSize);
+    setup->vertex_buffer = device->CreateBuffer(64 * 1024, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT);
+}
+
+static VkImageView CreateTexture(BenchmarkDevice *device) {
+    VkImage texture = device->CreateImage(kColorFormat, {kTargetSize, kTargetSize, 1}, 1, 1,
+                                          VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT);
+    device->TransitionImages({texture}, VK_IMAGE_ASPECT_COLOR_BIT, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    return device->CreateImageView(texture, kColorFormat, VK_IMAGE_VIEW_TYPE_2D, kColorRange);
+}
+
+static VkDescriptorSetLayout CreateMaterialSetLayout(BenchmarkDevice *device) {
+    return device->CreateDescriptorSetLayout({
+        {0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_FRAGMENT_BIT, nullptr},
+        {1, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 1, VK_SHADER_STAGE_FRAGMENT_BIT, nullptr},
+    });
+}
+
+// The material sets use one uniform buffer slice each, so offsets follow minUniformBufferOffsetAlignment
+static VkDeviceSize UniformStride(const BenchmarkDevice &device) {
+    return std::max<VkDeviceSize>(256, device.properties.limits.minUniformBufferOffsetAlignment);
+}
+
+static void WriteMaterialSet(VkDescriptorSet set, VkBuffer uniforms, VkDeviceSize offset, VkImageView view, VkSampler sampler,
+                             std::vector<VkWriteDescriptorSet> *writes, std::vector<VkDescriptorBufferInfo> *buffer_infos,
+                             std::vector<VkDescriptorImageInfo> *image_infos) {
+    // The info arrays are sized by the caller up front so the pointers taken here stay valid
+    buffer_infos->push_back({uniforms, offset, 256});
+    image_infos->push_back({sampler, view, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL});
+
+    VkWriteDescriptorSet write = {};
+    write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+    write.dstSet = set;
+    write.descriptorCount = 1;
+    write.dstBinding = 0;
+    write.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+    write.pBufferInfo = &buffer_infos->back();
+    writes->push_back(write);
+    write.dstBinding = 1;
+    write.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+    write.pBufferInfo = nullptr;
+    write.pImageInfo = &image_infos->back();
+    writes->push_back(write);
+}
+
+static void CreateMaterialDrawSetup(BenchmarkDevice *device, uint32_t set_count, DrawSetup *setup) {
+    CreateRenderTarget(device, setup);
+    VkDescriptorSetLayout set_layout = CreateMaterialSetLayout(device);
+    setup->pipeline_layout = device->CreatePipelineLayout({set_layout}, {});
+    VkShaderModule vertex = device->CreateShaderModule(AssembleShader(kVertexShader));
+    VkShaderModule fragment = device->CreateShaderModule(AssembleShader(kFragmentShader));
+    setup->pipeline = device->CreateGraphicsPipeline(
+        device->GraphicsPipelineInfo(vertex, fragment, setup->pipeline_layout, setup->render_pass, kTargetSize, kTargetSize));
+
+    const VkDeviceSize stride = UniformStride(*device);
+    VkBuffer uniforms = device->CreateBuffer(stride * set_count, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT);
+    VkImageView texture = CreateTexture(device);
+    VkSampler sampler = device->CreateSampler();
+    VkDescriptorPool pool = device->CreateDescriptorPool(
+        set_count, {{VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, set_count}, {VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, set_count}}, 0);
+
+    std::vector<VkWriteDescriptorSet> writes;
+    std::vector<VkDescriptorBufferInfo> buffer_infos;
+    std::vector<VkDescriptorImageInfo> image_infos;
+    buffer_infos.reserve(set_count);
+    image_infos.reserve(set_count);
+    for (uint32_t i = 0; i < set_count; ++i) {
+        setup->descriptor_sets.push_back(AllocateDescriptorSet(device->device, pool, set_layout));
+        WriteMaterialSet(setup->descriptor_sets.back(), uniforms, i * stride, texture, sampler, &writes, &buffer_infos,
+                         &image_infos);
+    }
+    vk::UpdateDescriptorSets(device->device, static_cast<uint32_t>(writes.size()), writes.data(), 0, nullptr);
+}
+
+// Records one command buffer containing a single render pass with draw_count draws
+static void RecordDraws(const DrawSetup &setup, VkCommandBuffer command_buffer, uint32_t draw_count, BenchmarkTimings *timings) {
+    EntryPointStats &begin_stats = timings->Get("vkBeginCommandBuffer");
+    EntryPointStats &begin_render_pass_stats = timings->Get("vkCmdBeginRenderPass");
+    EntryPointStats &bind_pipeline_stats = timings->Get("vkCmdBindPipeline");
+    EntryPointStats &bind_vertex_stats = timings->Get("vkCmdBindVertexBuffers");
+    EntryPointStats &bind_sets_stats = timings->Get("vkCmdBindDescriptorSets");
+    EntryPointStats &push_constants_stats = timings->Get("vkCmdPushConstants");
+    EntryPointStats &draw_stats = timings->Get("vkCmdDraw");
+    EntryPointStats &end_render_pass_stats = timings->Get("vkCmdEndRenderPass");
+    EntryPointStats &end_stats = timings->Get("vkEndCommandBuffer");
+
+    {
+        ScopedTimer timer(&begin_stats);
+        BeginCommandBuffer(command_buffer);
+    }
+
+    VkRenderPassBeginInfo render_pass_begin = {};
+    render_pass_begin.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+    render_pass_begin.renderPass = setup.render_pass;
+    render_pass_begin.framebuffer = setup.framebuffer;
+    render_pass_begin.renderArea = {{0, 0}, {kTargetSize, kTargetSize}};
+    {
+        ScopedTimer timer(&begin_render_pass_stats);
+        vk::CmdBeginRenderPass(command_buffer, &render_pass_begin, VK_SUBPASS_CONTENTS_INLINE);
+    }
+    {
+        ScopedTimer timer(&bind_pipeline_stats);
+        vk::CmdBindPipeline(command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, setup.pipeline);
+    }
+    const VkDeviceSize vertex_offset = 0;
+    {
+        ScopedTimer timer(&bind_vertex_stats);
+        vk::CmdBindVertexBuffers(command_buffer, 0, 1, &setup.vertex_buffer, &vertex_offset);
+    }
+
+    for (uint32_t draw = 0; draw < draw_count; ++draw) {
+        // Rebinding every few draws is typical of per-material state changes
+        if (draw % 8 == 0) {
+            const VkDescriptorSet set = setup.descriptor_sets[(draw / 8) % setup.descriptor_sets.size()];
+            ScopedTimer timer(&bind_sets_stats);
+            vk::CmdBindDescriptorSets(command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, setup.pipeline_layout, 0, 1, &set, 0,
+                                      nullptr);
+        }
+        if (setup.push_constant_indices) {
+            const uint32_t index = draw % setup.push_constant_indices;
+            ScopedTimer timer(&push_constants_stats);
+            vk::CmdPushConstants(command_buffer, setup.pipeline_layout, VK_SHADER_STAGE_FRAGMENT_BIT, 0, sizeof(index), &index);
+        }
+        ScopedTimer timer(&draw_stats);
+        vk::CmdDraw(command_buffer, 3, 1, 0, 0);
+    }
+
+    {
+        ScopedTimer timer(&end_render_pass_stats);
+        vk::CmdEndRenderPass(command_buffer);
+    }
+    {
+        ScopedTimer timer(&end_stats);
+        vk::EndCommandBuffer(command_buffer);
+    }
+}
+
+static bool RunDrawRecording(BenchmarkDevice *device, const BenchmarkOptions &options, BenchmarkTimings *timings) {
+    DrawSetup setup;
+    CreateMaterialDrawSetup(device, 64, &setup);
+    VkCommandBuffer command_buffer = device->AllocateCommandBuffer(device->CreateCommandPool());
+    for (uint32_t i = 0; i < Scaled(10, options); ++i) {
+        RecordDraws(setup, command_buffer, 10000, timings);
+    }
+    return true;
+}
+
+static bool RunBindlessDraws(BenchmarkDevice *device, const BenchmarkOptions &options, BenchmarkTimings *timings) {
+    const VkPhysicalDeviceLimits &limits = device->properties.limits;
+    const uint32_t array_size = std::min({1024u, limits.maxPerStageDescriptorSamplers, limits.maxPerStageDescriptorSampledImages,
+                                          limits.maxDescriptorSetSamplers, limits.maxDescriptorSetSampledImages});
+    if (array_size < 2) return false;
+
+    DrawSetup setup;
+    CreateRenderTarget(device, &setup);
+    VkDescriptorSetLayout set_layout = device->CreateDescriptorSetLayout(
+        {{0, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, array_size, VK_SHADER_STAGE_FRAGMENT_BIT, nullptr}});
+    setup.pipeline_layout = device->CreatePipelineLayout({set_layout}, {{VK_SHADER_STAGE_FRAGMENT_BIT, 0, sizeof(uint32_t)}});
+    VkShaderModule vertex = device->CreateShaderModule(AssembleShader(kVertexShader));
+    VkShaderModule fragment = device->CreateShaderModule(AssembleShader(BindlessFragmentShader(array_size)));
+    setup.pipeline = device->CreateGraphicsPipeline(
+        device->GraphicsPipelineInfo(vertex, fragment, setup.pipeline_layout, setup.render_pass, kTargetSize, kTargetSize));
+    setup.push_constant_indices = array_size;
+
+    // Every array element is written, as a bindless renderer keeps its whole texture table resident
+    VkImageView texture = CreateTexture(device);
+    VkSampler sampler = device->CreateSampler();
+    VkDescriptorPool pool = device->CreateDescriptorPool(1, {{VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, array_size}}, 0);
+    setup.descriptor_sets.push_back(AllocateDescriptorSet(device->device, pool, set_layout));
+    std::vector<VkDescriptorImageInfo> image_infos(array_size, {sampler, texture, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL});
+    VkWriteDescriptorSet write = {};
+    write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+    write.dstSet = setup.descriptor_sets[0];
+    write.dstBinding = 0;
+    write.descriptorCount = array_size;
+    write.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+    write.pImageInfo = image_infos.data();
+    vk::UpdateDescriptorSets(device->device, 1, &write, 0, nullptr);
+
+    VkCommandBuffer command_buffer = device->AllocateCommandBuffer(device->CreateCommandPool());
+    for (uint32_t i = 0; i < Scaled(10, options); ++i) {
+        RecordDraws(setup, command_buffer, 10000, timings);
+    }
+    return true;
+}
+
+static bool RunMultithreadedRecording(BenchmarkDevice *device, const BenchmarkOptions &options, BenchmarkTimings *timings) {
+    DrawSetup setup;
+    CreateMaterialDrawSetup(device, 64, &setup);
+
+    // Pools are externally synchronized, so every thread records from its own
+    std::vector<VkCommandBuffer> command_buffers;
+    for (uint32_t i = 0; i < options.threads; ++i) {
+        command_buffers.push_back(device->AllocateCommandBuffer(device->CreateCommandPool()));
+    }
+
+    std::vector<BenchmarkTimings> thread_timings(options.threads);
+    std::vector<std::thread> threads;
+    const uint32_t recordings = Scaled(10, options);
+    for (uint32_t i = 0; i < options.threads; ++i) {
+        threads.emplace_back([&setup, &command_buffers, &thread_timings, recordings, i]() {
+            for (uint32_t recording = 0; recording < recordings; ++recording) {
+                RecordDraws(setup, command_buffers[i], 10000, &thread_timings[i]);
+            }
+        });
+    }
+    for (auto &thread : threads) thread.join();
+    for (const auto &thread_timing : thread_timings) timings->Merge(thread_timing);
+    return true;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+// Thread safety collisions
+
+// vkResetFences writes the fence, so threads resetting the same one collide in ThreadSafety. Each collision report asks for the
+// call to be skipped, so the colliding call waits for the other thread to finish with the fence. Calls that collided are timed
+// apart from the others, which makes the "[collided]" row the collision resolution latency, report included. The
+// ThreadCollisionWaitDoesNotDeadlock layer test checks correctness; the watchdog here only keeps a hang from stalling a run.
+static bool RunThreadCollisions(BenchmarkDevice *device, const BenchmarkOptions &options, BenchmarkTimings *timings) {
+    VkFence fence = device->CreateFence();
+
+    device->wait_on_thread_collisions = true;
+    std::vector<BenchmarkTimings> thread_timings(options.threads);
+    std::vector<std::thread> threads;
+    std::mutex done_mutex;
+    std::condition_variable done_cv;
+    uint32_t done_count = 0;
+    const uint32_t resets = Scaled(10000, options);
+    for (uint32_t i = 0; i < options.threads; ++i) {
+        threads.emplace_back([&, i]() {
+            EntryPointStats &clear_stats = thread_timings[i].Get("vkResetFences");
+            EntryPointStats &collided_stats = thread_timings[i].Get("vkResetFences[collided]");
+            for (uint32_t reset = 0; reset < resets; ++reset) {
+                const uint64_t collisions = BenchmarkDevice::ThreadCollisionCount();
+                const auto start = std::chrono::steady_clock::now();
+                vk::ResetFences(device->device, 1, &fence);
+                const auto elapsed = std::chrono::steady_clock::now() - start;
+                EntryPointStats &stats = (BenchmarkDevice::ThreadCollisionCount() != collisions) ? collided_stats : clear_stats;
+                stats.Add(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+            }
+            std::lock_guard<std::mutex> lock(done_mutex);
+            ++done_count;
+            done_cv.notify_one();
+        });
+    }
+    {
+        std::unique_lock<std::mutex> lock(done_mutex);
+        if (!done_cv.wait_for(lock, std::chrono::seconds(60 * options.iterations),
+                              [&]() { return done_count == options.threads; })) {
+            // The threads are stuck inside the layer and can't be joined
+            fprintf(stderr, "thread_collisions: threads still waiting on the fence after %u seconds\n", 60 * options.iterations);
+            std::abort();
+        }
+    }
+    for (auto &thread : threads) thread.join();
+    device->wait_on_thread_collisions = false;
+    for (const auto &thread_timing : thread_timings) timings->Merge(thread_timing);
+    return true;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+// Entry point costs
+
+// Reports the per-validation-object split the layer measured for vkResetFences as "<entry point>/<validation object>" rows.
+// The counts themselves are checked by the EntryPointCosts layer test. Skipped unless the layer runs with
+// VK_LAYER_ENABLES=VALIDATION_CHECK_ENABLE_ENTRY_POINT_COSTS.
+static bool RunEntryPointCosts(BenchmarkDevice *device, const BenchmarkOptions &options, BenchmarkTimings *timings) {
+    auto get_costs =
+        reinterpret_cast<PFN_vkGetEntryPointCostsLAYER>(vk::GetDeviceProcAddr(device->device, "vkGetEntryPointCostsLAYER"));
+    uint32_t count = 0;
+    if (!get_costs || get_costs(device->device, &count, nullptr) != VK_SUCCESS) return false;
+
+    VkFence fence = device->CreateFence();
+    EntryPointStats &reset_stats = timings->Get("vkResetFences");
+    const uint32_t resets = Scaled(10000, options);
+    for (uint32_t reset = 0; reset < resets; ++reset) {
+        ScopedTimer timer(&reset_stats);
+        vk::ResetFences(device->device, 1, &fence);
+    }
+
+    get_costs(device->device, &count, nullptr);
+    std::vector<LayerEntryPointCost> costs(count);
+    get_costs(device->device, &count, costs.data());
+    for (const auto &cost : costs) {
+        if (strcmp(cost.entry_point, "vkResetFences") != 0) continue;
+        const uint64_t nanoseconds = cost.nanoseconds[kEntryPointPreCallValidate] + cost.nanoseconds[kEntryPointPreCallRecord] +
+                                     cost.nanoseconds[kEntryPointPostCallRecord];
+        timings->Get(std::string(cost.entry_point) + "/" + cost.validation_object).AddBatch(cost.call_count, nanoseconds);
+    }
+    return true;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+// Descriptor updates
+
+static bool RunDescriptorUpdates(BenchmarkDevice *device, const BenchmarkOptions &options, BenchmarkTimings *timings) {
+    const uint32_t set_count = 256;
+    VkDescriptorSetLayout set_layout = CreateMaterialSetLayout(device);
+    const VkDeviceSize stride = UniformStride(*device);
+    VkBuffer uniforms = device->CreateBuffer(stride * set_count, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT);
+    VkImageView texture = CreateTexture(device);
+    VkSampler sampler = device->CreateSampler();
+    VkDescriptorPool pool = device->CreateDescriptorPool(
+        set_count, {{VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, set_count}, {VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, set_count}}, 0);
+
+    EntryPointStats &reset_stats = timings->Get("vkResetDescriptorPool");
+    EntryPointStats &allocate_stats = timings->Get("vkAllocateDescriptorSets[256 sets]");
+    EntryPointStats &update_stats = timings->Get("vkUpdateDescriptorSets[2 writes]");
+    EntryPointStats &batched_update_stats = timings->Get("vkUpdateDescriptorSets[512 writes]");
+
+    const std::vector<VkDescriptorSetLayout> set_layouts(set_count, set_layout);
+    std::vector<VkDescriptorSet> sets(set_count);
+    VkDescriptorSetAllocateInfo alloc_info = {};
+    alloc_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+    alloc_info.descriptorPool = pool;
+    alloc_info.descriptorSetCount = set_count;
+    alloc_info.pSetLayouts = set_layouts.data();
+
+    std::vector<VkWriteDescriptorSet> writes;
+    std::vector<VkDescriptorBufferInfo> buffer_infos;
+    std::vector<VkDescriptorImageInfo> image_infos;
+    buffer_infos.reserve(set_count);
+    image_infos.reserve(set_count);
+    for (uint32_t round = 0; round < Scaled(20, options); ++round) {
+        // Per-frame descriptor churn: recycle the whole pool, then write every set individually and once as a batch
+        {
+            ScopedTimer timer(&reset_stats);
+            vk::ResetDescriptorPool(device->device, pool, 0);
+        }
+        {
+            ScopedTimer timer(&allocate_stats);
+            vk::AllocateDescriptorSets(device->device, &alloc_info, sets.data());
+        }
+
+        writes.clear();
+        buffer_infos.clear();
+        image_infos.clear();
+        for (uint32_t i = 0; i < set_count; ++i) {
+            WriteMaterialSet(sets[i], uniforms, i * stride, texture, sampler, &writes, &buffer_infos, &image_infos);
+        }
+        for (uint32_t i = 0; i < set_count; ++i) {
+            ScopedTimer timer(&update_stats);
+            vk::UpdateDescriptorSets(device->device, 2, &writes[i * 2], 0, nullptr);
+        }
+        {
+            ScopedTimer timer(&batched_update_stats);
+            vk::UpdateDescriptorSets(device->device, static_cast<uint32_t>(writes.size()), writes.data(), 0, nullptr);
+        }
+    }
+    return true;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+// Pipeline creation
+
+static bool RunPipelineCreation(BenchmarkDevice *device, const BenchmarkOptions &options, BenchmarkTimings *timings) {
+    DrawSetup setup;
+    CreateRenderTarget(device, &setup);
+    VkDescriptorSetLayout set_layout = CreateMaterialSetLayout(device);
+    VkPipelineLayout layout = device->CreatePipelineLayout({set_layout}, {});
+
+    const std::vector<uint32_t> vertex_spirv = AssembleShader(kVertexShader);
+    const std::vector<uint32_t> fragment_spirv = AssembleShader(kFragmentShader);
+    const std::vector<uint32_t> compute_spirv = AssembleShader(kComputeShader);
+
+    EntryPointStats &create_module_stats = timings->Get("vkCreateShaderModule");
+    EntryPointStats &destroy_module_stats = timings->Get("vkDestroyShaderModule");
+    EntryPointStats &create_graphics_stats = timings->Get("vkCreateGraphicsPipelines");
+    EntryPointStats &create_graphics_batch_stats = timings->Get("vkCreateGraphicsPipelines[32 pipelines]");
+    EntryPointStats &create_compute_stats = timings->Get("vkCreateComputePipelines");
+    EntryPointStats &destroy_pipeline_stats = timings->Get("vkDestroyPipeline");
+
+    auto create_module = [&](const std::vector<uint32_t> &spirv) {
+        VkShaderModuleCreateInfo create_info = {};
+        create_info.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+        create_info.codeSize = spirv.size() * sizeof(uint32_t);
+        create_info.pCode = spirv.data();
+        VkShaderModule module = VK_NULL_HANDLE;
+        ScopedTimer timer(&create_module_stats);
+        vk::CreateShaderModule(device->device, &create_info, nullptr, &module);
+        return module;
+    };
+    auto destroy_module = [&](VkShaderModule module) {
+        ScopedTimer timer(&destroy_module_stats);
+        vk::DestroyShaderModule(device->device, module, nullptr);
+    };
+    auto destroy_pipeline = [&](VkPipeline pipeline) {
+        ScopedTimer timer(&destroy_pipeline_stats);
+        vk::DestroyPipeline(device->device, pipeline, nullptr);
+    };
+
+    for (uint32_t round = 0; round < Scaled(10, options); ++round) {
+        VkShaderModule vertex = create_module(vertex_spirv);
+        VkShaderModule fragment = create_module(fragment_spirv);
+        VkShaderModule compute = create_module(compute_spirv);
+
+        const VkGraphicsPipelineCreateInfo graphics_info =
+            device->GraphicsPipelineInfo(vertex, fragment, layout, setup.render_pass, kTargetSize, kTargetSize);
+        for (uint32_t i = 0; i < 32; ++i) {
+            VkPipeline pipeline = VK_NULL_HANDLE;
+            {
+                ScopedTimer timer(&create_graphics_stats);
+                vk::CreateGraphicsPipelines(device->device, VK_NULL_HANDLE, 1, &graphics_info, nullptr, &pipeline);
+            }
+            destroy_pipeline(pipeline);
+        }
+
+        const std::vector<VkGraphicsPipelineCreateInfo> batch_info(32, graphics_info);
+        std::vector<VkPipeline> batch(batch_info.size());
+        {
+            ScopedTimer timer(&create_graphics_batch_stats);
+            vk::CreateGraphicsPipelines(device->device, VK_NULL_HANDLE, static_cast<uint32_t>(batch_info.size()),
+                                        batch_info.data(), nullptr, batch.data());
+        }
+        for (auto pipeline : batch) destroy_pipeline(pipeline);
+
+        VkComputePipelineCreateInfo compute_info = {};
+        compute_info.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
+        compute_info.stage.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+        compute_info.stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+        compute_info.stage.module = compute;
+        compute_info.stage.pName = "main";
+        compute_info.layout = layout;
+        compute_info.basePipelineIndex = -1;
+        for (uint32_t i = 0; i < 32; ++i) {
+            VkPipeline pipeline = VK_NULL_HANDLE;
+            {
+                ScopedTimer timer(&create_compute_stats);
+                vk::CreateComputePipelines(device->device, VK_NULL_HANDLE, 1, &compute_info, nullptr, &pipeline);
+            }
+            destroy_pipeline(pipeline);
+        }
+
+        destroy_module(vertex);
+        destroy_module(fragment);
+        destroy_module(compute);
+    }
+    return true;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+// Copies with many regions, as issued by texture streaming
+
+static bool RunCopyRegions(BenchmarkDevice *device, const BenchmarkOptions &options, BenchmarkTimings *timings) {
+    const uint32_t region_count = 10000;
+    const uint32_t tile = 8;
+    const uint32_t image_size = 1024;
+    const uint32_t tiles_per_row = image_size / tile;
+    const VkDeviceSize tile_bytes = tile * tile * 4;
+
+    const VkBufferUsageFlags buffer_usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    VkBuffer src_buffer = device->CreateBuffer(region_count * tile_bytes, buffer_usage);
+    VkBuffer dst_buffer = device->CreateBuffer(region_count * tile_bytes, buffer_usage);
+    const VkImageUsageFlags image_usage = VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+    VkImage src_image = device->CreateImage(kColorFormat, {image_size, image_size, 1}, 1, 1, image_usage);
+    VkImage dst_image = device->CreateImage(kColorFormat, {image_size, image_size, 1}, 1, 1, image_usage);
+    device->TransitionImages({src_image, dst_image}, VK_IMAGE_ASPECT_COLOR_BIT, VK_IMAGE_LAYOUT_GENERAL);
+
+    std::vector<VkBufferCopy> buffer_regions(region_count);
+    std::vector<VkBufferImageCopy> buffer_image_regions(region_count);
+    std::vector<VkImageCopy> image_regions(region_count);
+    for (uint32_t i = 0; i < region_count; ++i) {
+        const int32_t x = static_cast<int32_t>((i % tiles_per_row) * tile);
+        const int32_t y = static_cast<int32_t>((i / tiles_per_row) * tile);
+        const VkOffset3D offset = {x, y, 0};
+        const VkImageSubresourceLayers subresource = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1};
+        buffer_regions[i] = {i * tile_bytes, i * tile_bytes, tile_bytes};
+        buffer_image_regions[i] = {i * tile_bytes, 0, 0, subresource, offset, {tile, tile, 1}};
+        image_regions[i] = {subresource, offset, subresource, offset, {tile, tile, 1}};
+    }
+
+    EntryPointStats &copy_buffer_stats = timings->Get("vkCmdCopyBuffer");
+    EntryPointStats &copy_buffer_to_image_stats = timings->Get("vkCmdCopyBufferToImage");
+    EntryPointStats &copy_image_to_buffer_stats = timings->Get("vkCmdCopyImageToBuffer");
+    EntryPointStats &copy_image_stats = timings->Get("vkCmdCopyImage");
+    EntryPointStats &submit_stats = timings->Get("vkQueueSubmit");
+
+    VkCommandBuffer command_buffer = device->AllocateCommandBuffer(device->CreateCommandPool());
+    VkFence fence = device->CreateFence();
+    VkSubmitInfo submit_info = {};
+    submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submit_info.commandBufferCount = 1;
+    submit_info.pCommandBuffers = &command_buffer;
+    for (uint32_t round = 0; round < Scaled(10, options); ++round) {
+        BeginCommandBuffer(command_buffer);
+        {
+            ScopedTimer timer(&copy_buffer_stats);
+            vk::CmdCopyBuffer(command_buffer, src_buffer, dst_buffer, region_count, buffer_regions.data());
+        }
+        {
+            ScopedTimer timer(&copy_buffer_to_image_stats);
+            vk::CmdCopyBufferToImage(command_buffer, src_buffer, src_image, VK_IMAGE_LAYOUT_GENERAL, region_count,
+                                     buffer_image_regions.data());
+        }
+        {
+            ScopedTimer timer(&copy_image_to_buffer_stats);
+            vk::CmdCopyImageToBuffer(command_buffer, src_image, VK_IMAGE_LAYOUT_GENERAL, dst_buffer, region_count,
+                                     buffer_image_regions.data());
+        }
+        {
+            ScopedTimer timer(&copy_image_stats);
+            vk::CmdCopyImage(command_buffer, src_image, VK_IMAGE_LAYOUT_GENERAL, dst_image, VK_IMAGE_LAYOUT_GENERAL, region_count,
+                             image_regions.data());
+        }
+        vk::EndCommandBuffer(command_buffer);
+        {
+            ScopedTimer timer(&submit_stats);
+            vk::QueueSubmit(device->queue, 1, &submit_info, fence);
+        }
+        vk::WaitForFences(device->device, 1, &fence, VK_TRUE, UINT64_MAX);
+        vk::ResetFences(device->device, 1, &fence);
+    }
+    return true;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+// Submission
+
+// A command buffer that references thousands of resources, so the per-submit cost of tracking them dominates
+static bool RunSubmitBoundObjects(BenchmarkDevice *device, const BenchmarkOptions &options, BenchmarkTimings *timings) {
+    const uint32_t buffer_count = 4096;
+    const VkDeviceSize buffer_size = 256;
+    std::vector<VkBuffer> buffers;
+    for (uint32_t i = 0; i < buffer_count; ++i) {
+        buffers.push_back(device->CreateBuffer(buffer_size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT));
+    }
+
+    VkCommandBuffer command_buffer = device->AllocateCommandBuffer(device->CreateCommandPool());
+    BeginCommandBuffer(command_buffer);
+    const VkBufferCopy region = {0, 0, buffer_size};
+    for (uint32_t i = 0; i < buffer_count; ++i) {
+        vk::CmdCopyBuffer(command_buffer, buffers[i], buffers[(i + 1) % buffer_count], 1, &region);
+    }
+    vk::EndCommandBuffer(command_buffer);
+
+    EntryPointStats &submit_stats = timings->Get("vkQueueSubmit");
+    EntryPointStats &wait_stats = timings->Get("vkWaitForFences");
+    EntryPointStats &reset_stats = timings->Get("vkResetFences");
+    VkFence fence = device->CreateFence();
+    VkSubmitInfo submit_info = {};
+    submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submit_info.commandBufferCount = 1;
+    submit_info.pCommandBuffers = &command_buffer;
+    for (uint32_t round = 0; round < Scaled(200, options); ++round) {
+        {
+            ScopedTimer timer(&submit_stats);
+            vk::QueueSubmit(device->queue, 1, &submit_info, fence);
+        }
+        {
+            ScopedTimer timer(&wait_stats);
+            vk::WaitForFences(device->device, 1, &fence, VK_TRUE, UINT64_MAX);
+        }
+        {
+            ScopedTimer timer(&reset_stats);
+            vk::ResetFences(device->device, 1, &fence);
+        }
+    }
+    return true;
+}
+
+// 64 command buffers, each transitioning a few subresources of a 2000-image atlas and back, submitted together
+static bool RunImageAtlasSubmit(BenchmarkDevice *device, const BenchmarkOptions &options, BenchmarkTimings *timings) {
+    const uint32_t image_count = 2000;
+    const uint32_t layer_count = 4;
+    const uint32_t command_buffer_count = 64;
+    const uint32_t images_per_command_buffer = 4;
+
+    std::vector<VkImage> images;
+    for (uint32_t i = 0; i < image_count; ++i) {
+        images.push_back(device->CreateImage(kColorFormat, {64, 64, 1}, 1, layer_count,
+                                             VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT));
+    }
+    device->TransitionImages(images, VK_IMAGE_ASPECT_COLOR_BIT, VK_IMAGE_LAYOUT_GENERAL);
+
+    EntryPointStats &barrier_stats = timings->Get("vkCmdPipelineBarrier");
+    VkCommandPool pool = device->CreateCommandPool();
+    std::vector<VkCommandBuffer> command_buffers;
+    for (uint32_t cb = 0; cb < command_buffer_count; ++cb) {
+        command_buffers.push_back(device->AllocateCommandBuffer(pool));
+        BeginCommandBuffer(command_buffers.back());
+        for (uint32_t i = 0; i < images_per_command_buffer; ++i) {
+            const VkImage image = images[(cb * 31 + i * 7) % image_count];
+            const VkImageSubresourceRange range = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, (cb + i) % layer_count, 1};
+            // Each command buffer leaves the image as it found it, so any submission order is valid
+            const VkImageMemoryBarrier barriers[2] = {
+                LayoutBarrier(image, range, VK_IMAGE_LAYOUT_GENERAL, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL),
+                LayoutBarrier(image, range, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_GENERAL)};
+            for (const auto &barrier : barriers) {
+                ScopedTimer timer(&barrier_stats);
+                vk::CmdPipelineBarrier(command_buffers.back(), VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0,
+                                       nullptr, 0, nullptr, 1, &barrier);
+            }
+        }
+        vk::EndCommandBuffer(command_buffers.back());
+    }
+
+    EntryPointStats &submit_stats = timings->Get("vkQueueSubmit[64 command buffers]");
+    VkFence fence = device->CreateFence();
+    VkSubmitInfo submit_info = {};
+    submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submit_info.commandBufferCount = command_buffer_count;
+    submit_info.pCommandBuffers = command_buffers.data();
+    for (uint32_t round = 0; round < Scaled(100, options); ++round) {
+        {
+            ScopedTimer timer(&submit_stats);
+            vk::QueueSubmit(device->queue, 1, &submit_info, fence);
+        }
+        vk::WaitForFences(device->device, 1, &fence, VK_TRUE, UINT64_MAX);
+        vk::ResetFences(device->device, 1, &fence);
+    }
+    return true;
+}
+
+// Whole-image barriers on images in each of the image layout map's storage tiers: 1x1 fits the inline small map, 10x6 the
+// dense array, and 12x6 and 1x2048 are above the dense limit and use the range_map
+static bool RunImageBarriers(BenchmarkDevice *device, const BenchmarkOptions &options, BenchmarkTimings *timings) {
+    struct Shape {
+        uint32_t size;
+        uint32_t mip_levels;
+        uint32_t array_layers;
+    };
+    const Shape shapes[] = {
+        {1, 1, 1},
+        {2048, 10, 6},
+        {2048, 12, 6},
+        {64, 1, std::min(2048u, device->properties.limits.maxImageArrayLayers)},
+    };
+
+    VkCommandBuffer command_buffer = device->AllocateCommandBuffer(device->CreateCommandPool());
+    VkFence fence = device->CreateFence();
+    VkSubmitInfo submit_info = {};
+    submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submit_info.commandBufferCount = 1;
+    submit_info.pCommandBuffers = &command_buffer;
+
+    for (const auto &shape : shapes) {
+        VkImage image = device->CreateImage(kColorFormat, {shape.size, shape.size, 1}, shape.mip_levels, shape.array_layers,
+                                            VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT);
+        device->TransitionImages({image}, VK_IMAGE_ASPECT_COLOR_BIT, VK_IMAGE_LAYOUT_GENERAL);
+
+        const std::string suffix = "[" + std::to_string(shape.mip_levels) + "x" + std::to_string(shape.array_layers) + "]";
+        EntryPointStats &barrier_stats = timings->Get("vkCmdPipelineBarrier" + suffix);
+        EntryPointStats &submit_stats = timings->Get("vkQueueSubmit" + suffix);
+        const VkImageSubresourceRange range = {VK_IMAGE_ASPECT_COLOR_BIT, 0, shape.mip_levels, 0, shape.array_layers};
+        const VkImageMemoryBarrier to_transfer =
+            LayoutBarrier(image, range, VK_IMAGE_LAYOUT_GENERAL, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+        const VkImageMemoryBarrier to_general =
+            LayoutBarrier(image, range, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_GENERAL);
+
+        for (uint32_t round = 0; round < Scaled(20, options); ++round) {
+            BeginCommandBuffer(command_buffer);
+            for (uint32_t i = 0; i < 1000; ++i) {
+                // An even number of transitions leaves the image in GENERAL for the next round
+                const VkImageMemoryBarrier &barrier = (i % 2) ? to_general : to_transfer;
+                ScopedTimer timer(&barrier_stats);
+                vk::CmdPipelineBarrier(command_buffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0,
+                                       nullptr, 0, nullptr, 1, &barrier);
+            }
+            vk::EndCommandBuffer(command_buffer);
+            {
+                ScopedTimer timer(&submit_stats);
+                vk::QueueSubmit(device->queue, 1, &submit_info, fence);
+            }
+            vk::WaitForFences(device->device, 1, &fence, VK_TRUE, UINT64_MAX);
+            vk::ResetFences(device->device, 1, &fence);
+        }
+    }
+    return true;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+// Format queries, called directly since they sit under most image and buffer validation
+
+static std::vector<VkFormat> BenchmarkFormats() {
+    std::vector<VkFormat> formats;
+    for (int format = VK_FORMAT_UNDEFINED; format <= VK_FORMAT_ASTC_12x12_SRGB_BLOCK; ++format) {
+        formats.push_back(static_cast<VkFormat>(format));
+    }
+    for (int format = VK_FORMAT_PVRTC1_2BPP_UNORM_BLOCK_IMG; format <= VK_FORMAT_PVRTC2_4BPP_SRGB_BLOCK_IMG; ++format) {
+        formats.push_back(static_cast<VkFormat>(format));
+    }
+    for (int format = VK_FORMAT_G8B8G8R8_422_UNORM; format <= VK_FORMAT_G16_B16_R16_3PLANE_444_UNORM; ++format) {
+        formats.push_back(static_cast<VkFormat>(format));
+    }
+    return formats;
+}
+
+static bool RunFormatQueries(BenchmarkDevice *, const BenchmarkOptions &options, BenchmarkTimings *timings) {
+    struct FormatQuery {
+        const char *name;
+        uint64_t (*query)(VkFormat format);
+    };
+    static const FormatQuery queries[] = {
+        {"FormatIsDepthOrStencil", [](VkFormat f) -> uint64_t { return FormatIsDepthOrStencil(f); }},
+        {"FormatIsDepthAndStencil", [](VkFormat f) -> uint64_t { return FormatIsDepthAndStencil(f); }},
+        {"FormatIsDepthOnly", [](VkFormat f) -> uint64_t { return FormatIsDepthOnly(f); }},
+        {"FormatIsStencilOnly", [](VkFormat f) -> uint64_t { return FormatIsStencilOnly(f); }},
+        {"FormatIsNorm", [](VkFormat f) -> uint64_t { return FormatIsNorm(f); }},
+        {"FormatIsUNorm", [](VkFormat f) -> uint64_t { return FormatIsUNorm(f); }},
+        {"FormatIsSNorm", [](VkFormat f) -> uint64_t { return FormatIsSNorm(f); }},
+        {"FormatIsInt", [](VkFormat f) -> uint64_t { return FormatIsInt(f); }},
+        {"FormatIsSInt", [](VkFormat f) -> uint64_t { return FormatIsSInt(f); }},
+        {"FormatIsUInt", [](VkFormat f) -> uint64_t { return FormatIsUInt(f); }},
+        {"FormatIsFloat", [](VkFormat f) -> uint64_t { return FormatIsFloat(f); }},
+        {"FormatIsSRGB", [](VkFormat f) -> uint64_t { return FormatIsSRGB(f); }},
+        {"FormatIsUScaled", [](VkFormat f) -> uint64_t { return FormatIsUScaled(f); }},
+        {"FormatIsSScaled", [](VkFormat f) -> uint64_t { return FormatIsSScaled(f); }},
+        {"FormatIsCompressed", [](VkFormat f) -> uint64_t { return FormatIsCompressed(f); }},
+        {"FormatIsPacked", [](VkFormat f) -> uint64_t { return FormatIsPacked(f); }},
+        {"FormatElementIsTexel", [](VkFormat f) -> uint64_t { return FormatElementIsTexel(f); }},
+        {"FormatRequiresYcbcrConversion", [](VkFormat f) -> uint64_t { return FormatRequiresYcbcrConversion(f); }},
+        {"FormatDepthSize", [](VkFormat f) -> uint64_t { return FormatDepthSize(f); }},
+        {"FormatStencilSize", [](VkFormat f) -> uint64_t { return FormatStencilSize(f); }},
+        {"FormatPlaneCount", [](VkFormat f) -> uint64_t { return FormatPlaneCount(f); }},
+        {"FormatChannelCount", [](VkFormat f) -> uint64_t { return FormatChannelCount(f); }},
+        {"FormatTexelBlockExtent", [](VkFormat f) -> uint64_t { return FormatTexelBlockExtent(f).width; }},
+        {"FormatElementSize", [](VkFormat f) -> uint64_t { return FormatElementSize(f); }},
+        {"FormatTexelSize", [](VkFormat f) -> uint64_t { return static_cast<uint64_t>(FormatTexelSize(f) * 8.0); }},
+        {"FormatCompatibilityClass", [](VkFormat f) -> uint64_t { return FormatCompatibilityClass(f); }},
+    };
+
+    const std::vector<VkFormat> formats = BenchmarkFormats();
+    // Folding every result into a sink keeps the calls from being optimized away
+    volatile uint64_t sink = 0;
+    for (const auto &query : queries) {
+        EntryPointStats &stats = timings->Get(query.name);
+        for (uint32_t round = 0; round < Scaled(1000, options); ++round) {
+            uint64_t accumulated = 0;
+            const auto start = std::chrono::steady_clock::now();
+            for (const VkFormat format : formats) accumulated += query.query(format);
+            const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+            stats.AddBatch(formats.size(), static_cast<uint64_t>(elapsed.count()));
+            sink = sink + accumulated;
+        }
+    }
+    return true;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+const std::vector<BenchmarkScenario> &GetBenchmarkScenarios() {
+    static const std::vector<BenchmarkScenario> scenarios = {
+        {"draw_recording", "Render passes of 10k draws with a descriptor set rebind every 8 draws", RunDrawRecording},
+        {"bindless_draws", "Render passes of 10k draws indexing a 1024-entry sampler array by push constant", RunBindlessDraws},
+        {"multithreaded_recording", "draw_recording on --threads threads at once, each with its own pool",
+         RunMultithreadedRecording},
+        {"thread_collisions", "vkResetFences of one shared fence on --threads threads, timing calls that waited out a collision",
+         RunThreadCollisions},
+        {"entry_point_costs", "vkResetFences, split by validation object with the layer's vkGetEntryPointCostsLAYER counts",
+         RunEntryPointCosts},
+        {"descriptor_updates", "Pool reset, 256-set allocation and per-set plus batched descriptor writes", RunDescriptorUpdates},
+        {"pipeline_creation", "Shader module and graphics/compute pipeline creation bursts", RunPipelineCreation},
+        {"copy_regions", "Buffer and image copies of 10k regions each", RunCopyRegions},
+        {"submit_bound_objects", "Submits of a command buffer referencing 4096 buffers", RunSubmitBoundObjects},
+        {"image_atlas_submit", "Submits of 64 command buffers transitioning subresources of a 2000-image atlas",
+         RunImageAtlasSubmit},
+        {"image_barriers", "Whole-image barriers on 1x1, 10x6, 12x6 and 1x2048 (mips x layers) images", RunImageBarriers},
+        {"format_queries", "FormatIs*, FormatElementSize and related queries over every known format", RunFormatQueries},
+    };
+    return scenarios;
+}
@@ -0,0 +1,789 @@
+/*
+ * Copyright (c) 2020 The Khronos Group Inc.
+ * Copyright (c) 2020 Valve Corporation
+ * Copyright (c) 2020 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// Headless microbenchmarks for the validation layer.
+//
+// Each scenario replays a canned stream of API calls against a fresh instance and device and reports the cost of every
+// entry point it drives, so layer overhead can be tracked over time. Point VK_ICD_FILENAMES at the mock ICD from
+// Vulkan-Tools so that the timings are dominated by the layer rather than by a driver, and VK_LAYER_PATH at the layers
+// build directory.
+
+#include "vk_layer_benchmarks.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "spirv-tools/libspirv.h"
+
+void EntryPointStats::Merge(const EntryPointStats &other) {
+    calls += other.calls;
+    total_ns += other.total_ns;
+    if (other.min_ns < min_ns) min_ns = other.min_ns;
+    if (other.max_ns > max_ns) max_ns = other.max_ns;
+}
+
+void BenchmarkTimings::Merge(const BenchmarkTimings &other) {
+    for (const auto &entry : other.entry_points_) {
+        entry_points_[entry.first].Merge(entry.second);
+    }
+}
+
+static void CheckResult(VkResult result, const char *what) {
+    if (result != VK_SUCCESS) {
+        fprintf(stderr, "%s failed with VkResult %d\n", what, static_cast<int>(result));
+        exit(1);
+    }
+}
+
+void BenchmarkDevice::Destroy() {
+    if (device != VK_NULL_HANDLE) {
+        vk::DeviceWaitIdle(device);
+        for (auto pipeline : pipelines_) vk::DestroyPipeline(device, pipeline, nullptr);
+        for (auto framebuffer : framebuffers_) vk::DestroyFramebuffer(device, framebuffer, nullptr);
+        for (auto render_pass : render_passes_) vk::DestroyRenderPass(device, render_pass, nullptr);
+        for (auto layout : pipeline_layouts_) vk::DestroyPipelineLayout(device, layout, nullptr);
+        for (auto pool : descriptor_pools_) vk::DestroyDescriptorPool(device, pool, nullptr);
+        for (auto layout : set_layouts_) vk::DestroyDescriptorSetLayout(device, layout, nullptr);
+        for (auto module : shader_modules_) vk::DestroyShaderModule(device, module, nullptr);
+        for (auto sampler : samplers_) vk::DestroySampler(device, sampler, nullptr);
+        for (auto view : image_views_) vk::DestroyImageView(device, view, nullptr);
+        for (auto image : images_) vk::DestroyImage(device, image, nullptr);
+        for (auto buffer : buffers_) vk::DestroyBuffer(device, buffer, nullptr);
+        for (const auto &block : memory_blocks_) vk::FreeMemory(device, block.memory, nullptr);
+        for (auto pool : command_pools_) vk::DestroyCommandPool(device, pool, nullptr);
+        for (auto fence : fences_) vk::DestroyFence(device, fence, nullptr);
+        vk::DestroyDevice(device, nullptr);
+        device = VK_NULL_HANDLE;
+    }
+    if (instance != VK_NULL_HANDLE) {
+        if (messenger_ != VK_NULL_HANDLE) {
+            auto destroy_messenger = reinterpret_cast<PFN_vkDestroyDebugUtilsMessengerEXT>(
+                vk::GetInstanceProcAddr(instance, "vkDestroyDebugUtilsMessengerEXT"));
+            destroy_messenger(instance, messenger_, nullptr);
+            messenger_ = VK_NULL_HANDLE;
+        }
+        vk::DestroyInstance(instance, nullptr);
+        instance = VK_NULL_HANDLE;
+    }
+}
+
+static thread_local uint64_t thread_collision_count = 0;
+
+uint64_t BenchmarkDevice::ThreadCollisionCount() { return thread_collision_count; }
+
+VKAPI_ATTR VkBool32 VKAPI_CALL BenchmarkDevice::MessengerCallback(VkDebugUtilsMessageSeverityFlagBitsEXT message_severity,
+                                                                  VkDebugUtilsMessageTypeFlagsEXT message_type,
+                                                                  const VkDebugUtilsMessengerCallbackDataEXT *callback_data,
+                                                                  void *user_data) {
+    auto benchmark_device = static_cast<BenchmarkDevice *>(user_data);
+    if (benchmark_device->wait_on_thread_collisions.load() && callback_data->pMessageIdName &&
+        strcmp(callback_data->pMessageIdName, "UNASSIGNED-Threading-MultipleThreads") == 0) {
+        ++thread_collision_count;
+        return VK_TRUE;
+    }
+    // A scenario that trips validation is measuring error reporting rather than the fast path, so show the first few
+    const uint64_t count = benchmark_device->message_count_++;
+    if (count < 5) {
+        fprintf(stderr, "Validation message: %s\n", callback_data->pMessage);
+    }
+    return VK_FALSE;
+}
+
+bool BenchmarkDevice::Init(const BenchmarkOptions &options) {
+    std::vector<const char *> layers;
+    std::vector<const char *> extensions;
+    if (options.use_layer) {
+        layers.push_back("VK_LAYER_KHRONOS_validation");
+        extensions.push_back(VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
+        extensions.push_back(VK_EXT_VALIDATION_FEATURES_EXTENSION_NAME);
+    }
+
+    VkValidationFeaturesEXT validation_features = {};
+    validation_features.sType = VK_STRUCTURE_TYPE_VALIDATION_FEATURES_EXT;
+    validation_features.enabledValidationFeatureCount = static_cast<uint32_t>(options.enables.size());
+    validation_features.pEnabledValidationFeatures = options.enables.data();
+    validation_features.disabledValidationFeatureCount = static_cast<uint32_t>(options.disables.size());
+    validation_features.pDisabledValidationFeatures = options.disables.data();
+
+    VkApplicationInfo app_info = {};
+    app_info.sType = VK_STRUCTURE_TYPE_APPLICATION_INFO;
+    app_info.pApplicationName = "vk_layer_benchmarks";
+    app_info.apiVersion = VK_API_VERSION_1_0;
+
+    VkInstanceCreateInfo instance_info = {};
+    instance_info.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+    instance_info.pNext = options.use_layer ? &validation_features : nullptr;
+    instance_info.pApplicationInfo = &app_info;
+    instance_info.enabledLayerCount = static_cast<uint32_t>(layers.size());
+    instance_info.ppEnabledLayerNames = layers.data();
+    instance_info.enabledExtensionCount = static_cast<uint32_t>(extensions.size());
+    instance_info.ppEnabledExtensionNames = extensions.data();
+    VkResult result = vk::CreateInstance(&instance_info, nullptr, &instance);
+    if (result != VK_SUCCESS) {
+        fprintf(stderr, "vkCreateInstance failed with VkResult %d; is VK_LAYER_PATH set?\n", static_cast<int>(result));
+        instance = VK_NULL_HANDLE;
+        return false;
+    }
+
+    if (options.use_layer) {
+        auto create_messenger = reinterpret_cast<PFN_vkCreateDebugUtilsMessengerEXT>(
+            vk::GetInstanceProcAddr(instance, "vkCreateDebugUtilsMessengerEXT"));
+        VkDebugUtilsMessengerCreateInfoEXT messenger_info = {};
+        messenger_info.sType = VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CREATE_INFO_EXT;
+        messenger_info.messageSeverity =
+            VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT | VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT;
+        messenger_info.messageType = VK_DEBUG_UTILS_MESSAGE_TYPE_GENERAL_BIT_EXT | VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT |
+                                     VK_DEBUG_UTILS_MESSAGE_TYPE_PERFORMANCE_BIT_EXT;
+        messenger_info.pfnUserCallback = MessengerCallback;
+        messenger_info.pUserData = this;
+        CheckResult(create_messenger(instance, &messenger_info, nullptr, &messenger_), "vkCreateDebugUtilsMessengerEXT");
+    }
+
+    uint32_t gpu_count = 1;
+    result = vk::EnumeratePhysicalDevices(instance, &gpu_count, &gpu);
+    if ((result != VK_SUCCESS && result != VK_INCOMPLETE) || gpu_count == 0) {
+        fprintf(stderr, "No physical devices found; is VK_ICD_FILENAMES set?\n");
+        return false;
+    }
+    vk::GetPhysicalDeviceProperties(gpu, &properties);
+    vk::GetPhysicalDeviceMemoryProperties(gpu, &memory_properties);
+
+    uint32_t family_count = 0;
+    vk::GetPhysicalDeviceQueueFamilyProperties(gpu, &family_count, nullptr);
+    std::vector<VkQueueFamilyProperties> families(family_count);
+    vk::GetPhysicalDeviceQueueFamilyProperties(gpu, &family_count, families.data());
+    queue_family_index = family_count;
+    for (uint32_t i = 0; i < family_count; ++i) {
+        if (families[i].queueFlags & VK_QUEUE_GRAPHICS_BIT) {
+            queue_family_index = i;
+            break;
+        }
+    }
+    if (queue_family_index == family_count) {
+        fprintf(stderr, "No graphics queue found\n");
+        return false;
+    }
+
+    // Enable everything the device offers so that scenarios never fail validation on a missing feature
+    VkPhysicalDeviceFeatures features = {};
+    vk::GetPhysicalDeviceFeatures(gpu, &features);
+
+    const float priority = 1.0f;
+    VkDeviceQueueCreateInfo queue_info = {};
+    queue_info.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+    queue_info.queueFamilyIndex = queue_family_index;
+    queue_info.queueCount = 1;
+    queue_info.pQueuePriorities = &priority;
+
+    VkDeviceCreateInfo device_info = {};
+    device_info.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+    device_info.queueCreateInfoCount = 1;
+    device_info.pQueueCreateInfos = &queue_info;
+    device_info.pEnabledFeatures = &features;
+    CheckResult(vk::CreateDevice(gpu, &device_info, nullptr, &device), "vkCreateDevice");
+    vk::GetDeviceQueue(device, queue_family_index, 0, &queue);
+
+    setup_pool_ = CreateCommandPool();
+    setup_command_buffer_ = AllocateCommandBuffer(setup_pool_);
+    setup_fence_ = CreateFence();
+    return true;
+}
+
+void BenchmarkDevice::BindMemory(const VkMemoryRequirements &requirements, VkDeviceMemory *memory, VkDeviceSize *offset) {
+    uint32_t type_index = 0;
+    while (type_index < memory_properties.memoryTypeCount && !(requirements.memoryTypeBits & (1u << type_index))) ++type_index;
+    if (type_index == memory_properties.memoryTypeCount) {
+        fprintf(stderr, "No memory type satisfies memoryTypeBits 0x%x\n", requirements.memoryTypeBits);
+        exit(1);
+    }
+
+    const VkDeviceSize alignment = requirements.alignment ? requirements.alignment : 1;
+    for (auto &block : memory_blocks_) {
+        if (block.memory_type_index != type_index) continue;
+        const VkDeviceSize aligned = (block.used + alignment - 1) / alignment * alignment;
+        if (aligned + requirements.size <= block.size) {
+            block.used = aligned + requirements.size;
+            *memory = block.memory;
+            *offset = aligned;
+            return;
+        }
+    }
+
+    const VkDeviceSize kBlockSize = 64 * 1024 * 1024;
+    VkMemoryAllocateInfo alloc_info = {};
+    alloc_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    alloc_info.allocationSize = std::max(kBlockSize, requirements.size);
+    alloc_info.memoryTypeIndex = type_index;
+    MemoryBlock block = {VK_NULL_HANDLE, type_index, alloc_info.allocationSize, requirements.size};
+    CheckResult(vk::AllocateMemory(device, &alloc_info, nullptr, &block.memory), "vkAllocateMemory");
+    memory_blocks_.push_back(block);
+    *memory = block.memory;
+    *offset = 0;
+}
+
+VkBuffer BenchmarkDevice::CreateBuffer(VkDeviceSize size, VkBufferUsageFlags usage) {
+    VkBufferCreateInfo create_info = {};
+    create_info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    create_info.size = size;
+    create_info.usage = usage;
+    create_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    VkBuffer buffer;
+    CheckResult(vk::CreateBuffer(device, &create_info, nullptr, &buffer), "vkCreateBuffer");
+    buffers_.push_back(buffer);
+
+    VkMemoryRequirements requirements;
+    vk::GetBufferMemoryRequirements(device, buffer, &requirements);
+    VkDeviceMemory memory;
+    VkDeviceSize offset;
+    BindMemory(requirements, &memory, &offset);
+    CheckResult(vk::BindBufferMemory(device, buffer, memory, offset), "vkBindBufferMemory");
+    return buffer;
+}
+
+VkImage BenchmarkDevice::CreateImage(VkFormat format, VkExtent3D extent, uint32_t mip_levels, uint32_t array_layers,
+                                     VkImageUsageFlags usage) {
+    VkImageCreateInfo create_info = {};
+    create_info.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+    create_info.imageType = VK_IMAGE_TYPE_2D;
+    create_info.format = format;
+    create_info.extent = extent;
+    create_info.mipLevels = mip_levels;
+    create_info.arrayLayers = array_layers;
+    create_info.samples = VK_SAMPLE_COUNT_1_BIT;
+    create_info.tiling = VK_IMAGE_TILING_OPTIMAL;
+    create_info.usage = usage;
+    create_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    create_info.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    VkImage image;
+    CheckResult(vk::CreateImage(device, &create_info, nullptr, &image), "vkCreateImage");
+    images_.push_back(image);
+
+    VkMemoryRequirements requirements;
+    vk::GetImageMemoryRequirements(device, image, &requirements);
+    VkDeviceMemory memory;
+    VkDeviceSize offset;
+    BindMemory(requirements, &memory, &offset);
+    CheckResult(vk::BindImageMemory(device, image, memory, offset), "vkBindImageMemory");
+    return image;
+}
+
+VkImageView BenchmarkDevice::CreateImageView(VkImage image, VkFormat format, VkImageViewType view_type,
+                                             const VkImageSubresourceRange &range) {
+    VkImageViewCreateInfo create_info = {};
+    create_info.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+    create_info.image = image;
+    create_info.viewType = view_type;
+    create_info.format = format;
+    create_info.subresourceRange = range;
+    VkImageView view;
+    CheckResult(vk::CreateImageView(device, &create_info, nullptr, &view), "vkCreateImageView");
+    image_views_.push_back(view);
+    return view;
+}
+
+VkSampler BenchmarkDevice::CreateSampler() {
+    VkSamplerCreateInfo create_info = {};
+    create_info.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
+    create_info.magFilter = VK_FILTER_LINEAR;
+    create_info.minFilter = VK_FILTER_LINEAR;
+    create_info.mipmapMode = VK_SAMPLER_MIPMAP_MODE_LINEAR;
+    create_info.addressModeU = VK_SAMPLER_ADDRESS_MODE_REPEAT;
+    create_info.addressModeV = VK_SAMPLER_ADDRESS_MODE_REPEAT;
+    create_info.addressModeW = VK_SAMPLER_ADDRESS_MODE_REPEAT;
+    create_info.maxLod = 1.0f;
+    create_info.borderColor = VK_BORDER_COLOR_FLOAT_TRANSPARENT_BLACK;
+    VkSampler sampler;
+    CheckResult(vk::CreateSampler(device, &create_info, nullptr, &sampler), "vkCreateSampler");
+    samplers_.push_back(sampler);
+    return sampler;
+}
+
+std::vector<uint32_t> AssembleShader(const std::string &spirv_asm) {
+    spv_binary binary = nullptr;
+    spv_diagnostic diagnostic = nullptr;
+    spv_context context = spvContextCreate(SPV_ENV_VULKAN_1_0);
+    spv_result_t error = spvTextToBinary(context, spirv_asm.c_str(), spirv_asm.size(), &binary, &diagnostic);
+    spvContextDestroy(context);
+    if (error) {
+        spvDiagnosticPrint(diagnostic);
+        spvDiagnosticDestroy(diagnostic);
+        exit(1);
+    }
+    std::vector<uint32_t> spirv(binary->code, binary->code + binary->wordCount);
+    spvBinaryDestroy(binary);
+    return spirv;
+}
+
+VkShaderModule BenchmarkDevice::CreateShaderModule(const std::vector<uint32_t> &spirv) {
+    VkShaderModuleCreateInfo create_info = {};
+    create_info.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+    create_info.codeSize = spirv.size() * sizeof(uint32_t);
+    create_info.pCode = spirv.data();
+    VkShaderModule module;
+    CheckResult(vk::CreateShaderModule(device, &create_info, nullptr, &module), "vkCreateShaderModule");
+    shader_modules_.push_back(module);
+    return module;
+}
+
+VkDescriptorSetLayout BenchmarkDevice::CreateDescriptorSetLayout(const std::vector<VkDescriptorSetLayoutBinding> &bindings) {
+    VkDescriptorSetLayoutCreateInfo create_info = {};
+    create_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+    create_info.bindingCount = static_cast<uint32_t>(bindings.size());
+    create_info.pBindings = bindings.data();
+    VkDescriptorSetLayout layout;
+    CheckResult(vk::CreateDescriptorSetLayout(device, &create_info, nullptr, &layout), "vkCreateDescriptorSetLayout");
+    set_layouts_.push_back(layout);
+    return layout;
+}
+
+VkPipelineLayout BenchmarkDevice::CreatePipelineLayout(const std::vector<VkDescriptorSetLayout> &set_layouts,
+                                                       const std::vector<VkPushConstantRange> &push_constant_ranges) {
+    VkPipelineLayoutCreateInfo create_info = {};
+    create_info.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+    create_info.setLayoutCount = static_cast<uint32_t>(set_layouts.size());
+    create_info.pSetLayouts = set_layouts.data();
+    create_info.pushConstantRangeCount = static_cast<uint32_t>(push_constant_ranges.size());
+    create_info.pPushConstantRanges = push_constant_ranges.data();
+    VkPipelineLayout layout;
+    CheckResult(vk::CreatePipelineLayout(device, &create_info, nullptr, &layout), "vkCreatePipelineLayout");
+    pipeline_layouts_.push_back(layout);
+    return layout;
+}
+
+VkDescriptorPool BenchmarkDevice::CreateDescriptorPool(uint32_t max_sets, const std::vector<VkDescriptorPoolSize> &pool_sizes,
+                                                       VkDescriptorPoolCreateFlags flags) {
+    VkDescriptorPoolCreateInfo create_info = {};
+    create_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+    create_info.flags = flags;
+    create_info.maxSets = max_sets;
+    create_info.poolSizeCount = static_cast<uint32_t>(pool_sizes.size());
+    create_info.pPoolSizes = pool_sizes.data();
+    VkDescriptorPool pool;
+    CheckResult(vk::CreateDescriptorPool(device, &create_info, nullptr, &pool), "vkCreateDescriptorPool");
+    descriptor_pools_.push_back(pool);
+    return pool;
+}
+
+VkRenderPass BenchmarkDevice::CreateRenderPass(VkFormat color_format) {
+    VkAttachmentDescription attachment = {};
+    attachment.format = color_format;
+    attachment.samples = VK_SAMPLE_COUNT_1_BIT;
+    attachment.loadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+    attachment.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+    attachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+    attachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+    attachment.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    attachment.finalLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+
+    VkAttachmentReference color_ref = {0, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL};
+    VkSubpassDescription subpass = {};
+    subpass.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+    subpass.colorAttachmentCount = 1;
+    subpass.pColorAttachments = &color_ref;
+
+    VkRenderPassCreateInfo create_info = {};
+    create_info.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
+    create_info.attachmentCount = 1;
+    create_info.pAttachments = &attachment;
+    create_info.subpassCount = 1;
+    create_info.pSubpasses = &subpass;
+    VkRenderPass render_pass;
+    CheckResult(vk::CreateRenderPass(device, &create_info, nullptr, &render_pass), "vkCreateRenderPass");
+    render_passes_.push_back(render_pass);
+    return render_pass;
+}
+
+VkFramebuffer BenchmarkDevice::CreateFramebuffer(VkRenderPass render_pass, VkImageView attachment, uint32_t width,
+                                                 uint32_t height) {
+    VkFramebufferCreateInfo create_info = {};
+    create_info.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
+    create_info.renderPass = render_pass;
+    create_info.attachmentCount = 1;
+    create_info.pAttachments = &attachment;
+    create_info.width = width;
+    create_info.height = height;
+    create_info.layers = 1;
+    VkFramebuffer framebuffer;
+    CheckResult(vk::CreateFramebuffer(device, &create_info, nullptr, &framebuffer), "vkCreateFramebuffer");
+    framebuffers_.push_back(framebuffer);
+    return framebuffer;
+}
+
+VkCommandPool BenchmarkDevice::CreateCommandPool() {
+    VkCommandPoolCreateInfo create_info = {};
+    create_info.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+    create_info.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+    create_info.queueFamilyIndex = queue_family_index;
+    VkCommandPool pool;
+    CheckResult(vk::CreateCommandPool(device, &create_info, nullptr, &pool), "vkCreateCommandPool");
+    command_pools_.push_back(pool);
+    return pool;
+}
+
+VkCommandBuffer BenchmarkDevice::AllocateCommandBuffer(VkCommandPool pool) {
+    VkCommandBufferAllocateInfo alloc_info = {};
+    alloc_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    alloc_info.commandPool = pool;
+    alloc_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    alloc_info.commandBufferCount = 1;
+    VkCommandBuffer command_buffer;
+    CheckResult(vk::AllocateCommandBuffers(device, &alloc_info, &command_buffer), "vkAllocateCommandBuffers");
+    return command_buffer;
+}
+
+VkFence BenchmarkDevice::CreateFence() {
+    VkFenceCreateInfo create_info = {};
+    create_info.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+    VkFence fence;
+    CheckResult(vk::CreateFence(device, &create_info, nullptr, &fence), "vkCreateFence");
+    fences_.push_back(fence);
+    return fence;
+}
+
+VkGraphicsPipelineCreateInfo BenchmarkDevice::GraphicsPipelineInfo(VkShaderModule vertex, VkShaderModule fragment,
+                                                                   VkPipelineLayout layout, VkRenderPass render_pass,
+                                                                   uint32_t width, uint32_t height) {
+    for (auto &stage : stages_) {
+        stage = {};
+        stage.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+        stage.pName = "main";
+    }
+    stages_[0].stage = VK_SHADER_STAGE_VERTEX_BIT;
+    stages_[0].module = vertex;
+    stages_[1].stage = VK_SHADER_STAGE_FRAGMENT_BIT;
+    stages_[1].module = fragment;
+
+    // A binding without attributes still makes draws validate the bound vertex buffers
+    vertex_binding_ = {0, 16, VK_VERTEX_INPUT_RATE_VERTEX};
+    vertex_input_ = {};
+    vertex_input_.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
+    vertex_input_.vertexBindingDescriptionCount = 1;
+    vertex_input_.pVertexBindingDescriptions = &vertex_binding_;
+
+    input_assembly_ = {};
+    input_assembly_.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
+    input_assembly_.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+
+    viewport_ = {0.0f, 0.0f, static_cast<float>(width), static_cast<float>(height), 0.0f, 1.0f};
+    scissor_ = {{0, 0}, {width, height}};
+    viewport_state_ = {};
+    viewport_state_.sType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
+    viewport_state_.viewportCount = 1;
+    viewport_state_.pViewports = &viewport_;
+    viewport_state_.scissorCount = 1;
+    viewport_state_.pScissors = &scissor_;
+
+    rasterization_ = {};
+    rasterization_.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
+    rasterization_.polygonMode = VK_POLYGON_MODE_FILL;
+    rasterization_.cullMode = VK_CULL_MODE_NONE;
+    rasterization_.frontFace = VK_FRONT_FACE_COUNTER_CLOCKWISE;
+    rasterization_.lineWidth = 1.0f;
+
+    multisample_ = {};
+    multisample_.sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
+    multisample_.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
+
+    blend_attachment_ = {};
+    blend_attachment_.colorWriteMask =
+        VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
+    color_blend_ = {};
+    color_blend_.sType = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
+    color_blend_.attachmentCount = 1;
+    color_blend_.pAttachments = &blend_attachment_;
+
+    VkGraphicsPipelineCreateInfo create_info = {};
+    create_info.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+    create_info.stageCount = 2;
+    create_info.pStages = stages_;
+    create_info.pVertexInputState = &vertex_input_;
+    create_info.pInputAssemblyState = &input_assembly_;
+    create_info.pViewportState = &viewport_state_;
+    create_info.pRasterizationState = &rasterization_;
+    create_info.pMultisampleState = &multisample_;
+    create_info.pColorBlendState = &color_blend_;
+    create_info.layout = layout;
+    create_info.renderPass = render_pass;
+    create_info.subpass = 0;
+    create_info.basePipelineIndex = -1;
+    return create_info;
+}
+
+VkPipeline BenchmarkDevice::CreateGraphicsPipeline(const VkGraphicsPipelineCreateInfo &create_info) {
+    VkPipeline pipeline;
+    CheckResult(vk::CreateGraphicsPipelines(device, VK_NULL_HANDLE, 1, &create_info, nullptr, &pipeline),
+                "vkCreateGraphicsPipelines");
+    pipelines_.push_back(pipeline);
+    return pipeline;
+}
+
+void BenchmarkDevice::TransitionImages(const std::vector<VkImage> &images, VkImageAspectFlags aspect, VkImageLayout layout) {
+    VkCommandBufferBeginInfo begin_info = {};
+    begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    begin_info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    vk::BeginCommandBuffer(setup_command_buffer_, &begin_info);
+
+    std::vector<VkImageMemoryBarrier> barriers(images.size());
+    for (size_t i = 0; i < images.size(); ++i) {
+        VkImageMemoryBarrier &barrier = barriers[i];
+        barrier = {};
+        barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        barrier.dstAccessMask = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
+        barrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        barrier.newLayout = layout;
+        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.image = images[i];
+        barrier.subresourceRange = {aspect, 0, VK_REMAINING_MIP_LEVELS, 0, VK_REMAINING_ARRAY_LAYERS};
+    }
+    vk::CmdPipelineBarrier(setup_command_buffer_, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, 0,
+                           nullptr, 0, nullptr, static_cast<uint32_t>(barriers.size()), barriers.data());
+
+    vk::EndCommandBuffer(setup_command_buffer_);
+    SubmitAndWait(setup_command_buffer_);
+}
+
+void BenchmarkDevice::SubmitAndWait(VkCommandBuffer command_buffer) {
+    VkSubmitInfo submit_info = {};
+    submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submit_info.commandBufferCount = 1;
+    submit_info.pCommandBuffers = &command_buffer;
+    CheckResult(vk::QueueSubmit(queue, 1, &submit_info, setup_fence_), "vkQueueSubmit");
+    CheckResult(vk::WaitForFences(device, 1, &setup_fence_, VK_TRUE, UINT64_MAX), "vkWaitForFences");
+    vk::ResetFences(device, 1, &setup_fence_);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+struct ScenarioResult {
+    const BenchmarkScenario *scenario;
+    bool ran;
+    uint64_t wall_ns;
+    uint64_t validation_messages;
+    BenchmarkTimings timings;
+};
+
+// Cost of an empty ScopedTimer, included in every reported per-call time
+static double MeasureTimerOverhead() {
+    EntryPointStats stats;
+    for (uint32_t i = 0; i < 1000000; ++i) {
+        ScopedTimer timer(&stats);
+    }
+    return static_cast<double>(stats.total_ns) / static_cast<double>(stats.calls);
+}
+
+static std::string JsonEscape(const std::string &text) {
+    std::string escaped;
+    for (char c : text) {
+        if (c == '"' || c == '\\') {
+            escaped += '\\';
+            escaped += c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            char code[8];
+            snprintf(code, sizeof(code), "\\u%04x", static_cast<unsigned>(c));
+            escaped += code;
+        } else {
+            escaped += c;
+        }
+    }
+    return escaped;
+}
+
+static const std::map<std::string, VkValidationFeatureEnableEXT> kEnableNames = {
+    {"gpu_assisted", VK_VALIDATION_FEATURE_ENABLE_GPU_ASSISTED_EXT},
+    {"gpu_assisted_reserve_binding_slot", VK_VALIDATION_FEATURE_ENABLE_GPU_ASSISTED_RESERVE_BINDING_SLOT_EXT},
+    {"best_practices", VK_VALIDATION_FEATURE_ENABLE_BEST_PRACTICES_EXT},
+};
+
+static const std::map<std::string, VkValidationFeatureDisableEXT> kDisableNames = {
+    {"all", VK_VALIDATION_FEATURE_DISABLE_ALL_EXT},
+    {"shaders", VK_VALIDATION_FEATURE_DISABLE_SHADERS_EXT},
+    {"thread_safety", VK_VALIDATION_FEATURE_DISABLE_THREAD_SAFETY_EXT},
+    {"api_parameters", VK_VALIDATION_FEATURE_DISABLE_API_PARAMETERS_EXT},
+    {"object_lifetimes", VK_VALIDATION_FEATURE_DISABLE_OBJECT_LIFETIMES_EXT},
+    {"core_checks", VK_VALIDATION_FEATURE_DISABLE_CORE_CHECKS_EXT},
+    {"unique_handles", VK_VALIDATION_FEATURE_DISABLE_UNIQUE_HANDLES_EXT},
+};
+
+static void WriteJson(FILE *out, const BenchmarkOptions &options, const std::vector<std::string> &enable_names,
+                      const std::vector<std::string> &disable_names, const VkPhysicalDeviceProperties &properties,
+                      double timer_overhead_ns, const std::vector<ScenarioResult> &results) {
+    fprintf(out, "{\n");
+    fprintf(out, "  \"benchmark\": \"vk_layer_benchmarks\",\n");
+    fprintf(out, "  \"device_name\": \"%s\",\n", JsonEscape(properties.deviceName).c_str());
+    fprintf(out, "  \"layer_enabled\": %s,\n", options.use_layer ? "true" : "false");
+    fprintf(out, "  \"iterations\": %u,\n", options.iterations);
+    fprintf(out, "  \"threads\": %u,\n", options.threads);
+    fprintf(out, "  \"enabled_features\": [");
+    for (size_t i = 0; i < enable_names.size(); ++i) fprintf(out, "%s\"%s\"", i ? ", " : "", enable_names[i].c_str());
+    fprintf(out, "],\n");
+    fprintf(out, "  \"disabled_features\": [");
+    for (size_t i = 0; i < disable_names.size(); ++i) fprintf(out, "%s\"%s\"", i ? ", " : "", disable_names[i].c_str());
+    fprintf(out, "],\n");
+    fprintf(out, "  \"timer_overhead_ns\": %.2f,\n", timer_overhead_ns);
+    fprintf(out, "  \"scenarios\": [");
+    bool first_scenario = true;
+    for (const auto &result : results) {
+        if (!result.ran) continue;
+        fprintf(out, "%s\n    {\n", first_scenario ? "" : ",");
+        first_scenario = false;
+        fprintf(out, "      \"name\": \"%s\",\n", result.scenario->name);
+        fprintf(out, "      \"wall_ns\": %llu,\n", static_cast<unsigned long long>(result.wall_ns));
+        fprintf(out, "      \"validation_messages\": %llu,\n", static_cast<unsigned long long>(result.validation_messages));
+        fprintf(out, "      \"entry_points\": {");
+        bool first_entry = true;
+        for (const auto &entry : result.timings.EntryPoints()) {
+            const EntryPointStats &stats = entry.second;
+            if (!stats.calls) continue;
+            fprintf(out, "%s\n        \"%s\": {", first_entry ? "" : ",", JsonEscape(entry.first).c_str());
+            first_entry = false;
+            fprintf(out, "\"calls\": %llu, \"total_ns\": %llu, \"ns_per_call\": %.2f, \"min_ns\": %llu, \"max_ns\": %llu}",
+                    static_cast<unsigned long long>(stats.calls), static_cast<unsigned long long>(stats.total_ns),
+                    static_cast<double>(stats.total_ns) / static_cast<double>(stats.calls),
+                    static_cast<unsigned long long>(stats.min_ns), static_cast<unsigned long long>(stats.max_ns));
+        }
+        fprintf(out, "\n      }\n    }");
+    }
+    fprintf(out, "\n  ]\n}\n");
+}
+
+static void PrintTable(FILE *out, const std::vector<ScenarioResult> &results) {
+    fprintf(out, "%-32s %-36s %10s %12s %10s %10s\n", "Scenario", "Entry point", "Calls", "ns/call", "min ns", "max ns");
+    for (const auto &result : results) {
+        if (!result.ran) {
+            fprintf(out, "%-32s (skipped)\n", result.scenario->name);
+            continue;
+        }
+        for (const auto &entry : result.timings.EntryPoints()) {
+            const EntryPointStats &stats = entry.second;
+            if (!stats.calls) continue;
+            fprintf(out, "%-32s %-36s %10llu %12.1f %10llu %10llu\n", result.scenario->name, entry.first.c_str(),
+                    static_cast<unsigned long long>(stats.calls),
+                    static_cast<double>(stats.total_ns) / static_cast<double>(stats.calls),
+                    static_cast<unsigned long long>(stats.min_ns), static_cast<unsigned long long>(stats.max_ns));
+        }
+        if (result.validation_messages) {
+            fprintf(out, "%-32s %llu validation messages were reported\n", result.scenario->name,
+                    static_cast<unsigned long long>(result.validation_messages));
+        }
+    }
+}
+
+static void PrintUsage() {
+    printf("Usage: vk_layer_benchmarks [options]\n");
+    printf("  --list                    List the available scenarios\n");
+    printf("  --scenario=<name>         Run only this scenario; may be given more than once\n");
+    printf("  --iterations=<n>          Multiply every scenario's loop counts by n (default 1)\n");
+    printf("  --threads=<n>             Recording threads for multithreaded scenarios (default 4)\n");
+    printf("  --enable=<feature>        Enable a validation feature: best_practices, gpu_assisted,\n");
+    printf("                            gpu_assisted_reserve_binding_slot\n");
+    printf("  --disable=<feature>       Disable a validation object: core_checks, thread_safety, api_parameters,\n");
+    printf("                            object_lifetimes, unique_handles, shaders, all\n");
+    printf("  --no-layer                Run without the validation layer to measure the loader and ICD baseline\n");
+    printf("  --output=<file>           Write results as JSON to file, or - for stdout\n");
+}
+
+static bool ParseArgument(const char *arg, const char *name, std::string *value) {
+    const size_t length = strlen(name);
+    if (strncmp(arg, name, length) != 0 || arg[length] != '=') return false;
+    *value = arg + length + 1;
+    return true;
+}
+
+int main(int argc, char **argv) {
+    BenchmarkOptions options;
+    std::vector<std::string> selected;
+    std::vector<std::string> enable_names;
+    std::vector<std::string> disable_names;
+    std::string output;
+    const auto &scenarios = GetBenchmarkScenarios();
+
+    for (int i = 1; i < argc; ++i) {
+        std::string value;
+        if (strcmp(argv[i], "--list") == 0) {
+            for (const auto &scenario : scenarios) printf("%-32s %s\n", scenario.name, scenario.description);
+            return 0;
+        } else if (strcmp(argv[i], "--no-layer") == 0) {
+            options.use_layer = false;
+        } else if (ParseArgument(argv[i], "--scenario", &value)) {
+            selected.push_back(value);
+        } else if (ParseArgument(argv[i], "--iterations", &value)) {
+            options.iterations = std::max(1, atoi(value.c_str()));
+        } else if (ParseArgument(argv[i], "--threads", &value)) {
+            options.threads = std::max(1, atoi(value.c_str()));
+        } else if (ParseArgument(argv[i], "--output", &value)) {
+            output = value;
+        } else if (ParseArgument(argv[i], "--enable", &value) && kEnableNames.count(value)) {
+            options.enables.push_back(kEnableNames.at(value));
+            enable_names.push_back(value);
+        } else if (ParseArgument(argv[i], "--disable", &value) && kDisableNames.count(value)) {
+            options.disables.push_back(kDisableNames.at(value));
+            disable_names.push_back(value);
+        } else {
+            PrintUsage();
+            return strcmp(argv[i], "--help") == 0 ? 0 : 1;
+        }
+    }
+
+    vk::InitDispatchTable();
+
+    const double timer_overhead_ns = MeasureTimerOverhead();
+    VkPhysicalDeviceProperties properties = {};
+    std::vector<ScenarioResult> results;
+    for (const auto &scenario : scenarios) {
+        if (!selected.empty() && std::find(selected.begin(), selected.end(), scenario.name) == selected.end()) continue;
+
+        ScenarioResult result = {&scenario, false, 0, 0, BenchmarkTimings()};
+        {
+            BenchmarkDevice device;
+            if (!device.Init(options)) return 1;
+            properties = device.properties;
+
+            const auto start = std::chrono::steady_clock::now();
+            result.ran = scenario.run(&device, options, &result.timings);
+            const auto elapsed = std::chrono::steady_clock::now() - start;
+            result.wall_ns = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+            // Leaks and other teardown errors are only reported while destroying the device
+            device.Destroy();
+            result.validation_messages = device.MessageCount();
+        }
+        results.push_back(std::move(result));
+    }
+
+    if (options.use_layer && !strstr(properties.deviceName, "Mock")) {
+        fprintf(stderr, "Warning: not running on the mock ICD, so timings include driver work\n");
+    }
+    // Keep stdout clean for the JSON when it is written there
+    FILE *table_out = (output == "-") ? stderr : stdout;
+    PrintTable(table_out, results);
+    fprintf(table_out, "Timer overhead included in each call: %.1f ns\n", timer_overhead_ns);
+
+    if (!output.empty()) {
+        FILE *out = (output == "-") ? stdout : fopen(output.c_str(), "w");
+        if (!out) {
+            fprintf(stderr, "Unable to open %s for writing\n", output.c_str());
+            return 1;
+        }
+        WriteJson(out, options, enable_names, disable_names, properties, timer_overhead_ns, results);
+        if (out != stdout) fclose(out);
+    }
+    return 0;
+}
@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2020 The Khronos Group Inc.
+ * Copyright (c) 2020 Valve Corporation
+ * Copyright (c) 2020 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef VK_LAYER_BENCHMARKS_H
+#define VK_LAYER_BENCHMARKS_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <vulkan/vulkan.h>
+
+#include "lvt_function_pointers.h"
+
+// Accumulated wall-clock cost of one entry point within a scenario
+struct EntryPointStats {
+    uint64_t calls = 0;
+    uint64_t total_ns = 0;
+    uint64_t min_ns = UINT64_MAX;
+    uint64_t max_ns = 0;
+
+    void Add(uint64_t ns) {
+        ++calls;
+        total_ns += ns;
+        if (ns < min_ns) min_ns = ns;
+        if (ns > max_ns) max_ns = ns;
+    }
+    // For calls too cheap to time individually: min and max then describe the per-call average of each batch
+    void AddBatch(uint64_t batch_calls, uint64_t ns) {
+        if (!batch_calls) return;
+        const uint64_t per_call = ns / batch_calls;
+        calls += batch_calls;
+        total_ns += ns;
+        if (per_call < min_ns) min_ns = per_call;
+        if (per_call > max_ns) max_ns = per_call;
+    }
+    void Merge(const EntryPointStats &other);
+};
+
+class BenchmarkTimings {
+  public:
+    // Look the stats up once outside a timed loop; the returned reference stays valid as more entry points are added
+    EntryPointStats &Get(const std::string &entry_point) { return entry_points_[entry_point]; }
+    void Merge(const BenchmarkTimings &other);
+    const std::map<std::string, EntryPointStats> &EntryPoints() const { return entry_points_; }
+
+  private:
+    std::map<std::string, EntryPointStats> entry_points_;
+};
+
+// Times the enclosing scope and charges it to a single entry point
+class ScopedTimer {
+  public:
+    explicit ScopedTimer(EntryPointStats *stats) : stats_(stats), start_(std::chrono::steady_clock::now()) {}
+    ~ScopedTimer() {
+        const auto elapsed = std::chrono::steady_clock::now() - start_;
+        stats_->Add(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+    }
+
+  private:
+    EntryPointStats *stats_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+struct BenchmarkOptions {
+    bool use_layer = true;
+    std::vector<VkValidationFeatureEnableEXT> enables;
+    std::vector<VkValidationFeatureDisableEXT> disables;
+    uint32_t iterations = 1;  // Multiplies the per-scenario loop counts
+    uint32_t threads = 4;
+};
+
+// An instance and device running the validation layer over whichever ICD the loader finds (normally the mock ICD), plus
+// helpers that create the objects scenarios need and destroy them again in reverse order.
+class BenchmarkDevice {
+  public:
+    BenchmarkDevice() = default;
+    ~BenchmarkDevice() { Destroy(); }
+    BenchmarkDevice(const BenchmarkDevice &) = delete;
+    BenchmarkDevice &operator=(const BenchmarkDevice &) = delete;
+
+    bool Init(const BenchmarkOptions &options);
+    // Destroys every object, the device and the instance; messages reported during teardown are included in MessageCount
+    void Destroy();
+
+    uint64_t MessageCount() const { return message_count_.load(); }
+
+    // While set, threading collision reports ask for the call to be skipped, which makes ThreadSafety wait for the object to
+    // become idle instead. These reports are counted per thread rather than in MessageCount.
+    std::atomic<bool> wait_on_thread_collisions{false};
+    // Threading collisions reported on the calling thread so far
+    static uint64_t ThreadCollisionCount();
+
+    VkBuffer CreateBuffer(VkDeviceSize size, VkBufferUsageFlags usage);
+    VkImage CreateImage(VkFormat format, VkExtent3D extent, uint32_t mip_levels, uint32_t array_layers, VkImageUsageFlags usage);
+    VkImageView CreateImageView(VkImage image, VkFormat format, VkImageViewType view_type, const VkImageSubresourceRange &range);
+    VkSampler CreateSampler();
+    VkShaderModule CreateShaderModule(const std::vector<uint32_t> &spirv);
+    VkDescriptorSetLayout CreateDescriptorSetLayout(const std::vector<VkDescriptorSetLayoutBinding> &bindings);
+    VkPipelineLayout CreatePipelineLayout(const std::vector<VkDescriptorSetLayout> &set_layouts,
+                                          const std::vector<VkPushConstantRange> &push_constant_ranges);
+    VkDescriptorPool CreateDescriptorPool(uint32_t max_sets, const std::vector<VkDescriptorPoolSize> &pool_sizes,
+                                          VkDescriptorPoolCreateFlags flags);
+    VkRenderPass CreateRenderPass(VkFormat color_format);
+    VkFramebuffer CreateFramebuffer(VkRenderPass render_pass, VkImageView attachment, uint32_t width, uint32_t height);
+    VkCommandPool CreateCommandPool();
+    VkCommandBuffer AllocateCommandBuffer(VkCommandPool pool);
+    VkFence CreateFence();
+
+    // Fills in a graphics pipeline create info for a full-viewport triangle list; the referenced state lives in this object
+    // until the next call.
+    VkGraphicsPipelineCreateInfo GraphicsPipelineInfo(VkShaderModule vertex, VkShaderModule fragment, VkPipelineLayout layout,
+                                                      VkRenderPass render_pass, uint32_t width, uint32_t height);
+    VkPipeline CreateGraphicsPipeline(const VkGraphicsPipelineCreateInfo &create_info);
+
+    // Records a transition of every subresource of the images from UNDEFINED and waits for it to complete
+    void TransitionImages(const std::vector<VkImage> &images, VkImageAspectFlags aspect, VkImageLayout layout);
+    void SubmitAndWait(VkCommandBuffer command_buffer);
+
+    VkInstance instance = VK_NULL_HANDLE;
+    VkPhysicalDevice gpu = VK_NULL_HANDLE;
+    VkDevice device = VK_NULL_HANDLE;
+    VkQueue queue = VK_NULL_HANDLE;
+    uint32_t queue_family_index = 0;
+    VkPhysicalDeviceProperties properties = {};
+    VkPhysicalDeviceMemoryProperties memory_properties = {};
+
+  private:
+    struct MemoryBlock {
+        VkDeviceMemory memory;
+        uint32_t memory_type_index;
+        VkDeviceSize size;
+        VkDeviceSize used;
+    };
+
+    static VKAPI_ATTR VkBool32 VKAPI_CALL MessengerCallback(VkDebugUtilsMessageSeverityFlagBitsEXT message_severity,
+                                                            VkDebugUtilsMessageTypeFlagsEXT message_type,
+                                                            const VkDebugUtilsMessengerCallbackDataEXT *callback_data,
+                                                            void *user_data);
+
+    // Sub-allocates from large blocks so scenarios with thousands of resources stay under maxMemoryAllocationCount
+    void BindMemory(const VkMemoryRequirements &requirements, VkDeviceMemory *memory, VkDeviceSize *offset);
+
+    VkDebugUtilsMessengerEXT messenger_ = VK_NULL_HANDLE;
+    std::atomic<uint64_t> message_count_{0};
+    VkCommandPool setup_pool_ = VK_NULL_HANDLE;
+    VkCommandBuffer setup_command_buffer_ = VK_NULL_HANDLE;
+    VkFence setup_fence_ = VK_NULL_HANDLE;
+
+    std::vector<MemoryBlock> memory_blocks_;
+    std::vector<VkBuffer> buffers_;
+    std::vector<VkImage> images_;
+    std::vector<VkImageView> image_views_;
+    std::vector<VkSampler> samplers_;
+    std::vector<VkShaderModule> shader_modules_;
+    std::vector<VkDescriptorSetLayout> set_layouts_;
+    std::vector<VkPipelineLayout> pipeline_layouts_;
+    std::vector<VkDescriptorPool> descriptor_pools_;
+    std::vector<VkRenderPass> render_passes_;
+    std::vector<VkFramebuffer> framebuffers_;
+    std::vector<VkPipeline> pipelines_;
+    std::vector<VkCommandPool> command_pools_;
+    std::vector<VkFence> fences_;
+
+    // Backing state for GraphicsPipelineInfo
+    VkPipelineShaderStageCreateInfo stages_[2] = {};
+    VkVertexInputBindingDescription vertex_binding_ = {};
+    VkPipelineVertexInputStateCreateInfo vertex_input_ = {};
+    VkPipelineInputAssemblyStateCreateInfo input_assembly_ = {};
+    VkViewport viewport_ = {};
+    VkRect2D scissor_ = {};
+    VkPipelineViewportStateCreateInfo viewport_state_ = {};
+    VkPipelineRasterizationStateCreateInfo rasterization_ = {};
+    VkPipelineMultisampleStateCreateInfo multisample_ = {};
+    VkPipelineColorBlendAttachmentState blend_attachment_ = {};
+    VkPipelineColorBlendStateCreateInfo color_blend_ = {};
+};
+
+// Exits if the assembly does not parse, since every scenario's shaders are fixed
+std::vector<uint32_t> AssembleShader(const std::string &spirv_asm);
+
+struct BenchmarkScenario {
+    const char *name;
+    const char *description;
+    // Returns false if the scenario could not be set up on this device
+    bool (*run)(BenchmarkDevice *device, const BenchmarkOptions &options, BenchmarkTimings *timings);
+};
+
+// Defined in vk_layer_benchmark_scenarios.cpp
+const std::vector<BenchmarkScenario> &GetBenchmarkScenarios();
+
+#endif  // VK_LAYER_BENCHMARKS_H
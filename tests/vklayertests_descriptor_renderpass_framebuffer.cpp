@@ -506,6 +506,177 @@ TEST_F(VkLayerTest, GpuValidationArrayOOBGraphicsShaders) {
     return;
 }
 
+TEST_F(VkLayerTest, GpuValidationLargeUpdateAfterBindBinding) {
+    TEST_DESCRIPTION(
+        "GPU validation: Check at submit time which descriptors of a large update after bind binding were written after the "
+        "draw was recorded.");
+
+    VkValidationFeatureEnableEXT enables[] = {VK_VALIDATION_FEATURE_ENABLE_GPU_ASSISTED_EXT};
+    VkValidationFeaturesEXT features = {};
+    features.sType = VK_STRUCTURE_TYPE_VALIDATION_FEATURES_EXT;
+    features.enabledValidationFeatureCount = 1;
+    features.pEnabledValidationFeatures = enables;
+    bool descriptor_indexing = CheckDescriptorIndexingSupportAndInitFramework(this, m_instance_extension_names,
+                                                                              m_device_extension_names, &features, m_errorMonitor);
+    if (DeviceIsMockICD() || DeviceSimulation()) {
+        printf("%s GPU-Assisted validation test requires a driver that can draw.\n", kSkipPrefix);
+        return;
+    }
+    if (!descriptor_indexing) {
+        printf("%s Descriptor indexing extension not supported, skipping test.\n", kSkipPrefix);
+        return;
+    }
+
+    PFN_vkGetPhysicalDeviceFeatures2KHR vkGetPhysicalDeviceFeatures2KHR =
+        (PFN_vkGetPhysicalDeviceFeatures2KHR)vk::GetInstanceProcAddr(instance(), "vkGetPhysicalDeviceFeatures2KHR");
+    ASSERT_TRUE(vkGetPhysicalDeviceFeatures2KHR != nullptr);
+    auto indexing_features = lvl_init_struct<VkPhysicalDeviceDescriptorIndexingFeaturesEXT>();
+    auto features2 = lvl_init_struct<VkPhysicalDeviceFeatures2KHR>(&indexing_features);
+    vkGetPhysicalDeviceFeatures2KHR(gpu(), &features2);
+    if (!indexing_features.runtimeDescriptorArray || !indexing_features.descriptorBindingStorageBufferUpdateAfterBind ||
+        !indexing_features.descriptorBindingPartiallyBound || !indexing_features.shaderStorageBufferArrayNonUniformIndexing) {
+        printf("%s Not all descriptor indexing features supported, skipping test.\n", kSkipPrefix);
+        return;
+    }
+
+    // At least the layer's threshold for creating descriptors on first write
+    const uint32_t descriptor_count = 2048;
+    PFN_vkGetPhysicalDeviceProperties2KHR vkGetPhysicalDeviceProperties2KHR =
+        (PFN_vkGetPhysicalDeviceProperties2KHR)vk::GetInstanceProcAddr(instance(), "vkGetPhysicalDeviceProperties2KHR");
+    ASSERT_TRUE(vkGetPhysicalDeviceProperties2KHR != nullptr);
+    auto indexing_properties = lvl_init_struct<VkPhysicalDeviceDescriptorIndexingPropertiesEXT>();
+    auto properties2 = lvl_init_struct<VkPhysicalDeviceProperties2KHR>(&indexing_properties);
+    vkGetPhysicalDeviceProperties2KHR(gpu(), &properties2);
+    if ((indexing_properties.maxPerStageDescriptorUpdateAfterBindStorageBuffers < descriptor_count) ||
+        (indexing_properties.maxDescriptorSetUpdateAfterBindStorageBuffers < descriptor_count) ||
+        (indexing_properties.maxPerStageUpdateAfterBindResources <= descriptor_count)) {
+        printf("%s Device does not support %" PRIu32 " update after bind storage buffers, skipping test.\n", kSkipPrefix,
+               descriptor_count);
+        return;
+    }
+
+    ASSERT_NO_FATAL_FAILURE(InitState(nullptr, &features2, VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT));
+    if (m_device->props.apiVersion < VK_API_VERSION_1_1) {
+        printf("%s GPU-Assisted validation test requires Vulkan 1.1+.\n", kSkipPrefix);
+        return;
+    }
+    ASSERT_NO_FATAL_FAILURE(InitViewport());
+    ASSERT_NO_FATAL_FAILURE(InitRenderTarget());
+
+    // A uniform buffer holding the index the fragment shader reads, and a buffer for the storage buffer array
+    uint32_t qfi = 0;
+    VkBufferCreateInfo bci = {};
+    bci.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    bci.usage = VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT;
+    bci.size = 1024;
+    bci.queueFamilyIndexCount = 1;
+    bci.pQueueFamilyIndices = &qfi;
+    VkBufferObj index_buffer;
+    VkMemoryPropertyFlags mem_props = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+    index_buffer.init(*m_device, bci, mem_props);
+    bci.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+    VkBufferObj storage_buffer;
+    storage_buffer.init(*m_device, bci, mem_props);
+
+    VkDescriptorBindingFlagsEXT ds_binding_flags[2] = {
+        0, VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT_EXT | VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT_EXT};
+    auto layout_createinfo_binding_flags = lvl_init_struct<VkDescriptorSetLayoutBindingFlagsCreateInfoEXT>();
+    layout_createinfo_binding_flags.bindingCount = 2;
+    layout_createinfo_binding_flags.pBindingFlags = ds_binding_flags;
+    OneOffDescriptorSet descriptor_set(m_device,
+                                       {
+                                           {0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_VERTEX_BIT, nullptr},
+                                           {1, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, descriptor_count, VK_SHADER_STAGE_FRAGMENT_BIT,
+                                            nullptr},
+                                       },
+                                       VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT_EXT,
+                                       &layout_createinfo_binding_flags, VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT_EXT);
+    const VkPipelineLayoutObj pipeline_layout(m_device, {&descriptor_set.layout_});
+
+    // Leave the storage buffer array unwritten when the draw is recorded
+    VkDescriptorBufferInfo buffer_info = {index_buffer.handle(), 0, sizeof(uint32_t)};
+    VkWriteDescriptorSet descriptor_write = {};
+    descriptor_write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+    descriptor_write.dstSet = descriptor_set.set_;
+    descriptor_write.dstBinding = 0;
+    descriptor_write.descriptorCount = 1;
+    descriptor_write.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+    descriptor_write.pBufferInfo = &buffer_info;
+    vk::UpdateDescriptorSets(m_device->device(), 1, &descriptor_write, 0, NULL);
+
+    char const *vsSource =
+        "#version 450\n"
+        "\n"
+        "layout(std140, binding = 0) uniform foo { uint tex_index[1]; } uniform_index_buffer;\n"
+        "layout(location = 0) out flat uint index;\n"
+        "vec2 vertices[3];\n"
+        "void main(){\n"
+        "      vertices[0] = vec2(-1.0, -1.0);\n"
+        "      vertices[1] = vec2( 1.0, -1.0);\n"
+        "      vertices[2] = vec2( 0.0,  1.0);\n"
+        "   gl_Position = vec4(vertices[gl_VertexIndex % 3], 0.0, 1.0);\n"
+        "   index = uniform_index_buffer.tex_index[0];\n"
+        "}\n";
+    char const *fsSource =
+        "#version 450\n"
+        "#extension GL_EXT_nonuniform_qualifier : enable\n "
+        "\n"
+        "layout(set = 0, binding = 1) buffer foo { vec4 val; } colors[];\n"
+        "layout(location = 0) out vec4 uFragColor;\n"
+        "layout(location = 0) in flat uint index;\n"
+        "void main(){\n"
+        "   uFragColor = colors[index].val;\n"
+        "}\n";
+    VkShaderObj vs(m_device, vsSource, VK_SHADER_STAGE_VERTEX_BIT, this);
+    VkShaderObj fs(m_device, fsSource, VK_SHADER_STAGE_FRAGMENT_BIT, this);
+    VkPipelineObj pipe(m_device);
+    pipe.AddShader(&vs);
+    pipe.AddShader(&fs);
+    pipe.AddDefaultColorAttachment();
+    ASSERT_VK_SUCCESS(pipe.CreateVKPipeline(pipeline_layout.handle(), renderPass()));
+
+    m_commandBuffer->begin();
+    m_commandBuffer->BeginRenderPass(m_renderPassBeginInfo);
+    vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.handle());
+    vk::CmdBindDescriptorSets(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline_layout.handle(), 0, 1,
+                              &descriptor_set.set_, 0, nullptr);
+    vk::CmdSetViewport(m_commandBuffer->handle(), 0, 1, &m_viewports[0]);
+    vk::CmdSetScissor(m_commandBuffer->handle(), 0, 1, &m_scissors[0]);
+    vk::CmdDraw(m_commandBuffer->handle(), 3, 1, 0, 0);
+    vk::CmdEndRenderPass(m_commandBuffer->handle());
+    m_commandBuffer->end();
+
+    // Write one descriptor of the array after the draw was recorded, as update after bind allows
+    buffer_info = {storage_buffer.handle(), 0, 4 * sizeof(float)};
+    descriptor_write.dstBinding = 1;
+    descriptor_write.dstArrayElement = 1000;
+    descriptor_write.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    vk::UpdateDescriptorSets(m_device->device(), 1, &descriptor_write, 0, NULL);
+
+    VkSubmitInfo submit_info = {};
+    submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submit_info.commandBufferCount = 1;
+    submit_info.pCommandBuffers = &m_commandBuffer->handle();
+
+    // The descriptor written after binding is initialized by the time of the submit
+    uint32_t *data = (uint32_t *)index_buffer.memory().map();
+    data[0] = 1000;
+    index_buffer.memory().unmap();
+    m_errorMonitor->ExpectSuccess();
+    vk::QueueSubmit(m_device->m_queue, 1, &submit_info, VK_NULL_HANDLE);
+    vk::QueueWaitIdle(m_device->m_queue);
+    m_errorMonitor->VerifyNotFound();
+
+    // Its neighbor was never written
+    data = (uint32_t *)index_buffer.memory().map();
+    data[0] = 1001;
+    index_buffer.memory().unmap();
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "Descriptor index 1001 is uninitialized");
+    vk::QueueSubmit(m_device->m_queue, 1, &submit_info, VK_NULL_HANDLE);
+    vk::QueueWaitIdle(m_device->m_queue);
+    m_errorMonitor->VerifyFound();
+}
+
 TEST_F(VkLayerTest, GpuBufferDeviceAddressOOB) {
     bool supported = InstanceExtensionSupported(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME);
     m_instance_extension_names.push_back(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME);
@@ -6669,6 +6840,125 @@ TEST_F(VkLayerTest, CopyDescriptorUpdateErrors) {
     vk::DestroySampler(m_device->device(), immutable_sampler, NULL);
 }
 
+TEST_F(VkLayerTest, LargeDescriptorBindingUpdatesAndDrawState) {
+    TEST_DESCRIPTION(
+        "Write to, copy into and draw with a binding large enough that the layer only creates its descriptors when they are first "
+        "written.");
+
+    ASSERT_NO_FATAL_FAILURE(Init(nullptr, nullptr, VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT));
+    ASSERT_NO_FATAL_FAILURE(InitViewport());
+    ASSERT_NO_FATAL_FAILURE(InitRenderTarget());
+
+    // At least the layer's threshold for creating descriptors on first write
+    const uint32_t descriptor_count = 2048;
+    const VkPhysicalDeviceLimits &limits = m_device->props.limits;
+    if ((limits.maxPerStageDescriptorStorageBuffers < descriptor_count) ||
+        (limits.maxDescriptorSetStorageBuffers < descriptor_count) || (limits.maxPerStageResources <= descriptor_count)) {
+        printf("%s Device does not support %" PRIu32 " storage buffers in a shader stage, skipping test.\n", kSkipPrefix,
+               descriptor_count);
+        return;
+    }
+
+    const std::vector<VkDescriptorSetLayoutBinding> bindings = {
+        {0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, descriptor_count, VK_SHADER_STAGE_FRAGMENT_BIT, nullptr},
+    };
+    OneOffDescriptorSet unwritten_set(m_device, bindings);
+    OneOffDescriptorSet written_set(m_device, bindings);
+    OneOffDescriptorSet copied_set(m_device, bindings);
+
+    uint32_t qfi = 0;
+    VkBufferCreateInfo bci = {};
+    bci.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    bci.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+    bci.size = 256;
+    bci.queueFamilyIndexCount = 1;
+    bci.pQueueFamilyIndices = &qfi;
+    VkBufferObj storage_buffer;
+    storage_buffer.init(*m_device, bci);
+    bci.usage = VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT;
+    VkBufferObj uniform_buffer;
+    uniform_buffer.init(*m_device, bci);
+
+    // Writes into a range that was never written are validated like any other write
+    VkDescriptorBufferInfo uniform_info = {uniform_buffer.handle(), 0, VK_WHOLE_SIZE};
+    VkWriteDescriptorSet descriptor_write = {};
+    descriptor_write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+    descriptor_write.dstSet = written_set.set_;
+    descriptor_write.dstBinding = 0;
+    descriptor_write.dstArrayElement = 1500;
+    descriptor_write.descriptorCount = 1;
+    descriptor_write.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    descriptor_write.pBufferInfo = &uniform_info;
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "VUID-VkWriteDescriptorSet-descriptorType-00331");
+    vk::UpdateDescriptorSets(m_device->device(), 1, &descriptor_write, 0, NULL);
+    m_errorMonitor->VerifyFound();
+
+    m_errorMonitor->ExpectSuccess();
+    const std::vector<VkDescriptorBufferInfo> storage_infos(descriptor_count, {storage_buffer.handle(), 0, VK_WHOLE_SIZE});
+    descriptor_write.dstArrayElement = 0;
+    descriptor_write.descriptorCount = descriptor_count;
+    descriptor_write.pBufferInfo = storage_infos.data();
+    vk::UpdateDescriptorSets(m_device->device(), 1, &descriptor_write, 0, NULL);
+
+    // Copy the written binding, then copy part of the never written binding over it
+    VkCopyDescriptorSet copy_ds_update = {};
+    copy_ds_update.sType = VK_STRUCTURE_TYPE_COPY_DESCRIPTOR_SET;
+    copy_ds_update.srcSet = written_set.set_;
+    copy_ds_update.srcBinding = 0;
+    copy_ds_update.dstSet = copied_set.set_;
+    copy_ds_update.dstBinding = 0;
+    copy_ds_update.descriptorCount = descriptor_count;
+    vk::UpdateDescriptorSets(m_device->device(), 0, NULL, 1, &copy_ds_update);
+    copy_ds_update.srcSet = unwritten_set.set_;
+    copy_ds_update.srcArrayElement = 1000;
+    copy_ds_update.dstArrayElement = 1000;
+    copy_ds_update.descriptorCount = 64;
+    vk::UpdateDescriptorSets(m_device->device(), 0, NULL, 1, &copy_ds_update);
+    m_errorMonitor->VerifyNotFound();
+
+    char const *fsSource =
+        "#version 450\n"
+        "\n"
+        "layout(location=0) out vec4 x;\n"
+        "layout(set=0) layout(binding=0) buffer foo { vec4 y; } bar[2048];\n"
+        "void main(){\n"
+        "   x = bar[0].y;\n"
+        "}\n";
+    VkShaderObj fs(m_device, fsSource, VK_SHADER_STAGE_FRAGMENT_BIT, this);
+
+    CreatePipelineHelper pipe(*this);
+    pipe.InitInfo();
+    pipe.shader_stages_ = {pipe.vs_->GetStageCreateInfo(), fs.GetStageCreateInfo()};
+    pipe.InitState();
+    pipe.pipeline_layout_ = VkPipelineLayoutObj(m_device, {&written_set.layout_});
+    pipe.CreateGraphicsPipeline();
+
+    auto draw_with_set = [&](const OneOffDescriptorSet &descriptor_set) {
+        m_commandBuffer->begin();
+        m_commandBuffer->BeginRenderPass(m_renderPassBeginInfo);
+        vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.pipeline_);
+        vk::CmdBindDescriptorSets(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.pipeline_layout_.handle(), 0, 1,
+                                  &descriptor_set.set_, 0, nullptr);
+        m_commandBuffer->Draw(1, 0, 0, 0);
+        m_commandBuffer->EndRenderPass();
+        m_commandBuffer->end();
+    };
+
+    m_errorMonitor->ExpectSuccess();
+    draw_with_set(written_set);
+    m_errorMonitor->VerifyNotFound();
+
+    // Every descriptor of a statically used binding is validated at draw time, including those never written
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "index 0 is being used in draw but has never been updated");
+    draw_with_set(unwritten_set);
+    m_errorMonitor->VerifyFound();
+
+    // Copying unwritten descriptors over written ones leaves them unwritten
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "index 1000 is being used in draw but has never been updated");
+    draw_with_set(copied_set);
+    m_errorMonitor->VerifyFound();
+}
+
 TEST_F(VkLayerTest, DrawWithPipelineIncompatibleWithRenderPass) {
     TEST_DESCRIPTION(
         "Hit RenderPass incompatible cases. Initial case is drawing with an active renderpass that's not compatible with the bound "
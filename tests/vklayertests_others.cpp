@@ -25,8 +25,13 @@
  */
 
 #include "cast_utils.h"
+#include "entry_point_costs.h"
 #include "layer_validation_tests.h"
 
+#include <chrono>
+#include <condition_variable>
+#include <thread>
+
 TEST_F(VkLayerTest, RequiredParameter) {
     TEST_DESCRIPTION("Specify VK_NULL_HANDLE, NULL, and 0 for required handle, pointer, array, and array count parameters");
 
@@ -3028,6 +3033,90 @@ TEST_F(VkLayerTest, ThreadUpdateDescriptorUpdateAfterBindNoCollision) {
 
     m_errorMonitor->VerifyNotFound();
 }
+
+// Returning VK_TRUE for a collision asks ThreadSafety to skip the call, which it does by waiting for the object to become idle
+static VKAPI_ATTR VkBool32 VKAPI_CALL WaitOnThreadCollision(VkDebugUtilsMessageSeverityFlagBitsEXT message_severity,
+                                                          VkDebugUtilsMessageTypeFlagsEXT message_types,
+                                                          const VkDebugUtilsMessengerCallbackDataEXT *callback_data,
+                                                          void *user_data) {
+    if (callback_data->pMessageIdName && strcmp(callback_data->pMessageIdName, "UNASSIGNED-Threading-MultipleThreads") == 0) {
+        return VK_TRUE;
+    }
+    return VK_FALSE;
+}
+
+TEST_F(VkLayerTest, ThreadCollisionWaitDoesNotDeadlock) {
+    TEST_DESCRIPTION("Threads writing the same fence wait out each collision, and must never end up waiting on each other");
+
+    if (InstanceExtensionSupported(VK_EXT_DEBUG_UTILS_EXTENSION_NAME)) {
+        m_instance_extension_names.push_back(VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
+    } else {
+        printf("%s Debug Utils Extension not supported, skipping test\n", kSkipPrefix);
+        return;
+    }
+    ASSERT_NO_FATAL_FAILURE(InitFramework(m_errorMonitor));
+    ASSERT_NO_FATAL_FAILURE(InitState());
+
+    auto create_messenger = reinterpret_cast<PFN_vkCreateDebugUtilsMessengerEXT>(
+        vk::GetInstanceProcAddr(instance(), "vkCreateDebugUtilsMessengerEXT"));
+    auto destroy_messenger = reinterpret_cast<PFN_vkDestroyDebugUtilsMessengerEXT>(
+        vk::GetInstanceProcAddr(instance(), "vkDestroyDebugUtilsMessengerEXT"));
+    ASSERT_TRUE(create_messenger && destroy_messenger);
+
+    auto messenger_info = lvl_init_struct<VkDebugUtilsMessengerCreateInfoEXT>();
+    messenger_info.messageSeverity = VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT;
+    messenger_info.messageType = VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT;
+    messenger_info.pfnUserCallback = WaitOnThreadCollision;
+    VkDebugUtilsMessengerEXT messenger = VK_NULL_HANDLE;
+    ASSERT_VK_SUCCESS(create_messenger(instance(), &messenger_info, nullptr, &messenger));
+
+    VkFenceObj fence;
+    fence.init(*m_device, VkFenceObj::create_info());
+    const VkFence fence_handle = fence.handle();
+    const VkDevice device_handle = device();
+
+    // The collisions are the point of the test, so the first is expected and any further ones are allowed
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "UNASSIGNED-Threading-MultipleThreads");
+    m_errorMonitor->SetAllowedFailureMsg("UNASSIGNED-Threading-MultipleThreads");
+
+    // Each pair of colliding writers both wait, which with the caller's own use counted against it never finished. The
+    // watchdog turns such a hang into a failure instead of a stuck test run.
+    const uint32_t kThreads = 4;
+    const uint32_t kResets = 20000;
+    std::mutex done_mutex;
+    std::condition_variable done_cv;
+    uint32_t done_count = 0;
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0; i < kThreads; ++i) {
+        threads.emplace_back([&]() {
+            for (uint32_t reset = 0; reset < kResets; ++reset) {
+                vk::ResetFences(device_handle, 1, &fence_handle);
+            }
+            std::lock_guard<std::mutex> lock(done_mutex);
+            ++done_count;
+            done_cv.notify_one();
+        });
+    }
+    {
+        std::unique_lock<std::mutex> lock(done_mutex);
+        if (!done_cv.wait_for(lock, std::chrono::seconds(60), [&]() { return done_count == kThreads; })) {
+            // The workers are stuck inside the layer and can't be joined, so there is no way to continue the run
+            fprintf(stderr, "ThreadCollisionWaitDoesNotDeadlock: threads still waiting on the fence after 60 seconds\n");
+            std::abort();
+        }
+    }
+    for (auto &thread : threads) thread.join();
+
+    destroy_messenger(instance(), messenger, nullptr);
+    // The threads may happen not to overlap at all, which leaves nothing to check but isn't a failure
+    if (m_errorMonitor->AllDesiredMsgsFound()) {
+        m_errorMonitor->VerifyFound();
+    } else {
+        printf("%s No thread collisions occurred\n", kSkipPrefix);
+        m_errorMonitor->VerifyNotFound();
+    }
+}
+
 #endif  // GTEST_IS_THREADSAFE
 
 TEST_F(VkLayerTest, ExecuteUnrecordedPrimaryCB) {
@@ -7316,3 +7405,103 @@ TEST_F(VkLayerTest, InvalidExternalSemaphore) {
     vk::DestroySemaphore(device(), import_semaphore, nullptr);
 #endif
 }
+
+TEST_F(VkLayerTest, EntryPointCosts) {
+    TEST_DESCRIPTION("Check the vkResetFences call counts and the truncation of the layer's vkGetEntryPointCostsLAYER query.");
+
+    // VkValidationFeaturesEXT has no value for layer-specific checks, so enable the counters the way a user would
+#if defined(_WIN32)
+    SetEnvironmentVariable("VK_LAYER_ENABLES", "VALIDATION_CHECK_ENABLE_ENTRY_POINT_COSTS;");
+#else
+    setenv("VK_LAYER_ENABLES", "VALIDATION_CHECK_ENABLE_ENTRY_POINT_COSTS:", true);
+#endif
+    InitFramework(m_errorMonitor);
+#if defined(_WIN32)
+    SetEnvironmentVariable("VK_LAYER_ENABLES", nullptr);
+#else
+    unsetenv("VK_LAYER_ENABLES");
+#endif
+    ASSERT_NO_FATAL_FAILURE(InitState());
+
+    auto get_costs =
+        reinterpret_cast<PFN_vkGetEntryPointCostsLAYER>(vk::GetDeviceProcAddr(m_device->device(), "vkGetEntryPointCostsLAYER"));
+    if (!get_costs) {
+        printf("%s vkGetEntryPointCostsLAYER not found, skipping test\n", kSkipPrefix);
+        return;
+    }
+
+    m_errorMonitor->ExpectSuccess();
+    VkFenceObj fence;
+    fence.init(*m_device, VkFenceObj::create_info());
+    const uint32_t kResets = 100;
+    for (uint32_t i = 0; i < kResets; ++i) {
+        VkFence handle = fence.handle();
+        vk::ResetFences(m_device->device(), 1, &handle);
+    }
+    m_errorMonitor->VerifyNotFound();
+
+    uint32_t count = 0;
+    ASSERT_VK_SUCCESS(get_costs(m_device->device(), &count, nullptr));
+    ASSERT_GT(count, 1u);
+    std::vector<LayerEntryPointCost> costs(count);
+
+    uint32_t truncated = count - 1;
+    ASSERT_EQ(VK_INCOMPLETE, get_costs(m_device->device(), &truncated, costs.data()));
+    ASSERT_EQ(count - 1, truncated);
+
+    ASSERT_VK_SUCCESS(get_costs(m_device->device(), &count, costs.data()));
+    ASSERT_EQ(costs.size(), count);
+
+    uint32_t reset_rows = 0;
+    uint64_t reset_nanoseconds = 0;
+    for (const auto &cost : costs) {
+        if (strcmp(cost.entry_point, "vkResetFences") != 0) continue;
+        ++reset_rows;
+        ASSERT_EQ(kResets, cost.call_count) << cost.validation_object;
+        for (uint32_t phase = 0; phase < kEntryPointPhaseCount; ++phase) reset_nanoseconds += cost.nanoseconds[phase];
+    }
+    // One row per validation object the device dispatches to
+    ASSERT_GT(reset_rows, 0u);
+    ASSERT_GT(reset_nanoseconds, 0u);
+}
+
+TEST_F(VkLayerTest, UnifiedHandleRegistry) {
+    TEST_DESCRIPTION("Track handles for thread safety and object lifetimes in the shared per-device handle registry.");
+
+#if defined(_WIN32)
+    SetEnvironmentVariable("VK_LAYER_ENABLES", "VALIDATION_CHECK_ENABLE_UNIFIED_HANDLE_REGISTRY;");
+#else
+    setenv("VK_LAYER_ENABLES", "VALIDATION_CHECK_ENABLE_UNIFIED_HANDLE_REGISTRY:", true);
+#endif
+    InitFramework(m_errorMonitor);
+#if defined(_WIN32)
+    SetEnvironmentVariable("VK_LAYER_ENABLES", nullptr);
+#else
+    unsetenv("VK_LAYER_ENABLES");
+#endif
+    ASSERT_NO_FATAL_FAILURE(InitState());
+
+    // Both validation objects find the handles they created, including handles of different types
+    m_errorMonitor->ExpectSuccess();
+    VkFenceObj fence;
+    fence.init(*m_device, VkFenceObj::create_info());
+    VkBufferObj buffer;
+    buffer.init(*m_device, 256, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+    VkMemoryRequirements requirements;
+    for (uint32_t i = 0; i < 10; ++i) {
+        VkFence handle = fence.handle();
+        vk::ResetFences(m_device->device(), 1, &handle);
+        vk::GetBufferMemoryRequirements(m_device->device(), buffer.handle(), &requirements);
+    }
+    m_errorMonitor->VerifyNotFound();
+
+    // Destroying a handle removes it for both of them
+    const VkFenceCreateInfo fence_info = VkFenceObj::create_info();
+    VkFence destroyed_fence;
+    ASSERT_VK_SUCCESS(vk::CreateFence(m_device->device(), &fence_info, nullptr, &destroyed_fence));
+    vk::ResetFences(m_device->device(), 1, &destroyed_fence);
+    vk::DestroyFence(m_device->device(), destroyed_fence, nullptr);
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "VUID-vkResetFences-pFences-parameter");
+    vk::ResetFences(m_device->device(), 1, &destroyed_fence);
+    m_errorMonitor->VerifyFound();
+}
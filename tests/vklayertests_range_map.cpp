@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2019-2020 The Khronos Group Inc.
+ * Copyright (c) 2019-2020 Valve Corporation
+ * Copyright (c) 2019-2020 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Unit tests for the range map containers behind the image layout maps. These exercise the containers directly and
+// don't need a Vulkan device.
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "range_vector.h"
+
+namespace {
+using Range = sparse_container::range<uint64_t>;
+using BigMap = sparse_container::range_map<uint64_t, int>;
+using SmallMap = sparse_container::small_range_map<uint64_t, int, Range, 16>;
+using Entry = std::pair<Range, int>;
+
+template <typename Map>
+std::vector<Entry> Contents(const Map &map) {
+    std::vector<Entry> contents;
+    for (const auto &entry : map) {
+        contents.emplace_back(entry.first, entry.second);
+    }
+    return contents;
+}
+
+// Entries matching the new value before a gap moved the cached lower bound past range.begin, and the overwrite then
+// inserted the whole range on top of them.
+template <typename Map>
+void UpdateAfterMatchingPrefix(Map map) {
+    map.insert(std::make_pair(Range(0, 2), 1));
+    EXPECT_TRUE(
+        sparse_container::update_range_value(map, Range(0, 4), 1, sparse_container::value_precedence::prefer_source));
+    const std::vector<Entry> expected = {Entry(Range(0, 4), 1)};
+    EXPECT_EQ(Contents(map), expected);
+}
+}  // namespace
+
+TEST(RangeMap, UpdateRangeValueAfterMatchingPrefix) {
+    UpdateAfterMatchingPrefix(BigMap());
+    UpdateAfterMatchingPrefix(SmallMap(8));
+}
+
+// Erasing from the start of an entry must merge the cleared span with the empty space to its left.
+TEST(RangeMap, SmallMapEraseMergesLeftEmptySpace) {
+    SmallMap map(8);
+    map.insert(std::make_pair(Range(2, 4), 1));
+    map.insert(std::make_pair(Range(4, 6), 2));
+    map.erase_range(Range(2, 5));
+    std::vector<Entry> expected = {Entry(Range(5, 6), 2)};
+    EXPECT_EQ(Contents(map), expected);
+
+    auto lower = map.lower_bound(Range(0, 1));
+    ASSERT_TRUE(lower != map.end());
+    EXPECT_EQ(lower->first, Range(5, 6));
+
+    map.insert(std::make_pair(Range(0, 5), 3));
+    expected = {Entry(Range(0, 5), 3), Entry(Range(5, 6), 2)};
+    EXPECT_EQ(Contents(map), expected);
+}
+
+// Limits above N use heap storage, which moves must hand over and copies must duplicate.
+TEST(RangeMap, SmallMapCopyAndMove) {
+    for (size_t limit : {8, 40}) {
+        SmallMap map(limit);
+        map.insert(std::make_pair(Range(0, 4), 1));
+        map.insert(std::make_pair(Range(6, limit), 2));
+        const std::vector<Entry> expected = {Entry(Range(0, 4), 1), Entry(Range(6, limit), 2)};
+
+        SmallMap copied(map);
+        EXPECT_EQ(Contents(copied), expected);
+
+        SmallMap moved(std::move(map));
+        EXPECT_EQ(Contents(moved), expected);
+        EXPECT_TRUE(map.empty());
+
+        SmallMap assigned(limit);
+        assigned = std::move(moved);
+        EXPECT_EQ(Contents(assigned), expected);
+        EXPECT_TRUE(moved.empty());
+
+        copied.overwrite_range(std::make_pair(Range(0, limit), 3));
+        EXPECT_EQ(Contents(assigned), expected);
+    }
+}
@@ -26,6 +26,10 @@
 
 #include "cast_utils.h"
 #include "layer_validation_tests.h"
+
+#include <cstdlib>
+#include <new>
+
 //
 // POSITIVE VALIDATION TESTS
 //
@@ -3174,6 +3178,106 @@ TEST_F(VkPositiveLayerTest, DynamicOffsetWithInactiveBinding) {
     m_commandBuffer->end();
 }
 
+// Counts heap allocations made on the test thread while enabled. The layer library resolves operator new through the test
+// executable, so this also sees the layer's own allocations on platforms that interpose global symbols.
+static thread_local bool count_heap_allocations = false;
+static uint64_t heap_allocation_count = 0;
+
+void *operator new(std::size_t size) {
+    if (count_heap_allocations) ++heap_allocation_count;
+    if (void *ptr = std::malloc(size ? size : 1)) return ptr;
+    throw std::bad_alloc();
+}
+
+void operator delete(void *ptr) noexcept { std::free(ptr); }
+
+TEST_F(VkPositiveLayerTest, RebindDescriptorSetsAndDrawWithoutAllocating) {
+    TEST_DESCRIPTION("Rebinding a descriptor set with dynamic offsets and drawing should not allocate once it was bound once.");
+    m_errorMonitor->ExpectSuccess();
+
+    ASSERT_NO_FATAL_FAILURE(Init());
+    ASSERT_NO_FATAL_FAILURE(InitViewport());
+    ASSERT_NO_FATAL_FAILURE(InitRenderTarget());
+
+    OneOffDescriptorSet descriptor_set(m_device,
+                                       {
+                                           {0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, 1, VK_SHADER_STAGE_FRAGMENT_BIT, nullptr},
+                                       });
+
+    uint32_t qfi = 0;
+    VkBufferCreateInfo buffCI = {};
+    buffCI.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    buffCI.size = 1024;
+    buffCI.usage = VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT;
+    buffCI.queueFamilyIndexCount = 1;
+    buffCI.pQueueFamilyIndices = &qfi;
+    VkBufferObj dynamic_uniform_buffer;
+    dynamic_uniform_buffer.init(*m_device, buffCI);
+
+    VkDescriptorBufferInfo buff_info = {dynamic_uniform_buffer.handle(), 0, 256};
+    VkWriteDescriptorSet descriptor_write = {};
+    descriptor_write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+    descriptor_write.dstSet = descriptor_set.set_;
+    descriptor_write.dstBinding = 0;
+    descriptor_write.descriptorCount = 1;
+    descriptor_write.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+    descriptor_write.pBufferInfo = &buff_info;
+    vk::UpdateDescriptorSets(m_device->device(), 1, &descriptor_write, 0, NULL);
+
+    char const *fsSource =
+        "#version 450\n"
+        "\n"
+        "layout(location=0) out vec4 x;\n"
+        "layout(set=0) layout(binding=0) uniform foo { int x; int y; } bar;\n"
+        "void main(){\n"
+        "   x = vec4(bar.y);\n"
+        "}\n";
+    VkShaderObj vs(m_device, bindStateVertShaderText, VK_SHADER_STAGE_VERTEX_BIT, this);
+    VkShaderObj fs(m_device, fsSource, VK_SHADER_STAGE_FRAGMENT_BIT, this);
+
+    CreatePipelineHelper pipe(*this);
+    pipe.InitInfo();
+    pipe.InitState();
+    pipe.shader_stages_ = {vs.GetStageCreateInfo(), fs.GetStageCreateInfo()};
+    pipe.pipeline_layout_ = VkPipelineLayoutObj(m_device, {&descriptor_set.layout_});
+    pipe.CreateGraphicsPipeline();
+
+    m_commandBuffer->begin();
+    m_commandBuffer->BeginRenderPass(m_renderPassBeginInfo);
+    vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.pipeline_);
+
+    // The first bind and draw create the command buffer's per-set tracking state
+    const uint32_t dyn_offs[2] = {0, 256};
+    count_heap_allocations = true;
+    vk::CmdBindDescriptorSets(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.pipeline_layout_.handle(), 0, 1,
+                              &descriptor_set.set_, 1, &dyn_offs[0]);
+    m_commandBuffer->Draw(1, 0, 0, 0);
+    count_heap_allocations = false;
+    const bool allocations_visible = heap_allocation_count > 0;
+
+    // Later binds and draws must reuse that state. Driver-side command storage may still grow now and then, so only
+    // require that the calls do not allocate every time.
+    const uint32_t iterations = 64;
+    heap_allocation_count = 0;
+    count_heap_allocations = true;
+    for (uint32_t i = 0; i < iterations; ++i) {
+        vk::CmdBindDescriptorSets(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.pipeline_layout_.handle(), 0,
+                                  1, &descriptor_set.set_, 1, &dyn_offs[i % 2]);
+        m_commandBuffer->Draw(1, 0, 0, 0);
+    }
+    count_heap_allocations = false;
+
+    m_commandBuffer->EndRenderPass();
+    m_commandBuffer->end();
+    m_errorMonitor->VerifyNotFound();
+
+    if (!allocations_visible) {
+        printf("%s Layer allocations are not visible to the test's operator new on this platform.\n", kSkipPrefix);
+        return;
+    }
+    ASSERT_LT(heap_allocation_count, iterations);
+}
+
 TEST_F(VkPositiveLayerTest, NonCoherentMemoryMapping) {
     TEST_DESCRIPTION(
         "Ensure that validations handling of non-coherent memory mapping while using VK_WHOLE_SIZE does not cause access "
@@ -9304,3 +9408,49 @@ TEST_F(VkPositiveLayerTest, SubresourceLayout) {
     m_commandBuffer->QueueCommandBuffer();
     m_errorMonitor->VerifyNotFound();
 }
+
+TEST_F(VkPositiveLayerTest, ViewportSwizzleAndWScalingNVChain) {
+    TEST_DESCRIPTION("Chain viewport swizzle and w-scaling state, whose sTypes are not in value order, to the viewport state.");
+
+    ASSERT_NO_FATAL_FAILURE(InitFramework(m_errorMonitor));
+    for (auto device_extension : {VK_NV_VIEWPORT_SWIZZLE_EXTENSION_NAME, VK_NV_CLIP_SPACE_W_SCALING_EXTENSION_NAME}) {
+        if (DeviceExtensionSupported(gpu(), nullptr, device_extension)) {
+            m_device_extension_names.push_back(device_extension);
+        } else {
+            printf("%s %s Extension not supported, skipping tests\n", kSkipPrefix, device_extension);
+            return;
+        }
+    }
+    ASSERT_NO_FATAL_FAILURE(InitState());
+    ASSERT_NO_FATAL_FAILURE(InitRenderTarget());
+
+    const VkViewportWScalingNV scaling = {1.0f, 1.0f};
+    VkPipelineViewportWScalingStateCreateInfoNV w_scaling_state = {
+        VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_W_SCALING_STATE_CREATE_INFO_NV};
+    w_scaling_state.viewportWScalingEnable = VK_TRUE;
+    w_scaling_state.viewportCount = 1;
+    w_scaling_state.pViewportWScalings = &scaling;
+
+    const VkViewportSwizzleNV swizzle = {
+        VK_VIEWPORT_COORDINATE_SWIZZLE_POSITIVE_X_NV, VK_VIEWPORT_COORDINATE_SWIZZLE_POSITIVE_Y_NV,
+        VK_VIEWPORT_COORDINATE_SWIZZLE_POSITIVE_Z_NV, VK_VIEWPORT_COORDINATE_SWIZZLE_POSITIVE_W_NV};
+    VkPipelineViewportSwizzleStateCreateInfoNV swizzle_state = {
+        VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_SWIZZLE_STATE_CREATE_INFO_NV};
+    swizzle_state.viewportCount = 1;
+    swizzle_state.pViewportSwizzles = &swizzle;
+
+    // Both orders of the chain are valid
+    const auto swizzle_first = [&](CreatePipelineHelper &helper) {
+        swizzle_state.pNext = &w_scaling_state;
+        w_scaling_state.pNext = nullptr;
+        helper.vp_state_ci_.pNext = &swizzle_state;
+    };
+    CreatePipelineHelper::OneshotTest(*this, swizzle_first, kErrorBit, "", true);
+
+    const auto w_scaling_first = [&](CreatePipelineHelper &helper) {
+        w_scaling_state.pNext = &swizzle_state;
+        swizzle_state.pNext = nullptr;
+        helper.vp_state_ci_.pNext = &w_scaling_state;
+    };
+    CreatePipelineHelper::OneshotTest(*this, w_scaling_first, kErrorBit, "", true);
+}